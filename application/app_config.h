@@ -0,0 +1,221 @@
+//! @addtogroup AppConfig
+//! @{
+//
+//****************************************************************************
+//! @file app_config.h
+//! @brief Build time configuration of the application. Every module sizes
+//!        its static storage from here, and the per-module RAM budgets below
+//!        are checked against the STM32F411 memory at compile time.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef APP_CONFIG_H
+#define APP_CONFIG_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//
+//! @brief Compile time check, usable at file scope in C99
+//
+#define APP_STATIC_ASSERT(cond, name) \
+    typedef char app_static_assert_##name[(cond) ? 1 : -1]
+
+//----------------------------------------------------------------------------
+// Target memory, must match the linker configuration (stm32f411xe_flash.icf)
+//----------------------------------------------------------------------------
+#define APP_FLASH_SIZE                (512u * 1024u)
+#define APP_RAM_SIZE                  (128u * 1024u)
+//RAM below __region_RAM_start__
+#define APP_RAM_RESERVED              0x198u
+#define APP_STACK_SIZE                0x4000u
+#define APP_HEAP_SIZE                 0x8000u
+
+//----------------------------------------------------------------------------
+// Features, 1 to enable
+//----------------------------------------------------------------------------
+#ifndef APP_FEATURE_I2C_SLAVE
+#define APP_FEATURE_I2C_SLAVE         1
+#endif
+
+#ifndef APP_FEATURE_ADAPTIVE_SCHED
+#define APP_FEATURE_ADAPTIVE_SCHED    1
+#endif
+
+#ifndef APP_FEATURE_TRACE
+#define APP_FEATURE_TRACE             0
+#endif
+
+//I2C1 master under the Sensirion driver: 1 the LL interrupt engine in
+//sensirion_ll_i2c.c, 0 the polled HAL calls. Host builds model the HAL only.
+#ifndef APP_I2C_BACKEND_LL
+#ifdef HOST_BUILD
+#define APP_I2C_BACKEND_LL            0
+#else
+#define APP_I2C_BACKEND_LL            1
+#endif
+#endif
+
+//HAL timebase: 1 the free running 1 MHz TIM5 in timebase.c, 0 SysTick at
+//1 kHz. Host builds keep the host HAL tick.
+#ifndef APP_TIMEBASE_TIM5
+#ifdef HOST_BUILD
+#define APP_TIMEBASE_TIM5             0
+#else
+#define APP_TIMEBASE_TIM5             1
+#endif
+#endif
+
+//With the TIM5 timebase, 1 drops the periodic 1 ms interrupt; HAL_GetTick()
+//is computed from the counter and delays arm a one shot wakeup instead
+#ifndef APP_TIMEBASE_TICKLESS
+#define APP_TIMEBASE_TICKLESS         0
+#endif
+
+//Stop the flash interface clock while the core sleeps in WFI. Only safe
+//while no DMA stream reads from flash.
+#ifndef APP_IDLE_FLASH_GATE
+#define APP_IDLE_FLASH_GATE           1
+#endif
+
+//Peripheral completion interrupts: 1 the vectors decode the flags and call
+//the handlers routed in irq_dispatch.h, 0 through the HAL IRQ handlers and
+//HAL_xxx_Callback functions
+#ifndef APP_IRQ_DIRECT
+#define APP_IRQ_DIRECT                1
+#endif
+
+//Acquisition clock of SgpPoll(): 1 the RTC wakeup timer, each sample
+//stamped by its interrupt, 0 a deadline on the HAL tick
+#ifndef APP_SAMPLE_CLOCK_RTC
+#define APP_SAMPLE_CLOCK_RTC          1
+#endif
+
+//CRC32 of aligned words: 1 the CRC unit, 0 the slice-by-8 tables in crc32.c.
+//Host builds have no CRC unit.
+#ifndef APP_CRC_HW
+#ifdef HOST_BUILD
+#define APP_CRC_HW                    0
+#else
+#define APP_CRC_HW                    1
+#endif
+#endif
+
+//----------------------------------------------------------------------------
+// Buffer depths
+//----------------------------------------------------------------------------
+//UART message buffer in sgp_app
+#define APP_PRINT_BUF_LEN             256
+//Historical samples kept for the I2C host, per sensor, power of two
+#define APP_I2C_SLAVE_FIFO_DEPTH      64
+//I2C response trace recording buffer
+#define APP_TRACE_BUF_LEN             4096
+//USART2 DMA receive ring, power of two. Must hold what arrives between two
+//consumer polls: 1024 bytes is 11 ms at 921600 baud.
+#define APP_UART_RX_RING_LEN          1024
+//Time stamped events kept in RAM, power of two
+#define APP_EVENT_LOG_DEPTH           64
+
+//----------------------------------------------------------------------------
+// RTC
+//----------------------------------------------------------------------------
+//ck_spre = RTCCLK / ((PREDIV_A + 1) * (PREDIV_S + 1)): 1 Hz from the 32 kHz
+//LSI, with PREDIV_S + 1 subsecond steps
+#define APP_RTC_PREDIV_A              127u
+#define APP_RTC_PREDIV_S              249u
+//Calendar date set when the backup domain comes up blank
+#define APP_RTC_EPOCH_YEAR            2021u
+#define APP_RTC_EPOCH_MONTH           1u
+#define APP_RTC_EPOCH_DAY             1u
+
+//----------------------------------------------------------------------------
+// Persistent key-value store
+//----------------------------------------------------------------------------
+//Log of the 16 KB flash sectors APP_KV_SECTOR_FIRST.., kept out of the code
+//region by stm32f411xe_flash.icf (__region_KV_start__/__region_KV_end__)
+#define APP_KV_SECTOR_FIRST           2
+#define APP_KV_SECTOR_COUNT           2
+#define APP_KV_SECTOR_SIZE            (16u * 1024u)
+#define APP_KV_BASE                   (0x08000000u + APP_KV_SECTOR_FIRST * APP_KV_SECTOR_SIZE)
+//Key ids are 0 to APP_KV_MAX_KEYS - 1, one RAM index slot each
+#define APP_KV_MAX_KEYS               32
+//Largest value in bytes, multiple of 4
+#define APP_KV_VALUE_MAX              64
+
+//----------------------------------------------------------------------------
+// Console
+//----------------------------------------------------------------------------
+#define APP_UART_BAUDRATE             115200
+
+//----------------------------------------------------------------------------
+// Static RAM budget per module in bytes. Each module checks its own
+// statics against its budget; the sum is checked against the chip below.
+//----------------------------------------------------------------------------
+#define APP_RAM_BUDGET_SGP_APP        (APP_PRINT_BUF_LEN + 16u)
+#define APP_RAM_BUDGET_I2C_SLAVE      (APP_I2C_SLAVE_FIFO_DEPTH * 8u + 3u * 32u + 128u)
+#define APP_RAM_BUDGET_UART           (APP_UART_RX_RING_LEN + 384u)
+#define APP_RAM_BUDGET_SCHED          96u
+#define APP_RAM_BUDGET_PROF           160u
+#define APP_RAM_BUDGET_SENSIRION      128u
+#define APP_RAM_BUDGET_TIMEBASE       128u
+#define APP_RAM_BUDGET_KV             (APP_KV_MAX_KEYS * 4u + 96u)
+#define APP_RAM_BUDGET_CRC            ((APP_CRC_HW ? 1u : 8u) * 1024u + 64u)
+#define APP_RAM_BUDGET_IDLE           48u
+#define APP_RAM_BUDGET_RTC            64u
+#define APP_RAM_BUDGET_EVENT_LOG      (APP_EVENT_LOG_DEPTH * 12u + 4u)
+#if APP_FEATURE_TRACE
+#define APP_RAM_BUDGET_TRACE          (APP_TRACE_BUF_LEN + 32u)
+#else
+#define APP_RAM_BUDGET_TRACE          0u
+#endif
+
+#define APP_RAM_BUDGET_TOTAL          (APP_RAM_BUDGET_SGP_APP   + \
+                                       APP_RAM_BUDGET_I2C_SLAVE + \
+                                       APP_RAM_BUDGET_UART      + \
+                                       APP_RAM_BUDGET_SCHED     + \
+                                       APP_RAM_BUDGET_PROF      + \
+                                       APP_RAM_BUDGET_SENSIRION + \
+                                       APP_RAM_BUDGET_TIMEBASE  + \
+                                       APP_RAM_BUDGET_KV        + \
+                                       APP_RAM_BUDGET_CRC       + \
+                                       APP_RAM_BUDGET_IDLE      + \
+                                       APP_RAM_BUDGET_RTC       + \
+                                       APP_RAM_BUDGET_EVENT_LOG + \
+                                       APP_RAM_BUDGET_TRACE)
+
+#define APP_RAM_AVAILABLE             (APP_RAM_SIZE - APP_RAM_RESERVED - \
+                                       APP_STACK_SIZE - APP_HEAP_SIZE)
+
+APP_STATIC_ASSERT((APP_I2C_SLAVE_FIFO_DEPTH & (APP_I2C_SLAVE_FIFO_DEPTH - 1)) == 0,
+                  i2c_slave_fifo_depth_power_of_two);
+APP_STATIC_ASSERT((APP_UART_RX_RING_LEN & (APP_UART_RX_RING_LEN - 1)) == 0,
+                  uart_rx_ring_len_power_of_two);
+APP_STATIC_ASSERT((APP_EVENT_LOG_DEPTH & (APP_EVENT_LOG_DEPTH - 1)) == 0,
+                  event_log_depth_power_of_two);
+APP_STATIC_ASSERT(APP_UART_RX_RING_LEN <= 0xFFFFu, uart_rx_ring_len_fits_ndtr);
+//sectors 0 to 3 are the 16 KB ones, sector 0 holds the vector table
+APP_STATIC_ASSERT((APP_KV_SECTOR_FIRST >= 1) &&
+                  (APP_KV_SECTOR_FIRST + APP_KV_SECTOR_COUNT <= 4), kv_sectors_16k);
+APP_STATIC_ASSERT(APP_KV_SECTOR_COUNT >= 2, kv_needs_two_sectors);
+APP_STATIC_ASSERT((APP_KV_VALUE_MAX % 4) == 0, kv_value_max_word_multiple);
+APP_STATIC_ASSERT(!APP_TIMEBASE_TICKLESS || APP_TIMEBASE_TIM5, tickless_needs_tim5);
+APP_STATIC_ASSERT(APP_RAM_BUDGET_TOTAL <= APP_RAM_AVAILABLE, ram_budget_exceeds_chip);
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+
+#endif // APP_CONFIG_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -0,0 +1,229 @@
+//! @addtogroup Crc32
+//! @brief CRC32 integrity service
+//! @{
+//!
+//****************************************************************************/
+//! @file crc32.c
+//! @brief CRC-32/MPEG-2 over the CRC unit for word aligned data, with a
+//!        table driven software path giving the same result for unaligned
+//!        buffers, trailing bytes, calls made while the unit is in use (from
+//!        an interrupt) and builds without the unit (APP_CRC_HW 0). The
+//!        software path is slice-by-8 without the unit and a single 1 KB
+//!        table with it.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "crc32.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define CRC32_POLY     0x04C11DB7u
+
+#if APP_CRC_HW
+#define CRC32_SLICES   1u
+#else
+#define CRC32_SLICES   8u
+#endif
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+#if APP_CRC_HW
+//
+//! @brief Run whole words through the CRC unit
+//! @param[in]    crc    Running CRC
+//! @param[in]    words  Word aligned data
+//! @param[in]    count  Number of words, at least 1
+//! @param[out]   None
+//! @return       CRC
+//
+static uint32_t Hw(uint32_t crc, const uint32_t *words, uint32_t count);
+#endif
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+//s_Table[k][b]: byte b at the top of the register, shifted 8 * (k + 1) times
+static uint32_t          s_Table[CRC32_SLICES][256];
+static uint8_t           s_Ready;
+#if APP_CRC_HW
+static CRC_HandleTypeDef s_Crc;
+static volatile uint8_t  s_HwBusy;
+#endif
+
+APP_STATIC_ASSERT(sizeof(s_Table) + 32u <= APP_RAM_BUDGET_CRC, crc32_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void Crc32Init(void)
+{
+    uint32_t i;
+    uint32_t k;
+
+    for (i = 0; i < 256u; i++)
+    {
+        uint32_t c = i << 24;
+
+        for (k = 0; k < 8u; k++)
+        {
+            c = (c & 0x80000000u) ? ((c << 1) ^ CRC32_POLY) : (c << 1);
+        }
+        s_Table[0][i] = c;
+    }
+
+    for (k = 1; k < CRC32_SLICES; k++)
+    {
+        for (i = 0; i < 256u; i++)
+        {
+            uint32_t c = s_Table[k - 1u][i];
+
+            s_Table[k][i] = (c << 8) ^ s_Table[0][c >> 24];
+        }
+    }
+
+#if APP_CRC_HW
+    s_Crc.Instance = CRC;
+    HAL_CRC_Init(&s_Crc);
+#endif
+
+    s_Ready = 1;
+}//end Crc32Init
+
+uint32_t Crc32Accumulate(uint32_t crc, const void *data, uint32_t len)
+{
+    const uint8_t *p = data;
+
+#if APP_CRC_HW
+    uint32_t words = len / 4u;
+    uint32_t primask;
+    uint8_t  busy;
+
+    if (0 == s_Ready)
+    {
+        Crc32Init();
+    }
+
+    primask  = __get_PRIMASK();
+    __disable_irq();
+    busy     = s_HwBusy;
+    s_HwBusy = 1;
+    __set_PRIMASK(primask);
+
+    if (!busy)
+    {
+        if ((0 != words) && (0 == ((uintptr_t)p & 3u)))
+        {
+            crc  = Hw(crc, (const uint32_t*)p, words);
+            p   += words * 4u;
+            len -= words * 4u;
+        }
+        s_HwBusy = 0;
+    }
+#endif
+
+    return Crc32Soft(crc, p, len);
+}//end Crc32Accumulate
+
+uint32_t Crc32Calculate(const void *data, uint32_t len)
+{
+    return Crc32Accumulate(CRC32_INIT, data, len);
+}//end Crc32Calculate
+
+uint32_t Crc32Soft(uint32_t crc, const void *data, uint32_t len)
+{
+    const uint8_t *p = data;
+    uint32_t       a;
+
+    if (0 == s_Ready)
+    {
+        Crc32Init();
+    }
+
+#if CRC32_SLICES == 8u
+    while (len >= 8u)
+    {
+        uint32_t b;
+
+        memcpy(&a, p, 4);
+        memcpy(&b, p + 4, 4);
+        a  ^= crc;
+        crc = s_Table[7][a >> 24] ^ s_Table[6][(a >> 16) & 0xFFu] ^
+              s_Table[5][(a >> 8) & 0xFFu] ^ s_Table[4][a & 0xFFu] ^
+              s_Table[3][b >> 24] ^ s_Table[2][(b >> 16) & 0xFFu] ^
+              s_Table[1][(b >> 8) & 0xFFu] ^ s_Table[0][b & 0xFFu];
+        p   += 8;
+        len -= 8u;
+    }
+#endif
+
+    while (len >= 4u)
+    {
+        memcpy(&a, p, 4);
+        crc ^= a;
+        crc  = (crc << 8) ^ s_Table[0][crc >> 24];
+        crc  = (crc << 8) ^ s_Table[0][crc >> 24];
+        crc  = (crc << 8) ^ s_Table[0][crc >> 24];
+        crc  = (crc << 8) ^ s_Table[0][crc >> 24];
+        p   += 4;
+        len -= 4u;
+    }
+
+    while (len--)
+    {
+        crc = (crc << 8) ^ s_Table[0][(crc >> 24) ^ *p++];
+    }
+
+    return crc;
+}//end Crc32Soft
+
+#if APP_CRC_HW
+void HAL_CRC_MspInit(CRC_HandleTypeDef* hcrc)
+{
+    if (hcrc->Instance == CRC)
+    {
+        __HAL_RCC_CRC_CLK_ENABLE();
+    }
+}
+#endif
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+#if APP_CRC_HW
+static uint32_t Hw(uint32_t crc, const uint32_t *words, uint32_t count)
+{
+    __HAL_CRC_DR_RESET(&s_Crc);
+
+    //the unit restarts from CRC32_INIT: fold the running CRC into the
+    //first word
+    s_Crc.Instance->DR = ~crc ^ words[0];
+
+    if (1u == count)
+    {
+        return s_Crc.Instance->DR;
+    }
+
+    return HAL_CRC_Accumulate(&s_Crc, (uint32_t*)&words[1], count - 1u);
+}//end Hw
+#endif
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
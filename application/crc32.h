@@ -0,0 +1,80 @@
+//! @addtogroup Crc32
+//! @{
+//
+//****************************************************************************
+//! @file crc32.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the CRC32 integrity service
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef CRC32_H
+#define CRC32_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//Start value, the reset value of the CRC unit data register
+#define CRC32_INIT   0xFFFFFFFFu
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Build the software tables and start the CRC unit. Called on first
+//!        use if not called before.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void Crc32Init(void);
+
+//
+//! @brief CRC-32/MPEG-2 (poly 0x04C11DB7, no reflection, no final xor) as
+//!        the STM32 CRC unit computes it: whole words are taken as little
+//!        endian 32-bit values, the 1 to 3 trailing bytes are then fed one
+//!        at a time. Chunks compose when all but the last are a multiple
+//!        of 4 bytes long.
+//! @param[in]    crc   CRC32_INIT, or the result of the previous chunk
+//! @param[in]    data  Data, any alignment
+//! @param[in]    len   Length in bytes
+//! @param[out]   None
+//! @return       CRC
+//
+uint32_t Crc32Accumulate(uint32_t crc, const void *data, uint32_t len);
+
+//
+//! @brief CRC of one buffer, Crc32Accumulate(CRC32_INIT, data, len)
+//! @param[in]    data  Data, any alignment
+//! @param[in]    len   Length in bytes
+//! @param[out]   None
+//! @return       CRC
+//
+uint32_t Crc32Calculate(const void *data, uint32_t len);
+
+//
+//! @brief Software only CRC, same result as Crc32Accumulate(). Used for
+//!        what the unit cannot take, exposed for benchmarks.
+//! @param[in]    crc   CRC32_INIT or the previous result
+//! @param[in]    data  Data, any alignment
+//! @param[in]    len   Length in bytes
+//! @param[out]   None
+//! @return       CRC
+//
+uint32_t Crc32Soft(uint32_t crc, const void *data, uint32_t len);
+
+#endif // CRC32_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -0,0 +1,217 @@
+//! @addtogroup DmaStream
+//! @brief Double buffered DMA block streaming
+//! @{
+//!
+//****************************************************************************/
+//! @file dma_stream.c
+//! @brief Continuous ping-pong DMA over HAL_DMAEx_MultiBufferStart_IT. The
+//!        DMA alternates between two memory targets; each finished target is
+//!        handed to a processing callback while the DMA works on the other.
+//!        If the DMA comes back to a target that was not processed yet, the
+//!        block is lost (source) or sent stale (sink) and an overrun is
+//!        counted.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "dma_stream.h"
+#include "irq_dispatch.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Account a finished memory target, DMA interrupt context
+//! @param[in]    stream  Stream
+//! @param[in]    done    Memory target the DMA just finished, 0 or 1
+//! @param[out]   None
+//! @return       None
+//
+static void Complete(DmaStream_t *stream, uint8_t done);
+
+//
+//! @brief HAL transfer callbacks, memory target 0 done, 1 done and error
+//! @param[in]    hdma  Handle whose Parent is the stream
+//! @param[out]   None
+//! @return       None
+//
+static void M0Complete(DMA_HandleTypeDef *hdma);
+static void M1Complete(DMA_HandleTypeDef *hdma);
+static void Error(DMA_HandleTypeDef *hdma);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void DmaStreamInit(DmaStream_t *stream, DMA_HandleTypeDef *hdma, uint32_t periph,
+                   void *buf0, void *buf1, uint32_t count,
+                   DmaStreamProcess_t process, void *ctx, uint8_t flags)
+{
+    memset(stream, 0, sizeof(*stream));
+
+    stream->hdma    = hdma;
+    stream->periph  = periph;
+    stream->buf[0]  = buf0;
+    stream->buf[1]  = buf1;
+    stream->count   = count;
+    stream->process = process;
+    stream->ctx     = ctx;
+    stream->flags   = flags;
+
+    hdma->Parent             = stream;
+    hdma->XferCpltCallback   = M0Complete;
+    hdma->XferM1CpltCallback = M1Complete;
+    hdma->XferErrorCallback  = Error;
+}//end DmaStreamInit
+
+HAL_StatusTypeDef DmaStreamStart(DmaStream_t *stream)
+{
+    DMA_HandleTypeDef *hdma = stream->hdma;
+
+    stream->pending = 0;
+    stream->next    = 0;
+
+    if (DMA_MEMORY_TO_PERIPH == hdma->Init.Direction)
+    {
+        stream->process(stream->ctx, stream->buf[0], stream->count);
+        stream->process(stream->ctx, stream->buf[1], stream->count);
+
+        return HAL_DMAEx_MultiBufferStart_IT(hdma, (uint32_t)(uintptr_t)stream->buf[0],
+                                             stream->periph,
+                                             (uint32_t)(uintptr_t)stream->buf[1],
+                                             stream->count);
+    }
+
+    return HAL_DMAEx_MultiBufferStart_IT(hdma, stream->periph,
+                                         (uint32_t)(uintptr_t)stream->buf[0],
+                                         (uint32_t)(uintptr_t)stream->buf[1],
+                                         stream->count);
+}//end DmaStreamStart
+
+void DmaStreamStop(DmaStream_t *stream)
+{
+    HAL_DMA_Abort(stream->hdma);
+    stream->pending = 0;
+}//end DmaStreamStop
+
+uint32_t DmaStreamPoll(DmaStream_t *stream)
+{
+    uint32_t done = 0;
+    uint8_t  idx  = stream->next;
+
+    while (stream->pending & (1u << idx))
+    {
+        uint32_t primask;
+
+        stream->process(stream->ctx, stream->buf[idx], stream->count);
+        done++;
+
+        primask = __get_PRIMASK();
+        __disable_irq();
+        stream->stats.processed++;
+        //the bit is cleared only now: the DMA must not re-enter this
+        //target while the callback still works on it
+        stream->pending &= (uint8_t)~(1u << idx);
+        //an overrun during the callback already moved next on
+        if (stream->next == idx)
+        {
+            stream->next = idx ^ 1u;
+        }
+        idx = stream->next;
+        __set_PRIMASK(primask);
+    }
+
+    return done;
+}//end DmaStreamPoll
+
+void DmaStreamEvent(DmaStream_t *stream, uint32_t flags)
+{
+    //the stream has already switched: CT back on target 0 means 1 is done
+    if (flags & IRQ_DMA_TC)
+    {
+        Complete(stream, (stream->hdma->Instance->CR & DMA_SxCR_CT) ? 0u : 1u);
+    }
+}//end DmaStreamEvent
+
+void DmaStreamGetStats(const DmaStream_t *stream, DmaStreamStats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *stats = stream->stats;
+    __set_PRIMASK(primask);
+}//end DmaStreamGetStats
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static void Complete(DmaStream_t *stream, uint8_t done)
+{
+    uint8_t other = done ^ 1u;
+
+    stream->stats.blocks++;
+
+    if (stream->pending & (1u << other))
+    {
+        //DMA has moved on to a target that still waits for processing
+        stream->stats.overruns++;
+        stream->pending &= (uint8_t)~(1u << other);
+        stream->next     = done;
+    }
+
+    stream->pending |= (uint8_t)(1u << done);
+
+    if (stream->flags & DMA_STREAM_FLAG_PROCESS_IN_ISR)
+    {
+        stream->process(stream->ctx, stream->buf[done], stream->count);
+        stream->stats.processed++;
+        stream->pending &= (uint8_t)~(1u << done);
+        stream->next     = other;
+
+        //CT names the target in use: back on ours means the other one
+        //finished while we were busy, and this block was hit
+        if (((stream->hdma->Instance->CR & DMA_SxCR_CT) ? 1u : 0u) == done)
+        {
+            stream->stats.overruns++;
+        }
+    }
+}//end Complete
+
+static void M0Complete(DMA_HandleTypeDef *hdma)
+{
+    Complete((DmaStream_t*)hdma->Parent, 0);
+}//end M0Complete
+
+static void M1Complete(DMA_HandleTypeDef *hdma)
+{
+    Complete((DmaStream_t*)hdma->Parent, 1);
+}//end M1Complete
+
+static void Error(DMA_HandleTypeDef *hdma)
+{
+    ((DmaStream_t*)hdma->Parent)->stats.errors++;
+}//end Error
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
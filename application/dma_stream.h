@@ -0,0 +1,140 @@
+//! @addtogroup DmaStream
+//! @{
+//
+//****************************************************************************
+//! @file dma_stream.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for double buffered (ping-pong) DMA block streaming
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef DMA_STREAM_H
+#define DMA_STREAM_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//Run the processing callback from the DMA interrupt instead of DmaStreamPoll()
+#define DMA_STREAM_FLAG_PROCESS_IN_ISR   0x01u
+
+//
+//! @brief Block processing callback. For a source (peripheral to memory)
+//!        the block holds the samples just received; for a sink (memory to
+//!        peripheral) it must be refilled with the next samples to send.
+//! @param[in]    ctx    Context given to DmaStreamInit()
+//! @param[in]    block  Memory target the DMA just finished with
+//! @param[in]    count  Items in the block, in units of the DMA data width
+//
+typedef void (*DmaStreamProcess_t)(void *ctx, void *block, uint32_t count);
+
+typedef struct
+{
+    uint32_t blocks;      //!< blocks completed by the DMA
+    uint32_t processed;   //!< blocks handed to the callback
+    uint32_t overruns;    //!< blocks overwritten or resent before processing
+    uint32_t errors;      //!< DMA transfer errors
+}DmaStreamStats_t;
+
+//
+//! @brief One stream. Fields are private, use the functions below.
+//
+typedef struct
+{
+    DMA_HandleTypeDef  *hdma;
+    uint32_t            periph;
+    void               *buf[2];
+    uint32_t            count;
+    DmaStreamProcess_t  process;
+    void               *ctx;
+    uint8_t             flags;
+    //bit n set: memory target n is complete and not processed yet
+    volatile uint8_t    pending;
+    //memory target to process next
+    volatile uint8_t    next;
+    DmaStreamStats_t    stats;
+}DmaStream_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Bind a stream to an initialised DMA handle and two equally sized
+//!        memory targets. The handle direction decides source or sink; the
+//!        peripheral side (e.g. ADC DMA request) is enabled by the caller.
+//!        The stream takes over hdma->Parent and the transfer callbacks.
+//! @param[in]    hdma     Initialised DMA handle, not in memory to memory mode
+//! @param[in]    periph   Peripheral data register address
+//! @param[in]    buf0     Memory target 0
+//! @param[in]    buf1     Memory target 1
+//! @param[in]    count    Items per block, 1 to 65535
+//! @param[in]    process  Block callback
+//! @param[in]    ctx      Passed to process
+//! @param[in]    flags    DMA_STREAM_FLAG_xxx
+//! @param[out]   stream   Stream to set up
+//! @return       None
+//
+void DmaStreamInit(DmaStream_t *stream, DMA_HandleTypeDef *hdma, uint32_t periph,
+                   void *buf0, void *buf1, uint32_t count,
+                   DmaStreamProcess_t process, void *ctx, uint8_t flags);
+
+//
+//! @brief Start streaming. A sink gets both blocks filled by the callback
+//!        before the DMA starts.
+//! @param[in]    stream  Stream
+//! @param[out]   None
+//! @return       HAL_OK or the HAL error
+//
+HAL_StatusTypeDef DmaStreamStart(DmaStream_t *stream);
+
+//
+//! @brief Stop streaming, pending blocks are discarded
+//! @param[in]    stream  Stream
+//! @param[out]   None
+//! @return       None
+//
+void DmaStreamStop(DmaStream_t *stream);
+
+//
+//! @brief Process completed blocks, oldest first. Call from the main loop
+//!        at least once per block period unless processing runs in the ISR.
+//! @param[in]    stream  Stream
+//! @param[out]   None
+//! @return       Number of blocks processed
+//
+uint32_t DmaStreamPoll(DmaStream_t *stream);
+
+//
+//! @brief Transfer complete from a routed vector (irq_dispatch.h), in place
+//!        of HAL_DMA_IRQHandler() and the handle callbacks. The flags are
+//!        already cleared; errors still go through HAL_DMA_IRQHandler().
+//! @param[in]    stream  Stream
+//! @param[in]    flags   IRQ_DMA_TC
+//! @param[out]   None
+//! @return       None
+//
+void DmaStreamEvent(DmaStream_t *stream, uint32_t flags);
+
+//
+//! @brief Get stream counters
+//! @param[in]    stream  Stream
+//! @param[out]   stats   Counters
+//! @return       None
+//
+void DmaStreamGetStats(const DmaStream_t *stream, DmaStreamStats_t *stats);
+
+#endif // DMA_STREAM_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
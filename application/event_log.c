@@ -0,0 +1,89 @@
+//! @addtogroup EventLog
+//! @brief Event log
+//! @{
+//!
+//****************************************************************************/
+//! @file event_log.c
+//! @brief Ring of the last APP_EVENT_LOG_DEPTH events in RAM, 12 bytes each
+//!        with the packed RTC stamp. Written from the main loop only, so it
+//!        needs no locking.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+//user defined header files
+#include "app_config.h"
+#include "event_log.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define EVENT_LOG_MASK   (APP_EVENT_LOG_DEPTH - 1u)
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static EventLogRecord_t s_Log[APP_EVENT_LOG_DEPTH];
+//records appended, the next one goes to s_Log[s_Count & EVENT_LOG_MASK]
+static uint32_t         s_Count;
+
+APP_STATIC_ASSERT(sizeof(EventLogRecord_t) == 12u, event_log_record_packed);
+APP_STATIC_ASSERT(sizeof(s_Log) + sizeof(s_Count) <= APP_RAM_BUDGET_EVENT_LOG,
+                  event_log_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void EventLogInit(void)
+{
+    s_Count = 0;
+}//end EventLogInit
+
+void EventLogPut(uint8_t event, uint8_t flags, const RtcStamp_t *stamp,
+                 uint16_t a, uint16_t b)
+{
+    EventLogRecord_t *record = &s_Log[s_Count & EVENT_LOG_MASK];
+
+    record->time   = stamp->time;
+    record->subsec = stamp->subsec;
+    record->event  = event;
+    record->flags  = flags;
+    record->a      = a;
+    record->b      = b;
+    s_Count++;
+}//end EventLogPut
+
+uint32_t EventLogCount(void)
+{
+    return s_Count;
+}//end EventLogCount
+
+int16_t EventLogGet(uint32_t age, EventLogRecord_t *record)
+{
+    if ((age >= s_Count) || (age >= APP_EVENT_LOG_DEPTH))
+    {
+        return -1;
+    }
+
+    *record = s_Log[(s_Count - 1u - age) & EVENT_LOG_MASK];
+
+    return 0;
+}//end EventLogGet
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,92 @@
+//! @addtogroup EventLog
+//! @{
+//
+//****************************************************************************
+//! @file event_log.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the RAM event log of time stamped samples and events
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+#include "rtc_clock.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//Events, with what a and b hold
+#define EVENT_LOG_BOOT          1u      //a, b: boot count low, high half
+#define EVENT_LOG_SAMPLE        2u      //a: tVOC ppb, b: CO2eq ppm
+#define EVENT_LOG_SENSOR_ERROR  3u      //a: driver error code
+#define EVENT_LOG_MISSED        4u      //a: sampling wakeups not served
+#define EVENT_LOG_I2C_SLAVE     5u      //I2C2 slave not started, map not served
+
+//Flags
+#define EVENT_LOG_FLAG_WAKEUP   0x01u   //stamp taken by the wakeup interrupt
+
+typedef struct
+{
+    uint32_t time;        //!< packed calendar time, see RTC_STAMP_PACK
+    uint16_t subsec;      //!< fraction of the second in 1/65536 s
+    uint8_t  event;       //!< EVENT_LOG_xxx
+    uint8_t  flags;       //!< EVENT_LOG_FLAG_xxx
+    uint16_t a;
+    uint16_t b;
+}EventLogRecord_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Empty the log
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void EventLogInit(void);
+
+//
+//! @brief Append a record, overwriting the oldest once the log is full.
+//!        Main loop only, not from interrupts.
+//! @param[in]    event  EVENT_LOG_xxx
+//! @param[in]    flags  EVENT_LOG_FLAG_xxx
+//! @param[in]    stamp  Time of the event
+//! @param[in]    a, b   Event data
+//! @param[out]   None
+//! @return       None
+//
+void EventLogPut(uint8_t event, uint8_t flags, const RtcStamp_t *stamp,
+                 uint16_t a, uint16_t b);
+
+//
+//! @brief Records appended since EventLogInit(), including overwritten ones
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Count
+//
+uint32_t EventLogCount(void);
+
+//
+//! @brief Read a record back
+//! @param[in]    age     0 for the newest, 1 for the one before, ...
+//! @param[out]   record  Record
+//! @return       0, or -1 if it was overwritten or never written
+//
+int16_t EventLogGet(uint32_t age, EventLogRecord_t *record);
+
+#endif // EVENT_LOG_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -0,0 +1,413 @@
+//! @addtogroup I2CSlaveApp
+//! @brief Implement I2C slave register map App
+//! @{
+//!
+//****************************************************************************/
+//! @file i2c_slave_app.c
+//! @brief I2C slave app. Exposes latest IAQ values, statistics and a FIFO of
+//!        historical samples to a host MCU on I2C2. All bus traffic is served
+//!        from interrupts; reads are transmitted straight out of the published
+//!        register map image and FIFO storage without copying.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "i2c_slave_app.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define I2C_SLAVE_SCL_Pin        GPIO_PIN_10
+#define I2C_SLAVE_SCL_GPIO_Port  GPIOB
+#define I2C_SLAVE_SDA_Pin        GPIO_PIN_3
+#define I2C_SLAVE_SDA_GPIO_Port  GPIOB
+
+//Triple buffered map: one image the ISR may be transmitting, one latest
+//published image and one free image for the next publish
+#define MAP_IMAGE_COUNT          3
+#define MAP_IMAGE_NONE           0xFF
+
+#define FIFO_MASK                (I2C_SLAVE_FIFO_DEPTH - 1)
+
+//register addresses in i2c_slave_app.h must match the map layout
+APP_STATIC_ASSERT(sizeof(I2CSlaveRegMap_t) == I2C_SLAVE_REG_FIFO_OVERFLOW + 2,
+                  i2c_slave_map_layout);
+APP_STATIC_ASSERT(sizeof(I2CSlaveRegMap_t) <= I2C_SLAVE_REG_FIFO_DATA,
+                  i2c_slave_map_below_fifo);
+APP_STATIC_ASSERT(sizeof(I2CSlaveSample_t) == 8, i2c_slave_sample_size);
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Start transmitting from current register address
+//! @param[in]    hi2c  I2C handle
+//! @param[out]   None
+//! @return       None
+//
+static void StartTransmit(I2C_HandleTypeDef *hi2c);
+
+//
+//! @brief Listen for the host again. A peripheral left neither ready nor
+//!        listening by a bus error is reset first.
+//! @param[in]    hi2c  I2C handle
+//! @param[out]   None
+//! @return       None
+//
+static void Listen(I2C_HandleTypeDef *hi2c);
+
+//
+//! @brief Release transmit buffers and pop FIFO entries the host has read
+//! @param[in]    hi2c  I2C handle
+//! @param[out]   None
+//! @return       None
+//
+static void FinishTransmit(I2C_HandleTypeDef *hi2c);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+I2C_HandleTypeDef hi2c2;
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static I2CSlaveRegMap_t s_Map[MAP_IMAGE_COUNT];
+static volatile uint8_t s_ActiveMap = 0;
+static volatile uint8_t s_TxMap     = MAP_IMAGE_NONE;
+
+static I2CSlaveSample_t s_Fifo[I2C_SLAVE_FIFO_DEPTH];
+static volatile uint16_t s_FifoHead     = 0;
+static volatile uint16_t s_FifoTail     = 0;
+static volatile uint8_t  s_FifoTxActive = 0;
+static uint16_t s_FifoOverflow          = 0;
+
+static uint8_t  s_RegAddr = 0;
+static uint16_t s_TxLen   = 0;
+static uint8_t  s_TxBusy  = 0;
+//sent when host reads past the end of the map or from an empty FIFO
+static uint8_t  s_Filler[sizeof(I2CSlaveSample_t)];
+
+static uint32_t s_SampleCount = 0;
+static uint64_t s_TvocSum     = 0;
+static uint64_t s_Co2EqSum    = 0;
+
+APP_STATIC_ASSERT(sizeof(s_Map) + sizeof(s_Fifo) + sizeof(s_Filler) +
+                  sizeof(hi2c2) <= APP_RAM_BUDGET_I2C_SLAVE, i2c_slave_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int16_t I2CSlaveInit(void)
+{
+    memset(s_Map, 0, sizeof(s_Map));
+    memset(s_Filler, 0xFF, sizeof(s_Filler));
+    s_Map[0].id       = I2C_SLAVE_ID;
+    s_Map[0].version  = I2C_SLAVE_MAP_VERSION;
+    s_Map[0].tvoc_min = 0xFFFF;
+    s_Map[0].co2_eq_min = 0xFFFF;
+    s_ActiveMap       = 0;
+
+    hi2c2.Instance             = I2C2;
+    hi2c2.Init.ClockSpeed      = 100000;
+    hi2c2.Init.DutyCycle       = I2C_DUTYCYCLE_2;
+    hi2c2.Init.OwnAddress1     = I2C_SLAVE_OWN_ADDRESS << 1;
+    hi2c2.Init.AddressingMode  = I2C_ADDRESSINGMODE_7BIT;
+    hi2c2.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+    hi2c2.Init.OwnAddress2     = 0;
+    hi2c2.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+    hi2c2.Init.NoStretchMode   = I2C_NOSTRETCH_DISABLE;
+
+    //without the bus the map is still kept up to date, only not served
+    if (HAL_OK != HAL_I2C_Init(&hi2c2))
+    {
+        return -1;
+    }
+
+    HAL_NVIC_SetPriority(I2C2_EV_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(I2C2_EV_IRQn);
+    HAL_NVIC_SetPriority(I2C2_ER_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(I2C2_ER_IRQn);
+
+    if (HAL_OK != HAL_I2C_EnableListen_IT(&hi2c2))
+    {
+        (void)HAL_I2C_DeInit(&hi2c2);
+        return -1;
+    }
+
+    return 0;
+}//end I2CSlaveInit
+
+void I2CSlavePublish(uint16_t tvoc_ppb, uint16_t co2_eq_ppm, uint32_t iaq_baseline)
+{
+    const I2CSlaveRegMap_t *prev = &s_Map[s_ActiveMap];
+    uint8_t tx_map               = s_TxMap;
+    uint8_t next                 = 0;
+
+    //pick the image which is neither published nor being transmitted
+    while ( (next == s_ActiveMap) || (next == tx_map) )
+    {
+        next++;
+    }
+
+    I2CSlaveRegMap_t *map = &s_Map[next];
+
+    *map = *prev;
+    s_SampleCount++;
+    s_TvocSum  += tvoc_ppb;
+    s_Co2EqSum += co2_eq_ppm;
+
+    map->seq++;
+    map->tvoc_ppb     = tvoc_ppb;
+    map->co2_eq_ppm   = co2_eq_ppm;
+    map->sample_count = s_SampleCount;
+
+    if (0 != iaq_baseline)
+    {
+        map->iaq_baseline = iaq_baseline;
+    }
+
+    if (tvoc_ppb < map->tvoc_min)
+    {
+        map->tvoc_min = tvoc_ppb;
+    }
+
+    if (tvoc_ppb > map->tvoc_max)
+    {
+        map->tvoc_max = tvoc_ppb;
+    }
+
+    if (co2_eq_ppm < map->co2_eq_min)
+    {
+        map->co2_eq_min = co2_eq_ppm;
+    }
+
+    if (co2_eq_ppm > map->co2_eq_max)
+    {
+        map->co2_eq_max = co2_eq_ppm;
+    }
+
+    map->tvoc_mean   = (uint16_t)(s_TvocSum / s_SampleCount);
+    map->co2_eq_mean = (uint16_t)(s_Co2EqSum / s_SampleCount);
+
+    //FIFO push. When full the oldest entry is dropped, unless the host is
+    //reading it right now, then the new sample is dropped instead.
+    uint8_t drop = 0;
+
+    __disable_irq();
+
+    if ( (uint16_t)(s_FifoHead - s_FifoTail) >= I2C_SLAVE_FIFO_DEPTH )
+    {
+        s_FifoOverflow++;
+
+        if (s_FifoTxActive)
+        {
+            drop = 1;
+        }
+        else
+        {
+            s_FifoTail++;
+        }
+    }
+
+    __enable_irq();
+
+    if (0 == drop)
+    {
+        I2CSlaveSample_t *sample = &s_Fifo[s_FifoHead & FIFO_MASK];
+
+        sample->seq        = s_SampleCount;
+        sample->tvoc_ppb   = tvoc_ppb;
+        sample->co2_eq_ppm = co2_eq_ppm;
+        s_FifoHead++;
+    }
+
+    map->fifo_count    = (uint16_t)(s_FifoHead - s_FifoTail);
+    map->fifo_overflow = s_FifoOverflow;
+
+    s_ActiveMap = next;
+}//end I2CSlavePublish
+
+void HAL_I2C_MspInit(I2C_HandleTypeDef* hi2c)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    if (hi2c->Instance == I2C2)
+    {
+        __HAL_RCC_GPIOB_CLK_ENABLE();
+        /**I2C2 GPIO Configuration
+        PB10     ------> I2C2_SCL
+        PB3      ------> I2C2_SDA
+        */
+        GPIO_InitStruct.Pin       = I2C_SLAVE_SCL_Pin;
+        GPIO_InitStruct.Mode      = GPIO_MODE_AF_OD;
+        GPIO_InitStruct.Pull      = GPIO_PULLUP;
+        GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_VERY_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF4_I2C2;
+        HAL_GPIO_Init(I2C_SLAVE_SCL_GPIO_Port, &GPIO_InitStruct);
+
+        GPIO_InitStruct.Pin       = I2C_SLAVE_SDA_Pin;
+        GPIO_InitStruct.Alternate = GPIO_AF9_I2C2;
+        HAL_GPIO_Init(I2C_SLAVE_SDA_GPIO_Port, &GPIO_InitStruct);
+
+        /* Peripheral clock enable */
+        __HAL_RCC_I2C2_CLK_ENABLE();
+    }
+}
+
+void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c)
+{
+    if (hi2c->Instance == I2C2)
+    {
+        /* Peripheral clock disable */
+        __HAL_RCC_I2C2_CLK_DISABLE();
+
+        HAL_GPIO_DeInit(I2C_SLAVE_SCL_GPIO_Port, I2C_SLAVE_SCL_Pin);
+        HAL_GPIO_DeInit(I2C_SLAVE_SDA_GPIO_Port, I2C_SLAVE_SDA_Pin);
+        HAL_NVIC_DisableIRQ(I2C2_EV_IRQn);
+        HAL_NVIC_DisableIRQ(I2C2_ER_IRQn);
+    }
+}
+
+void HAL_I2C_AddrCallback(I2C_HandleTypeDef *hi2c, uint8_t TransferDirection,
+                          uint16_t AddrMatchCode)
+{
+    //only the own address 1 is enabled, so the match code is always it
+    (void)AddrMatchCode;
+
+    if (hi2c->Instance != I2C2)
+    {
+        return;
+    }
+
+    //master transmits: it is setting the register address
+    if (I2C_DIRECTION_TRANSMIT == TransferDirection)
+    {
+        HAL_I2C_Slave_Seq_Receive_IT(hi2c, &s_RegAddr, 1, I2C_FIRST_FRAME);
+    }
+    else
+    {
+        StartTransmit(hi2c);
+    }
+}
+
+void HAL_I2C_SlaveTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C2)
+    {
+        FinishTransmit(hi2c);
+    }
+}
+
+void HAL_I2C_ListenCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C2)
+    {
+        FinishTransmit(hi2c);
+        Listen(hi2c);
+    }
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C2)
+    {
+        //host NACKs before the end of the window is the normal end of a read,
+        //listen complete follows. Bus and arbitration errors end it too.
+        FinishTransmit(hi2c);
+        Listen(hi2c);
+    }
+}
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static void StartTransmit(I2C_HandleTypeDef *hi2c)
+{
+    uint8_t *data = s_Filler;
+    uint16_t len  = 1;
+
+    if (s_RegAddr >= I2C_SLAVE_REG_FIFO_DATA)
+    {
+        uint16_t count = (uint16_t)(s_FifoHead - s_FifoTail);
+        uint16_t tail  = s_FifoTail & FIFO_MASK;
+
+        //only contiguous entries, rest is read on the next transaction
+        if (count > (I2C_SLAVE_FIFO_DEPTH - tail))
+        {
+            count = I2C_SLAVE_FIFO_DEPTH - tail;
+        }
+
+        if (count > 0)
+        {
+            data           = (uint8_t*)&s_Fifo[tail];
+            len            = count * sizeof(I2CSlaveSample_t);
+            s_FifoTxActive = 1;
+        }
+        else
+        {
+            len = sizeof(s_Filler);
+        }
+    }
+    else if (s_RegAddr < sizeof(I2CSlaveRegMap_t))
+    {
+        s_TxMap = s_ActiveMap;
+        data    = (uint8_t*)&s_Map[s_TxMap] + s_RegAddr;
+        len     = sizeof(I2CSlaveRegMap_t) - s_RegAddr;
+    }
+
+    s_TxLen  = len;
+    s_TxBusy = 1;
+    HAL_I2C_Slave_Seq_Transmit_IT(hi2c, data, len, I2C_LAST_FRAME);
+}
+
+static void Listen(I2C_HandleTypeDef *hi2c)
+{
+    //still listening after an acknowledge failure, listen complete follows
+    if ( (HAL_OK == HAL_I2C_EnableListen_IT(hi2c)) ||
+         (HAL_I2C_STATE_LISTEN == (hi2c->State & HAL_I2C_STATE_LISTEN)) )
+    {
+        return;
+    }
+
+    (void)HAL_I2C_DeInit(hi2c);
+
+    if (HAL_OK == HAL_I2C_Init(hi2c))
+    {
+        (void)HAL_I2C_EnableListen_IT(hi2c);
+    }
+}
+
+static void FinishTransmit(I2C_HandleTypeDef *hi2c)
+{
+    if (0 == s_TxBusy)
+    {
+        return;
+    }
+
+    if (s_FifoTxActive)
+    {
+        //XferCount may already include one preloaded byte the host NACKed,
+        //rounding down to whole entries takes care of it
+        uint16_t sent = s_TxLen - hi2c->XferCount;
+
+        s_FifoTail    += sent / sizeof(I2CSlaveSample_t);
+        s_FifoTxActive = 0;
+    }
+
+    s_TxMap  = MAP_IMAGE_NONE;
+    s_TxBusy = 0;
+}
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
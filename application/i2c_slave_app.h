@@ -0,0 +1,116 @@
+//! @addtogroup I2CSlaveApp
+//! @{
+//
+//****************************************************************************
+//! @file i2c_slave_app.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the I2C slave register map Application
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef I2C_SLAVE_APP_H
+#define I2C_SLAVE_APP_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+#include "app_config.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//7-bit address the host MCU uses to reach us on I2C2
+#define I2C_SLAVE_OWN_ADDRESS    0x42
+
+#define I2C_SLAVE_ID             0x30
+#define I2C_SLAVE_MAP_VERSION    0x01
+
+//Register addresses. The host writes one register address byte, then reads
+//any number of bytes starting from it (repeated start or separate read).
+#define I2C_SLAVE_REG_ID             0x00
+#define I2C_SLAVE_REG_VERSION        0x01
+#define I2C_SLAVE_REG_SEQ            0x02
+#define I2C_SLAVE_REG_TVOC           0x04
+#define I2C_SLAVE_REG_CO2EQ          0x06
+#define I2C_SLAVE_REG_BASELINE       0x08
+#define I2C_SLAVE_REG_SAMPLE_COUNT   0x0C
+#define I2C_SLAVE_REG_TVOC_MIN       0x10
+#define I2C_SLAVE_REG_TVOC_MAX       0x12
+#define I2C_SLAVE_REG_TVOC_MEAN      0x14
+#define I2C_SLAVE_REG_CO2EQ_MIN      0x16
+#define I2C_SLAVE_REG_CO2EQ_MAX      0x18
+#define I2C_SLAVE_REG_CO2EQ_MEAN     0x1A
+#define I2C_SLAVE_REG_FIFO_COUNT     0x1C
+#define I2C_SLAVE_REG_FIFO_OVERFLOW  0x1E
+//Reading from this register pops whole I2CSlaveSample_t entries, oldest first
+#define I2C_SLAVE_REG_FIFO_DATA      0x80
+
+//Number of historical samples kept for the host
+#define I2C_SLAVE_FIFO_DEPTH         APP_I2C_SLAVE_FIFO_DEPTH
+
+//
+//! @brief Live register map image, little endian, laid out as the
+//!        I2C_SLAVE_REG_xxx addresses above
+//
+typedef struct
+{
+    uint8_t  id;
+    uint8_t  version;
+    uint16_t seq;
+    uint16_t tvoc_ppb;
+    uint16_t co2_eq_ppm;
+    uint32_t iaq_baseline;
+    uint32_t sample_count;
+    uint16_t tvoc_min;
+    uint16_t tvoc_max;
+    uint16_t tvoc_mean;
+    uint16_t co2_eq_min;
+    uint16_t co2_eq_max;
+    uint16_t co2_eq_mean;
+    uint16_t fifo_count;
+    uint16_t fifo_overflow;
+}I2CSlaveRegMap_t;
+
+//
+//! @brief One historical sample as read from I2C_SLAVE_REG_FIFO_DATA
+//
+typedef struct
+{
+    uint32_t seq;
+    uint16_t tvoc_ppb;
+    uint16_t co2_eq_ppm;
+}I2CSlaveSample_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Init I2C2 as slave and start listening for the host
+//! @param[in]    None
+//! @param[out]   None
+//! @return       0, or -1 if the peripheral cannot be started. Samples are
+//!               then still published, only not served.
+//
+int16_t I2CSlaveInit(void);
+
+//
+//! @brief Publish a new IAQ sample to the register map and FIFO
+//! @param[in]    tvoc_ppb      tVOC concentration
+//! @param[in]    co2_eq_ppm    CO2eq concentration
+//! @param[in]    iaq_baseline  Current IAQ baseline, 0 if unknown
+//! @param[out]   None
+//! @return       None
+//
+void I2CSlavePublish(uint16_t tvoc_ppb, uint16_t co2_eq_ppm, uint32_t iaq_baseline);
+
+#endif // I2C_SLAVE_APP_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -0,0 +1,218 @@
+//! @addtogroup Idle
+//! @brief Idle loop
+//! @{
+//!
+//****************************************************************************/
+//! @file idle.c
+//! @brief Every wait in the firmware ends up here: HAL_Delay() through
+//!        TimebaseDelayUs(), the I2C transfer wait and main loops that call
+//!        IdleUntil(). The core sleeps in WFI with interrupts masked, so an
+//!        interrupt between the last check and the WFI still ends the sleep,
+//!        and the DWT cycle counter is read on both sides of it to split the
+//!        time into active and idle cycles.
+//!
+//!        With APP_TIMEBASE_TICKLESS the wakeup is a one shot TIM5 compare
+//!        at the deadline, without it the 1 ms tick wakes the core and the
+//!        wait goes back to sleep.
+//!
+//!        APP_IDLE_FLASH_GATE stops the flash interface clock while the core
+//!        sleeps (RCC AHB1LPENR.FLITFLPEN). No DMA stream reads flash here:
+//!        USART2 and dma_stream write to RAM and UART transmit is polled.
+//!        HAL_PWREx_EnableFlashPowerDown() is not used, it only acts in Stop
+//!        mode, which would stop the timebase.
+//!
+//!        Host builds count virtual time at the 100 MHz core clock; a sleep
+//!        moves the model straight to the wakeup, as the tickless core does.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "idle.h"
+#include "timebase.h"
+#include "kv_store.h"
+#include "rtc_clock.h"
+#ifdef HOST_BUILD
+#include "hal_host.h"
+#endif
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define IDLE_HOST_MHZ   100u
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Cycle count, wraps after 42.9 s at 100 MHz
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Cycles
+//
+static uint32_t Cycles(void);
+
+//
+//! @brief Microseconds since boot on the HAL timebase
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Time in us
+//
+static uint64_t Micros(void);
+
+//
+//! @brief Shortest time until one of IDLE_SOURCES is due
+//! @param[in]    None
+//! @param[out]   None
+//! @return       us, 0 for now, IDLE_NEVER if none is scheduled
+//
+static uint32_t NextDue(void);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static IdleStats_t s_Stats;
+//Cycles() at the last wakeup
+static uint32_t    s_Mark;
+
+APP_STATIC_ASSERT(sizeof(s_Stats) + sizeof(s_Mark) <= APP_RAM_BUDGET_IDLE,
+                  idle_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void IdleInit(void)
+{
+#ifndef HOST_BUILD
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#if APP_IDLE_FLASH_GATE
+    __HAL_RCC_FLITF_CLK_SLEEP_DISABLE();
+#endif
+#endif
+    s_Stats.active = 0;
+    s_Stats.idle   = 0;
+    s_Stats.sleeps = 0;
+    s_Stats.early  = 0;
+    s_Mark         = Cycles();
+}//end IdleInit
+
+void IdleSleep(uint32_t us)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t before;
+
+    __disable_irq();
+
+    before          = Cycles();
+    s_Stats.active += before - s_Mark;
+    s_Stats.sleeps++;
+
+#ifdef HOST_BUILD
+    //the model raises the wakeup interrupts itself, with the caller's mask
+    __set_PRIMASK(primask);
+    HalHostSleepUs(us);
+    __disable_irq();
+#else
+    TimebaseWakeAfter(us);
+    __DSB();
+    __WFI();
+#endif
+
+    s_Mark        = Cycles();
+    s_Stats.idle += s_Mark - before;
+
+    __set_PRIMASK(primask);
+}//end IdleSleep
+
+uint32_t IdleUntil(uint32_t deadline)
+{
+    while (1)
+    {
+        int32_t  left = (int32_t)(deadline - HAL_GetTick());
+        uint32_t due;
+        uint32_t us;
+
+        if (left <= 0)
+        {
+            return 0;
+        }
+
+        due = NextDue();
+        if (0u == due)
+        {
+            s_Stats.early++;
+            return 1;
+        }
+
+        //to the deadline, less the part of the current ms already gone
+        us = (uint32_t)left * 1000u - (uint32_t)(Micros() % 1000u);
+        IdleSleep((due < us) ? due : us);
+    }
+}//end IdleUntil
+
+void IdleGetStats(IdleStats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t now;
+
+    __disable_irq();
+    now             = Cycles();
+    s_Stats.active += now - s_Mark;
+    s_Mark          = now;
+    *stats          = s_Stats;
+    __set_PRIMASK(primask);
+}//end IdleGetStats
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint32_t Cycles(void)
+{
+#ifdef HOST_BUILD
+    return (uint32_t)(HalHostMicros() * IDLE_HOST_MHZ);
+#else
+    return DWT->CYCCNT;
+#endif
+}//end Cycles
+
+static uint64_t Micros(void)
+{
+#ifdef HOST_BUILD
+    return HalHostMicros();
+#else
+    return TimebaseMicros64();
+#endif
+}//end Micros
+
+static uint32_t NextDue(void)
+{
+    uint32_t next = IDLE_NEVER;
+    uint32_t due;
+
+#define IDLE_SOURCE_DUE(fn)  \
+    due  = fn();             \
+    next = (due < next) ? due : next;
+
+    IDLE_SOURCES(IDLE_SOURCE_DUE)
+
+#undef IDLE_SOURCE_DUE
+
+    return next;
+}//end NextDue
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
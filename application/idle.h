@@ -0,0 +1,93 @@
+//! @addtogroup Idle
+//! @{
+//
+//****************************************************************************
+//! @file idle.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the idle loop: sleep in WFI to the next deadline, with active
+//!        and idle cycles counted on the DWT cycle counter
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef IDLE_H
+#define IDLE_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//Returned by a source with nothing scheduled
+#define IDLE_NEVER   UINT32_MAX
+
+//
+//! Sources IdleUntil() asks before each sleep: a function returning the us
+//! until the source needs the CPU, 0 if it has work now, IDLE_NEVER if
+//! nothing is scheduled. Interrupt driven I/O needs no entry, its interrupt
+//! ends the sleep.
+//
+#define IDLE_SOURCES(X) \
+    X(KvStoreIdleDue)   \
+    X(RtcClockIdleDue)
+
+typedef struct
+{
+    uint64_t active;      //!< cycles awake since IdleInit()
+    uint64_t idle;        //!< cycles in WFI since IdleInit()
+    uint32_t sleeps;      //!< WFI entries
+    uint32_t early;       //!< IdleUntil() returns for a source, deadline not reached
+}IdleStats_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Start the cycle counter and the accounting; with
+//!        APP_IDLE_FLASH_GATE, stop the flash interface clock in Sleep mode
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void IdleInit(void);
+
+//
+//! @brief Sleep in WFI until an interrupt, at most the given time: with the
+//!        tickless timebase a one shot wakeup is armed, otherwise the 1 ms
+//!        tick ends the sleep. May be called with interrupts disabled, the
+//!        pending one then runs once the caller enables them.
+//! @param[in]    us  Longest sleep in us
+//! @param[out]   None
+//! @return       None
+//
+void IdleSleep(uint32_t us);
+
+//
+//! @brief Sleep until the deadline, or until one of IDLE_SOURCES has work.
+//!        For loops that have something to do with the time they wait.
+//! @param[in]    deadline  HAL_GetTick() value to wake at
+//! @param[out]   None
+//! @return       0 at the deadline, 1 if a source has work before it
+//
+uint32_t IdleUntil(uint32_t deadline);
+
+//
+//! @brief Get the active and idle cycle counts
+//! @param[in]    None
+//! @param[out]   stats  Counters, brought up to now
+//! @return       None
+//
+void IdleGetStats(IdleStats_t *stats);
+
+#endif // IDLE_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
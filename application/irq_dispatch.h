@@ -0,0 +1,169 @@
+//! @addtogroup IrqDispatch
+//! @{
+//
+//****************************************************************************
+//! @file irq_dispatch.h
+//! @brief Compile time routing of peripheral completion interrupts. Each
+//!        route below expands, in stm32f4xx_it.c, into the vector itself:
+//!        it reads and clears the flags of its one instance and calls the
+//!        handler by name. No handle lookup, state checks or function
+//!        pointers on the way; anything unusual (error flags, transmit
+//!        interrupts) is passed to the HAL IRQ handler of the instance
+//!        unchanged.
+//!
+//!        DMA routes suit circular and double buffer streams only: one shot
+//!        transfers need the HAL handler to return the handle to READY.
+//!        I2C1 is already served by the LL engine in sensirion_ll_i2c.c;
+//!        the I2C2 slave keeps the HAL state machine and its callbacks.
+//!
+//!        PROF_STAGE_IRQ_ENTRY measures vector entry to handler in cycles,
+//!        with APP_IRQ_DIRECT 1 and 0 alike.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef IRQ_DISPATCH_H
+#define IRQ_DISPATCH_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+#include "prof.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//DMA stream flags handed to routed handlers, at the stream 0 bit positions
+#define IRQ_DMA_FE       DMA_LISR_FEIF0
+#define IRQ_DMA_DME      DMA_LISR_DMEIF0
+#define IRQ_DMA_TE       DMA_LISR_TEIF0
+#define IRQ_DMA_HT       DMA_LISR_HTIF0
+#define IRQ_DMA_TC       DMA_LISR_TCIF0
+#define IRQ_DMA_ERRORS   (IRQ_DMA_FE | IRQ_DMA_DME | IRQ_DMA_TE)
+
+//Flag offset of a stream in LISR/HISR: 0, 6, 16, 22
+#define IRQ_DMA_SHIFT(idx)   ((((idx) & 1u) * 6u) + (((idx) & 2u) * 8u))
+
+//
+//! Routes. DMA: vector and stream name, controller, stream number,
+//! handler(flags), HAL fallback(void). USART: vector and instance name,
+//! IDLE handler(sr), HAL fallback(void).
+//
+#define IRQ_DMA_ROUTES(X) \
+    X(DMA1_Stream5, DMA1, 5u, UARTRxDmaEvent, UARTRxDmaIrqHandler)
+
+#define IRQ_USART_ROUTES(X) \
+    X(USART2, UARTRxIdleEvent, UARTRxIrqHandler)
+
+//
+//! @brief Vector of a routed DMA stream
+//
+#define IRQ_DMA_VECTOR(name, dma, idx, handler, fallback)            \
+void name##_IRQHandler(void)                                         \
+{                                                                    \
+    uint32_t flags;                                                  \
+                                                                     \
+    PROF_IRQ_ENTRY();                                                \
+    flags = IrqDmaTake(dma, name, idx);                              \
+    if (flags & IRQ_DMA_ERRORS)                                      \
+    {                                                                \
+        fallback();                                                  \
+    }                                                                \
+    else if (0u != flags)                                            \
+    {                                                                \
+        handler(flags);                                              \
+    }                                                                \
+}
+
+//
+//! @brief Vector of a routed USART, receive by DMA with the IDLE interrupt
+//
+#define IRQ_USART_VECTOR(name, handler, fallback)                    \
+void name##_IRQHandler(void)                                         \
+{                                                                    \
+    uint32_t sr;                                                     \
+                                                                     \
+    PROF_IRQ_ENTRY();                                                \
+    sr = IrqUsartTakeIdle(name);                                     \
+    if (0u != sr)                                                    \
+    {                                                                \
+        handler(sr);                                                 \
+    }                                                                \
+    else                                                             \
+    {                                                                \
+        fallback();                                                  \
+    }                                                                \
+}
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Read the enabled flags of a DMA stream and clear them, unless an
+//!        error is among them: then they stay for the HAL handler
+//! @param[in]    dma     Controller
+//! @param[in]    stream  Stream registers
+//! @param[in]    idx     Stream number, a constant so the offsets fold
+//! @param[out]   None
+//! @return       Flags at the stream 0 positions, 0 if none
+//
+static inline uint32_t IrqDmaTake(DMA_TypeDef *dma, DMA_Stream_TypeDef *stream,
+                                  uint32_t idx)
+{
+    uint32_t shift = IRQ_DMA_SHIFT(idx);
+    //TCIE..DMEIE sit one bit below TCIF..DMEIF
+    uint32_t enabled = ((stream->CR & (DMA_SxCR_TCIE | DMA_SxCR_HTIE |
+                                       DMA_SxCR_TEIE | DMA_SxCR_DMEIE)) << 1) |
+                       ((stream->FCR & DMA_SxFCR_FEIE) ? IRQ_DMA_FE : 0u);
+    uint32_t flags   = (((idx < 4u) ? dma->LISR : dma->HISR) >> shift) & enabled;
+
+    if (0u == (flags & IRQ_DMA_ERRORS))
+    {
+        if (idx < 4u)
+        {
+            dma->LIFCR = flags << shift;
+        }
+        else
+        {
+            dma->HIFCR = flags << shift;
+        }
+    }
+
+    return flags;
+}
+
+//
+//! @brief Take a plain IDLE event: IDLE pending and enabled, no receive
+//!        error and no transmit interrupt enabled. IDLE is cleared by the
+//!        SR then DR read.
+//! @param[in]    usart  Instance
+//! @param[out]   None
+//! @return       SR as read, 0 if the HAL handler has to look
+//
+static inline uint32_t IrqUsartTakeIdle(USART_TypeDef *usart)
+{
+    uint32_t sr  = usart->SR;
+    uint32_t cr1 = usart->CR1;
+
+    if ((sr & USART_SR_IDLE) && (cr1 & USART_CR1_IDLEIE) &&
+        (0u == (sr & (USART_SR_PE | USART_SR_FE | USART_SR_NE | USART_SR_ORE))) &&
+        (0u == (cr1 & (USART_CR1_TXEIE | USART_CR1_TCIE | USART_CR1_RXNEIE))))
+    {
+        (void)usart->DR;
+        return sr;
+    }
+
+    return 0u;
+}
+
+#endif // IRQ_DISPATCH_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
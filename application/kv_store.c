@@ -0,0 +1,747 @@
+//! @addtogroup KvStore
+//! @brief Flash backed key-value store
+//! @{
+//!
+//****************************************************************************/
+//! @file kv_store.c
+//! @brief Log structured key-value store over APP_KV_SECTOR_COUNT flash
+//!        sectors. Every write appends a record to the newest (head) sector;
+//!        a RAM index holds the flash address of the current record of each
+//!        key, so a lookup is one table read. When the last erased sector
+//!        is opened, compaction copies the records still current out of the
+//!        oldest (tail) sector and erases it, a few records per
+//!        KvStoreService() call.
+//!
+//!        Sector: magic, sequence, ~sequence, state (erased = in use,
+//!        0 = obsolete), then records.
+//!        Record: key | length << 16 | flags, CRC, commit word, value
+//!        padded to words. The commit word is programmed last; a record
+//!        without it or with a bad CRC was cut by a power loss and is
+//!        skipped. What a cut leaves of the last record is overwritten with
+//!        zero pad words at the next boot, so the log stays walkable and
+//!        the head keeps taking records.
+//!
+//!        Writes are admitted while the live records fit one sector less
+//!        than the store, so compaction always has room to copy into.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "kv_store.h"
+#include "crc32.h"
+#ifdef HOST_BUILD
+#include "hal_host.h"
+#endif
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#ifdef HOST_BUILD
+#define KV_WORDS(addr)        ((const uint32_t*)HalHostFlash(addr))
+#else
+#define KV_WORDS(addr)        ((const uint32_t*)(uintptr_t)(addr))
+#endif
+
+#define KV_SECTOR_MAGIC       0x4B565331u    //"KVS1"
+#define KV_STATE_OBSOLETE     0x00000000u
+#define KV_COMMIT             0x00000000u
+#define KV_ERASED             0xFFFFFFFFu
+#define KV_SECTOR_HDR_SIZE    16u
+#define KV_REC_HDR_SIZE       12u
+#define KV_PAD                0x00000000u
+//first record word flags
+#define KV_REC_MARK           0x40000000u
+#define KV_REC_DELETED        0x80000000u
+
+#define KV_ALIGN(n)           (((uint32_t)(n) + 3u) & ~3u)
+#define KV_KEY(w0)            ((uint16_t)((w0) & 0xFFFFu))
+#define KV_LEN(w0)            ((uint16_t)(((w0) >> 16) & 0x3FFFu))
+#define KV_REC_SIZE(w0)       (KV_REC_HDR_SIZE + KV_ALIGN(KV_LEN(w0)))
+#define KV_REC_MAX            (KV_REC_HDR_SIZE + APP_KV_VALUE_MAX)
+#define KV_SECTOR_ADDR(s)     (APP_KV_BASE + (uint32_t)(s) * APP_KV_SECTOR_SIZE)
+#define KV_SECTOR_OF(addr)    ((uint8_t)(((addr) - APP_KV_BASE) / APP_KV_SECTOR_SIZE))
+#define KV_LIVE_LIMIT         ((APP_KV_SECTOR_COUNT - 1u) * \
+                               (APP_KV_SECTOR_SIZE - KV_SECTOR_HDR_SIZE) - KV_REC_MAX)
+//Records a KvStoreService() call copies at most
+#define KV_COMPACT_STEP       8u
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Program words, then lock the flash again
+//! @param[in]    addr   Flash address, word aligned and erased
+//! @param[in]    words  Data
+//! @param[in]    count  Number of words
+//! @param[out]   None
+//! @return       KV_OK or KV_ERR_FLASH
+//
+static int16_t Program(uint32_t addr, const uint32_t *words, uint32_t count);
+
+//
+//! @brief Erase one store sector
+//! @param[in]    sector  Store sector, 0 to APP_KV_SECTOR_COUNT - 1
+//! @param[out]   None
+//! @return       KV_OK or KV_ERR_FLASH
+//
+static int16_t Erase(uint8_t sector);
+
+//
+//! @brief Check a sector reads erased from end to end
+//! @param[in]    sector  Store sector
+//! @param[out]   None
+//! @return       1 if blank
+//
+static uint32_t IsBlank(uint8_t sector);
+
+//
+//! @brief Program zero pad words over a range
+//! @param[in]    from  First address
+//! @param[in]    to    Address after the range
+//! @param[out]   None
+//! @return       None
+//
+static void Pad(uint32_t from, uint32_t to);
+
+//
+//! @brief Index the records of a sector, oldest sector first
+//! @param[in]    sector  Store sector in use
+//! @param[in]    head    1 for the newest sector, whose broken last record
+//!                       is padded over
+//! @param[out]   None
+//! @return       Address after the last record, the sector end if the
+//!               record chain of an older sector is broken
+//
+static uint32_t Replay(uint8_t sector, uint8_t head);
+
+//
+//! @brief Point a key at a new record and move the live byte counts
+//! @param[in]    addr  Record address
+//! @param[in]    w0    First record word
+//! @param[out]   None
+//! @return       None
+//
+static void Index(uint32_t addr, uint32_t w0);
+
+//
+//! @brief Program a record at the head and index it
+//! @param[in]    w0     Key and length
+//! @param[in]    crc    Record CRC
+//! @param[in]    value  Value words
+//! @param[out]   None
+//! @return       KV_OK, KV_ERR_FULL or KV_ERR_FLASH
+//
+static int16_t Append(uint32_t w0, uint32_t crc, const uint32_t *value);
+
+//
+//! @brief Build and append a record, making room first
+//! @param[in]    key    Key id
+//! @param[in]    value  Value
+//! @param[in]    len    Value length
+//! @param[in]    flags  KV_REC_DELETED for a deletion, else 0
+//! @param[out]   None
+//! @return       KV_OK, KV_ERR_FULL or KV_ERR_FLASH
+//
+static int16_t Put(uint16_t key, const void *value, uint16_t len, uint32_t flags);
+
+//
+//! @brief Get room for a record at the head, opening a sector or finishing
+//!        a compaction as needed
+//! @param[in]    size  Record size
+//! @param[out]   None
+//! @return       KV_OK, KV_ERR_FULL or KV_ERR_FLASH
+//
+static int16_t MakeRoom(uint32_t size);
+
+//
+//! @brief Start a new head in an erased sector
+//! @param[in]    None
+//! @param[out]   None
+//! @return       KV_OK or KV_ERR_FLASH
+//
+static int16_t OpenHead(void);
+
+//
+//! @brief Copy current records out of the tail, erase it once empty
+//! @param[in]    records  Records to look at, at most
+//! @param[out]   None
+//! @return       KV_OK or the error of the copy or erase
+//
+static int16_t CompactStep(uint32_t records);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+//address of the current record of each key, 0 if none
+static uint32_t       s_Index[APP_KV_MAX_KEYS];
+//bytes of current records per sector
+static uint16_t       s_SectorLive[APP_KV_SECTOR_COUNT];
+//sectors in use, oldest (tail) first, newest (head) last
+static uint8_t        s_Order[APP_KV_SECTOR_COUNT];
+static uint8_t        s_Used;
+static uint32_t       s_Seq;
+static uint32_t       s_HeadAddr;
+//next record to look at in the tail, 0 when no compaction is under way
+static uint32_t       s_CompactAddr;
+static KvStoreStats_t s_Stats;
+
+APP_STATIC_ASSERT(KV_KEY_COUNT <= APP_KV_MAX_KEYS, kv_keys_fit_index);
+APP_STATIC_ASSERT(APP_KV_SECTOR_SIZE <= 0xFFFFu, kv_sector_live_fits);
+APP_STATIC_ASSERT(sizeof(s_Index) + sizeof(s_SectorLive) + sizeof(s_Order) + 16u +
+                  sizeof(s_Stats) <= APP_RAM_BUDGET_KV, kv_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int16_t KvStoreInit(void)
+{
+    uint32_t seq[APP_KV_SECTOR_COUNT];
+    uint8_t  sector;
+    uint8_t  i;
+    int16_t  ret = KV_OK;
+
+    memset(s_Index, 0, sizeof(s_Index));
+    memset(s_SectorLive, 0, sizeof(s_SectorLive));
+    memset(&s_Stats, 0, sizeof(s_Stats));
+    s_Used        = 0;
+    s_Seq         = 0;
+    s_HeadAddr    = 0;
+    s_CompactAddr = 0;
+
+    for (sector = 0; sector < APP_KV_SECTOR_COUNT; sector++)
+    {
+        const uint32_t *hdr = KV_WORDS(KV_SECTOR_ADDR(sector));
+
+        if ((KV_SECTOR_MAGIC == hdr[0]) && (hdr[2] == ~hdr[1]) && (KV_ERASED == hdr[3]))
+        {
+            //insert by sequence, oldest first
+            for (i = s_Used++; (i > 0) && (seq[i - 1] > hdr[1]); i--)
+            {
+                s_Order[i] = s_Order[i - 1];
+                seq[i]     = seq[i - 1];
+            }
+            s_Order[i] = sector;
+            seq[i]     = hdr[1];
+        }
+        else if (!IsBlank(sector))
+        {
+            //obsolete, or cut short while being opened or erased
+            if (KV_OK != Erase(sector))
+            {
+                ret = KV_ERR_FLASH;
+            }
+        }
+    }
+
+    for (i = 0; i < s_Used; i++)
+    {
+        s_HeadAddr = Replay(s_Order[i], (uint8_t)(i == s_Used - 1u));
+    }
+
+    if (0 == s_Used)
+    {
+        return (KV_OK == ret) ? OpenHead() : ret;
+    }
+
+    s_Seq = seq[s_Used - 1];
+
+    return ret;
+}//end KvStoreInit
+
+int16_t KvStoreRead(uint16_t key, void *value, uint16_t size, uint16_t *len)
+{
+    const uint32_t *rec;
+    uint16_t        n;
+
+    if ((key >= APP_KV_MAX_KEYS) || (0 == s_Index[key]))
+    {
+        return KV_ERR_NOT_FOUND;
+    }
+
+    rec = KV_WORDS(s_Index[key]);
+    n   = KV_LEN(rec[0]);
+
+    if (NULL != len)
+    {
+        *len = n;
+    }
+
+    if (size < n)
+    {
+        return KV_ERR_PARAM;
+    }
+
+    memcpy(value, &rec[KV_REC_HDR_SIZE / 4u], n);
+
+    return KV_OK;
+}//end KvStoreRead
+
+int16_t KvStoreWrite(uint16_t key, const void *value, uint16_t len)
+{
+    uint32_t old = 0;
+
+    if ((key >= APP_KV_MAX_KEYS) || (len > APP_KV_VALUE_MAX) ||
+        ((NULL == value) && (0 != len)))
+    {
+        return KV_ERR_PARAM;
+    }
+
+    if (0 != s_Index[key])
+    {
+        const uint32_t *rec = KV_WORDS(s_Index[key]);
+
+        //value is NULL for an empty one, memcmp wants a valid pointer
+        if ((KV_LEN(rec[0]) == len) &&
+            ((0 == len) || (0 == memcmp(&rec[KV_REC_HDR_SIZE / 4u], value, len))))
+        {
+            return KV_OK;
+        }
+        old = KV_REC_SIZE(rec[0]);
+    }
+
+    if (s_Stats.live_bytes - old + KV_REC_HDR_SIZE + KV_ALIGN(len) > KV_LIVE_LIMIT)
+    {
+        return KV_ERR_FULL;
+    }
+
+    s_Stats.user_bytes += len;
+
+    return Put(key, value, len, 0);
+}//end KvStoreWrite
+
+int16_t KvStoreDelete(uint16_t key)
+{
+    if ((key >= APP_KV_MAX_KEYS) || (0 == s_Index[key]))
+    {
+        return KV_ERR_NOT_FOUND;
+    }
+
+    return Put(key, NULL, 0, KV_REC_DELETED);
+}//end KvStoreDelete
+
+uint32_t KvStoreService(void)
+{
+    if (APP_KV_SECTOR_COUNT != s_Used)
+    {
+        return 0;
+    }
+
+    (void)CompactStep(KV_COMPACT_STEP);
+
+    return (APP_KV_SECTOR_COUNT == s_Used) ? 1u : 0u;
+}//end KvStoreService
+
+uint32_t KvStoreIdleDue(void)
+{
+    return (APP_KV_SECTOR_COUNT == s_Used) ? 0u : UINT32_MAX;
+}//end KvStoreIdleDue
+
+void KvStoreGetStats(KvStoreStats_t *stats)
+{
+    *stats = s_Stats;
+}//end KvStoreGetStats
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static int16_t Program(uint32_t addr, const uint32_t *words, uint32_t count)
+{
+    HAL_StatusTypeDef status = HAL_FLASH_Unlock();
+    uint32_t          i;
+
+    for (i = 0; (HAL_OK == status) && (i < count); i++)
+    {
+        status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, addr + 4u * i, words[i]);
+    }
+
+    HAL_FLASH_Lock();
+    s_Stats.flash_bytes += 4u * i;
+
+    return (HAL_OK == status) ? KV_OK : KV_ERR_FLASH;
+}//end Program
+
+static int16_t Erase(uint8_t sector)
+{
+    FLASH_EraseInitTypeDef erase;
+    uint32_t               error  = 0;
+    HAL_StatusTypeDef      status = HAL_FLASH_Unlock();
+
+    erase.TypeErase    = FLASH_TYPEERASE_SECTORS;
+    erase.Banks        = FLASH_BANK_1;
+    erase.Sector       = APP_KV_SECTOR_FIRST + sector;
+    erase.NbSectors    = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+    if (HAL_OK == status)
+    {
+        status = HAL_FLASHEx_Erase(&erase, &error);
+    }
+
+    HAL_FLASH_Lock();
+    s_Stats.erases++;
+
+    return (HAL_OK == status) ? KV_OK : KV_ERR_FLASH;
+}//end Erase
+
+static uint32_t IsBlank(uint8_t sector)
+{
+    const uint32_t *words = KV_WORDS(KV_SECTOR_ADDR(sector));
+    uint32_t        i;
+
+    for (i = 0; i < APP_KV_SECTOR_SIZE / 4u; i++)
+    {
+        if (KV_ERASED != words[i])
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}//end IsBlank
+
+static void Pad(uint32_t from, uint32_t to)
+{
+    uint32_t pad = KV_PAD;
+
+    //a refused word is tried once more: an erased word left behind reads
+    //as the log end unless the next one is programmed
+    for (; from < to; from += 4u)
+    {
+        if (KV_OK != Program(from, &pad, 1))
+        {
+            (void)Program(from, &pad, 1);
+        }
+    }
+}//end Pad
+
+static uint32_t Replay(uint8_t sector, uint8_t head)
+{
+    uint32_t addr = KV_SECTOR_ADDR(sector) + KV_SECTOR_HDR_SIZE;
+    uint32_t end  = KV_SECTOR_ADDR(sector) + APP_KV_SECTOR_SIZE;
+
+    while (addr + KV_REC_HDR_SIZE <= end)
+    {
+        const uint32_t *rec = KV_WORDS(addr);
+        uint32_t        w0  = rec[0];
+
+        if (KV_ERASED == w0)
+        {
+            //a pad word refused twice leaves a hole, not the log end
+            if ((addr + 4u < end) && (KV_ERASED != rec[1]))
+            {
+                addr += 4u;
+                continue;
+            }
+            break;
+        }
+
+        if (KV_PAD == w0)
+        {
+            addr += 4u;
+            continue;
+        }
+
+        if (!(w0 & KV_REC_MARK) || (KV_KEY(w0) >= APP_KV_MAX_KEYS) ||
+            (KV_LEN(w0) > APP_KV_VALUE_MAX) || (addr + KV_REC_SIZE(w0) > end))
+        {
+            uint32_t last;
+
+            //older sectors were complete when the next one was opened
+            if (!head)
+            {
+                return end;
+            }
+
+            //a cut record is the last thing written: pad over it
+            for (last = end; (last > addr) && (KV_ERASED == KV_WORDS(last - 4u)[0]); last -= 4u)
+            {
+            }
+            Pad(addr, last);
+
+            return last;
+        }
+
+        s_Stats.records++;
+
+        if ((KV_COMMIT == rec[2]) &&
+            (rec[1] == Crc32Accumulate(Crc32Accumulate(CRC32_INIT, &w0, 4u),
+                                       &rec[KV_REC_HDR_SIZE / 4u],
+                                       KV_ALIGN(KV_LEN(w0)))))
+        {
+            Index(addr, w0);
+        }
+
+        addr += KV_REC_SIZE(w0);
+    }
+
+    return addr;
+}//end Replay
+
+static void Index(uint32_t addr, uint32_t w0)
+{
+    uint16_t key = KV_KEY(w0);
+    uint32_t old = s_Index[key];
+    uint32_t size;
+
+    if (0 != old)
+    {
+        size = KV_REC_SIZE(KV_WORDS(old)[0]);
+        s_SectorLive[KV_SECTOR_OF(old)] -= (uint16_t)size;
+        s_Stats.live_bytes              -= size;
+    }
+
+    if (w0 & KV_REC_DELETED)
+    {
+        s_Index[key] = 0;
+        return;
+    }
+
+    size                              = KV_REC_SIZE(w0);
+    s_Index[key]                      = addr;
+    s_SectorLive[KV_SECTOR_OF(addr)] += (uint16_t)size;
+    s_Stats.live_bytes               += size;
+}//end Index
+
+static int16_t Append(uint32_t w0, uint32_t crc, const uint32_t *value)
+{
+    uint32_t addr   = s_HeadAddr;
+    uint32_t words  = KV_ALIGN(KV_LEN(w0)) / 4u;
+    uint32_t hdr[2] = {w0, crc};
+    uint32_t commit = KV_COMMIT;
+    int16_t  ret;
+
+    if (addr + KV_REC_SIZE(w0) > KV_SECTOR_ADDR(s_Order[s_Used - 1]) + APP_KV_SECTOR_SIZE)
+    {
+        return KV_ERR_FULL;
+    }
+
+    //the space is used whatever happens below
+    s_HeadAddr += KV_REC_SIZE(w0);
+
+    ret = Program(addr, hdr, 2);
+    if (KV_OK == ret)
+    {
+        ret = Program(addr + KV_REC_HDR_SIZE, value, words);
+    }
+    if (KV_OK == ret)
+    {
+        ret = Program(addr + 8u, &commit, 1);
+    }
+    if ((KV_OK == ret) &&
+        ((KV_WORDS(addr)[0] != w0) || (KV_WORDS(addr)[1] != crc) ||
+         (0 != memcmp(KV_WORDS(addr + KV_REC_HDR_SIZE), value, words * 4u))))
+    {
+        ret = KV_ERR_FLASH;
+    }
+
+    if (KV_OK == ret)
+    {
+        Index(addr, w0);
+    }
+    else if (KV_WORDS(addr)[0] != w0)
+    {
+        //keep the log walkable past the failed record; with its header in
+        //place it is skipped by length like any record without commit
+        Pad(addr, s_HeadAddr);
+    }
+
+    return ret;
+}//end Append
+
+static int16_t Put(uint16_t key, const void *value, uint16_t len, uint32_t flags)
+{
+    uint32_t words[APP_KV_VALUE_MAX / 4u];
+    uint32_t w0    = (uint32_t)key | ((uint32_t)len << 16) | KV_REC_MARK | flags;
+    uint32_t count = KV_ALIGN(len) / 4u;
+    int16_t  ret;
+
+    if (0 == s_Used)
+    {
+        return KV_ERR_FLASH;
+    }
+
+    memset(words, 0xFF, sizeof(words));
+
+    //KvStoreDelete() passes no value
+    if (0 != len)
+    {
+        memcpy(words, value, len);
+    }
+
+    ret = MakeRoom(KV_REC_SIZE(w0));
+    if (KV_OK == ret)
+    {
+        ret = Append(w0, Crc32Accumulate(Crc32Accumulate(CRC32_INIT, &w0, 4u), words,
+                                          count * 4u), words);
+    }
+
+    return ret;
+}//end Put
+
+static int16_t MakeRoom(uint32_t size)
+{
+    uint32_t tries;
+    int16_t  ret;
+
+    for (tries = 0; tries < 2u * APP_KV_SECTOR_COUNT + 2u; tries++)
+    {
+        uint32_t free = KV_SECTOR_ADDR(s_Order[s_Used - 1]) + APP_KV_SECTOR_SIZE - s_HeadAddr;
+        uint32_t tail = s_SectorLive[s_Order[0]];
+
+        if (APP_KV_SECTOR_COUNT != s_Used)
+        {
+            if (free >= size)
+            {
+                return KV_OK;
+            }
+            ret = OpenHead();
+        }
+        //compaction pending: keep room at the head for what the tail holds
+        else if (free >= size + tail)
+        {
+            return KV_OK;
+        }
+        else if (free >= tail)
+        {
+            ret = CompactStep(UINT32_MAX);
+        }
+        else
+        {
+            return KV_ERR_FULL;
+        }
+
+        if (KV_OK != ret)
+        {
+            return ret;
+        }
+    }
+
+    return KV_ERR_FULL;
+}//end MakeRoom
+
+static int16_t OpenHead(void)
+{
+    uint32_t hdr[3];
+    uint8_t  sector;
+    uint8_t  i;
+    int16_t  ret;
+
+    //lowest sector not in use, erased
+    for (sector = 0; sector < APP_KV_SECTOR_COUNT; sector++)
+    {
+        for (i = 0; (i < s_Used) && (s_Order[i] != sector); i++)
+        {
+        }
+        if (i == s_Used)
+        {
+            break;
+        }
+    }
+
+    //an erase refused earlier is caught up on here
+    if (!IsBlank(sector) && (KV_OK != Erase(sector)))
+    {
+        return KV_ERR_FLASH;
+    }
+
+    s_Seq++;
+    hdr[0] = KV_SECTOR_MAGIC;
+    hdr[1] = s_Seq;
+    hdr[2] = ~s_Seq;
+
+    ret = Program(KV_SECTOR_ADDR(sector), hdr, 3);
+    if (KV_OK != ret)
+    {
+        //nothing goes into a sector with a broken header: erase it for the
+        //next try, the old head stays the head. Kept in use it would be a
+        //full head the tail can never be compacted into.
+        (void)Erase(sector);
+        return ret;
+    }
+
+    s_Order[s_Used++] = sector;
+    s_HeadAddr        = KV_SECTOR_ADDR(sector) + KV_SECTOR_HDR_SIZE;
+
+    return ret;
+}//end OpenHead
+
+static int16_t CompactStep(uint32_t records)
+{
+    uint8_t  tail     = s_Order[0];
+    uint32_t end      = KV_SECTOR_ADDR(tail) + APP_KV_SECTOR_SIZE;
+    uint32_t obsolete = KV_STATE_OBSOLETE;
+    int16_t  ret;
+
+    if (0 == s_CompactAddr)
+    {
+        s_CompactAddr = KV_SECTOR_ADDR(tail) + KV_SECTOR_HDR_SIZE;
+    }
+
+    for (; (records > 0) && (0 != s_SectorLive[tail]); records--)
+    {
+        const uint32_t *rec = KV_WORDS(s_CompactAddr);
+
+        //live bytes left but no records: the index is out of step
+        if ((s_CompactAddr + KV_REC_HDR_SIZE > end) ||
+            ((KV_ERASED == rec[0]) && (KV_ERASED == rec[1])))
+        {
+            return KV_ERR_FLASH;
+        }
+
+        if ((KV_PAD == rec[0]) || (KV_ERASED == rec[0]))
+        {
+            s_CompactAddr += 4u;
+            continue;
+        }
+
+        if (s_Index[KV_KEY(rec[0])] == s_CompactAddr)
+        {
+            ret = Append(rec[0], rec[1], &rec[KV_REC_HDR_SIZE / 4u]);
+            if (KV_OK != ret)
+            {
+                return ret;
+            }
+            s_Stats.copied_bytes += KV_REC_SIZE(rec[0]);
+        }
+
+        s_CompactAddr += KV_REC_SIZE(rec[0]);
+    }
+
+    if (0 != s_SectorLive[tail])
+    {
+        return KV_OK;
+    }
+
+    //a reset from here on finds the sector obsolete and erases it again
+    ret = Program(KV_SECTOR_ADDR(tail) + 12u, &obsolete, 1);
+    if (KV_OK == ret)
+    {
+        ret = Erase(tail);
+    }
+
+    if (KV_OK == ret)
+    {
+        memmove(&s_Order[0], &s_Order[1], --s_Used);
+        s_CompactAddr = 0;
+    }
+
+    return ret;
+}//end CompactStep
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,124 @@
+//! @addtogroup KvStore
+//! @{
+//
+//****************************************************************************
+//! @file kv_store.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the flash backed key-value store
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef KV_STORE_H
+#define KV_STORE_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+#define KV_OK                 0
+#define KV_ERR_NOT_FOUND     -1
+#define KV_ERR_PARAM         -2
+#define KV_ERR_FULL          -3
+#define KV_ERR_FLASH         -4
+
+//Key ids in use, below APP_KV_MAX_KEYS
+typedef enum
+{
+    KV_KEY_SGP_BASELINE = 0,   //!< uint32_t, sgp30_get_iaq_baseline()
+    KV_KEY_BOOT_COUNT,         //!< uint32_t, resets seen
+    KV_KEY_COUNT
+}KvKey_t;
+
+typedef struct
+{
+    uint32_t user_bytes;    //!< value bytes given to KvStoreWrite()
+    uint32_t flash_bytes;   //!< bytes programmed: records, copies, headers
+    uint32_t copied_bytes;  //!< bytes moved by compaction
+    uint32_t erases;        //!< sector erases
+    uint32_t live_bytes;    //!< flash taken by current values
+    uint32_t records;       //!< records scanned by the last KvStoreInit()
+}KvStoreStats_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Scan the flash log and rebuild the RAM index. Sectors left half
+//!        erased or half opened by a power loss are erased, a compaction
+//!        that was cut short carries on in KvStoreService().
+//! @param[in]    None
+//! @param[out]   None
+//! @return       KV_OK or KV_ERR_FLASH
+//
+int16_t KvStoreInit(void);
+
+//
+//! @brief Read the current value of a key
+//! @param[in]    key    Key id
+//! @param[in]    size   Size of value
+//! @param[out]   value  Value
+//! @param[out]   len    Value length, may be NULL
+//! @return       KV_OK, KV_ERR_NOT_FOUND, or KV_ERR_PARAM if size is short
+//
+int16_t KvStoreRead(uint16_t key, void *value, uint16_t size, uint16_t *len);
+
+//
+//! @brief Store a new value for a key. The record is committed by its last
+//!        word, a power loss before that leaves the old value. Writing the
+//!        value already stored programs nothing.
+//! @param[in]    key    Key id
+//! @param[in]    value  Value
+//! @param[in]    len    Value length, up to APP_KV_VALUE_MAX
+//! @param[out]   None
+//! @return       KV_OK, KV_ERR_PARAM, KV_ERR_FULL or KV_ERR_FLASH
+//
+int16_t KvStoreWrite(uint16_t key, const void *value, uint16_t len);
+
+//
+//! @brief Remove a key
+//! @param[in]    key  Key id
+//! @param[out]   None
+//! @return       KV_OK, KV_ERR_NOT_FOUND, KV_ERR_FULL or KV_ERR_FLASH
+//
+int16_t KvStoreDelete(uint16_t key);
+
+//
+//! @brief Background compaction, call from the main loop. Each call copies
+//!        a few live records out of the oldest sector or erases it. The
+//!        erase stalls code fetch from flash for about 250 ms.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       1 while compaction is pending, else 0
+//
+uint32_t KvStoreService(void);
+
+//
+//! @brief Idle source, see IDLE_SOURCES
+//! @param[in]    None
+//! @param[out]   None
+//! @return       0 while compaction is pending, else UINT32_MAX (IDLE_NEVER)
+//
+uint32_t KvStoreIdleDue(void);
+
+//
+//! @brief Get store counters
+//! @param[in]    None
+//! @param[out]   stats  Counters
+//! @return       None
+//
+void KvStoreGetStats(KvStoreStats_t *stats);
+
+#endif // KV_STORE_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -14,9 +14,17 @@
 //****************************************************************************/
 //standard header files
 //user defined header files
+#include "app_config.h"
 #include "init.h"
 #include "uart_app.h"
 #include "sgp_app.h"
+#include "i2c_slave_app.h"
+#include "prof.h"
+#include "sensirion_trace.h"
+#include "kv_store.h"
+#include "idle.h"
+#include "rtc_clock.h"
+#include "event_log.h"
 
 //****************************************************************************/
 //                           Defines and typedefs
@@ -40,8 +48,31 @@
 //****************************************************************************/
 int main()
 {
+    uint32_t   boots = 0;
+    RtcStamp_t now;
+
     Init();
+    ProfInit();
+    IdleInit();
+#if SENSIRION_TRACE_ENABLE
+    //record from boot so a replay sees the probe and info reads too
+    sensirion_trace_start(NULL);
+#endif
     UARTInit();
+    KvStoreInit();
+    (void)KvStoreRead(KV_KEY_BOOT_COUNT, &boots, sizeof(boots), NULL);
+    boots++;
+    (void)KvStoreWrite(KV_KEY_BOOT_COUNT, &boots, sizeof(boots));
+    (void)RtcClockInit();
+    EventLogInit();
+    RtcClockNow(&now);
+    EventLogPut(EVENT_LOG_BOOT, 0, &now, (uint16_t)boots, (uint16_t)(boots >> 16));
+#if APP_FEATURE_I2C_SLAVE
+    if (0 != I2CSlaveInit())
+    {
+        EventLogPut(EVENT_LOG_I2C_SLAVE, 0, &now, 0, 0);
+    }
+#endif
     SgpInit();
     SgpPoll();
 
@@ -0,0 +1,129 @@
+//! @addtogroup Prof
+//! @brief Per-stage cycle profiling
+//! @{
+//!
+//****************************************************************************/
+//! @file prof.c
+//! @brief Per-stage cycle profiling. Uses the DWT cycle counter on target and
+//!        the monotonic clock on host builds.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+#ifdef HOST_BUILD
+#include <time.h>
+#endif
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "prof.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static ProfStat_t        s_Stats[PROF_STAGE_COUNT];
+//ProfNow() at entry of the interrupt being served
+static volatile uint32_t s_IrqEntry;
+
+APP_STATIC_ASSERT(sizeof(s_Stats) + sizeof(s_IrqEntry) <= APP_RAM_BUDGET_PROF,
+                  prof_ram_budget);
+
+static const char * const s_Names[PROF_STAGE_COUNT] =
+{
+    "i2c_read",
+    "i2c_write",
+    "measure",
+    "report",
+    "publish",
+    "i2c_isr",
+    "tick_isr",
+    "irq_entry",
+};
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void ProfInit(void)
+{
+#ifndef HOST_BUILD
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT       = 0;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    memset(s_Stats, 0, sizeof(s_Stats));
+}//end ProfInit
+
+uint32_t ProfNow(void)
+{
+#ifdef HOST_BUILD
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}//end ProfNow
+
+void ProfAdd(ProfStage_t stage, uint32_t start)
+{
+    //unsigned subtraction is wrap safe
+    uint32_t elapsed  = ProfNow() - start;
+    ProfStat_t *stat = &s_Stats[stage];
+
+    stat->calls++;
+    stat->total += elapsed;
+
+    if (elapsed > stat->max)
+    {
+        stat->max = elapsed;
+    }
+}//end ProfAdd
+
+void ProfIrqEntry(void)
+{
+    s_IrqEntry = ProfNow();
+}//end ProfIrqEntry
+
+void ProfIrqHandler(void)
+{
+    ProfAdd(PROF_STAGE_IRQ_ENTRY, s_IrqEntry);
+}//end ProfIrqHandler
+
+const ProfStat_t* ProfGet(ProfStage_t stage)
+{
+    return &s_Stats[stage];
+}//end ProfGet
+
+const char* ProfName(ProfStage_t stage)
+{
+    return s_Names[stage];
+}//end ProfName
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
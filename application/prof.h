@@ -0,0 +1,147 @@
+//! @addtogroup Prof
+//! @{
+//
+//****************************************************************************
+//! @file prof.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for per-stage cycle profiling
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef PROF_H
+#define PROF_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//Profiling is always on for host builds, opt-in on target
+#ifndef PROF_ENABLE
+#ifdef HOST_BUILD
+#define PROF_ENABLE  1
+#else
+#define PROF_ENABLE  0
+#endif
+#endif
+
+//Unit of ProfNow(): DWT cycles on target, nanoseconds on host
+#ifdef HOST_BUILD
+#define PROF_UNIT_STR  "ns"
+#else
+#define PROF_UNIT_STR  "cycles"
+#endif
+
+typedef enum
+{
+    PROF_STAGE_I2C_READ = 0,
+    PROF_STAGE_I2C_WRITE,
+    PROF_STAGE_MEASURE,
+    PROF_STAGE_REPORT,
+    PROF_STAGE_PUBLISH,
+    PROF_STAGE_I2C_ISR,
+    PROF_STAGE_TICK_ISR,
+    PROF_STAGE_IRQ_ENTRY,     //!< vector entry to the routed handler
+    PROF_STAGE_COUNT
+}ProfStage_t;
+
+typedef struct
+{
+    uint32_t calls;
+    uint32_t max;
+    uint64_t total;
+}ProfStat_t;
+
+#if PROF_ENABLE
+#define PROF_BEGIN(start)         uint32_t start = ProfNow()
+#define PROF_END(stage, start)    ProfAdd((stage), (start))
+#else
+#define PROF_BEGIN(start)
+#define PROF_END(stage, start)
+#endif
+
+//Interrupt entry latency, target only: host builds have no vectors
+#if PROF_ENABLE && !defined(HOST_BUILD)
+#define PROF_IRQ_ENTRY()          ProfIrqEntry()
+#define PROF_IRQ_HANDLER()        ProfIrqHandler()
+#else
+#define PROF_IRQ_ENTRY()
+#define PROF_IRQ_HANDLER()
+#endif
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Start the cycle counter and clear all stage statistics
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void ProfInit(void);
+
+//
+//! @brief Read the free running profiling counter
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Counter value in PROF_UNIT_STR
+//
+uint32_t ProfNow(void);
+
+//
+//! @brief Account the time elapsed since start to a stage
+//! @param[in]    stage  Stage to account to
+//! @param[in]    start  ProfNow() value at the beginning of the stage
+//! @param[out]   None
+//! @return       None
+//
+void ProfAdd(ProfStage_t stage, uint32_t start);
+
+//
+//! @brief Stamp the entry of a peripheral interrupt vector, first thing in
+//!        the vector
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void ProfIrqEntry(void);
+
+//
+//! @brief Account the time since ProfIrqEntry() to PROF_STAGE_IRQ_ENTRY,
+//!        first thing in the handler the interrupt is meant for. The 12
+//!        cycles of exception entry before the vector are not included.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void ProfIrqHandler(void);
+
+//
+//! @brief Get statistics of a stage
+//! @param[in]    stage  Stage
+//! @param[out]   None
+//! @return       Pointer to stage statistics
+//
+const ProfStat_t* ProfGet(ProfStage_t stage);
+
+//
+//! @brief Get printable stage name
+//! @param[in]    stage  Stage
+//! @param[out]   None
+//! @return       Stage name
+//
+const char* ProfName(ProfStage_t stage);
+
+#endif // PROF_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
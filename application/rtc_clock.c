@@ -0,0 +1,286 @@
+//! @addtogroup RtcClock
+//! @brief RTC sampling clock
+//! @{
+//!
+//****************************************************************************/
+//! @file rtc_clock.c
+//! @brief Calendar and wakeup timer of the RTC. The wakeup timer counts
+//!        ck_spre, the 1 Hz clock the calendar itself advances on, so the
+//!        sampling period is a whole number of calendar seconds and each
+//!        wakeup falls on a second edge. The RTC keeps counting in Sleep,
+//!        Stop and Standby, where the HAL tick does not, and the wakeup
+//!        interrupt ends a WFI like any other.
+//!
+//!        The interrupt stamps the wakeup with the calendar, so a sample is
+//!        stamped with the time it was due rather than the time the main
+//!        loop got to it. Stamps are packed to 6 bytes: FAT style calendar
+//!        time in a word and the subseconds in 1/65536 s.
+//!
+//!        init.c runs the RTC on the LSI. Its frequency is only known to a
+//!        few percent; the period is exact in RTC seconds, the calendar
+//!        drifts with the LSI.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "rtc_clock.h"
+#include "idle.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define RTC_DAY_S          86400u
+//days in the 4 years from a leap year
+#define RTC_QUAD_DAYS      1461u
+//RTC_WUTR.WUT, the timer counts WUT + 1 ck_spre edges
+#define RTC_WUT_MAX        0xFFFFu
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Days before the first of a month
+//! @param[in]    month  1 to 12
+//! @param[in]    leap   1 in a leap year
+//! @param[out]   None
+//! @return       Days
+//
+static uint32_t DaysBefore(uint32_t month, uint32_t leap);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const uint16_t s_MonthDays[12] =
+{
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+};
+
+static RTC_HandleTypeDef s_Rtc;
+//stamp of the latest wakeup and wakeups since the last take, set in the
+//interrupt
+static RtcStamp_t        s_Stamp;
+static volatile uint32_t s_Pending;
+
+APP_STATIC_ASSERT(sizeof(s_Rtc) + sizeof(s_Stamp) + sizeof(s_Pending) <= APP_RAM_BUDGET_RTC,
+                  rtc_clock_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int16_t RtcClockInit(void)
+{
+    RTC_DateTypeDef date;
+
+    s_Rtc.Instance            = RTC;
+    s_Rtc.Init.HourFormat     = RTC_HOURFORMAT_24;
+    s_Rtc.Init.AsynchPrediv   = APP_RTC_PREDIV_A;
+    s_Rtc.Init.SynchPrediv    = APP_RTC_PREDIV_S;
+    s_Rtc.Init.OutPut         = RTC_OUTPUT_DISABLE;
+    s_Rtc.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
+    s_Rtc.Init.OutPutType     = RTC_OUTPUT_TYPE_OPENDRAIN;
+    s_Pending                 = 0;
+
+    if (HAL_OK != HAL_RTC_Init(&s_Rtc))
+    {
+        return -1;
+    }
+
+    //the year is 0 only until the calendar is first set (RTC_ISR.INITS)
+    (void)HAL_RTC_GetDate(&s_Rtc, &date, RTC_FORMAT_BIN);
+    if (0u == date.Year)
+    {
+        return RtcClockSet(RTC_STAMP_PACK(APP_RTC_EPOCH_YEAR - 2000u, APP_RTC_EPOCH_MONTH,
+                                          APP_RTC_EPOCH_DAY, 0, 0, 0));
+    }
+
+    return 0;
+}//end RtcClockInit
+
+int16_t RtcClockSet(uint32_t time)
+{
+    RTC_TimeTypeDef t = {0};
+    RTC_DateTypeDef d = {0};
+
+    t.Hours          = (uint8_t)RTC_STAMP_HOUR(time);
+    t.Minutes        = (uint8_t)RTC_STAMP_MINUTE(time);
+    t.Seconds        = (uint8_t)RTC_STAMP_SECOND(time);
+    t.TimeFormat     = RTC_HOURFORMAT12_AM;
+    t.DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
+    t.StoreOperation = RTC_STOREOPERATION_RESET;
+
+    d.Year    = (uint8_t)(RTC_STAMP_YEAR(time) - 2000u);
+    d.Month   = (uint8_t)RTC_STAMP_MONTH(time);
+    d.Date    = (uint8_t)RTC_STAMP_DAY(time);
+    //2000-01-01 was a Saturday, RTC_WEEKDAY_MONDAY is 1
+    d.WeekDay = (uint8_t)((RtcStampSeconds(time) / RTC_DAY_S + 5u) % 7u + 1u);
+
+    if ((HAL_OK != HAL_RTC_SetDate(&s_Rtc, &d, RTC_FORMAT_BIN)) ||
+        (HAL_OK != HAL_RTC_SetTime(&s_Rtc, &t, RTC_FORMAT_BIN)))
+    {
+        return -1;
+    }
+
+    return 0;
+}//end RtcClockSet
+
+int16_t RtcClockStart(uint32_t period_s)
+{
+    uint32_t          primask = __get_PRIMASK();
+    HAL_StatusTypeDef status;
+
+    if ((0u == period_s) || (period_s - 1u > RTC_WUT_MAX))
+    {
+        return -1;
+    }
+
+    __disable_irq();
+    s_Pending = 0;
+    __set_PRIMASK(primask);
+
+    status = HAL_RTCEx_SetWakeUpTimer_IT(&s_Rtc, period_s - 1u, RTC_WAKEUPCLOCK_CK_SPRE_16BITS);
+
+    return (HAL_OK == status) ? 0 : -1;
+}//end RtcClockStart
+
+void RtcClockStop(void)
+{
+    (void)HAL_RTCEx_DeactivateWakeUpTimer(&s_Rtc);
+}//end RtcClockStop
+
+void RtcClockNow(RtcStamp_t *stamp)
+{
+    uint32_t        primask = __get_PRIMASK();
+    RTC_TimeTypeDef time;
+    RTC_DateTypeDef date;
+
+    //reading SSR locks TR and DR until DR is read; a read from the
+    //interrupt in between would unlock them under this one
+    __disable_irq();
+    (void)HAL_RTC_GetTime(&s_Rtc, &time, RTC_FORMAT_BIN);
+    (void)HAL_RTC_GetDate(&s_Rtc, &date, RTC_FORMAT_BIN);
+    __set_PRIMASK(primask);
+
+    stamp->time   = RTC_STAMP_PACK(date.Year, date.Month, date.Date,
+                                   time.Hours, time.Minutes, time.Seconds);
+    //SSR counts down from PREDIV_S to 0 through the second
+    stamp->subsec = (uint16_t)(((time.SecondFraction - time.SubSeconds) * RTC_STAMP_SUBSEC_HZ) /
+                               (time.SecondFraction + 1u));
+}//end RtcClockNow
+
+uint32_t RtcClockTake(RtcStamp_t *stamp)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t pending;
+
+    __disable_irq();
+    pending = s_Pending;
+    if (0u != pending)
+    {
+        *stamp    = s_Stamp;
+        s_Pending = 0;
+    }
+    __set_PRIMASK(primask);
+
+    return pending;
+}//end RtcClockTake
+
+uint32_t RtcClockIdleDue(void)
+{
+    return (0u != s_Pending) ? 0u : IDLE_NEVER;
+}//end RtcClockIdleDue
+
+uint32_t RtcStampSeconds(uint32_t time)
+{
+    uint32_t year = RTC_STAMP_YEAR(time) - 2000u;
+    //leap days before this year, 2000 being one
+    uint32_t days = year * 365u + (year + 3u) / 4u +
+                    DaysBefore(RTC_STAMP_MONTH(time), (0u == year % 4u) ? 1u : 0u) +
+                    RTC_STAMP_DAY(time) - 1u;
+
+    return days * RTC_DAY_S + RTC_STAMP_HOUR(time) * 3600u +
+           RTC_STAMP_MINUTE(time) * 60u + RTC_STAMP_SECOND(time);
+}//end RtcStampSeconds
+
+uint32_t RtcStampPack(uint32_t seconds)
+{
+    uint32_t days  = seconds / RTC_DAY_S;
+    uint32_t sod   = seconds % RTC_DAY_S;
+    uint32_t year  = 4u * (days / RTC_QUAD_DAYS);
+    uint32_t doy   = days % RTC_QUAD_DAYS;
+    uint32_t leap  = 1u;
+    uint32_t month = 12u;
+
+    //the leap year leads each 4 years up to 2099
+    if (doy >= 366u)
+    {
+        doy  -= 366u;
+        year += 1u + doy / 365u;
+        doy  %= 365u;
+        leap  = 0u;
+    }
+
+    while (DaysBefore(month, leap) > doy)
+    {
+        month--;
+    }
+
+    return RTC_STAMP_PACK(year, month, doy - DaysBefore(month, leap) + 1u,
+                          sod / 3600u, sod / 60u % 60u, sod % 60u);
+}//end RtcStampPack
+
+void RtcClockIrqHandler(void)
+{
+    //clears WUTF and EXTI line 22, then HAL_RTCEx_WakeUpTimerEventCallback()
+    HAL_RTCEx_WakeUpTimerIRQHandler(&s_Rtc);
+}//end RtcClockIrqHandler
+
+void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
+{
+    (void)hrtc;
+
+    RtcClockNow(&s_Stamp);
+    s_Pending++;
+}
+
+#ifndef HOST_BUILD
+void HAL_RTC_MspInit(RTC_HandleTypeDef* hrtc)
+{
+    if (hrtc->Instance == RTC)
+    {
+        //RTCSEL is set in init.c; the calendar registers are in the backup
+        //domain
+        HAL_PWR_EnableBkUpAccess();
+        __HAL_RCC_RTC_ENABLE();
+
+        //the wakeup timer is EXTI line 22, set up by
+        //HAL_RTCEx_SetWakeUpTimer_IT()
+        HAL_NVIC_SetPriority(RTC_WKUP_IRQn, 2, 0);
+        HAL_NVIC_EnableIRQ(RTC_WKUP_IRQn);
+    }
+}
+#endif
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint32_t DaysBefore(uint32_t month, uint32_t leap)
+{
+    return s_MonthDays[month - 1u] + ((month > 2u) ? leap : 0u);
+}//end DaysBefore
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
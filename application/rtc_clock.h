@@ -0,0 +1,147 @@
+//! @addtogroup RtcClock
+//! @{
+//
+//****************************************************************************
+//! @file rtc_clock.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the RTC sampling clock: calendar time stamps with subseconds
+//!        and the wakeup timer that paces acquisition
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef RTC_CLOCK_H
+#define RTC_CLOCK_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//
+//! Packed calendar time, FAT style with whole seconds:
+//! year - 2000 [31:26], month [25:22], day [21:17], hour [16:12],
+//! minute [11:6], second [5:0]. Packed stamps of the same century compare
+//! in time order as plain integers.
+//
+#define RTC_STAMP_PACK(y, mo, d, h, mi, s)                         \
+    (((uint32_t)(y) << 26) | ((uint32_t)(mo) << 22) |             \
+     ((uint32_t)(d) << 17) | ((uint32_t)(h) << 12) |              \
+     ((uint32_t)(mi) << 6) | (uint32_t)(s))
+
+#define RTC_STAMP_YEAR(t)     (2000u + ((t) >> 26))
+#define RTC_STAMP_MONTH(t)    (((t) >> 22) & 0x0Fu)
+#define RTC_STAMP_DAY(t)      (((t) >> 17) & 0x1Fu)
+#define RTC_STAMP_HOUR(t)     (((t) >> 12) & 0x1Fu)
+#define RTC_STAMP_MINUTE(t)   (((t) >> 6) & 0x3Fu)
+#define RTC_STAMP_SECOND(t)   ((t) & 0x3Fu)
+
+//Subsecond unit, independent of the synchronous prescaler
+#define RTC_STAMP_SUBSEC_HZ   65536u
+
+typedef struct
+{
+    uint32_t time;        //!< packed calendar time, see RTC_STAMP_PACK
+    uint16_t subsec;      //!< fraction of the second in 1/65536 s
+}RtcStamp_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Start the RTC on the prescalers of app_config.h. The calendar is
+//!        kept across resets in the backup domain; it is set to the
+//!        APP_RTC_EPOCH_ date only when it has never been set.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       0, or -1 if the RTC did not enter init mode
+//
+int16_t RtcClockInit(void);
+
+//
+//! @brief Set the calendar, the prescaler phase restarts at the new second
+//! @param[in]    time  Packed calendar time
+//! @param[out]   None
+//! @return       0, or -1 if the RTC did not enter init mode
+//
+int16_t RtcClockSet(uint32_t time);
+
+//
+//! @brief Wake up every period on ck_spre, the 1 Hz calendar clock, so each
+//!        wakeup falls on a second edge. Earlier wakeups not yet taken are
+//!        dropped.
+//! @param[in]    period_s  1 to 65536 s
+//! @param[out]   None
+//! @return       0, or -1 if the timer could not be written
+//
+int16_t RtcClockStart(uint32_t period_s);
+
+//
+//! @brief Stop the wakeup timer
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void RtcClockStop(void);
+
+//
+//! @brief Read the calendar now
+//! @param[in]    None
+//! @param[out]   stamp  Calendar time and subseconds
+//! @return       None
+//
+void RtcClockNow(RtcStamp_t *stamp);
+
+//
+//! @brief Take the wakeups that came since the last call
+//! @param[in]    None
+//! @param[out]   stamp  Calendar time the wakeup interrupt ran at
+//! @return       Wakeups that were due, 0 if none; more than 1 if the
+//!               caller fell behind, stamp is then the latest
+//
+uint32_t RtcClockTake(RtcStamp_t *stamp);
+
+//
+//! @brief Idle source, see IDLE_SOURCES
+//! @param[in]    None
+//! @param[out]   None
+//! @return       0 if a wakeup is waiting to be taken, else IDLE_NEVER
+//
+uint32_t RtcClockIdleDue(void);
+
+//
+//! @brief Seconds since 2000-01-01 00:00:00 of a packed time
+//! @param[in]    time  Packed calendar time
+//! @param[out]   None
+//! @return       Seconds
+//
+uint32_t RtcStampSeconds(uint32_t time);
+
+//
+//! @brief Packed time of seconds since 2000-01-01 00:00:00
+//! @param[in]    seconds  Seconds
+//! @param[out]   None
+//! @return       Packed calendar time
+//
+uint32_t RtcStampPack(uint32_t seconds);
+
+//
+//! @brief RTC wakeup interrupt, called from RTC_WKUP_IRQHandler()
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void RtcClockIrqHandler(void);
+
+#endif // RTC_CLOCK_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -0,0 +1,242 @@
+//! @addtogroup SampleSched
+//! @brief Adaptive reporting scheduler
+//! @{
+//!
+//****************************************************************************/
+//! @file sample_sched.c
+//! @brief Keeps the 1 Hz measurement cadence but varies how often samples
+//!        are reported and stored. Stable air is batched into summaries,
+//!        any change switches back to full rate output at once.
+//!
+//!        Processing is not decimated. The IAQ algorithm in the sensor
+//!        needs the measure command every second, and the change check
+//!        here is the only other per sample work, so skipping it would
+//!        only delay the switch back to full rate.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+//user defined header files
+#include "app_config.h"
+#include "sample_sched.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+typedef struct
+{
+    float mean;
+    float var;
+}RunningStat_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Update running mean/variance and check for a change
+//! @param[in]    stat   Running statistic
+//! @param[in]    x      New sample
+//! @param[in]    floor  Smallest deviation considered a change
+//! @param[out]   None
+//! @return       1 if x is a change, 0 otherwise
+//
+static uint8_t UpdateStat(RunningStat_t *stat, float x, float floor);
+
+//
+//! @brief Add a sample to the running summary
+//! @param[in]    tvoc_ppb    tVOC concentration
+//! @param[in]    co2_eq_ppm  CO2eq concentration
+//! @param[out]   None
+//! @return       None
+//
+static void Accumulate(uint16_t tvoc_ppb, uint16_t co2_eq_ppm);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static RunningStat_t s_Tvoc;
+static RunningStat_t s_Co2Eq;
+static uint8_t  s_Primed       = 0;
+static uint32_t s_QuietSamples = 0;
+
+static SampleSchedSummary_t s_Summary;
+static uint32_t s_TvocSum  = 0;
+static uint32_t s_Co2EqSum = 0;
+
+static SampleSchedStats_t s_Stats;
+
+APP_STATIC_ASSERT(sizeof(s_Tvoc) + sizeof(s_Co2Eq) + sizeof(s_Summary) +
+                  sizeof(s_Stats) + 16 <= APP_RAM_BUDGET_SCHED, sched_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void SampleSchedInit(void)
+{
+    SampleSchedSummary_t unused;
+
+    memset(&s_Stats, 0, sizeof(s_Stats));
+    s_Primed       = 0;
+    s_QuietSamples = 0;
+    SampleSchedTakeSummary(&unused);
+}//end SampleSchedInit
+
+uint8_t SampleSchedUpdate(uint16_t tvoc_ppb, uint16_t co2_eq_ppm)
+{
+    uint8_t action = 0;
+    uint8_t change = 0;
+
+    s_Stats.samples++;
+
+    if (0 == s_Primed)
+    {
+        s_Tvoc.mean  = tvoc_ppb;
+        s_Tvoc.var   = 0;
+        s_Co2Eq.mean = co2_eq_ppm;
+        s_Co2Eq.var  = 0;
+        s_Primed     = 1;
+        change       = 1;
+    }
+    else
+    {
+        change  = UpdateStat(&s_Tvoc, tvoc_ppb, SAMPLE_SCHED_TVOC_FLOOR_PPB);
+        change |= UpdateStat(&s_Co2Eq, co2_eq_ppm, SAMPLE_SCHED_CO2EQ_FLOOR_PPM);
+    }
+
+    if (change)
+    {
+        s_Stats.changes++;
+
+        //close the quiet period so the host sees what led up to the change
+        if (s_Summary.count > 0)
+        {
+            action |= SAMPLE_SCHED_SUMMARY;
+        }
+
+        s_QuietSamples = 0;
+    }
+    else
+    {
+        s_QuietSamples++;
+    }
+
+    if (s_QuietSamples < SAMPLE_SCHED_QUIET_AFTER)
+    {
+        action |= SAMPLE_SCHED_REPORT | SAMPLE_SCHED_STORE;
+    }
+    else
+    {
+        uint32_t quiet_index = s_QuietSamples - SAMPLE_SCHED_QUIET_AFTER + 1;
+
+        Accumulate(tvoc_ppb, co2_eq_ppm);
+
+        if (0 == (quiet_index % SAMPLE_SCHED_STORE_PERIOD))
+        {
+            action |= SAMPLE_SCHED_STORE;
+        }
+
+        if (s_Summary.count >= SAMPLE_SCHED_SUMMARY_PERIOD)
+        {
+            action |= SAMPLE_SCHED_SUMMARY;
+        }
+    }
+
+    if (action & SAMPLE_SCHED_REPORT)
+    {
+        s_Stats.reports++;
+    }
+
+    if (action & SAMPLE_SCHED_SUMMARY)
+    {
+        s_Stats.summaries++;
+    }
+
+    if (action & SAMPLE_SCHED_STORE)
+    {
+        s_Stats.stores++;
+    }
+
+    return action;
+}//end SampleSchedUpdate
+
+void SampleSchedTakeSummary(SampleSchedSummary_t *summary)
+{
+    if (s_Summary.count > 0)
+    {
+        s_Summary.tvoc_mean   = (uint16_t)(s_TvocSum / s_Summary.count);
+        s_Summary.co2_eq_mean = (uint16_t)(s_Co2EqSum / s_Summary.count);
+    }
+
+    *summary = s_Summary;
+
+    memset(&s_Summary, 0, sizeof(s_Summary));
+    s_Summary.tvoc_min   = 0xFFFF;
+    s_Summary.co2_eq_min = 0xFFFF;
+    s_TvocSum            = 0;
+    s_Co2EqSum           = 0;
+}//end SampleSchedTakeSummary
+
+const SampleSchedStats_t* SampleSchedGetStats(void)
+{
+    return &s_Stats;
+}//end SampleSchedGetStats
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint8_t UpdateStat(RunningStat_t *stat, float x, float floor)
+{
+    float diff      = x - stat->mean;
+    float diff_sq   = diff * diff;
+    float threshold = SAMPLE_SCHED_SIGMA_K * SAMPLE_SCHED_SIGMA_K * stat->var;
+
+    //check against the history before the sample is folded in
+    uint8_t change = (diff_sq > threshold) && (diff_sq > (floor * floor));
+
+    stat->mean += SAMPLE_SCHED_ALPHA * diff;
+    stat->var   = (1.0f - SAMPLE_SCHED_ALPHA) * (stat->var + SAMPLE_SCHED_ALPHA * diff_sq);
+
+    return change;
+}
+
+static void Accumulate(uint16_t tvoc_ppb, uint16_t co2_eq_ppm)
+{
+    s_Summary.count++;
+    s_TvocSum  += tvoc_ppb;
+    s_Co2EqSum += co2_eq_ppm;
+
+    if (tvoc_ppb < s_Summary.tvoc_min)
+    {
+        s_Summary.tvoc_min = tvoc_ppb;
+    }
+
+    if (tvoc_ppb > s_Summary.tvoc_max)
+    {
+        s_Summary.tvoc_max = tvoc_ppb;
+    }
+
+    if (co2_eq_ppm < s_Summary.co2_eq_min)
+    {
+        s_Summary.co2_eq_min = co2_eq_ppm;
+    }
+
+    if (co2_eq_ppm > s_Summary.co2_eq_max)
+    {
+        s_Summary.co2_eq_max = co2_eq_ppm;
+    }
+}
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,111 @@
+//! @addtogroup SampleSched
+//! @{
+//
+//****************************************************************************
+//! @file sample_sched.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the adaptive reporting scheduler
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef SAMPLE_SCHED_H
+#define SAMPLE_SCHED_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//The SGP30 IAQ algorithm needs one measurement per second, always
+#define SAMPLE_SCHED_PERIOD_MS        1000
+
+//Consecutive unchanged samples before reporting drops to summaries
+#define SAMPLE_SCHED_QUIET_AFTER      30
+//Summary report interval while quiet, in samples
+#define SAMPLE_SCHED_SUMMARY_PERIOD   60
+//Store/publish interval while quiet, in samples
+#define SAMPLE_SCHED_STORE_PERIOD     10
+
+//A sample is a change if it is more than K sigma and more than the floor
+//away from the running mean
+#define SAMPLE_SCHED_SIGMA_K          3.0f
+#define SAMPLE_SCHED_TVOC_FLOOR_PPB   10.0f
+#define SAMPLE_SCHED_CO2EQ_FLOOR_PPM  20.0f
+//Running mean/variance smoothing
+#define SAMPLE_SCHED_ALPHA            (1.0f / 16.0f)
+
+//What SgpPollStep() should do with the current sample
+#define SAMPLE_SCHED_REPORT           0x01    //print the sample
+#define SAMPLE_SCHED_SUMMARY          0x02    //print the quiet period summary
+#define SAMPLE_SCHED_STORE            0x04    //publish/store the sample
+
+typedef struct
+{
+    uint32_t count;
+    uint16_t tvoc_min;
+    uint16_t tvoc_max;
+    uint16_t tvoc_mean;
+    uint16_t co2_eq_min;
+    uint16_t co2_eq_max;
+    uint16_t co2_eq_mean;
+}SampleSchedSummary_t;
+
+typedef struct
+{
+    uint32_t samples;
+    uint32_t reports;
+    uint32_t summaries;
+    uint32_t stores;
+    uint32_t changes;
+}SampleSchedStats_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Reset scheduler to full rate
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void SampleSchedInit(void);
+
+//
+//! @brief Feed one 1 Hz sample and decide what to do with it
+//! @param[in]    tvoc_ppb    tVOC concentration
+//! @param[in]    co2_eq_ppm  CO2eq concentration
+//! @param[out]   None
+//! @return       SAMPLE_SCHED_xxx flags
+//
+uint8_t SampleSchedUpdate(uint16_t tvoc_ppb, uint16_t co2_eq_ppm);
+
+//
+//! @brief Get the summary of the quiet period and start a new one. Valid
+//!        when SampleSchedUpdate() returned SAMPLE_SCHED_SUMMARY.
+//! @param[in]    None
+//! @param[out]   summary  Summary of samples not reported individually
+//! @return       None
+//
+void SampleSchedTakeSummary(SampleSchedSummary_t *summary);
+
+//
+//! @brief Get scheduler statistics
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Statistics since SampleSchedInit()
+//
+const SampleSchedStats_t* SampleSchedGetStats(void);
+
+#endif // SAMPLE_SCHED_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
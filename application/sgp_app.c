@@ -17,21 +17,47 @@
 #include <stdio.h>
 //user defined header files
 #include "stm32f4xx_hal.h"
+#include "app_config.h"
 #include "sgp_app.h"
 #include "sgp30.h"
 #include "sgp_git_version.h"
+#include "sensirion_crc8.h"
 #include "uart_app.h"
+#include "i2c_slave_app.h"
+#include "prof.h"
+#include "sample_sched.h"
+#include "kv_store.h"
+#include "idle.h"
+#include "rtc_clock.h"
+#include "event_log.h"
 
 //****************************************************************************/
 //                           Defines and typedefs
 //****************************************************************************/
-#define PRINT_BUF_LEN   256
+#define PRINT_BUF_LEN   APP_PRINT_BUF_LEN
+
+//SGP30 commands read back as whole CRC checked responses: the per sample
+//measurement and the info commands. The rest (init, baseline get/set) run
+//once or once an hour and stay in the driver.
+#define SGP30_I2C_ADDRESS                     0x58
+#define SGP30_CMD_IAQ_MEASURE                 0x2008
+#define SGP30_CMD_IAQ_MEASURE_DURATION_US     12000
+#define SGP30_CMD_IAQ_MEASURE_WORDS           2
+#define SGP30_CMD_GET_FEATURE_SET             0x202f
+#define SGP30_CMD_GET_FEATURE_SET_DURATION_US 10000
+#define SGP30_CMD_GET_FEATURE_SET_WORDS       1
+#define SGP30_CMD_GET_SERIAL_ID               0x3682
+#define SGP30_CMD_GET_SERIAL_ID_DURATION_US   500
+#define SGP30_CMD_GET_SERIAL_ID_WORDS         3
 
 //****************************************************************************/
 //                           Private Functions
 //****************************************************************************/
 static void SgpSelfTest(void);
 static void GetSgpInfo(void);
+static int16_t ReadSgpWords(uint16_t cmd, uint32_t duration_us,
+                            uint16_t* words, uint16_t num_words);
+static void SgpPrintIdle(void);
 
 //****************************************************************************/
 //                           external variables
@@ -42,6 +68,13 @@ const char *SGP_DRV_VERSION_STR = "7.0.0";
 //                           Private variables
 //****************************************************************************/
 static char msg[PRINT_BUF_LEN] = {0};
+static uint32_t s_PollCount     = 0;
+static uint32_t s_IaqBaseline   = 0;
+
+//longest message is the quiet period summary
+APP_STATIC_ASSERT(PRINT_BUF_LEN >= 128, sgp_print_buf_fits_summary);
+APP_STATIC_ASSERT(sizeof(msg) + sizeof(s_PollCount) + sizeof(s_IaqBaseline) <=
+                  APP_RAM_BUDGET_SGP_APP, sgp_app_ram_budget);
 
 
 //****************************************************************************/
@@ -71,6 +104,53 @@ void SgpInit(void)
 }//end Init
 
 void SgpPoll(void)
+{
+    SgpPollStart();
+
+#if APP_SAMPLE_CLOCK_RTC
+    RtcStamp_t stamp;
+    uint32_t   due;
+
+    //wakeups on calendar second edges, stamped in the interrupt
+    (void)RtcClockStart(SAMPLE_SCHED_PERIOD_MS / 1000u);
+
+    while (1)
+    {
+        //flash compaction while waiting, asleep for the rest; the wakeup
+        //interrupt ends the sleep, the deadline only bounds it
+        while (0u == (due = RtcClockTake(&stamp)))
+        {
+            KvStoreService();
+            (void)IdleUntil(HAL_GetTick() + SAMPLE_SCHED_PERIOD_MS);
+        }
+
+        if (due > 1u)
+        {
+            EventLogPut(EVENT_LOG_MISSED, EVENT_LOG_FLAG_WAKEUP, &stamp, (uint16_t)(due - 1u), 0);
+        }
+
+        SgpPollStepAt(&stamp, EVENT_LOG_FLAG_WAKEUP);
+    }
+#else
+    //deadline based so time spent in SgpPollStep() does not add drift
+    uint32_t deadline = HAL_GetTick();
+
+    while (1) 
+    {
+        SgpPollStep();
+
+        deadline += SAMPLE_SCHED_PERIOD_MS;
+
+        //flash compaction in the time left over, asleep for the rest
+        do
+        {
+            KvStoreService();
+        } while (IdleUntil(deadline));
+    }    
+#endif
+}//end SgpPoll
+
+void SgpPollStart(void)
 {
    // Consider the two cases (A) and (B):
     //(A) If no baseline is available or the most recent baseline is more than
@@ -91,46 +171,111 @@ void SgpPoll(void)
     }
     
     //(B) If a recent baseline is available, set it after sgp30_iaq_init() for
-    //faster start-up */
-    //IMPLEMENT: retrieve iaq_baseline from presistent storage;
-    //err = sgp30_set_iaq_baseline(iaq_baseline);
-
-    while (1) 
+    //faster start-up. Without a calendar clock the age of the stored
+    //baseline is not known, it is always used.
+    if (KV_OK == KvStoreRead(KV_KEY_SGP_BASELINE, &s_IaqBaseline,
+                             sizeof(s_IaqBaseline), NULL))
     {
-        uint16_t tvoc_ppb     = 0;
-        uint16_t co2_eq_ppm   = 0;
-        uint32_t iaq_baseline = 0;  
-        uint16_t count        = 0;
+        err = sgp30_set_iaq_baseline(s_IaqBaseline);
+        sprintf(msg, "sgp30 baseline 0x%08lx restored%s\r\n",
+                (unsigned long)s_IaqBaseline, (STATUS_OK == err) ? "" : " failed!");
+        UARTPrint(msg);
+    }
+
+    s_PollCount = 0;
+    SampleSchedInit();
+}//end SgpPollStart
+
+void SgpPollStep(void)
+{
+    RtcStamp_t now;
+
+    RtcClockNow(&now);
+    SgpPollStepAt(&now, 0u);
+}//end SgpPollStep
+
+void SgpPollStepAt(const RtcStamp_t *stamp, uint8_t flags)
+{
+    uint16_t words[SGP30_CMD_IAQ_MEASURE_WORDS] = {0};
     
-        err = sgp30_measure_iaq_blocking_read(&tvoc_ppb, &co2_eq_ppm);
-        
-        if (STATUS_OK == err) 
+    //same exchange as sgp30_measure_iaq_blocking_read(): CO2eq, then tVOC
+    PROF_BEGIN(measure_start);
+    int16_t err = ReadSgpWords(SGP30_CMD_IAQ_MEASURE,
+                               SGP30_CMD_IAQ_MEASURE_DURATION_US,
+                               words, SGP30_CMD_IAQ_MEASURE_WORDS);
+    PROF_END(PROF_STAGE_MEASURE, measure_start);
+
+    uint16_t co2_eq_ppm = words[0];
+    uint16_t tvoc_ppb   = words[1];
+    
+    if (STATUS_OK == err) 
+    {
+        EventLogPut(EVENT_LOG_SAMPLE, flags, stamp, tvoc_ppb, co2_eq_ppm);
+
+#if APP_FEATURE_ADAPTIVE_SCHED
+        uint8_t action = SampleSchedUpdate(tvoc_ppb, co2_eq_ppm);
+#else
+        uint8_t action = SAMPLE_SCHED_REPORT | SAMPLE_SCHED_STORE;
+#endif
+
+        PROF_BEGIN(report_start);
+
+        if (action & SAMPLE_SCHED_SUMMARY)
+        {
+            SampleSchedSummary_t summary;
+
+            SampleSchedTakeSummary(&summary);
+            sprintf(msg, "IAQ summary of %lu samples min/mean/max: "
+                    "tVOC %u/%u/%uppb CO2eq %u/%u/%uppm\r\n",
+                    (unsigned long)summary.count,
+                    summary.tvoc_min, summary.tvoc_mean, summary.tvoc_max,
+                    summary.co2_eq_min, summary.co2_eq_mean, summary.co2_eq_max);
+            UARTPrint(msg);
+            SgpPrintIdle();
+        }
+
+        if (action & SAMPLE_SCHED_REPORT)
         {
             sprintf(msg, "tVOC  Concentration: %dppb\r\n", tvoc_ppb);
             UARTPrint(msg);
             sprintf(msg, "CO2eq Concentration: %dppm\r\n", co2_eq_ppm);
             UARTPrint(msg);
-        } 
-        else 
+        }
+
+        PROF_END(PROF_STAGE_REPORT, report_start);
+
+        if (action & SAMPLE_SCHED_STORE)
         {
-            sprintf(msg, "error reading IAQ values\r\n");
-            UARTPrint(msg);
+#if APP_FEATURE_I2C_SLAVE
+            PROF_BEGIN(publish_start);
+            I2CSlavePublish(tvoc_ppb, co2_eq_ppm, s_IaqBaseline);
+            PROF_END(PROF_STAGE_PUBLISH, publish_start);
+#endif
         }
+    } 
+    else 
+    {
+        EventLogPut(EVENT_LOG_SENSOR_ERROR, flags, stamp, (uint16_t)err, 0);
+        sprintf(msg, "error reading IAQ values\r\n");
+        UARTPrint(msg);
+    }
 
-        // Persist the current baseline every hour
-        if ( (++count % 3600) == 3599) 
+    // Persist the current baseline every hour
+    if ( (++s_PollCount % 3600) == 3599) 
+    {
+        err = sgp30_get_iaq_baseline(&s_IaqBaseline);
+        
+        if (err == STATUS_OK) 
         {
-            err = sgp30_get_iaq_baseline(&iaq_baseline);
-            
-            if (err == STATUS_OK) 
+            if (KV_OK != KvStoreWrite(KV_KEY_SGP_BASELINE, &s_IaqBaseline,
+                                      sizeof(s_IaqBaseline)))
             {
-                // IMPLEMENT: store baseline to presistent storage
+                sprintf(msg, "storing baseline failed\r\n");
+                UARTPrint(msg);
             }
         }
-
-        HAL_Delay(1000);
-    }    
-}//end SgpPoll
+    }
+}//end SgpPollStepAt
 
 /******************************************************************************
  *                           L O C A L  F U N C T I O N S
@@ -166,13 +311,17 @@ static void SgpSelfTest(void)
 
 static void GetSgpInfo(void)
 {
-    uint16_t feature_set_version;
-    uint8_t product_type;
+    uint16_t words[SGP30_CMD_GET_SERIAL_ID_WORDS];
     
-    int16_t err = sgp30_get_feature_set_version(&feature_set_version, &product_type);
+    int16_t err = ReadSgpWords(SGP30_CMD_GET_FEATURE_SET,
+                               SGP30_CMD_GET_FEATURE_SET_DURATION_US,
+                               words, SGP30_CMD_GET_FEATURE_SET_WORDS);
     
     if (STATUS_OK == err) 
     {
+        uint16_t feature_set_version = words[0] & 0x00FF;
+        uint8_t product_type         = (uint8_t)((words[0] & 0xF000) >> 12);
+
         sprintf(msg, "Feature set version: %u\r\n", feature_set_version);
         UARTPrint(msg);
         sprintf(msg, "Product type: %u\r\n", product_type);
@@ -184,13 +333,13 @@ static void GetSgpInfo(void)
         UARTPrint(msg);
     }
     
-    uint64_t serial_id;
-    
-    err = sgp30_get_serial_id(&serial_id);
+    err = ReadSgpWords(SGP30_CMD_GET_SERIAL_ID,
+                       SGP30_CMD_GET_SERIAL_ID_DURATION_US,
+                       words, SGP30_CMD_GET_SERIAL_ID_WORDS);
     
     if (STATUS_OK == err)
     {
-        sprintf(msg, "SerialID: %u\r\n", serial_id);
+        sprintf(msg, "SerialID: 0x%04x%04x%04x\r\n", words[0], words[1], words[2]);
         UARTPrint(msg);
     } 
     else 
@@ -201,6 +350,37 @@ static void GetSgpInfo(void)
     
 }
 
+static int16_t ReadSgpWords(uint16_t cmd, uint32_t duration_us,
+                            uint16_t* words, uint16_t num_words)
+{
+    int16_t err = sensirion_i2c_write_cmd(SGP30_I2C_ADDRESS, cmd);
+
+    if (STATUS_OK != err)
+    {
+        return err;
+    }
+
+    sensirion_sleep_usec(duration_us);
+
+    //all words validated in one pass instead of per word in the common layer
+    return sensirion_i2c_read_words_checked(SGP30_I2C_ADDRESS, words, num_words);
+}
+
+static void SgpPrintIdle(void)
+{
+    IdleStats_t stats;
+    uint64_t    total;
+    uint32_t    permille;
+
+    IdleGetStats(&stats);
+    total    = stats.active + stats.idle;
+    permille = total ? (uint32_t)(stats.idle * 1000u / total) : 0u;
+
+    sprintf(msg, "CPU idle %lu.%lu%% (%lu sleeps)\r\n", (unsigned long)(permille / 10u),
+            (unsigned long)(permille % 10u), (unsigned long)stats.sleeps);
+    UARTPrint(msg);
+}//end SgpPrintIdle
+
 /******************************************************************************
  *                             End of file
  ******************************************************************************/
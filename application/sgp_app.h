@@ -15,6 +15,8 @@
 //****************************************************************************
 //                           Includes
 //****************************************************************************
+#include <stdint.h>
+#include "rtc_clock.h"
 
 //****************************************************************************
 //                           Constants and typedefs
@@ -36,13 +38,40 @@
 void SgpInit(void);
 
 //
-//! @brief Poll sgp
+//! @brief Poll sgp, paced by the RTC wakeup timer with APP_SAMPLE_CLOCK_RTC
+//!        or by a deadline on the HAL tick
 //! @param[in]    None
 //! @param[out]   None
 //! @return       None
 //
 void SgpPoll(void);
 
+//
+//! @brief Start IAQ measurement, called once before SgpPollStep()
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void SgpPollStart(void);
+
+//
+//! @brief Take and report one IAQ sample, called once per second. The
+//!        sample is logged with the RTC time it was taken at.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void SgpPollStep(void);
+
+//
+//! @brief As SgpPollStep(), for a sample that was due at the given time
+//! @param[in]    stamp  Time the sample was due
+//! @param[in]    flags  EVENT_LOG_FLAG_xxx for its log record
+//! @param[out]   None
+//! @return       None
+//
+void SgpPollStepAt(const RtcStamp_t *stamp, uint8_t flags);
+
 #endif // SGP_APP_H
 //****************************************************************************
 //                             End of file
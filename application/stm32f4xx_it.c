@@ -21,6 +21,15 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f4xx_it.h"
 #include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "uart_app.h"
+#include "timebase.h"
+#include "prof.h"
+#include "irq_dispatch.h"
+#include "rtc_clock.h"
+#if APP_I2C_BACKEND_LL
+#include "sensirion_ll_i2c.h"
+#endif
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 /* USER CODE END Includes */
@@ -56,7 +65,9 @@
 
 /* External variables --------------------------------------------------------*/
 /* USER CODE BEGIN EV */
-
+#if APP_FEATURE_I2C_SLAVE
+extern I2C_HandleTypeDef hi2c2;
+#endif
 /* USER CODE END EV */
 
 /******************************************************************************/
@@ -184,8 +195,20 @@ void PendSV_Handler(void)
   */
 void SysTick_Handler(void)
 {
-    HAL_IncTick();
+#if !APP_TIMEBASE_TIM5
+    TimebaseIrqHandler();
+#endif
+}
+
+#if APP_TIMEBASE_TIM5
+/**
+  * @brief This function handles TIM5 global interrupt, the HAL timebase.
+  */
+void TIM5_IRQHandler(void)
+{
+    TimebaseIrqHandler();
 }
+#endif
 
 /******************************************************************************/
 /* STM32F4xx Peripheral Interrupt Handlers                                    */
@@ -194,6 +217,74 @@ void SysTick_Handler(void)
 /* please refer to the startup file (startup_stm32f4xx.s).                    */
 /******************************************************************************/
 
+#if APP_IRQ_DIRECT
+//USART2 and DMA1 stream 5, see irq_dispatch.h
+IRQ_USART_ROUTES(IRQ_USART_VECTOR)
+IRQ_DMA_ROUTES(IRQ_DMA_VECTOR)
+#else
+/**
+  * @brief This function handles USART2 global interrupt.
+  */
+void USART2_IRQHandler(void)
+{
+    PROF_IRQ_ENTRY();
+    UARTRxIrqHandler();
+}
+
+/**
+  * @brief This function handles DMA1 stream5 global interrupt.
+  */
+void DMA1_Stream5_IRQHandler(void)
+{
+    PROF_IRQ_ENTRY();
+    UARTRxDmaIrqHandler();
+}
+#endif
+
+#if APP_I2C_BACKEND_LL
+/**
+  * @brief This function handles I2C1 event interrupt.
+  */
+void I2C1_EV_IRQHandler(void)
+{
+    sensirion_ll_i2c_ev_irq();
+}
+
+/**
+  * @brief This function handles I2C1 error interrupt.
+  */
+void I2C1_ER_IRQHandler(void)
+{
+    sensirion_ll_i2c_er_irq();
+}
+#endif
+
+/**
+  * @brief This function handles RTC wakeup interrupt through EXTI line 22.
+  */
+void RTC_WKUP_IRQHandler(void)
+{
+    RtcClockIrqHandler();
+}
+
+#if APP_FEATURE_I2C_SLAVE
+/**
+  * @brief This function handles I2C2 event interrupt.
+  */
+void I2C2_EV_IRQHandler(void)
+{
+    HAL_I2C_EV_IRQHandler(&hi2c2);
+}
+
+/**
+  * @brief This function handles I2C2 error interrupt.
+  */
+void I2C2_ER_IRQHandler(void)
+{
+    HAL_I2C_ER_IRQHandler(&hi2c2);
+}
+#endif
+
 /* USER CODE BEGIN 1 */
 
 /* USER CODE END 1 */
@@ -0,0 +1,313 @@
+//! @addtogroup Timebase
+//! @brief Microsecond HAL timebase
+//! @{
+//!
+//****************************************************************************/
+//! @file timebase.c
+//! @brief HAL timebase on the free running 32-bit TIM5 counting at 1 MHz,
+//!        after stm32f4xx_hal_timebase_tim_template.c. Replaces the SysTick
+//!        implementations of HAL_InitTick, HAL_GetTick, HAL_Delay and
+//!        HAL_Suspend/ResumeTick.
+//!
+//!        HAL_GetTick() keeps its millisecond unit because every HAL driver
+//!        timeout is given in ms; it is now derived from the us counter.
+//!        TimebaseMicros() gives the us time, HAL_Delay() and
+//!        TimebaseDelayUs() wait to the us.
+//!
+//!        APP_TIMEBASE_TICKLESS 0: CC1 still interrupts every 1 ms and calls
+//!        HAL_IncTick(), for code that expects a periodic wakeup.
+//!        APP_TIMEBASE_TICKLESS 1: the only interrupts are the counter
+//!        overflow every 71.6 minutes and the CC1 wakeup IdleSleep() arms
+//!        at the end of a delay long enough to sleep through.
+//!
+//!        The interrupt rates follow from the configuration: 1000 per s
+//!        with the periodic tick, none between sleeps tickless. The
+//!        tick_isr cycles per interrupt and the wakeup latency added to a
+//!        sleeping delay are unmeasured; read them from the tick_isr stage
+//!        and TimebaseIrqCount() on the board.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "timebase.h"
+#include "idle.h"
+#include "prof.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define TIMEBASE_HZ            1000000u
+#define TIMEBASE_TICK_US       1000u
+//Below this a delay spins, the wakeup would cost more than it saves
+#define TIMEBASE_SLEEP_MIN_US  50u
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+//stm32f4xx_hal.c, read back by HAL_GetTickPrio()
+extern uint32_t uwTickPrio;
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static uint32_t s_IrqCount;
+
+#if APP_TIMEBASE_TIM5
+static TIM_HandleTypeDef htim5;
+//us elapsed before the last HAL_InitTick(), which restarts the counter
+static uint64_t          s_Base;
+static volatile uint32_t s_Overflows;
+
+APP_STATIC_ASSERT(sizeof(htim5) + sizeof(s_Base) + 8u <= APP_RAM_BUDGET_TIMEBASE,
+                  timebase_ram_budget);
+#endif
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+#if APP_TIMEBASE_TIM5
+/**
+  * @brief  Configure TIM5 as a free running 1 MHz time base. Called by
+  *         HAL_Init() and again by HAL_RCC_ClockConfig() after the clock
+  *         changed; the time carries on across the restart.
+  * @param  TickPriority Tick interrupt priority.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
+{
+    RCC_ClkInitTypeDef clkconfig;
+    uint32_t           uwTimclock;
+    uint32_t           pFLatency;
+
+    if (NULL != htim5.Instance)
+    {
+        s_Base      = TimebaseMicros64();
+        s_Overflows = 0;
+        HAL_TIM_Base_Stop(&htim5);
+    }
+
+    HAL_NVIC_SetPriority(TIM5_IRQn, TickPriority, 0U);
+    HAL_NVIC_EnableIRQ(TIM5_IRQn);
+    __HAL_RCC_TIM5_CLK_ENABLE();
+
+    //APB1 timers run at twice PCLK1 when APB1 is divided
+    HAL_RCC_GetClockConfig(&clkconfig, &pFLatency);
+    uwTimclock = HAL_RCC_GetPCLK1Freq();
+    if (RCC_HCLK_DIV1 != clkconfig.APB1CLKDivider)
+    {
+        uwTimclock *= 2U;
+    }
+
+    htim5.Instance               = TIM5;
+    htim5.Init.Period            = 0xFFFFFFFFU;
+    htim5.Init.Prescaler         = (uwTimclock / TIMEBASE_HZ) - 1U;
+    htim5.Init.ClockDivision     = 0U;
+    htim5.Init.CounterMode       = TIM_COUNTERMODE_UP;
+    htim5.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    if (HAL_TIM_Base_Init(&htim5) != HAL_OK)
+    {
+        return HAL_ERROR;
+    }
+
+    //the init update event reloaded the prescaler, it is not an overflow
+    __HAL_TIM_CLEAR_FLAG(&htim5, TIM_FLAG_UPDATE | TIM_FLAG_CC1);
+    __HAL_TIM_ENABLE_IT(&htim5, TIM_IT_UPDATE);
+#if !APP_TIMEBASE_TICKLESS
+    htim5.Instance->CCR1 = TIMEBASE_TICK_US;
+    __HAL_TIM_ENABLE_IT(&htim5, TIM_IT_CC1);
+#endif
+
+    uwTickPrio = TickPriority;
+
+    return HAL_TIM_Base_Start(&htim5);
+}
+
+/**
+  * @brief  Milliseconds since boot, from the us counter
+  * @retval tick value
+  */
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(TimebaseMicros64() / TIMEBASE_TICK_US);
+}
+
+/**
+  * @brief  Wait Delay ms to the us, no extra tick added
+  * @param  Delay specifies the delay time length, in milliseconds.
+  * @retval None
+  */
+void HAL_Delay(uint32_t Delay)
+{
+    uint64_t end = TimebaseMicros64() + (uint64_t)Delay * TIMEBASE_TICK_US;
+
+    //split so each part fits TimebaseDelayUs()
+    while (end > TimebaseMicros64())
+    {
+        uint64_t left = end - TimebaseMicros64();
+
+        TimebaseDelayUs((left > 0x7FFFFFFFu) ? 0x7FFFFFFFu : (uint32_t)left);
+    }
+}
+
+/**
+  * @brief  Suspend the periodic tick, time keeps counting
+  * @retval None
+  */
+void HAL_SuspendTick(void)
+{
+    __HAL_TIM_DISABLE_IT(&htim5, TIM_IT_CC1);
+}
+
+/**
+  * @brief  Resume the periodic tick
+  * @retval None
+  */
+void HAL_ResumeTick(void)
+{
+#if !APP_TIMEBASE_TICKLESS
+    htim5.Instance->CCR1 = htim5.Instance->CNT + TIMEBASE_TICK_US;
+    __HAL_TIM_CLEAR_FLAG(&htim5, TIM_FLAG_CC1);
+    __HAL_TIM_ENABLE_IT(&htim5, TIM_IT_CC1);
+#endif
+}
+
+uint32_t TimebaseMicros(void)
+{
+    return (uint32_t)TimebaseMicros64();
+}//end TimebaseMicros
+
+uint64_t TimebaseMicros64(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t hi;
+    uint32_t lo;
+
+    __disable_irq();
+    hi = s_Overflows;
+    lo = htim5.Instance->CNT;
+    //wrapped, but the overflow interrupt has not run yet
+    if ((htim5.Instance->SR & TIM_SR_UIF) && (lo < 0x80000000u))
+    {
+        hi++;
+    }
+    __set_PRIMASK(primask);
+
+    return s_Base + (((uint64_t)hi << 32) | lo);
+}//end TimebaseMicros64
+
+void TimebaseDelayUs(uint32_t us)
+{
+    uint32_t start = htim5.Instance->CNT;
+
+    if (us >= TIMEBASE_SLEEP_MIN_US)
+    {
+        uint32_t elapsed;
+
+        //other interrupts end the sleep early, sleep again for the rest
+        while ((elapsed = htim5.Instance->CNT - start) < us)
+        {
+            IdleSleep(us - elapsed);
+        }
+        return;
+    }
+
+    while ((htim5.Instance->CNT - start) < us)
+    {
+    }
+}//end TimebaseDelayUs
+
+void TimebaseWakeAfter(uint32_t us)
+{
+    //one shot compare; the periodic tick owns CC1 when not tickless
+#if APP_TIMEBASE_TICKLESS
+    htim5.Instance->CCR1 = htim5.Instance->CNT + us;
+    __HAL_TIM_CLEAR_FLAG(&htim5, TIM_FLAG_CC1);
+    __HAL_TIM_ENABLE_IT(&htim5, TIM_IT_CC1);
+#else
+    (void)us;
+#endif
+}//end TimebaseWakeAfter
+
+void TimebaseIrqHandler(void)
+{
+    //flags handled directly: HAL_TIM_IRQHandler walks every channel and the
+    //break/trigger flags on each interrupt
+    PROF_BEGIN(start);
+    uint32_t sr = htim5.Instance->SR & htim5.Instance->DIER;
+
+    s_IrqCount++;
+
+    if (sr & TIM_SR_UIF)
+    {
+        __HAL_TIM_CLEAR_FLAG(&htim5, TIM_FLAG_UPDATE);
+        s_Overflows++;
+    }
+
+    if (sr & TIM_SR_CC1IF)
+    {
+        __HAL_TIM_CLEAR_FLAG(&htim5, TIM_FLAG_CC1);
+#if APP_TIMEBASE_TICKLESS
+        __HAL_TIM_DISABLE_IT(&htim5, TIM_IT_CC1);
+#else
+        htim5.Instance->CCR1 += TIMEBASE_TICK_US;
+        HAL_IncTick();
+#endif
+    }
+
+    PROF_END(PROF_STAGE_TICK_ISR, start);
+}//end TimebaseIrqHandler
+
+#else
+//SysTick timebase: ms resolution only
+
+uint32_t TimebaseMicros(void)
+{
+    return HAL_GetTick() * TIMEBASE_TICK_US;
+}//end TimebaseMicros
+
+uint64_t TimebaseMicros64(void)
+{
+    return (uint64_t)HAL_GetTick() * TIMEBASE_TICK_US;
+}//end TimebaseMicros64
+
+void TimebaseDelayUs(uint32_t us)
+{
+    HAL_Delay((us + TIMEBASE_TICK_US - 1u) / TIMEBASE_TICK_US);
+}//end TimebaseDelayUs
+
+void TimebaseWakeAfter(uint32_t us)
+{
+    //the 1 ms SysTick wakes the core
+    (void)us;
+}//end TimebaseWakeAfter
+
+void TimebaseIrqHandler(void)
+{
+    PROF_BEGIN(start);
+    s_IrqCount++;
+    HAL_IncTick();
+    PROF_END(PROF_STAGE_TICK_ISR, start);
+}//end TimebaseIrqHandler
+#endif
+
+uint32_t TimebaseIrqCount(void)
+{
+    return s_IrqCount;
+}//end TimebaseIrqCount
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
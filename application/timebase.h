@@ -0,0 +1,86 @@
+//! @addtogroup Timebase
+//! @{
+//
+//****************************************************************************
+//! @file timebase.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the microsecond HAL timebase on TIM5
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Microseconds since boot, wraps after 71.6 minutes
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Time in us
+//
+uint32_t TimebaseMicros(void);
+
+//
+//! @brief Microseconds since boot, never wraps
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Time in us
+//
+uint64_t TimebaseMicros64(void);
+
+//
+//! @brief Wait at least the given time, sleeping in WFI when it is long
+//!        enough to be worth a wakeup interrupt
+//! @param[in]    us  Time to wait in us
+//! @param[out]   None
+//! @return       None
+//
+void TimebaseDelayUs(uint32_t us);
+
+//
+//! @brief Arm a one shot wakeup, tickless timebase only: the periodic tick
+//!        wakes the core every 1 ms otherwise
+//! @param[in]    us  Time to the wakeup in us
+//! @param[out]   None
+//! @return       None
+//
+void TimebaseWakeAfter(uint32_t us);
+
+//
+//! @brief Number of timebase interrupts taken since boot, for measuring the
+//!        interrupt load of the tick
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Interrupt count
+//
+uint32_t TimebaseIrqCount(void);
+
+//
+//! @brief TIM5 interrupt, call from TIM5_IRQHandler
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void TimebaseIrqHandler(void);
+
+#endif // TIMEBASE_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
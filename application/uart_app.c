@@ -4,7 +4,9 @@
 //!
 //****************************************************************************/
 //! @file uart_app.c
-//! @brief UART app
+//! @brief UART app. Transmit is blocking; receive runs DMA in circular mode
+//!        into a ring and the IDLE line interrupt publishes what arrived, so
+//!        commands of any length are available without knowing it up front.
 //! @author Savindra Kumar(savindran1989@gmail.com)
 //! @bug No known bugs.
 //!
@@ -18,7 +20,9 @@
 #include <string.h>
 //user defined header files
 #include "stm32f4xx_hal.h"
+#include "app_config.h"
 #include "uart_app.h"
+#include "prof.h"
 
 
 
@@ -30,9 +34,39 @@
 #define USART_RX_Pin GPIO_PIN_3
 #define USART_RX_GPIO_Port GPIOA
 
+#define UART_RX_RING_LEN   APP_UART_RX_RING_LEN
+#define UART_RX_RING_MASK  (UART_RX_RING_LEN - 1u)
+
 //****************************************************************************/
 //                           Private Functions
 //****************************************************************************/
+//
+//! @brief Set up the RX DMA stream and start circular reception
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+static void RxStart(void);
+
+//
+//! @brief Advance the ring head to the DMA write position, interrupt
+//!        context or interrupts masked
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+static void RxUpdate(void);
+
+//
+//! @brief Split a ring range into at most two contiguous spans
+//! @param[in]    start   Absolute position of the first byte
+//! @param[in]    len     Number of bytes, at most UART_RX_RING_LEN
+//! @param[out]   first   Up to the ring end
+//! @param[out]   second  Wrapped rest
+//! @return       len
+//
+static uint16_t RxSpans(uint32_t start, uint32_t len, UARTRxSpan_t *first,
+                        UARTRxSpan_t *second);
 
 //****************************************************************************/
 //                           external variables
@@ -42,6 +76,21 @@
 //                           Private variables
 //****************************************************************************/
 static UART_HandleTypeDef huart2;
+static DMA_HandleTypeDef  hdma_usart2_rx;
+
+static uint8_t  s_RxRing[UART_RX_RING_LEN];
+//Absolute byte positions, the ring index is the low bits. Head is moved by
+//the interrupts, tail by the consumer and by the overrun handling.
+static volatile uint32_t s_RxHead;
+static volatile uint32_t s_RxTail;
+//Where UARTRxLine() stopped looking for '\n'
+static uint32_t s_RxScan;
+static uint16_t s_RxDmaPos;
+static volatile uint8_t s_RxDropped;
+static UARTRxStats_t s_RxStats;
+
+APP_STATIC_ASSERT(sizeof(huart2) + sizeof(hdma_usart2_rx) + sizeof(s_RxRing) +
+                  sizeof(s_RxStats) + 20u <= APP_RAM_BUDGET_UART, uart_ram_budget);
 
 //****************************************************************************/
 //                    G L O B A L  F U N C T I O N S
@@ -50,7 +99,7 @@ static UART_HandleTypeDef huart2;
 void UARTInit(void)
 {
   huart2.Instance = USART2;
-  huart2.Init.BaudRate = 115200;
+  huart2.Init.BaudRate = APP_UART_BAUDRATE;
   huart2.Init.WordLength = UART_WORDLENGTH_8B;
   huart2.Init.StopBits = UART_STOPBITS_1;
   huart2.Init.Parity = UART_PARITY_NONE;
@@ -62,6 +111,7 @@ void UARTInit(void)
     //Error_Handler();
   }
 
+  RxStart();
 }
 
 void UARTPrint(char *buf)
@@ -70,6 +120,169 @@ void UARTPrint(char *buf)
     memset(buf, 0, strlen(buf) );
 }
 
+uint16_t UARTRxPeek(UARTRxSpan_t *first, UARTRxSpan_t *second)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t tail;
+    uint32_t head;
+
+    __disable_irq();
+    //pick up bytes of a message still arriving
+    RxUpdate();
+    head        = s_RxHead;
+    tail        = s_RxTail;
+    s_RxDropped = 0;
+    __set_PRIMASK(primask);
+
+    return RxSpans(tail, head - tail, first, second);
+}//end UARTRxPeek
+
+uint16_t UARTRxLine(UARTRxSpan_t *first, UARTRxSpan_t *second)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t tail;
+    uint32_t head;
+    uint32_t scan;
+
+    __disable_irq();
+    RxUpdate();
+    head        = s_RxHead;
+    tail        = s_RxTail;
+    s_RxDropped = 0;
+    __set_PRIMASK(primask);
+
+    //bytes before tail were consumed or dropped, never rescan the rest
+    scan = ((int32_t)(s_RxScan - tail) > 0) ? s_RxScan : tail;
+
+    while (scan != head)
+    {
+        uint32_t idx   = scan & UART_RX_RING_MASK;
+        uint32_t chunk = head - scan;
+        const uint8_t *nl;
+
+        if (chunk > UART_RX_RING_LEN - idx)
+        {
+            chunk = UART_RX_RING_LEN - idx;
+        }
+
+        nl = memchr(&s_RxRing[idx], '\n', chunk);
+        if (NULL != nl)
+        {
+            uint32_t len = scan + (uint32_t)(nl - &s_RxRing[idx]) + 1u - tail;
+
+            s_RxScan = tail + len;
+
+            return RxSpans(tail, len, first, second);
+        }
+
+        scan += chunk;
+    }
+
+    s_RxScan = scan;
+
+    if (UART_RX_RING_LEN == head - tail)
+    {
+        return RxSpans(tail, UART_RX_RING_LEN, first, second);
+    }
+
+    return 0;
+}//end UARTRxLine
+
+int8_t UARTRxConsume(uint16_t len)
+{
+    uint32_t primask = __get_PRIMASK();
+    int8_t   ret     = 0;
+
+    __disable_irq();
+
+    if (s_RxDropped)
+    {
+        //tail already moved past the dropped bytes
+        ret = -1;
+    }
+    else if (len > s_RxHead - s_RxTail)
+    {
+        s_RxTail = s_RxHead;
+    }
+    else
+    {
+        s_RxTail += len;
+    }
+
+    __set_PRIMASK(primask);
+
+    return ret;
+}//end UARTRxConsume
+
+void UARTRxGetStats(UARTRxStats_t *stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *stats = s_RxStats;
+    __set_PRIMASK(primask);
+}//end UARTRxGetStats
+
+void UARTRxIrqHandler(void)
+{
+    uint32_t sr = huart2.Instance->SR;
+
+    if ((sr & USART_SR_IDLE) && (huart2.Instance->CR1 & USART_CR1_IDLEIE))
+    {
+        //SR read above then DR read clears IDLE and the ORE/NE/FE flags
+        (void)huart2.Instance->DR;
+
+        UARTRxIdleEvent(sr);
+    }
+
+    HAL_UART_IRQHandler(&huart2);
+}//end UARTRxIrqHandler
+
+void UARTRxIdleEvent(uint32_t sr)
+{
+    PROF_IRQ_HANDLER();
+
+    if (sr & (USART_SR_ORE | USART_SR_NE | USART_SR_FE))
+    {
+        s_RxStats.line_errors++;
+    }
+
+    s_RxStats.idle_events++;
+    RxUpdate();
+}//end UARTRxIdleEvent
+
+void UARTRxDmaIrqHandler(void)
+{
+    HAL_DMA_IRQHandler(&hdma_usart2_rx);
+}//end UARTRxDmaIrqHandler
+
+void UARTRxDmaEvent(uint32_t flags)
+{
+    //half and full transfer both only move the ring head
+    (void)flags;
+    PROF_IRQ_HANDLER();
+    RxUpdate();
+}//end UARTRxDmaEvent
+
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+    if (huart == &huart2)
+    {
+        PROF_IRQ_HANDLER();
+        RxUpdate();
+    }
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+    //circular mode, the DMA keeps running
+    if (huart == &huart2)
+    {
+        PROF_IRQ_HANDLER();
+        RxUpdate();
+    }
+}
+
 void HAL_MspInit(void)
 {
   __HAL_RCC_SYSCFG_CLK_ENABLE();
@@ -95,6 +308,13 @@ void HAL_UART_MspInit(UART_HandleTypeDef* huart)
     GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
     GPIO_InitStruct.Alternate = GPIO_AF7_USART2;
     HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+    //USART2_RX is DMA1 stream 5 channel 4
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+    HAL_NVIC_SetPriority(USART2_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(USART2_IRQn);
   }
 
 }
@@ -111,12 +331,89 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
     PA3     ------> USART2_RX 
     */
     HAL_GPIO_DeInit(GPIOA, USART_TX_Pin|USART_RX_Pin);
+
+    HAL_DMA_DeInit(huart->hdmarx);
+    HAL_NVIC_DisableIRQ(DMA1_Stream5_IRQn);
+    HAL_NVIC_DisableIRQ(USART2_IRQn);
   }
 }
 
 /******************************************************************************
  *                           L O C A L  F U N C T I O N S
  *****************************************************************************/
+static void RxStart(void)
+{
+    hdma_usart2_rx.Instance                 = DMA1_Stream5;
+    hdma_usart2_rx.Init.Channel             = DMA_CHANNEL_4;
+    hdma_usart2_rx.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+    hdma_usart2_rx.Init.PeriphInc           = DMA_PINC_DISABLE;
+    hdma_usart2_rx.Init.MemInc              = DMA_MINC_ENABLE;
+    hdma_usart2_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_usart2_rx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    hdma_usart2_rx.Init.Mode                = DMA_CIRCULAR;
+    hdma_usart2_rx.Init.Priority            = DMA_PRIORITY_HIGH;
+    hdma_usart2_rx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_usart2_rx) != HAL_OK)
+    {
+        return;
+    }
+    __HAL_LINKDMA(&huart2, hdmarx, hdma_usart2_rx);
+
+    s_RxHead    = 0;
+    s_RxTail    = 0;
+    s_RxScan    = 0;
+    s_RxDmaPos  = 0;
+    s_RxDropped = 0;
+    memset(&s_RxStats, 0, sizeof(s_RxStats));
+
+    HAL_UART_Receive_DMA(&huart2, s_RxRing, UART_RX_RING_LEN);
+
+    //The HAL treats any receive error as fatal in DMA mode and aborts the
+    //stream. Keep it running instead; errors are counted on IDLE.
+    __HAL_UART_DISABLE_IT(&huart2, UART_IT_PE);
+    __HAL_UART_DISABLE_IT(&huart2, UART_IT_ERR);
+    __HAL_UART_ENABLE_IT(&huart2, UART_IT_IDLE);
+}//end RxStart
+
+static void RxUpdate(void)
+{
+    //NDTR reloads to the full length on wrap, the mask folds that to 0
+    uint16_t pos   = (uint16_t)((UART_RX_RING_LEN -
+                                 __HAL_DMA_GET_COUNTER(&hdma_usart2_rx)) & UART_RX_RING_MASK);
+    uint32_t delta = (uint32_t)(pos - s_RxDmaPos) & UART_RX_RING_MASK;
+
+    s_RxDmaPos       = pos;
+    s_RxHead        += delta;
+    s_RxStats.bytes += delta;
+
+    if (s_RxHead - s_RxTail > UART_RX_RING_LEN)
+    {
+        //DMA lapped the consumer, what is left unread is unreliable
+        s_RxStats.overruns++;
+        s_RxStats.overrun_bytes += s_RxHead - s_RxTail;
+        s_RxTail    = s_RxHead;
+        s_RxDropped = 1;
+    }
+}//end RxUpdate
+
+static uint16_t RxSpans(uint32_t start, uint32_t len, UARTRxSpan_t *first,
+                        UARTRxSpan_t *second)
+{
+    uint32_t idx = start & UART_RX_RING_MASK;
+    uint32_t run = UART_RX_RING_LEN - idx;
+
+    if (run > len)
+    {
+        run = len;
+    }
+
+    first->data  = &s_RxRing[idx];
+    first->len   = (uint16_t)run;
+    second->data = s_RxRing;
+    second->len  = (uint16_t)(len - run);
+
+    return (uint16_t)len;
+}//end RxSpans
 
 /******************************************************************************
  *                             End of file
@@ -15,10 +15,31 @@
 //****************************************************************************
 //                           Includes
 //****************************************************************************
+#include <stdint.h>
 
 //****************************************************************************
 //                           Constants and typedefs
 //****************************************************************************
+//
+//! @brief View into the receive ring, valid until the bytes are consumed
+//
+typedef struct
+{
+    const uint8_t *data;
+    uint16_t       len;
+}UARTRxSpan_t;
+
+//
+//! @brief Receive counters since UARTInit()
+//
+typedef struct
+{
+    uint32_t bytes;          //!< bytes written to the ring by DMA
+    uint32_t idle_events;    //!< IDLE line interrupts
+    uint32_t overruns;       //!< times the ring lapped the consumer
+    uint32_t overrun_bytes;  //!< unread bytes dropped because of it
+    uint32_t line_errors;    //!< USART overrun, noise or framing errors
+}UARTRxStats_t;
 
 //****************************************************************************
 //                           Global variables
@@ -37,6 +58,78 @@ void UARTInit(void);
 
 void UARTPrint(char *buf); 
 
+//
+//! @brief Get the unread bytes as up to two spans, the second one is non
+//!        empty when the data wraps around the end of the ring
+//! @param[in]    None
+//! @param[out]   first   Bytes from the read position up to the ring end
+//! @param[out]   second  Rest of the bytes from the ring start
+//! @return       Total number of unread bytes
+//
+uint16_t UARTRxPeek(UARTRxSpan_t *first, UARTRxSpan_t *second);
+
+//
+//! @brief Get the oldest complete line, '\n' terminated, without copying.
+//!        A line that fills the whole ring is returned as is.
+//! @param[in]    None
+//! @param[out]   first   Start of the line
+//! @param[out]   second  Wrapped part of the line, len 0 if none
+//! @return       Line length including '\n', 0 if no complete line yet
+//
+uint16_t UARTRxLine(UARTRxSpan_t *first, UARTRxSpan_t *second);
+
+//
+//! @brief Release bytes returned by UARTRxPeek() or UARTRxLine()
+//! @param[in]    len  Number of bytes to release
+//! @param[out]   None
+//! @return       0, or -1 if the ring overran since the peek: the spans may
+//!               hold overwritten data and the unread bytes were dropped
+//
+int8_t UARTRxConsume(uint16_t len);
+
+//
+//! @brief Get receive counters
+//! @param[in]    None
+//! @param[out]   stats  Counters
+//! @return       None
+//
+void UARTRxGetStats(UARTRxStats_t *stats);
+
+//
+//! @brief USART2 interrupt, call from USART2_IRQHandler. Routed vectors
+//!        (irq_dispatch.h) call it for everything but a plain IDLE event.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void UARTRxIrqHandler(void);
+
+//
+//! @brief USART2 IDLE line event, IDLE already cleared by the caller
+//! @param[in]    sr  USART status register as read by the caller
+//! @param[out]   None
+//! @return       None
+//
+void UARTRxIdleEvent(uint32_t sr);
+
+//
+//! @brief USART2 RX DMA interrupt, call from DMA1_Stream5_IRQHandler.
+//!        Routed vectors call it only for error flags.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void UARTRxDmaIrqHandler(void);
+
+//
+//! @brief USART2 RX DMA half or full transfer event, flags already cleared
+//!        by the caller
+//! @param[in]    flags  IRQ_DMA_HT and/or IRQ_DMA_TC
+//! @param[out]   None
+//! @return       None
+//
+void UARTRxDmaEvent(uint32_t flags);
+
 #endif // SGP_APP_H
 //****************************************************************************
 //                             End of file
@@ -31,6 +31,289 @@
 
 #include "arm_math.h"
 
+/* Table selection
+ *
+ * By default every table below is compiled.  Defining ARM_DSP_CONFIG_TABLES
+ * for the whole build compiles only the tables that are selected, so that the
+ * FFT initialization functions, which reference every length they support,
+ * no longer pull all of them into flash.  A length that is not selected makes
+ * its initialization function return ARM_MATH_ARGUMENT_ERROR.
+ *
+ * Tables are selected per transform and length:
+ *   ARM_TABLES_CFFT_F32_<N>        arm_cfft_f32(),      N = 16 ... 4096
+ *   ARM_TABLES_CFFT_Q31_<N>        arm_cfft_q31(),      N = 16 ... 4096
+ *   ARM_TABLES_CFFT_Q15_<N>        arm_cfft_q15(),      N = 16 ... 4096
+ *   ARM_TABLES_RFFT_FAST_F32_<N>   arm_rfft_fast_f32(), N = 32 ... 4096
+ *   ARM_TABLES_RFFT_Q31_<N>        arm_rfft_q31(),      N = 32 ... 8192
+ *   ARM_TABLES_RFFT_Q15_<N>        arm_rfft_q15(),      N = 32 ... 8192
+ * or one by one with the ARM_TABLE_ macros tested below, and by group with
+ * ARM_ALL_FFT_TABLES and ARM_ALL_FAST_TABLES (sine and cosine of FastMath).
+ * The deprecated radix-2 and radix-4 transforms use ARM_TABLE_BITREV_1024 and
+ * the 4096 point twiddle table of their type.
+ *
+ * The declarations stay visible: a table that is used but not selected is
+ * reported by the linker under its own name.
+ */
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES)
+  #define ARM_TABLE_BITREV_1024 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_16 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_32 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_64 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_128 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_256 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_512 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_1024 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_2048 1
+  #define ARM_TABLE_TWIDDLECOEF_F32_4096 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_16 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_32 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_64 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_128 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_256 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_512 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_1024 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_2048 1
+  #define ARM_TABLE_TWIDDLECOEF_Q31_4096 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_16 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_32 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_64 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_128 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_256 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_512 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_1024 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_2048 1
+  #define ARM_TABLE_TWIDDLECOEF_Q15_4096 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_32 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_64 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_128 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_256 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_512 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096 1
+  #define ARM_TABLE_BITREVIDX_FLT_16 1
+  #define ARM_TABLE_BITREVIDX_FLT_32 1
+  #define ARM_TABLE_BITREVIDX_FLT_64 1
+  #define ARM_TABLE_BITREVIDX_FLT_128 1
+  #define ARM_TABLE_BITREVIDX_FLT_256 1
+  #define ARM_TABLE_BITREVIDX_FLT_512 1
+  #define ARM_TABLE_BITREVIDX_FLT_1024 1
+  #define ARM_TABLE_BITREVIDX_FLT_2048 1
+  #define ARM_TABLE_BITREVIDX_FLT_4096 1
+  #define ARM_TABLE_BITREVIDX_FXT_16 1
+  #define ARM_TABLE_BITREVIDX_FXT_32 1
+  #define ARM_TABLE_BITREVIDX_FXT_64 1
+  #define ARM_TABLE_BITREVIDX_FXT_128 1
+  #define ARM_TABLE_BITREVIDX_FXT_256 1
+  #define ARM_TABLE_BITREVIDX_FXT_512 1
+  #define ARM_TABLE_BITREVIDX_FXT_1024 1
+  #define ARM_TABLE_BITREVIDX_FXT_2048 1
+  #define ARM_TABLE_BITREVIDX_FXT_4096 1
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FAST_TABLES)
+  #define ARM_TABLE_SIN_F32 1
+  #define ARM_TABLE_SIN_Q31 1
+  #define ARM_TABLE_SIN_Q15 1
+#endif
+
+/* The real transforms run a complex transform of half their length */
+#if defined(ARM_TABLES_RFFT_FAST_F32_32)
+  #define ARM_TABLES_CFFT_F32_16 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_32 1
+#endif
+#if defined(ARM_TABLES_RFFT_FAST_F32_64)
+  #define ARM_TABLES_CFFT_F32_32 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_64 1
+#endif
+#if defined(ARM_TABLES_RFFT_FAST_F32_128)
+  #define ARM_TABLES_CFFT_F32_64 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_128 1
+#endif
+#if defined(ARM_TABLES_RFFT_FAST_F32_256)
+  #define ARM_TABLES_CFFT_F32_128 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_256 1
+#endif
+#if defined(ARM_TABLES_RFFT_FAST_F32_512)
+  #define ARM_TABLES_CFFT_F32_256 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_512 1
+#endif
+#if defined(ARM_TABLES_RFFT_FAST_F32_1024)
+  #define ARM_TABLES_CFFT_F32_512 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024 1
+#endif
+#if defined(ARM_TABLES_RFFT_FAST_F32_2048)
+  #define ARM_TABLES_CFFT_F32_1024 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048 1
+#endif
+#if defined(ARM_TABLES_RFFT_FAST_F32_4096)
+  #define ARM_TABLES_CFFT_F32_2048 1
+  #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_32)
+  #define ARM_TABLES_CFFT_Q31_16 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_64)
+  #define ARM_TABLES_CFFT_Q31_32 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_128)
+  #define ARM_TABLES_CFFT_Q31_64 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_256)
+  #define ARM_TABLES_CFFT_Q31_128 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_512)
+  #define ARM_TABLES_CFFT_Q31_256 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_1024)
+  #define ARM_TABLES_CFFT_Q31_512 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_2048)
+  #define ARM_TABLES_CFFT_Q31_1024 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_4096)
+  #define ARM_TABLES_CFFT_Q31_2048 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q31_8192)
+  #define ARM_TABLES_CFFT_Q31_4096 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_32)
+  #define ARM_TABLES_CFFT_Q15_16 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_64)
+  #define ARM_TABLES_CFFT_Q15_32 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_128)
+  #define ARM_TABLES_CFFT_Q15_64 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_256)
+  #define ARM_TABLES_CFFT_Q15_128 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_512)
+  #define ARM_TABLES_CFFT_Q15_256 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_1024)
+  #define ARM_TABLES_CFFT_Q15_512 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_2048)
+  #define ARM_TABLES_CFFT_Q15_1024 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_4096)
+  #define ARM_TABLES_CFFT_Q15_2048 1
+#endif
+#if defined(ARM_TABLES_RFFT_Q15_8192)
+  #define ARM_TABLES_CFFT_Q15_4096 1
+#endif
+
+#if defined(ARM_TABLES_CFFT_F32_16)
+  #define ARM_TABLE_TWIDDLECOEF_F32_16 1
+  #define ARM_TABLE_BITREVIDX_FLT_16 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_32)
+  #define ARM_TABLE_TWIDDLECOEF_F32_32 1
+  #define ARM_TABLE_BITREVIDX_FLT_32 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_64)
+  #define ARM_TABLE_TWIDDLECOEF_F32_64 1
+  #define ARM_TABLE_BITREVIDX_FLT_64 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_128)
+  #define ARM_TABLE_TWIDDLECOEF_F32_128 1
+  #define ARM_TABLE_BITREVIDX_FLT_128 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_256)
+  #define ARM_TABLE_TWIDDLECOEF_F32_256 1
+  #define ARM_TABLE_BITREVIDX_FLT_256 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_512)
+  #define ARM_TABLE_TWIDDLECOEF_F32_512 1
+  #define ARM_TABLE_BITREVIDX_FLT_512 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_1024)
+  #define ARM_TABLE_TWIDDLECOEF_F32_1024 1
+  #define ARM_TABLE_BITREVIDX_FLT_1024 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_2048)
+  #define ARM_TABLE_TWIDDLECOEF_F32_2048 1
+  #define ARM_TABLE_BITREVIDX_FLT_2048 1
+#endif
+#if defined(ARM_TABLES_CFFT_F32_4096)
+  #define ARM_TABLE_TWIDDLECOEF_F32_4096 1
+  #define ARM_TABLE_BITREVIDX_FLT_4096 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_16)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_16 1
+  #define ARM_TABLE_BITREVIDX_FXT_16 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_32)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_32 1
+  #define ARM_TABLE_BITREVIDX_FXT_32 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_64)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_64 1
+  #define ARM_TABLE_BITREVIDX_FXT_64 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_128)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_128 1
+  #define ARM_TABLE_BITREVIDX_FXT_128 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_256)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_256 1
+  #define ARM_TABLE_BITREVIDX_FXT_256 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_512)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_512 1
+  #define ARM_TABLE_BITREVIDX_FXT_512 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_1024)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_1024 1
+  #define ARM_TABLE_BITREVIDX_FXT_1024 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_2048)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_2048 1
+  #define ARM_TABLE_BITREVIDX_FXT_2048 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q31_4096)
+  #define ARM_TABLE_TWIDDLECOEF_Q31_4096 1
+  #define ARM_TABLE_BITREVIDX_FXT_4096 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_16)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_16 1
+  #define ARM_TABLE_BITREVIDX_FXT_16 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_32)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_32 1
+  #define ARM_TABLE_BITREVIDX_FXT_32 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_64)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_64 1
+  #define ARM_TABLE_BITREVIDX_FXT_64 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_128)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_128 1
+  #define ARM_TABLE_BITREVIDX_FXT_128 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_256)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_256 1
+  #define ARM_TABLE_BITREVIDX_FXT_256 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_512)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_512 1
+  #define ARM_TABLE_BITREVIDX_FXT_512 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_1024)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_1024 1
+  #define ARM_TABLE_BITREVIDX_FXT_1024 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_2048)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_2048 1
+  #define ARM_TABLE_BITREVIDX_FXT_2048 1
+#endif
+#if defined(ARM_TABLES_CFFT_Q15_4096)
+  #define ARM_TABLE_TWIDDLECOEF_Q15_4096 1
+  #define ARM_TABLE_BITREVIDX_FXT_4096 1
+#endif
+
 extern const uint16_t armBitRevTable[1024];
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
@@ -126,6 +126,11 @@
    * and ARM_MATH_CM0 for building library on Cortex-M0 target, ARM_MATH_CM0PLUS for building library on Cortex-M0+ target, and
    * ARM_MATH_CM7 for building the library on cortex-M7.
    *
+   * - ARM_MATH_HOST:
+   *
+   * Define macro ARM_MATH_HOST for building the library with GCC or Clang on a general purpose machine, see arm_math_host.h.
+   * The portable C paths are used, written so the compiler can vectorize them.
+   *
    * - ARM_MATH_ARMV8MxL:
    *
    * Define macro ARM_MATH_ARMV8MBL for building the library on Armv8-M Baseline target, ARM_MATH_ARMV8MML for building library
@@ -337,8 +342,11 @@
   #if (defined (__DSP_PRESENT) && (__DSP_PRESENT == 1))
     #define ARM_MATH_DSP
   #endif
+#elif defined (ARM_MATH_HOST)
+  #include "arm_math_host.h"
+  #define ARM_MATH_CM0_FAMILY
 #else
-  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS, ARM_MATH_CM0, ARM_MATH_ARMV8MBL, ARM_MATH_ARMV8MML"
+  #error "Define according the used Cortex core ARM_MATH_CM7, ARM_MATH_CM4, ARM_MATH_CM3, ARM_MATH_CM0PLUS, ARM_MATH_CM0, ARM_MATH_ARMV8MBL, ARM_MATH_ARMV8MML, or ARM_MATH_HOST"
 #endif
 
 #undef  __CMSIS_GENERIC         /* enable NVIC and Systick functions */
@@ -440,7 +448,10 @@ extern "C"
   /**
    * @brief definition to read/write two 16 bit values.
    */
-#if   defined ( __CC_ARM )
+#if   defined ( ARM_MATH_HOST )
+  /* __SIMD32_TYPE, __SIMD32, __SIMD64, CMSIS_UNUSED and CMSIS_INLINE from arm_math_host.h */
+
+#elif defined ( __CC_ARM )
   #define __SIMD32_TYPE int32_t __packed
   #define CMSIS_UNUSED __attribute__((unused))
   #define CMSIS_INLINE __attribute__((always_inline))
@@ -479,10 +490,12 @@ extern "C"
   #error Unknown compiler
 #endif
 
+#if !defined ( ARM_MATH_HOST )
 #define __SIMD32(addr)        (*(__SIMD32_TYPE **) & (addr))
+#define __SIMD64(addr)        (*(int64_t **) & (addr))
+#endif
 #define __SIMD32_CONST(addr)  ((__SIMD32_TYPE *)(addr))
 #define _SIMD32_OFFSET(addr)  (*(__SIMD32_TYPE *)  (addr))
-#define __SIMD64(addr)        (*(int64_t **) & (addr))
 
 #if !defined (ARM_MATH_DSP)
   /**
@@ -1195,6 +1208,166 @@ extern "C"
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q7 FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;          /**< ring position of the next input sample. */
+    q7_t *pState;                 /**< points to the state variable array, two copies of the ring. The array is of length 2*numTaps. */
+    q7_t *pCoeffs;                /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q7;
+
+
+  /**
+   * @brief Instance structure for the Q15 FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;          /**< ring position of the next input sample. */
+    q15_t *pState;                /**< points to the state variable array, two copies of the ring. The array is of length 2*numTaps. */
+    q15_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q15;
+
+
+  /**
+   * @brief Instance structure for the Q31 FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;          /**< ring position of the next input sample. */
+    q31_t *pState;                /**< points to the state variable array, two copies of the ring. The array is of length 2*numTaps. */
+    q31_t *pCoeffs;               /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q31;
+
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with circular state.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    uint16_t stateIndex;          /**< ring position of the next input sample. */
+    float32_t *pState;            /**< points to the state variable array, two copies of the ring. The array is of length 2*numTaps. */
+    float32_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q7 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q7 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q7(
+  arm_fir_circ_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q7 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q7 circular state FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of 2*numTaps samples.
+   */
+  void arm_fir_circ_init_q7(
+  arm_fir_circ_instance_q7 * S,
+  uint16_t numTaps,
+  q7_t * pCoeffs,
+  q7_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q15(
+  arm_fir_circ_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 circular state FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of 2*numTaps samples.
+   */
+  void arm_fir_circ_init_q15(
+  arm_fir_circ_instance_q15 * S,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q31(
+  arm_fir_circ_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 circular state FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of 2*numTaps samples.
+   */
+  void arm_fir_circ_init_q31(
+  arm_fir_circ_instance_q31 * S,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point circular state FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_f32(
+  arm_fir_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point circular state FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer of 2*numTaps samples.
+   */
+  void arm_fir_circ_init_f32(
+  arm_fir_circ_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -2116,6 +2289,20 @@ void arm_cfft_q31(
     uint8_t ifftFlag,
     uint8_t bitReverseFlag);
 
+void arm_cfft_bfp_q15(
+    const arm_cfft_instance_q15 * S,
+    q15_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int8_t * pBlockExp);
+
+void arm_cfft_bfp_q31(
+    const arm_cfft_instance_q31 * S,
+    q31_t * p1,
+    uint8_t ifftFlag,
+    uint8_t bitReverseFlag,
+    int8_t * pBlockExp);
+
   /**
    * @brief Instance structure for the floating-point CFFT/CIFFT function.
    */
@@ -2133,6 +2320,11 @@ void arm_cfft_q31(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  arm_status arm_cfft_init_ram_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2183,6 +2375,18 @@ void arm_cfft_q31(
   q31_t * pSrc,
   q31_t * pDst);
 
+  void arm_rfft_bfp_q15(
+  const arm_rfft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  int8_t * pBlockExp);
+
+  void arm_rfft_bfp_q31(
+  const arm_rfft_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  int8_t * pBlockExp);
+
   /**
    * @brief Instance structure for the floating-point RFFT/RIFFT function.
    */
@@ -2229,6 +2433,183 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+arm_status arm_rfft_fast_init_ram_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle);
+
+  /**
+   * @brief Largest number of stages of the mixed radix FFT, enough for any 16-bit length.
+   */
+#define ARM_CFFT_MR_MAX_STAGES 16U
+
+  /**
+   * @brief Instance structure for the mixed radix floating-point CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+    uint16_t fftLen;                     /**< length of the FFT. */
+    uint16_t numStages;                  /**< number of radix stages. */
+    uint16_t twidCoefModifier;           /**< twiddle coefficient modifier, 2 inside the real FFT which shares its table. */
+    uint8_t radix[ARM_CFFT_MR_MAX_STAGES]; /**< radix of each stage, 4, 2, 3 or 5. */
+    const float32_t *pTwiddle;           /**< points to the twiddle factor table of 2*fftLen values. */
+  } arm_cfft_mr_instance_f32;
+
+arm_status arm_cfft_mr_init_f32(
+  arm_cfft_mr_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle);
+
+void arm_cfft_mr_f32(
+  const arm_cfft_mr_instance_f32 * S,
+  float32_t * p1,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the mixed radix floating-point RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+    arm_cfft_mr_instance_f32 Sint;       /**< Internal CFFT structure of fftLenRFFT/2 points. */
+    uint16_t fftLenRFFT;                 /**< length of the real sequence. */
+    const float32_t *pTwiddleRFFT;       /**< Twiddle factors of fftLenRFFT points, 2*fftLenRFFT values. */
+  } arm_rfft_mr_instance_f32;
+
+arm_status arm_rfft_mr_init_f32(
+  arm_rfft_mr_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle);
+
+void arm_rfft_mr_f32(
+  const arm_rfft_mr_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint8_t ifftFlag);
+
+  /**
+   * @brief Length, in floating-point values, of the state buffer of the floating-point sliding DFT.
+   */
+#define ARM_SDFT_STATE_LEN_F32(winLen, numBins)   ((uint32_t) (winLen) + (4U * (uint32_t) (numBins)))
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t winLen;                     /**< length of the sliding window. */
+    uint16_t numBins;                    /**< number of DFT bins. */
+    uint16_t pos;                        /**< delay line index of the oldest sample. */
+    const uint16_t *pBins;               /**< points to the bin indices, 0 to winLen-1. */
+    const float32_t *pTwiddle;           /**< points to the twiddle factors of winLen points, 2*winLen values. */
+    float32_t *pState;                   /**< points to the delay line of winLen samples, then the running and restarted sums of 2*numBins values each. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t winLen;                     /**< length of the sliding window. */
+    uint16_t numBins;                    /**< number of DFT bins. */
+    uint16_t pos;                        /**< delay line index of the oldest sample. */
+    uint8_t winShift;                    /**< output scaling, the bins are divided by 2^winShift. */
+    const uint16_t *pBins;               /**< points to the bin indices, 0 to winLen-1. */
+    const q31_t *pTwiddle;               /**< points to the twiddle factors of winLen points, 2*winLen values. */
+    q31_t *pState;                       /**< points to the delay line of winLen samples. */
+    q63_t *pSums;                        /**< points to the running sums, 2*numBins values. */
+  } arm_sdft_instance_q31;
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t winLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t * pTwiddle,
+  float32_t * pState);
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t winLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  q31_t * pTwiddle,
+  q31_t * pState,
+  q63_t * pSums);
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
+  /**
+   * @brief Lengths of the coefficient buffers of the Goertzel filter banks, per bin.
+   */
+#define ARM_GOERTZEL_COEFFS_LEN_F32(numBins)     (6U * (uint32_t) (numBins))
+#define ARM_GOERTZEL_COEFFS_LEN_Q31(numBins)     (7U * (uint32_t) (numBins))
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t blockLen;                   /**< number of samples per result. */
+    uint16_t numBins;                    /**< number of frequencies. */
+    uint16_t count;                      /**< samples of the current block filtered so far. */
+    const float32_t *pCoeffs;            /**< points to the coefficients, 6 per frequency. */
+    float32_t *pState;                   /**< points to the state buffer, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+    uint16_t blockLen;                   /**< number of samples per result. */
+    uint16_t numBins;                    /**< number of frequencies. */
+    uint16_t count;                      /**< samples of the current block filtered so far. */
+    uint8_t inShift;                     /**< left shift of the input into the 64-bit state. */
+    uint8_t outShift;                    /**< output scaling, the results are divided by 2^outShift. */
+    const q31_t *pCoeffs;                /**< points to the coefficients, 7 per frequency. */
+    q63_t *pState;                       /**< points to the state buffer, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t blockLen,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst);
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t blockLen,
+  uint16_t numBins,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q63_t * pState);
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3407,6 +3788,59 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q31 CIC decimator.
+   */
+  typedef struct
+  {
+    uint8_t numStages;              /**< number of integrator and comb stages. */
+    uint8_t outShift;               /**< right shift of the comb output, ceil(numStages*log2(R)). */
+    uint16_t R;                     /**< decimation factor of the CIC stages. */
+    uint16_t count;                 /**< input samples since the last CIC output sample. */
+    q63_t *pState;                  /**< points to the state variable array of numStages integrators then numStages combs. */
+    arm_fir_decimate_instance_q31 *pComp;  /**< points to the compensation FIR decimator, or NULL for none. */
+    q31_t *pScratch;                /**< points to the CIC output buffer for the compensation FIR, of length blockSize/R. */
+  } arm_cic_decimate_instance_q31;
+
+
+  /**
+   * @brief Processing function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return The number of output samples written.
+   */
+  uint32_t arm_cic_decimate_q31(
+  arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 CIC decimator.
+   * @param[in,out] S          points to an instance of the Q31 CIC decimator structure.
+   * @param[in]     numStages  number of integrator and comb stages.
+   * @param[in]     R          decimation factor of the CIC stages.
+   * @param[in]     pState     points to the state buffer of 2*numStages words.
+   * @param[in]     pComp      points to an initialized compensation FIR decimator, or NULL.
+   * @param[in]     pScratch   points to a buffer of blockSize/R words, or NULL without compensation.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if the compensation is used and blockSize is not
+   * a multiple of R times its decimation factor, or ARM_MATH_ARGUMENT_ERROR if numStages or R is 0
+   * or R to the power numStages is above 2^32.
+   */
+  arm_status arm_cic_decimate_init_q31(
+  arm_cic_decimate_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t R,
+  q63_t * pState,
+  arm_fir_decimate_instance_q31 * pComp,
+  q31_t * pScratch,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 FIR interpolator.
    */
@@ -3543,6 +3977,140 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Largest number of output samples of the FIR resampler for a block of input samples.
+   */
+#define ARM_FIR_RESAMPLE_MAX_OUT(blockSize, L, stepInt)  ((((uint32_t) (blockSize) * (L)) / (stepInt)) + 1U)
+
+  /**
+   * @brief Instance structure for the Q15 FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< number of polyphase filter components, the upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t stepInt;               /**< components per output sample, the downsample factor M of a rational ratio L/M. */
+    uint32_t stepFrac;              /**< fraction of a component per output sample, 0 for a rational ratio. */
+    uint32_t pos;                   /**< state index of the oldest input sample of the next output sample. */
+    uint32_t phase;                 /**< component of the next output sample. */
+    uint32_t phaseFrac;             /**< fraction of a component of the next output sample. */
+    q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q15_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point FIR resampler.
+   */
+  typedef struct
+  {
+    uint16_t L;                     /**< number of polyphase filter components, the upsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint32_t stepInt;               /**< components per output sample, the downsample factor M of a rational ratio L/M. */
+    uint32_t stepFrac;              /**< fraction of a component per output sample, 0 for a rational ratio. */
+    uint32_t pos;                   /**< state index of the oldest input sample of the next output sample. */
+    uint32_t phase;                 /**< component of the next output sample. */
+    uint32_t phaseFrac;             /**< fraction of a component of the next output sample. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q15 FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return The number of output samples written.
+   */
+  uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if numTaps is not a multiple of L,
+   * or ARM_MATH_ARGUMENT_ERROR if L or M is 0.
+   */
+  arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sets the ratio of the Q15 FIR resampler, for the fractional mode.
+   * @param[in,out] S      points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     ratio  input samples per output sample.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if ratio is less than 1/L.
+   */
+  arm_status arm_fir_resample_set_ratio_q15(
+  arm_fir_resample_instance_q15 * S,
+  float32_t ratio);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return The number of output samples written.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if numTaps is not a multiple of L,
+   * or ARM_MATH_ARGUMENT_ERROR if L or M is 0.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sets the ratio of the floating-point FIR resampler, for the fractional mode.
+   * @param[in,out] S      points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     ratio  input samples per output sample.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if ratio is less than 1/L.
+   */
+  arm_status arm_fir_resample_set_ratio_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t ratio);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -4405,6 +4973,190 @@ void arm_rfft_fast_f32(
   q7_t * pDst);
 
 
+  /**
+   * @brief FFT based convolution of floating-point sequences.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  fftLen    FFT length, 32 to 4096, not less than the shorter sequence.
+   * @param[in]  pScratch  points to the work buffer of length 3*fftLen.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  uint16_t fftLen,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief FFT based convolution of Q15 sequences, with the result in block floating point.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length srcALen+srcBLen-1.
+   * @param[in]  fftLen    FFT length, 32 to 4096, not less than the shorter sequence.
+   * @param[in]  pScratch  points to the work buffer of 4*fftLen floating-point values.
+   * @param[out] pShift    points to the shift of the result, pDst[n] << *pShift in 1.15 format.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_conv_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint16_t fftLen,
+  float32_t * pScratch,
+  int8_t * pShift);
+
+
+  /**
+   * @brief FFT based correlation of floating-point sequences.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  fftLen    FFT length, 32 to 4096, not less than the shorter sequence.
+   * @param[in]  pScratch  points to the work buffer of length 3*fftLen.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_correlate_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  uint16_t fftLen,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief FFT based correlation of Q15 sequences, with the result in block floating point.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  fftLen    FFT length, 32 to 4096, not less than the shorter sequence.
+   * @param[in]  pScratch  points to the work buffer of 4*fftLen floating-point values.
+   * @param[out] pShift    points to the shift of the result, pDst[n] << *pShift in 1.15 format.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_correlate_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint16_t fftLen,
+  float32_t * pScratch,
+  int8_t * pShift);
+
+
+  /**
+   * @brief FFT length for the FFT based convolution and correlation functions.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[in]  maxFftLen  largest FFT length the caller has work memory for.
+   * @return The cheapest FFT length, or 0 if the direct function is cheaper.
+   */
+  uint16_t arm_conv_fft_len(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint16_t maxFftLen);
+
+
+  /**
+   * @brief FFT length for the FFT based convolution and correlation functions, with the
+   * cost model given at run time.
+   * @param[in]  srcALen    length of the first input sequence.
+   * @param[in]  srcBLen    length of the second input sequence.
+   * @param[in]  maxFftLen  largest FFT length the caller has work memory for.
+   * @param[in]  costRfft   cost of one real FFT per N*log2(N), in 1/16 of a direct MAC.
+   * @param[in]  costPoint  cost of the other work per point of a segment, in 1/16 of a direct MAC.
+   * @return The cheapest FFT length, or 0 if the direct function is cheaper.
+   */
+  uint16_t arm_conv_fft_len_cost(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint16_t maxFftLen,
+  uint16_t costRfft,
+  uint16_t costPoint);
+
+
+  /**
+   * @brief Number of partitions of the partitioned overlap-save FIR filter.
+   */
+#define ARM_FIR_OLS_NUM_PARTS(numTaps, partSize)   (((uint32_t) (numTaps) + (partSize) - 1U) / (partSize))
+
+  /**
+   * @brief Lengths, in floating-point values, of the partition spectra, state and scratch
+   * buffers of the partitioned overlap-save FIR filter.
+   */
+#define ARM_FIR_OLS_COEFFS_LEN(numTaps, partSize)  (2U * (partSize) * ARM_FIR_OLS_NUM_PARTS(numTaps, partSize))
+#define ARM_FIR_OLS_STATE_LEN(numTaps, partSize)   (ARM_FIR_OLS_COEFFS_LEN(numTaps, partSize) + (2U * (partSize)))
+#define ARM_FIR_OLS_SCRATCH_LEN(partSize)          (4U * (partSize))
+
+
+  /**
+   * @brief Instance structure for the floating-point partitioned overlap-save FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;             /**< number of filter coefficients in the filter. */
+    uint16_t partSize;            /**< samples per partition and per processed block. */
+    uint16_t numParts;            /**< number of partitions of the impulse response. */
+    uint16_t partIndex;           /**< delay line slot of the newest input spectrum. */
+    float32_t *pState;            /**< points to the last two input blocks, then the delay line. The array is of length 2*partSize*(numParts+1). */
+    float32_t *pCoeffs;           /**< points to the partition spectra. The array is of length 2*partSize*numParts. */
+    arm_rfft_fast_instance_f32 rfft; /**< real FFT of 2*partSize points. */
+  } arm_fir_ols_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point partitioned overlap-save FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point overlap-save FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of partSize.
+   * @param[in]     pScratch   points to the work buffer of 4*partSize values.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR if blockSize is not a multiple of partSize.
+   */
+  arm_status arm_fir_ols_f32(
+  arm_fir_ols_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  float32_t * pScratch);
+
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned overlap-save FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point overlap-save FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[out]    pCoeffsFd  points to the partition spectra buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     partSize   samples per partition, 16 to 2048, a power of 2.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if partSize is not supported.
+   */
+  arm_status arm_fir_ols_init_f32(
+  arm_fir_ols_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsFd,
+  float32_t * pState,
+  uint16_t partSize);
+
+
   /**
    * @brief Instance structure for the floating-point sparse FIR filter.
    */
@@ -5840,12 +6592,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0U;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5858,7 +6611,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (int32_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -5939,13 +6692,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5958,7 +6712,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q15_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6039,13 +6793,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6058,7 +6813,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if (dst == (q7_t *) dst_end)
+      if (dst == dst_end)
       {
         dst = dst_base;
       }
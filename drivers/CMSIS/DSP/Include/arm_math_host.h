@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_math_host.h
+ * Description:  Generic host profile: portable intrinsics for arm_math.h
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Host (GCC or Clang, any architecture)
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @defgroup groupHost Host Profile
+ *
+ * Define <code>ARM_MATH_HOST</code> instead of an <code>ARM_MATH_CMx</code>
+ * macro to build the library for a general purpose machine, for offline
+ * processing and tests on the same sources that run on the target.
+ *
+ * The profile selects the plain C paths of the library (those taken for
+ * <code>ARM_MATH_CM0_FAMILY</code>): one result per loop iteration, no
+ * manual unrolling, no packed 16-bit arithmetic. Those are the loops GCC
+ * and Clang vectorize for the host's SIMD unit. The DSP extension
+ * intrinsics the library still uses (<code>__SMLAD</code>,
+ * <code>__QADD16</code>, ...) come from the C versions in arm_math.h;
+ * this file adds the core intrinsics normally taken from cmsis_gcc.h
+ * (<code>__SSAT</code>, <code>__USAT</code>, <code>__CLZ</code>, ...) as
+ * branch free C, and makes <code>__SIMD32</code> accesses safe under
+ * strict aliasing.
+ *
+ * Suggested flags: <code>-O3 -DARM_MATH_HOST -fno-math-errno</code>, plus
+ * <code>-march=native</code> for the widest vectors. Floating-point sums
+ * (statistics, dot products, FIR taps) only vectorize when the compiler
+ * may reassociate them, <code>-fassociative-math -fno-signed-zeros
+ * -fno-trapping-math</code> or <code>-ffast-math</code>; results then differ
+ * from the target in the last bits, as the unrolled Cortex-M4 paths do.
+ *
+ * Results are bit exact with the Cortex-M0 build for integer types.
+ */
+
+#ifndef _ARM_MATH_HOST_H
+#define _ARM_MATH_HOST_H
+
+#if !defined ( __GNUC__ )
+  #error "ARM_MATH_HOST needs GCC or Clang"
+#endif
+
+#include <stdint.h>
+
+#if defined (__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__) && !defined (ARM_MATH_BIG_ENDIAN)
+  #define ARM_MATH_BIG_ENDIAN
+#endif
+
+/**
+ * @brief Compiler keywords used by the library sources.
+ */
+#ifndef   __ASM
+  #define __ASM                   __asm
+#endif
+#ifndef   __INLINE
+  #define __INLINE                inline
+#endif
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE         static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE    __attribute__((always_inline)) static inline
+#endif
+#ifndef   __WEAK
+  #define __WEAK                  __attribute__((weak))
+#endif
+#ifndef   __ALIGNED
+  #define __ALIGNED(x)            __attribute__((aligned(x)))
+#endif
+#ifndef   __PACKED
+  #define __PACKED                __attribute__((packed, aligned(1)))
+#endif
+
+/**
+ * @brief 32-bit and 64-bit access to packed 16-bit and 8-bit data through
+ * __SIMD32() and __SIMD64(). Both the data and the q15_t / q7_t pointer
+ * the macros step are accessed under another type; may_alias on each keeps
+ * type based alias analysis from reordering those accesses.
+ */
+typedef int32_t __attribute__((__may_alias__)) arm_host_simd32_t;
+typedef int64_t __attribute__((__may_alias__)) arm_host_simd64_t;
+typedef arm_host_simd32_t * __attribute__((__may_alias__)) arm_host_simd32_ptr_t;
+typedef arm_host_simd64_t * __attribute__((__may_alias__)) arm_host_simd64_ptr_t;
+
+#define __SIMD32_TYPE           arm_host_simd32_t
+#define __SIMD32(addr)          (*(arm_host_simd32_ptr_t *) & (addr))
+#define __SIMD64(addr)          (*(arm_host_simd64_ptr_t *) & (addr))
+#define CMSIS_UNUSED            __attribute__((unused))
+#define CMSIS_INLINE            __attribute__((always_inline))
+
+/* cmsis_gcc.h, or a host replacement for it, already supplies these */
+#if !defined (__CMSIS_GCC_H)
+
+/**
+ * @brief Signed saturation to sat bits, 1 to 32.
+ */
+__STATIC_FORCEINLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  const int32_t max = (int32_t)((sat >= 32U) ? 0x7FFFFFFFU : ((1U << (sat - 1U)) - 1U));
+  const int32_t min = -1 - max;
+
+  return (val > max) ? max : ((val < min) ? min : val);
+}
+
+/**
+ * @brief Unsigned saturation to sat bits, 0 to 31.
+ */
+__STATIC_FORCEINLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  const int32_t max = (int32_t)((1U << sat) - 1U);
+
+  return (uint32_t)((val > max) ? max : ((val < 0) ? 0 : val));
+}
+
+/**
+ * @brief Count leading zeros, 32 for 0.
+ */
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+  return (uint8_t)((value == 0U) ? 32U : (uint32_t)__builtin_clz(value));
+}
+
+/**
+ * @brief Rotate right.
+ */
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 %= 32U;
+  return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+/**
+ * @brief Byte reversal.
+ */
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value)
+{
+  return __builtin_bswap32(value);
+}
+
+#endif /* !defined (__CMSIS_GCC_H) */
+
+#endif /* _ARM_MATH_HOST_H */
@@ -64,6 +64,7 @@
 /*
 * @brief  Table for bit reversal process
 */
+#if defined(ARM_TABLE_BITREV_1024)
 const uint16_t armBitRevTable[1024] = {
    0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700, 0x80, 0x480, 0x280,
    0x680, 0x180, 0x580, 0x380, 0x780, 0x40, 0x440, 0x240, 0x640, 0x140,
@@ -169,6 +170,7 @@ const uint16_t armBitRevTable[1024] = {
    0x67e, 0x17e, 0x57e, 0x37e, 0x77e, 0xfe, 0x4fe, 0x2fe, 0x6fe, 0x1fe,
    0x5fe, 0x3fe, 0x7fe, 0x1
 };
+#endif
 
 
 /*
@@ -190,6 +192,7 @@ const uint16_t armBitRevTable[1024] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_16)
 const float32_t twiddleCoef_16[32] = {
     1.000000000f,  0.000000000f,
     0.923879533f,  0.382683432f,
@@ -208,6 +211,7 @@ const float32_t twiddleCoef_16[32] = {
     0.707106781f, -0.707106781f,
     0.923879533f, -0.382683432f
 };
+#endif
 
 /**
 * \par
@@ -224,6 +228,7 @@ const float32_t twiddleCoef_16[32] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_32)
 const float32_t twiddleCoef_32[64] = {
     1.000000000f,  0.000000000f,
     0.980785280f,  0.195090322f,
@@ -258,6 +263,7 @@ const float32_t twiddleCoef_32[64] = {
     0.923879533f, -0.382683432f,
     0.980785280f, -0.195090322f
 };
+#endif
 
 /**
 * \par
@@ -274,6 +280,7 @@ const float32_t twiddleCoef_32[64] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_64)
 const float32_t twiddleCoef_64[128] = {
     1.000000000f,  0.000000000f,
     0.995184727f,  0.098017140f,
@@ -340,6 +347,7 @@ const float32_t twiddleCoef_64[128] = {
     0.980785280f, -0.195090322f,
     0.995184727f, -0.098017140f
 };
+#endif
 
 /**
 * \par
@@ -357,6 +365,7 @@ const float32_t twiddleCoef_64[128] = {
 *
 */
 
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_128)
 const float32_t twiddleCoef_128[256] = {
     1.000000000f,  0.000000000f,
     0.998795456f,  0.049067674f,
@@ -487,6 +496,7 @@ const float32_t twiddleCoef_128[256] = {
     0.995184727f, -0.098017140f,
     0.998795456f, -0.049067674f
 };
+#endif
 
 /**
 * \par
@@ -503,6 +513,7 @@ const float32_t twiddleCoef_128[256] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_256)
 const float32_t twiddleCoef_256[512] = {
     1.000000000f,  0.000000000f,
     0.999698819f,  0.024541229f,
@@ -761,6 +772,7 @@ const float32_t twiddleCoef_256[512] = {
     0.998795456f, -0.049067674f,
     0.999698819f, -0.024541229f
 };
+#endif
 
 /**
 * \par
@@ -777,6 +789,7 @@ const float32_t twiddleCoef_256[512] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_512)
 const float32_t twiddleCoef_512[1024] = {
     1.000000000f,  0.000000000f,
     0.999924702f,  0.012271538f,
@@ -1291,6 +1304,7 @@ const float32_t twiddleCoef_512[1024] = {
     0.999698819f, -0.024541229f,
     0.999924702f, -0.012271538f
 };
+#endif
 /**
 * \par
 * Example code for Floating-point Twiddle factors Generation:
@@ -1306,6 +1320,7 @@ const float32_t twiddleCoef_512[1024] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_1024)
 const float32_t twiddleCoef_1024[2048] = {
     1.000000000f,  0.000000000f,
     0.999981175f,  0.006135885f,
@@ -2332,6 +2347,7 @@ const float32_t twiddleCoef_1024[2048] = {
     0.999924702f, -0.012271538f,
     0.999981175f, -0.006135885f
 };
+#endif
 
 /**
 * \par
@@ -2348,6 +2364,7 @@ const float32_t twiddleCoef_1024[2048] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_2048)
 const float32_t twiddleCoef_2048[4096] = {
     1.000000000f,  0.000000000f,
     0.999995294f,  0.003067957f,
@@ -4398,6 +4415,7 @@ const float32_t twiddleCoef_2048[4096] = {
     0.999981175f, -0.006135885f,
     0.999995294f, -0.003067957f
 };
+#endif
 
 /**
 * \par
@@ -4414,6 +4432,7 @@ const float32_t twiddleCoef_2048[4096] = {
 * Cos and Sin values are in interleaved fashion
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_F32_4096)
 const float32_t twiddleCoef_4096[8192] = {
     1.000000000f,  0.000000000f,
     0.999998823f,  0.001533980f,
@@ -8512,6 +8531,7 @@ const float32_t twiddleCoef_4096[8192] = {
     0.999995294f, -0.003067957f,
     0.999998823f, -0.001533980f
 };
+#endif
 
 /*
 * @brief  Q31 Twiddle factors Table
@@ -8536,6 +8556,7 @@ const float32_t twiddleCoef_4096[8192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_16)
 const q31_t twiddleCoef_16_q31[24] = {
     (q31_t)0x7FFFFFFF, (q31_t)0x00000000,
     (q31_t)0x7641AF3C, (q31_t)0x30FBC54D,
@@ -8550,6 +8571,7 @@ const q31_t twiddleCoef_16_q31[24] = {
     (q31_t)0xA57D8666, (q31_t)0xA57D8666,
     (q31_t)0xCF043AB2, (q31_t)0x89BE50C3
 };
+#endif
 
 /**
 * \par
@@ -8569,6 +8591,7 @@ const q31_t twiddleCoef_16_q31[24] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_32)
 const q31_t twiddleCoef_32_q31[48] = {
     (q31_t)0x7FFFFFFF, (q31_t)0x00000000,
     (q31_t)0x7D8A5F3F, (q31_t)0x18F8B83C,
@@ -8595,6 +8618,7 @@ const q31_t twiddleCoef_32_q31[48] = {
     (q31_t)0xCF043AB2, (q31_t)0x89BE50C3,
     (q31_t)0xE70747C3, (q31_t)0x8275A0C0
 };
+#endif
 
 /**
 * \par
@@ -8614,6 +8638,7 @@ const q31_t twiddleCoef_32_q31[48] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_64)
 const q31_t twiddleCoef_64_q31[96] = {
 	(q31_t)0x7FFFFFFF, (q31_t)0x00000000, (q31_t)0x7F62368F,
 	(q31_t)0x0C8BD35E, (q31_t)0x7D8A5F3F, (q31_t)0x18F8B83C,
@@ -8648,6 +8673,7 @@ const q31_t twiddleCoef_64_q31[96] = {
 	(q31_t)0xDAD7F3A2, (q31_t)0x8582FAA4, (q31_t)0xE70747C3,
 	(q31_t)0x8275A0C0, (q31_t)0xF3742CA1, (q31_t)0x809DC970
 };
+#endif
 
 /**
 * \par
@@ -8667,6 +8693,7 @@ const q31_t twiddleCoef_64_q31[96] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_128)
 const q31_t twiddleCoef_128_q31[192] = {
 	(q31_t)0x7FFFFFFF, (q31_t)0x00000000, (q31_t)0x7FD8878D,
 	(q31_t)0x0647D97C, (q31_t)0x7F62368F, (q31_t)0x0C8BD35E,
@@ -8733,6 +8760,7 @@ const q31_t twiddleCoef_128_q31[192] = {
 	(q31_t)0xED37EF91, (q31_t)0x8162AA03, (q31_t)0xF3742CA1,
 	(q31_t)0x809DC970, (q31_t)0xF9B82683, (q31_t)0x80277872
 };
+#endif
 
 /**
 * \par
@@ -8752,6 +8780,7 @@ const q31_t twiddleCoef_128_q31[192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_256)
 const q31_t twiddleCoef_256_q31[384] = {
 	(q31_t)0x7FFFFFFF, (q31_t)0x00000000, (q31_t)0x7FF62182,
 	(q31_t)0x03242ABF, (q31_t)0x7FD8878D, (q31_t)0x0647D97C,
@@ -8882,6 +8911,7 @@ const q31_t twiddleCoef_256_q31[384] = {
 	(q31_t)0xF6956FB6, (q31_t)0x8058C94C, (q31_t)0xF9B82683,
 	(q31_t)0x80277872, (q31_t)0xFCDBD541, (q31_t)0x8009DE7D
 };
+#endif
 
 /**
 * \par
@@ -8901,6 +8931,7 @@ const q31_t twiddleCoef_256_q31[384] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_512)
 const q31_t twiddleCoef_512_q31[768] = {
     (q31_t)0x7FFFFFFF, (q31_t)0x00000000, (q31_t)0x7FFD885A,
 	(q31_t)0x01921D1F, (q31_t)0x7FF62182, (q31_t)0x03242ABF,
@@ -9159,6 +9190,7 @@ const q31_t twiddleCoef_512_q31[768] = {
 	(q31_t)0xFB49E6A2, (q31_t)0x80163440, (q31_t)0xFCDBD541,
 	(q31_t)0x8009DE7D, (q31_t)0xFE6DE2E0, (q31_t)0x800277A5
 };
+#endif
 
 /**
 * \par
@@ -9178,6 +9210,7 @@ const q31_t twiddleCoef_512_q31[768] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_1024)
 const q31_t twiddleCoef_1024_q31[1536] = {
 	(q31_t)0x7FFFFFFF, (q31_t)0x00000000, (q31_t)0x7FFF6216,
 	(q31_t)0x00C90F88, (q31_t)0x7FFD885A, (q31_t)0x01921D1F,
@@ -9692,6 +9725,7 @@ const q31_t twiddleCoef_1024_q31[1536] = {
 	(q31_t)0xFDA4D928, (q31_t)0x80058D2E, (q31_t)0xFE6DE2E0,
 	(q31_t)0x800277A5, (q31_t)0xFF36F078, (q31_t)0x80009DE9
 };
+#endif
 
 /**
 * \par
@@ -9711,6 +9745,7 @@ const q31_t twiddleCoef_1024_q31[1536] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_2048)
 const q31_t twiddleCoef_2048_q31[3072] = {
 	(q31_t)0x7FFFFFFF, (q31_t)0x00000000, (q31_t)0x7FFFD885,
 	(q31_t)0x006487E3, (q31_t)0x7FFF6216, (q31_t)0x00C90F88,
@@ -10737,6 +10772,7 @@ const q31_t twiddleCoef_2048_q31[3072] = {
 	(q31_t)0xFED2694F, (q31_t)0x8001634D, (q31_t)0xFF36F078,
 	(q31_t)0x80009DE9, (q31_t)0xFF9B781D, (q31_t)0x8000277A
 };
+#endif
 
 /**
 * \par
@@ -10756,6 +10792,7 @@ const q31_t twiddleCoef_2048_q31[3072] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q31_4096)
 const q31_t twiddleCoef_4096_q31[6144] =
 {
 	(q31_t)0x7FFFFFFF, (q31_t)0x00000000, (q31_t)0x7FFFF621,
@@ -12807,6 +12844,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
 	(q31_t)0xFF69343E, (q31_t)0x800058D3, (q31_t)0xFF9B781D,
 	(q31_t)0x8000277A, (q31_t)0xFFCDBC0A, (q31_t)0x800009DE
 };
+#endif
 
 
 
@@ -12833,6 +12871,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_16)
 const q15_t twiddleCoef_16_q15[24] = {
     (q15_t)0x7FFF, (q15_t)0x0000,
     (q15_t)0x7641, (q15_t)0x30FB,
@@ -12847,6 +12886,7 @@ const q15_t twiddleCoef_16_q15[24] = {
     (q15_t)0xA57D, (q15_t)0xA57D,
     (q15_t)0xCF04, (q15_t)0x89BE
 };
+#endif
 
 /**
 * \par
@@ -12866,6 +12906,7 @@ const q15_t twiddleCoef_16_q15[24] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_32)
 const q15_t twiddleCoef_32_q15[48] = {
     (q15_t)0x7FFF, (q15_t)0x0000,
     (q15_t)0x7D8A, (q15_t)0x18F8,
@@ -12892,6 +12933,7 @@ const q15_t twiddleCoef_32_q15[48] = {
     (q15_t)0xCF04, (q15_t)0x89BE,
     (q15_t)0xE707, (q15_t)0x8275
 };
+#endif
 
 /**
 * \par
@@ -12911,6 +12953,7 @@ const q15_t twiddleCoef_32_q15[48] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_64)
 const q15_t twiddleCoef_64_q15[96] = {
 	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7F62, (q15_t)0x0C8B,
 	(q15_t)0x7D8A, (q15_t)0x18F8, (q15_t)0x7A7D, (q15_t)0x2528,
@@ -12937,6 +12980,7 @@ const q15_t twiddleCoef_64_q15[96] = {
 	(q15_t)0xCF04, (q15_t)0x89BE, (q15_t)0xDAD7, (q15_t)0x8582,
 	(q15_t)0xE707, (q15_t)0x8275, (q15_t)0xF374, (q15_t)0x809D
 };
+#endif
 
 /**
 * \par
@@ -12956,6 +13000,7 @@ const q15_t twiddleCoef_64_q15[96] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_128)
 const q15_t twiddleCoef_128_q15[192] = {
 	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FD8, (q15_t)0x0647,
 	(q15_t)0x7F62, (q15_t)0x0C8B, (q15_t)0x7E9D, (q15_t)0x12C8,
@@ -13006,6 +13051,7 @@ const q15_t twiddleCoef_128_q15[192] = {
 	(q15_t)0xE707, (q15_t)0x8275, (q15_t)0xED37, (q15_t)0x8162,
 	(q15_t)0xF374, (q15_t)0x809D, (q15_t)0xF9B8, (q15_t)0x8027
 };
+#endif
 
 /**
 * \par
@@ -13025,6 +13071,7 @@ const q15_t twiddleCoef_128_q15[192] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_256)
 const q15_t twiddleCoef_256_q15[384] = {
 	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FF6, (q15_t)0x0324,
 	(q15_t)0x7FD8, (q15_t)0x0647, (q15_t)0x7FA7, (q15_t)0x096A,
@@ -13123,6 +13170,7 @@ const q15_t twiddleCoef_256_q15[384] = {
 	(q15_t)0xF374, (q15_t)0x809D, (q15_t)0xF695, (q15_t)0x8058,
 	(q15_t)0xF9B8, (q15_t)0x8027, (q15_t)0xFCDB, (q15_t)0x8009
 };
+#endif
 
 /**
 * \par
@@ -13142,6 +13190,7 @@ const q15_t twiddleCoef_256_q15[384] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_512)
 const q15_t twiddleCoef_512_q15[768] = {
 	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFD, (q15_t)0x0192,
 	(q15_t)0x7FF6, (q15_t)0x0324, (q15_t)0x7FE9, (q15_t)0x04B6,
@@ -13336,6 +13385,7 @@ const q15_t twiddleCoef_512_q15[768] = {
 	(q15_t)0xF9B8, (q15_t)0x8027, (q15_t)0xFB49, (q15_t)0x8016,
 	(q15_t)0xFCDB, (q15_t)0x8009, (q15_t)0xFE6D, (q15_t)0x8002
 };
+#endif
 
 /**
 * \par
@@ -13355,6 +13405,7 @@ const q15_t twiddleCoef_512_q15[768] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_1024)
 const q15_t twiddleCoef_1024_q15[1536] = {
 	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x00C9,
 	(q15_t)0x7FFD, (q15_t)0x0192, (q15_t)0x7FFA, (q15_t)0x025B,
@@ -13741,6 +13792,7 @@ const q15_t twiddleCoef_1024_q15[1536] = {
 	(q15_t)0xFCDB, (q15_t)0x8009, (q15_t)0xFDA4, (q15_t)0x8005,
 	(q15_t)0xFE6D, (q15_t)0x8002, (q15_t)0xFF36, (q15_t)0x8000
 };
+#endif
 
 /**
 * \par
@@ -13760,6 +13812,7 @@ const q15_t twiddleCoef_1024_q15[1536] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_2048)
 const q15_t twiddleCoef_2048_q15[3072] = {
 	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0064,
 	(q15_t)0x7FFF, (q15_t)0x00C9, (q15_t)0x7FFE, (q15_t)0x012D,
@@ -14530,6 +14583,7 @@ const q15_t twiddleCoef_2048_q15[3072] = {
 	(q15_t)0xFE6D, (q15_t)0x8002, (q15_t)0xFED2, (q15_t)0x8001,
 	(q15_t)0xFF36, (q15_t)0x8000, (q15_t)0xFF9B, (q15_t)0x8000
 };
+#endif
 
 /**
 * \par
@@ -14549,6 +14603,7 @@ const q15_t twiddleCoef_2048_q15[3072] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))
 *
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_Q15_4096)
 const q15_t twiddleCoef_4096_q15[6144] =
 {
 	(q15_t)0x7FFF, (q15_t)0x0000, (q15_t)0x7FFF, (q15_t)0x0032,
@@ -16088,6 +16143,7 @@ const q15_t twiddleCoef_4096_q15[6144] =
 	(q15_t)0xFF36, (q15_t)0x8000, (q15_t)0xFF69, (q15_t)0x8000,
 	(q15_t)0xFF9B, (q15_t)0x8000, (q15_t)0xFFCD, (q15_t)0x8000
 };
+#endif
 
 
 /**
@@ -16128,12 +16184,15 @@ const q31_t armRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_16)
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE_16_TABLE_LENGTH] =
 {
    /* 8x2, size 20 */
    8,64, 24,72, 16,64, 40,80, 32,64, 56,88, 48,72, 88,104, 72,96, 104,112
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_32)
 const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH] =
 {
    /* 8x4, size 48 */
@@ -16141,7 +16200,9 @@ const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH] =
    80,144, 96,192, 104,208, 112,152, 120,216, 136,192, 144,160, 168,208,
    152,224, 176,208, 184,232, 216,240, 200,224, 232,240
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_64)
 const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH] =
 {
    /* radix 8, size 56 */
@@ -16150,7 +16211,9 @@ const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH] =
    184,464, 224,280, 232,344, 240,408, 248,472, 296,352, 304,416, 312,480,
    368,424, 376,488, 440,496
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_128)
 const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
 {
    /* 8x2, size 208 */
@@ -16168,7 +16231,9 @@ const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
    792,864, 808,904, 816,864, 824,920, 840,864, 856,880, 872,944, 888,1008,
    904,928, 912,960, 920,992, 944,968, 952,1000, 968,992, 984,1008
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_256)
 const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
 {
    /* 8x4, size 440 */
@@ -16206,7 +16271,9 @@ const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
    1880,1904, 1888,1984, 1896,2000, 1912,2032, 1904,2016, 1976,2032,
    1960,1968, 2008,2032, 1992,2016, 2024,2032
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_512)
 const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
 {
    /* radix 8, size 448 */
@@ -16246,7 +16313,9 @@ const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
    3064,4072, 3128,3632, 3192,3696, 3256,3760, 3320,3824, 3384,3888,
    3448,3952, 3512,4016, 3576,4080
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_1024)
 const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH] =
 {
    /* 8x2, size 1800 */
@@ -16398,7 +16467,9 @@ const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH] =
    8008,8032, 8024,8048, 8056,8120, 8072,8096, 8080,8128, 8088,8160,
    8112,8136, 8120,8168, 8136,8160, 8152,8176
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_2048)
 const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH] =
 {
    /* 8x2, size 3808 */
@@ -16740,7 +16811,9 @@ const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH] =
    16248,16368, 16264,16288, 16280,16296, 16296,16304, 16344,16368,
    16328,16352, 16360,16368
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FLT_4096)
 const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH] =
 {
    /* radix 8, size 4032 */
@@ -17111,21 +17184,27 @@ const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH] =
    31096,31544, 31160,32056, 31224,32568, 31672,32120, 31736,32632,
    32248,32696
 };
+#endif
 
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_16)
 const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH] =
 {
    /* radix 4, size 12 */
    8,64, 16,32, 24,96, 40,80, 56,112, 88,104
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_32)
 const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH] =
 {
    /* 4x2, size 24 */
    8,128, 16,64, 24,192, 40,160, 48,96, 56,224, 72,144,
    88,208, 104,176, 120,240, 152,200, 184,232
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_64)
 const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH] =
 {
    /* radix 4, size 56 */
@@ -17133,7 +17212,9 @@ const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED_64_TABLE_L
    112,224, 120,480, 136,272, 152,400, 168,336, 176,208, 184,464, 200,304, 216,432,
    232,368, 248,496, 280,392, 296,328, 312,456, 344,424, 376,488, 440,472
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_128)
 const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH] =
 {
    /* 4x2, size 112 */
@@ -17144,7 +17225,9 @@ const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED_128_TABLE
    472,880, 488,752, 504,1008, 536,776, 552,648, 568,904, 600,840, 616,712, 632,968,
    664,808, 696,936, 728,872, 760,1000, 824,920, 888,984
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_256)
 const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH] =
 {
    /* radix 4, size 240 */
@@ -17163,7 +17246,9 @@ const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED_256_TABLE
    1368,1704, 1384,1448, 1400,1960, 1432,1640, 1464,1896, 1496,1768, 1528,2024, 1592,1816,
    1624,1688, 1656,1944, 1720,1880, 1784,2008, 1912,1976
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_512)
 const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH] =
 {
    /* 4x2, size 480 */
@@ -17197,7 +17282,9 @@ const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED_512_TABLE
    3128,3608, 3160,3352, 3192,3864, 3256,3736, 3288,3480, 3320,3992, 3384,3672, 3448,3928,
    3512,3800, 3576,4056, 3704,3896, 3832,4024
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_1024)
 const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] =
 {
     /* radix 4, size 992 */
@@ -17271,7 +17358,9 @@ const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TAB
     6872,7000, 6904,8024, 6968,7384, 7032,7896, 7096,7640, 7160,8152, 7288,7736,
     7352,7480, 7416,7992, 7544,7864, 7672,8120, 7928,8056
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_2048)
 const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] =
 {
     /* 4x2, size 1984 */
@@ -17427,7 +17516,9 @@ const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TAB
     14456,15416, 14520,14904, 14584,15928, 14712,15672, 14776,15160, 14840,16184,
     14968,15544, 15096,16056, 15224,15800, 15352,16312, 15608,15992, 15864,16248
 };
+#endif
 
+#if defined(ARM_TABLE_BITREVIDX_FXT_4096)
 const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] =
 {
     /* radix 4, size 4032 */
@@ -17765,6 +17856,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
     30456,32184, 30584,31672, 30712,32696, 30968,31864, 31096,31352, 31224,32376,
     31480,32120, 31736,32632, 32248,32504
 };
+#endif
 
 /**
 * \par
@@ -17774,6 +17866,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
 * \par
 * Real and Imag values are in interleaved fashion
 */
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_32)
 const float32_t twiddleCoef_rfft_32[32] = {
     0.000000000f,  1.000000000f,
     0.195090322f,  0.980785280f,
@@ -17792,7 +17885,9 @@ const float32_t twiddleCoef_rfft_32[32] = {
     0.382683432f, -0.923879533f,
     0.195090322f, -0.980785280f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_64)
 const float32_t twiddleCoef_rfft_64[64] = {
     0.000000000000000f,  1.000000000000000f,
     0.098017140329561f,  0.995184726672197f,
@@ -17827,7 +17922,9 @@ const float32_t twiddleCoef_rfft_64[64] = {
     0.195090322016129f, -0.980785280403230f,
     0.098017140329561f, -0.995184726672197f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_128)
 const float32_t twiddleCoef_rfft_128[128] = {
     0.000000000f,  1.000000000f,
     0.049067674f,  0.998795456f,
@@ -17894,7 +17991,9 @@ const float32_t twiddleCoef_rfft_128[128] = {
     0.098017140f, -0.995184727f,
     0.049067674f, -0.998795456f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_256)
 const float32_t twiddleCoef_rfft_256[256] = {
     0.000000000f,  1.000000000f,
     0.024541229f,  0.999698819f,
@@ -18025,7 +18124,9 @@ const float32_t twiddleCoef_rfft_256[256] = {
     0.049067674f, -0.998795456f,
     0.024541229f, -0.999698819f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_512)
 const float32_t twiddleCoef_rfft_512[512] = {
     0.000000000f,  1.000000000f,
     0.012271538f,  0.999924702f,
@@ -18284,7 +18385,9 @@ const float32_t twiddleCoef_rfft_512[512] = {
     0.024541229f, -0.999698819f,
     0.012271538f, -0.999924702f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024)
 const float32_t twiddleCoef_rfft_1024[1024] = {
     0.000000000f,  1.000000000f,
     0.006135885f,  0.999981175f,
@@ -18799,7 +18902,9 @@ const float32_t twiddleCoef_rfft_1024[1024] = {
     0.012271538f, -0.999924702f,
     0.006135885f, -0.999981175f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048)
 const float32_t twiddleCoef_rfft_2048[2048] = {
     0.000000000f,  1.000000000f,
     0.003067957f,  0.999995294f,
@@ -19826,7 +19931,9 @@ const float32_t twiddleCoef_rfft_2048[2048] = {
     0.006135885f, -0.999981175f,
     0.003067957f, -0.999995294f
 };
+#endif
 
+#if defined(ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096)
 const float32_t twiddleCoef_rfft_4096[4096] = {
     0.000000000f,  1.000000000f,
     0.001533980f,  0.999998823f,
@@ -21877,6 +21984,7 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
     0.003067957f, -0.999995294f,
     0.001533980f, -0.999998823f
 };
+#endif
 
 
 /**
@@ -21892,6 +22000,7 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
  * where pi value is  3.14159265358979
  */
 
+#if defined(ARM_TABLE_SIN_F32)
 const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
    0.00000000f, 0.01227154f, 0.02454123f, 0.03680722f, 0.04906767f, 0.06132074f,
    0.07356456f, 0.08579731f, 0.09801714f, 0.11022221f, 0.12241068f, 0.13458071f,
@@ -21988,6 +22097,7 @@ const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
    -0.11022221f, -0.09801714f, -0.08579731f, -0.07356456f, -0.06132074f,
    -0.04906767f, -0.03680722f, -0.02454123f, -0.01227154f, -0.00000000f
 };
+#endif
 
 /**
  * \par
@@ -22007,6 +22117,7 @@ const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1] = {
  * Finally, round to the nearest integer value:
  * 	sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);
  */
+#if defined(ARM_TABLE_SIN_Q31)
 const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
 	0L, 26352928L, 52701887L, 79042909L, 105372028L, 131685278L, 157978697L,
 	184248325L, 210490206L, 236700388L, 262874923L, 289009871L, 315101295L,
@@ -22100,6 +22211,7 @@ const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
 	-315101295L, -289009871L, -262874923L, -236700388L, -210490206L, -184248325L,
 	-157978697L, -131685278L, -105372028L, -79042909L, -52701887L, -26352928L, 0
 };
+#endif
 
 /**
  * \par
@@ -22119,6 +22231,7 @@ const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1] = {
  * Finally, round to the nearest integer value:
  * 	sinTable[i] += (sinTable[i] > 0 ? 0.5 :-0.5);
  */
+#if defined(ARM_TABLE_SIN_Q15)
 const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
 	0, 402, 804, 1206, 1608, 2009, 2411, 2811, 3212, 3612, 4011, 4410, 4808,
 	5205, 5602, 5998, 6393, 6787, 7180, 7571, 7962, 8351, 8740, 9127, 9512,
@@ -22174,3 +22287,4 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
 	-5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2411,
 	-2009, -1608, -1206, -804, -402, 0
 };
+#endif
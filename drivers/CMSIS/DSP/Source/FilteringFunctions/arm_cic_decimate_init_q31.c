@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_decimate_init_q31.c
+ * Description:  Q31 CIC decimator initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup CIC_Decimate
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 CIC decimator.
+ * @param[in,out] *S         points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     numStages  number of integrator and comb stages.
+ * @param[in]     R          decimation factor of the CIC stages.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     *pComp     points to an initialized compensation FIR decimator, or NULL for none.
+ * @param[in]     *pScratch  points to the CIC output buffer, or NULL for no compensation.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS, ARM_MATH_ARGUMENT_ERROR if <code>numStages</code>
+ * or <code>R</code> is 0 or <code>R^numStages</code> is above <code>2^32</code>, or ARM_MATH_LENGTH_ERROR
+ * if <code>pComp</code> is not NULL and <code>blockSize</code> is not a multiple of <code>R*pComp->M</code>.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to the array of state variables, of length <code>2*numStages</code>:
+ * the integrators, then the combs.  The state buffer is cleared.
+ * \par
+ * <code>pComp</code> points to an instance of the Q31 FIR decimator, initialized by
+ * <code>arm_fir_decimate_init_q31()</code> with a block size of <code>blockSize/R</code>.
+ * <code>pScratch</code> then points to a buffer of <code>blockSize/R</code> words.
+ */
+
+arm_status arm_cic_decimate_init_q31(
+  arm_cic_decimate_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t R,
+  q63_t * pState,
+  arm_fir_decimate_instance_q31 * pComp,
+  q31_t * pScratch,
+  uint32_t blockSize)
+{
+  uint64_t gain = 1U;                            /* DC gain, R^numStages */
+  uint32_t shift = 0U;                           /* Bits of the gain */
+  uint32_t i;                                    /* Loop counter */
+
+  if ((numStages == 0U) || (R == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The comb output must fit in the 64-bit registers */
+  for (i = 0U; i < numStages; i++)
+  {
+    gain *= R;
+
+    if (gain > 0x100000000ULL)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  /* The compensation FIR decimator takes whole blocks */
+  if ((pComp != NULL) && ((blockSize % ((uint32_t) R * pComp->M)) != 0U))
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  while ((1ULL << shift) < gain)
+  {
+    shift++;
+  }
+
+  S->numStages = numStages;
+  S->outShift = (uint8_t) shift;
+  S->R = R;
+  S->count = 0U;
+  S->pState = pState;
+  S->pComp = pComp;
+  S->pScratch = pScratch;
+
+  /* Clear state buffer and size of buffer is always 2*numStages */
+  memset(pState, 0, 2U * numStages * sizeof(q63_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of CIC_Decimate group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cic_decimate_q31.c
+ * Description:  Q31 CIC decimator
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup CIC_Decimate Cascaded Integrator-Comb (CIC) Decimator
+ *
+ * This function decimates by large factors, 100 to 1000 and more, without multiplications.
+ * The CIC decimator is a cascade of <code>N</code> integrators at the input rate, a decimation by
+ * <code>R</code>, and <code>N</code> combs at the output rate.  It is the FIR filter of <code>N</code>
+ * moving sums of <code>R</code> samples:
+ * <pre>
+ *    H(z) = ((1 - z^-R) / (1 - z^-1))^N
+ * </pre>
+ * which costs <code>N</code> additions per input sample and <code>N</code> subtractions per output
+ * sample, whatever <code>R</code>.  An \ref FIR_decimate "FIR decimator" with the same rejection needs a
+ * filter several times longer than the decimation factor, and <code>numTaps/M</code> multiply-accumulates
+ * per input sample.
+ *
+ * \par
+ * The response of the CIC stages droops across the passband, as <code>(sin(pi*f*R)/(R*sin(pi*f)))^N</code>,
+ * and only its nulls at multiples of the output rate reject what would alias.  So the CIC stages are
+ * usually followed by a short compensation FIR, which flattens the passband, rejects the rest of the band
+ * and decimates by a further 2 to 8.  The instance takes an \ref FIR_decimate "FIR decimator" for this,
+ * initialized with a block size of <code>blockSize/R</code>, whose coefficients are provided by the user.
+ *
+ * \par Algorithm:
+ * Each input sample runs through the integrators, and every <code>R</code>-th result through the combs:
+ * <pre>
+ *    i1[n] = i1[n-1] + x[n]          c1[m] = iN[m*R] - iN[(m-1)*R]
+ *    i2[n] = i2[n-1] + i1[n]         c2[m] = c1[m] - c1[m-1]
+ *    ...                             ...
+ *    iN[n] = iN[n-1] + iN-1[n]       y[m] = cN[m] - cN[m-1]
+ * </pre>
+ * The integrators are never reset and overflow, which does no harm in wrap-around arithmetic: the combs
+ * subtract the same wrapped values, and their output is exact as long as it fits in the registers.
+ * The DC gain is <code>R^N</code>, so the registers need <code>N*log2(R)</code> bits above the input.
+ *
+ * \par
+ * The functions take a block of <code>blockSize</code> input samples and return the number of output
+ * samples written.  Without compensation <code>blockSize</code> is free and the function writes
+ * <code>blockSize/R</code> samples, plus one depending on the samples left by the previous call.
+ * With compensation <code>blockSize</code> must be a multiple of <code>R</code> times the decimation
+ * factor of the FIR decimator.
+ *
+ * \par Fixed-Point Behavior
+ * The input is Q31 and the registers are 64 bits, in wrap-around arithmetic, so
+ * <code>R^N</code> may be as large as <code>2^32</code> without losing any bit of the input: for
+ * instance <code>R</code> up to 256 with 4 stages, or 1625 with 3.  The comb output is shifted right by
+ * <code>outShift = ceil(N*log2(R))</code> to a 1.31 result, with a DC gain of <code>R^N/2^outShift</code>
+ * between 0.5 and 1, which the compensation FIR may correct.
+ */
+
+/**
+ * @addtogroup CIC_Decimate
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 CIC decimator.
+ * @param[in,out] *S         points to an instance of the Q31 CIC decimator structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return the number of output samples written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The integrators and combs are 64-bit and wrap around on overflow.  The comb output is exact
+ * and fits in 32+outShift bits, it is truncated to 1.31 format by discarding the low <code>outShift</code> bits.
+ * The compensation FIR then behaves as <code>arm_fir_decimate_q31()</code>.
+ */
+
+uint32_t arm_cic_decimate_q31(
+  arm_cic_decimate_instance_q31 * S,
+  const q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint64_t *pInteg = (uint64_t *) S->pState;     /* Integrator state pointer */
+  uint64_t *pComb = pInteg + S->numStages;       /* Comb state pointer */
+  q31_t *pOut = (S->pComp != NULL) ? S->pScratch : pDst;  /* CIC output pointer */
+  uint32_t numStages = S->numStages;             /* Number of stages */
+  uint32_t R = S->R;                             /* Decimation factor */
+  uint32_t count = S->count;                     /* Input samples since the last output */
+  uint32_t shift = S->outShift;                  /* Right shift of the comb output */
+  uint32_t outCnt = 0U;                          /* Output samples written */
+  uint32_t blkCnt, stage;                        /* Loop counters */
+  uint64_t acc, prev;                            /* Wrap-around accumulator */
+
+  for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+  {
+    /* Integrators, in wrap-around arithmetic */
+    acc = (uint64_t) (q63_t) *pSrc++;
+
+    for (stage = 0U; stage < numStages; stage++)
+    {
+      acc += pInteg[stage];
+      pInteg[stage] = acc;
+    }
+
+    /* Combs, at the output rate */
+    if (++count == R)
+    {
+      count = 0U;
+
+      for (stage = 0U; stage < numStages; stage++)
+      {
+        prev = pComb[stage];
+        pComb[stage] = acc;
+        acc -= prev;
+      }
+
+      *pOut++ = (q31_t) ((q63_t) acc >> shift);
+      outCnt++;
+    }
+  }
+
+  S->count = (uint16_t) count;
+
+  /* Compensation FIR, decimating again */
+  if (S->pComp != NULL)
+  {
+    arm_fir_decimate_q31(S->pComp, S->pScratch, pDst, outCnt);
+    outCnt /= S->pComp->M;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of CIC_Decimate group
+ */
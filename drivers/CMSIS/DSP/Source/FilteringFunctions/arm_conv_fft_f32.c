@@ -0,0 +1,229 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_f32.c
+ * Description:  FFT based convolution of floating-point sequences
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup ConvFFT FFT Convolution and Correlation
+ *
+ * These functions compute the same results as <code>arm_conv_f32()</code> and
+ * <code>arm_correlate_f32()</code> with fast convolution: the sequences are
+ * multiplied in the frequency domain, using <code>arm_rfft_fast_f32()</code>.
+ * The direct functions cost <code>srcALen * srcBLen</code> multiply-accumulates;
+ * these cost <code>O((srcALen + srcBLen) * log2(fftLen))</code>, which is far
+ * less once the shorter sequence is more than a few dozen samples long.
+ *
+ * \par Algorithm
+ * The shorter sequence is the kernel.  It is zero padded to <code>fftLen</code>
+ * samples and transformed once.  The longer one is cut into segments of
+ * <code>fftLen - kernLen + 1</code> samples; each is zero padded, transformed,
+ * multiplied by the kernel spectrum and transformed back, which gives its full
+ * linear convolution with the kernel, and the overlapping
+ * <code>kernLen - 1</code> samples of consecutive segments are added (overlap-add).
+ * The kernel must not be longer than <code>fftLen</code>; the longer sequence
+ * may be of any length.
+ * \par
+ * Correlation is convolution with one sequence reversed in time, and takes the
+ * same path.
+ *
+ * \par Choosing the FFT length
+ * <code>fftLen</code> is 32, 64, ... 4096.  Short FFTs waste work on the
+ * overlap, long ones on the zero padding; <code>arm_conv_fft_len()</code> picks
+ * the cheapest length up to a limit, or returns 0 when the direct function is
+ * expected to be cheaper.  A caller that handles all sizes:
+ * <pre>
+ *     fftLen = arm_conv_fft_len(srcALen, srcBLen, MAX_FFT_LEN);
+ *     if (fftLen == 0)
+ *       arm_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+ *     else
+ *       arm_conv_fft_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, fftLen, pScratch);
+ * </pre>
+ *
+ * \par Work memory
+ * The functions allocate nothing.  <code>pScratch</code> points to a buffer of
+ * <code>3 * fftLen</code> floating-point values supplied by the caller: the kernel
+ * spectrum, a segment and its result.  The Q15 functions take <code>4 * fftLen</code>,
+ * the fourth block holding the overlap at full precision.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 functions compute in floating-point and give their result in block
+ * floating point: Q15 samples and one shift for the whole output, chosen so the
+ * largest result fits.  They never saturate, where <code>arm_conv_q15()</code>
+ * and <code>arm_correlate_q15()</code> would.
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Overlap-add convolution, shared by the floating-point FFT convolution
+ * and correlation functions.  Either sequence may be read reversed in time.
+ * @param[in]  *S        points to an initialized real FFT instance of fftLen points.
+ * @param[in]  *pIn      points to the longer sequence.
+ * @param[in]  inLen     length of the longer sequence.
+ * @param[in]  inRev     1 to read it reversed in time.
+ * @param[in]  *pKern    points to the kernel.
+ * @param[in]  kernLen   length of the kernel, 1 to fftLen.
+ * @param[in]  kernRev   1 to read it reversed in time.
+ * @param[out] *pDst     points to the output of length inLen + kernLen - 1.
+ * @param[in]  *pScratch points to the work buffer of length 3 * fftLen.
+ * @return none.
+ */
+
+void arm_conv_fft_ola_f32(
+  arm_rfft_fast_instance_f32 * S,
+  float32_t * pIn,
+  uint32_t inLen,
+  uint8_t inRev,
+  float32_t * pKern,
+  uint32_t kernLen,
+  uint8_t kernRev,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  uint32_t fftLen = S->fftLenRFFT;               /* FFT length */
+  float32_t *pH = pScratch;                      /* Kernel spectrum */
+  float32_t *pX = pScratch + fftLen;             /* Segment, then product spectrum */
+  float32_t *pY = pScratch + (2U * fftLen);      /* Segment spectrum, then result */
+  uint32_t segLen = (fftLen - kernLen) + 1U;     /* Input samples per segment */
+  uint32_t start, blkLen, outLen, overlap;       /* Segment bounds */
+  uint32_t i;                                    /* Loop counter */
+
+  /* Kernel spectrum */
+  for (i = 0U; i < kernLen; i++)
+  {
+    pX[i] = pKern[(kernRev == 1U) ? (kernLen - 1U - i) : i];
+  }
+  for (; i < fftLen; i++)
+  {
+    pX[i] = 0.0f;
+  }
+  arm_rfft_fast_f32(S, pX, pH, 0U);
+
+  for (start = 0U; start < inLen; start += segLen)
+  {
+    blkLen = inLen - start;
+    if (blkLen > segLen)
+    {
+      blkLen = segLen;
+    }
+
+    /* Zero padded segment */
+    for (i = 0U; i < blkLen; i++)
+    {
+      pX[i] = pIn[(inRev == 1U) ? (inLen - 1U - (start + i)) : (start + i)];
+    }
+    for (; i < fftLen; i++)
+    {
+      pX[i] = 0.0f;
+    }
+
+    arm_rfft_fast_f32(S, pX, pY, 0U);
+
+    /* Bins 0 and fftLen/2 are real and packed in the first pair */
+    pX[0] = pY[0] * pH[0];
+    pX[1] = pY[1] * pH[1];
+    arm_cmplx_mult_cmplx_f32(pY + 2, pH + 2, pX + 2, (fftLen >> 1U) - 1U);
+
+    arm_rfft_fast_f32(S, pX, pY, 1U);
+
+    /* The first kernLen - 1 results overlap the tail of the previous segment */
+    outLen = blkLen + (kernLen - 1U);
+    overlap = (start == 0U) ? 0U : (kernLen - 1U);
+
+    for (i = 0U; i < overlap; i++)
+    {
+      pDst[start + i] += pY[i];
+    }
+    for (; i < outLen; i++)
+    {
+      pDst[start + i] = pY[i];
+    }
+  }
+}
+
+/**
+ * @brief FFT based convolution of floating-point sequences.
+ * @param[in]  *pSrcA    points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  *pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] *pDst     points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  fftLen    FFT length, 32 to 4096, not less than the shorter sequence.
+ * @param[in]  *pScratch points to the work buffer of length 3*fftLen.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported length or is shorter than the shorter sequence.
+ *
+ * The result matches <code>arm_conv_f32()</code> to the rounding of the transforms.
+ */
+
+arm_status arm_conv_fft_f32(
+  float32_t * pSrcA,
+  uint32_t srcALen,
+  float32_t * pSrcB,
+  uint32_t srcBLen,
+  float32_t * pDst,
+  uint16_t fftLen,
+  float32_t * pScratch)
+{
+  arm_rfft_fast_instance_f32 S;                  /* Real FFT instance */
+
+  if ((srcALen == 0U) || (srcBLen == 0U) || ((fftLen & (fftLen - 1U)) != 0U) ||
+      (arm_rfft_fast_init_f32(&S, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The shorter sequence is the kernel */
+  if (srcALen >= srcBLen)
+  {
+    if (srcBLen > fftLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    arm_conv_fft_ola_f32(&S, pSrcA, srcALen, 0U, pSrcB, srcBLen, 0U, pDst, pScratch);
+  }
+  else
+  {
+    if (srcALen > fftLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    arm_conv_fft_ola_f32(&S, pSrcB, srcBLen, 0U, pSrcA, srcALen, 0U, pDst, pScratch);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
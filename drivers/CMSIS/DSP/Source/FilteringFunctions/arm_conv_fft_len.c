@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_len.c
+ * Description:  FFT length choice for FFT based convolution and correlation
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/* Cost model, in multiply-accumulates of the direct functions:
+ * one real FFT of N points costs ARM_CONV_FFT_COST_RFFT * N * log2(N) / 16,
+ * and each point of a segment ARM_CONV_FFT_COST_POINT / 16 more for the
+ * zero padding, the spectrum product and the overlap-add.
+ * The defaults are estimates for Cortex-M4 with the FPU, about 2.7 cycles per
+ * N * log2(N) for arm_rfft_fast_f32() and 1.8 cycles per MAC for arm_conv_f32();
+ * define them to retune the crossover for another core or data type.
+ * With constants measured on the core, the MAC timed with a short kernel
+ * where the choice is close, the length picked is the fastest or one octave
+ * from it: up to about 15% slower than the fastest in host measurements.
+ * Constants off by 2x, as the defaults are on a desktop core, can pick the
+ * direct function at 1.3x to 2.5x the fastest time. */
+#ifndef ARM_CONV_FFT_COST_RFFT
+#define ARM_CONV_FFT_COST_RFFT    24U
+#endif
+
+#ifndef ARM_CONV_FFT_COST_POINT
+#define ARM_CONV_FFT_COST_POINT   72U
+#endif
+
+/**
+ * @brief FFT length for the FFT based convolution and correlation functions.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[in]  maxFftLen largest FFT length the caller has work memory for, 32 to 4096.
+ * @return The FFT length, 32 to maxFftLen, with the least estimated cost,
+ * or 0 if the direct function is estimated to cost less than any of them or
+ * the shorter sequence is longer than <code>maxFftLen</code>.
+ *
+ * The work memory of the FFT functions is <code>3 * fftLen</code> values, so
+ * <code>maxFftLen</code> bounds it.  The estimate counts the segments of
+ * <code>fftLen - min(srcALen, srcBLen) + 1</code> samples the longer sequence
+ * is cut into, two real FFTs and <code>fftLen</code> points of other work per
+ * segment, and the FFT of the kernel, against
+ * <code>srcALen * srcBLen</code> multiply-accumulates for the direct functions.
+ */
+
+uint16_t arm_conv_fft_len(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint16_t maxFftLen)
+{
+  return (arm_conv_fft_len_cost(srcALen, srcBLen, maxFftLen,
+                                ARM_CONV_FFT_COST_RFFT, ARM_CONV_FFT_COST_POINT));
+}
+
+/**
+ * @brief FFT length for the FFT based convolution and correlation functions,
+ * with the cost model given at run time.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[in]  maxFftLen largest FFT length the caller has work memory for, 32 to 4096.
+ * @param[in]  costRfft  cost of one real FFT per <code>N * log2(N)</code>, in 1/16 of a direct MAC.
+ * @param[in]  costPoint cost of the other work per point of a segment, in 1/16 of a direct MAC.
+ * @return As <code>arm_conv_fft_len()</code>.
+ *
+ * <code>arm_conv_fft_len()</code> is this function with <code>ARM_CONV_FFT_COST_RFFT</code>
+ * and <code>ARM_CONV_FFT_COST_POINT</code>; this one lets constants measured on
+ * the running core be used without rebuilding the library.
+ */
+
+uint16_t arm_conv_fft_len_cost(
+  uint32_t srcALen,
+  uint32_t srcBLen,
+  uint16_t maxFftLen,
+  uint16_t costRfft,
+  uint16_t costPoint)
+{
+  uint32_t longLen, kernLen;                     /* Lengths of the longer and shorter sequences */
+  uint32_t fftLen, log2Len;                      /* Candidate FFT length and its log2 */
+  uint32_t numSeg;                               /* Segments of the longer sequence */
+  uint64_t cost, fftCost;                        /* Estimated costs, 16 units per MAC */
+  uint64_t bestCost;                             /* Least cost so far */
+  uint16_t bestLen = 0U;                         /* FFT length of the least cost */
+
+  longLen = (srcALen >= srcBLen) ? srcALen : srcBLen;
+  kernLen = (srcALen >= srcBLen) ? srcBLen : srcALen;
+
+  bestCost = 16U * (uint64_t) srcALen * srcBLen;
+
+  for (fftLen = 32U, log2Len = 5U; (fftLen <= maxFftLen) && (fftLen <= 4096U); fftLen <<= 1U, log2Len++)
+  {
+    if (fftLen < kernLen)
+    {
+      continue;
+    }
+
+    numSeg = (longLen + (fftLen - kernLen)) / ((fftLen - kernLen) + 1U);
+    fftCost = (uint64_t) costRfft * fftLen * log2Len;
+    cost = (((2U * (uint64_t) numSeg) + 1U) * fftCost) +
+           ((uint64_t) numSeg * costPoint * fftLen);
+
+    if (cost < bestCost)
+    {
+      bestCost = cost;
+      bestLen = (uint16_t) fftLen;
+    }
+  }
+
+  return (bestLen);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
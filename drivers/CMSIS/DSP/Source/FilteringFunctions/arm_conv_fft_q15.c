@@ -0,0 +1,238 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_q15.c
+ * Description:  FFT based convolution of Q15 sequences in block floating point
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+/**
+ * @brief Overlap-add convolution in block floating point, shared by the Q15 FFT
+ * convolution and correlation functions.  Either sequence may be read reversed in time.
+ * @param[in]  *S        points to an initialized real FFT instance of fftLen points.
+ * @param[in]  *pIn      points to the longer sequence.
+ * @param[in]  inLen     length of the longer sequence.
+ * @param[in]  inRev     1 to read it reversed in time.
+ * @param[in]  *pKern    points to the kernel.
+ * @param[in]  kernLen   length of the kernel, 1 to fftLen.
+ * @param[in]  kernRev   1 to read it reversed in time.
+ * @param[out] *pDst     points to the output of length inLen + kernLen - 1.
+ * @param[in]  *pScratch points to the work buffer of length 4 * fftLen.
+ * @param[out] *pShift   points to the shift of the output.
+ * @return none.
+ *
+ * The shift starts at 0 and grows when a segment does not fit; the samples
+ * already written are then shifted down to match, with rounding.
+ */
+
+void arm_conv_fft_ola_q15(
+  arm_rfft_fast_instance_f32 * S,
+  q15_t * pIn,
+  uint32_t inLen,
+  uint8_t inRev,
+  q15_t * pKern,
+  uint32_t kernLen,
+  uint8_t kernRev,
+  q15_t * pDst,
+  float32_t * pScratch,
+  int8_t * pShift)
+{
+  uint32_t fftLen = S->fftLenRFFT;               /* FFT length */
+  float32_t *pH = pScratch;                      /* Kernel spectrum */
+  float32_t *pX = pScratch + fftLen;             /* Segment, then product spectrum */
+  float32_t *pY = pScratch + (2U * fftLen);      /* Segment spectrum, then result */
+  float32_t *pT = pScratch + (3U * fftLen);      /* Overlap for the next segment */
+  uint32_t segLen = (fftLen - kernLen) + 1U;     /* Input samples per segment */
+  uint32_t start, blkLen, outLen, overlap, done; /* Segment bounds */
+  uint32_t shift = 0U, newShift;                 /* Output shift */
+  float32_t gain = 1.0f;                         /* 2^shift */
+  float32_t absMax, in;                          /* Temporary variables */
+  q15_t *pOut;                                   /* Output pointer */
+  uint32_t i;                                    /* Loop counter */
+
+  /* Kernel spectrum, scaled so the results come out in Q15 LSBs, as the
+   * 1.30 products shifted down by 15 of arm_conv_q15() */
+  for (i = 0U; i < kernLen; i++)
+  {
+    pX[i] = (float32_t) pKern[(kernRev == 1U) ? (kernLen - 1U - i) : i] * (1.0f / 32768.0f);
+  }
+  for (; i < fftLen; i++)
+  {
+    pX[i] = 0.0f;
+  }
+  arm_rfft_fast_f32(S, pX, pH, 0U);
+
+  for (start = 0U; start < inLen; start += segLen)
+  {
+    blkLen = inLen - start;
+    if (blkLen > segLen)
+    {
+      blkLen = segLen;
+    }
+
+    /* Zero padded segment */
+    for (i = 0U; i < blkLen; i++)
+    {
+      pX[i] = (float32_t) pIn[(inRev == 1U) ? (inLen - 1U - (start + i)) : (start + i)];
+    }
+    for (; i < fftLen; i++)
+    {
+      pX[i] = 0.0f;
+    }
+
+    arm_rfft_fast_f32(S, pX, pY, 0U);
+
+    /* Bins 0 and fftLen/2 are real and packed in the first pair */
+    pX[0] = pY[0] * pH[0];
+    pX[1] = pY[1] * pH[1];
+    arm_cmplx_mult_cmplx_f32(pY + 2, pH + 2, pX + 2, (fftLen >> 1U) - 1U);
+
+    arm_rfft_fast_f32(S, pX, pY, 1U);
+
+    /* The first kernLen - 1 results overlap the tail of the previous segment,
+     * kept in floating-point so that it is rounded only once */
+    outLen = blkLen + (kernLen - 1U);
+    overlap = (start == 0U) ? 0U : (kernLen - 1U);
+    pOut = pDst + start;
+
+    for (i = 0U; i < overlap; i++)
+    {
+      pY[i] += pT[i];
+    }
+
+    /* All results are final after the last segment, the first blkLen before */
+    done = ((start + blkLen) == inLen) ? outLen : blkLen;
+
+    /* The shift that fits the finished results after rounding */
+    absMax = 0.0f;
+    for (i = 0U; i < done; i++)
+    {
+      in = (pY[i] < 0.0f) ? -pY[i] : pY[i];
+      absMax = (in > absMax) ? in : absMax;
+    }
+
+    newShift = shift;
+    while (absMax >= (32767.5f * gain))
+    {
+      newShift++;
+      gain *= 2.0f;
+    }
+
+    /* Bring the earlier results to the new shift */
+    if (newShift > shift)
+    {
+      for (i = 0U; i < start; i++)
+      {
+        pDst[i] = (q15_t) (((q31_t) pDst[i] + (1 << (newShift - shift - 1U))) >> (newShift - shift));
+      }
+      shift = newShift;
+    }
+
+    for (i = 0U; i < done; i++)
+    {
+      in = pY[i] / gain;
+      pOut[i] = (q15_t) __SSAT((q31_t) ((in > 0.0f) ? (in + 0.5f) : (in - 0.5f)), 16);
+    }
+    for (; i < outLen; i++)
+    {
+      pT[i - done] = pY[i];
+    }
+  }
+
+  *pShift = (int8_t) shift;
+}
+
+/**
+ * @brief FFT based convolution of Q15 sequences, with the result in block floating point.
+ * @param[in]  *pSrcA    points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  *pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] *pDst     points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  fftLen    FFT length, 32 to 4096, not less than the shorter sequence.
+ * @param[in]  *pScratch points to the work buffer of 4*fftLen floating-point values.
+ * @param[out] *pShift   points to the shift of the result: each output is <code>pDst[n] << *pShift</code> in 1.15 format.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported length or is shorter than the shorter sequence.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The result is that of <code>arm_conv_q15()</code>, the sum of the 1.30 products truncated to 1.15,
+ * except that it is rounded and does not saturate: when it does not fit in 1.15,
+ * <code>*pShift</code> is the smallest shift that makes it fit and each output holds the result shifted down by it.
+ * The computation is in single precision, so the error is within 1 LSB of the output for
+ * kernels of up to a few thousand samples.
+ */
+
+arm_status arm_conv_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint16_t fftLen,
+  float32_t * pScratch,
+  int8_t * pShift)
+{
+  arm_rfft_fast_instance_f32 S;                  /* Real FFT instance */
+
+  if ((srcALen == 0U) || (srcBLen == 0U) || ((fftLen & (fftLen - 1U)) != 0U) ||
+      (arm_rfft_fast_init_f32(&S, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The shorter sequence is the kernel */
+  if (srcALen >= srcBLen)
+  {
+    if (srcBLen > fftLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    arm_conv_fft_ola_q15(&S, pSrcA, srcALen, 0U, pSrcB, srcBLen, 0U, pDst, pScratch, pShift);
+  }
+  else
+  {
+    if (srcALen > fftLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+    arm_conv_fft_ola_q15(&S, pSrcB, srcBLen, 0U, pSrcA, srcALen, 0U, pDst, pScratch, pShift);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
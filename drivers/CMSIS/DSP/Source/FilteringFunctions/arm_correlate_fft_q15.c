@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_fft_q15.c
+ * Description:  FFT based correlation of Q15 sequences in block floating point
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup ConvFFT
+ * @{
+ */
+
+extern void arm_conv_fft_ola_q15(
+  arm_rfft_fast_instance_f32 * S,
+  q15_t * pIn,
+  uint32_t inLen,
+  uint8_t inRev,
+  q15_t * pKern,
+  uint32_t kernLen,
+  uint8_t kernRev,
+  q15_t * pDst,
+  float32_t * pScratch,
+  int8_t * pShift);
+
+/**
+ * @brief FFT based correlation of Q15 sequences, with the result in block floating point.
+ * @param[in]  *pSrcA    points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  *pSrcB    points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] *pDst     points to the location where the output result is written.  Length 2 * max(srcALen, srcBLen) - 1.
+ * @param[in]  fftLen    FFT length, 32 to 4096, not less than the shorter sequence.
+ * @param[in]  *pScratch points to the work buffer of 4*fftLen floating-point values.
+ * @param[out] *pShift   points to the shift of the result: each output is <code>pDst[n] << *pShift</code> in 1.15 format.
+ * @return The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported length or is shorter than the shorter sequence.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * As <code>arm_conv_fft_q15()</code>: the result is that of <code>arm_correlate_q15()</code>,
+ * rounded and in block floating point instead of saturated.
+ * The <code>abs(srcALen - srcBLen)</code> outputs that <code>arm_correlate_q15()</code> leaves
+ * untouched are written with zeros here, so <code>pDst</code> need not be cleared first.
+ */
+
+arm_status arm_correlate_fft_q15(
+  q15_t * pSrcA,
+  uint32_t srcALen,
+  q15_t * pSrcB,
+  uint32_t srcBLen,
+  q15_t * pDst,
+  uint16_t fftLen,
+  float32_t * pScratch,
+  int8_t * pShift)
+{
+  arm_rfft_fast_instance_f32 S;                  /* Real FFT instance */
+  uint32_t kernLen;                              /* Length of the shorter sequence */
+  uint32_t convLen = (srcALen + srcBLen) - 1U;   /* Length of the nonzero part */
+  uint32_t pad;                                  /* Zeros in the output */
+  uint32_t i;                                    /* Loop counter */
+
+  kernLen = (srcALen >= srcBLen) ? srcBLen : srcALen;
+
+  if ((kernLen == 0U) || (kernLen > fftLen) || ((fftLen & (fftLen - 1U)) != 0U) ||
+      (arm_rfft_fast_init_f32(&S, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Correlation is the convolution of pSrcA with pSrcB reversed in time:
+   *     c[n] = sum(a[k] * b[srcBLen - 1 - n + k])
+   * over the nonzero part of the output, which starts after srcALen - srcBLen
+   * zeros when pSrcA is the longer sequence and ends srcBLen - srcALen zeros
+   * before the end otherwise. */
+  pad = (srcALen >= srcBLen) ? (srcALen - srcBLen) : (srcBLen - srcALen);
+
+  if (srcALen >= srcBLen)
+  {
+    for (i = 0U; i < pad; i++)
+    {
+      pDst[i] = 0;
+    }
+    arm_conv_fft_ola_q15(&S, pSrcA, srcALen, 0U, pSrcB, srcBLen, 1U, pDst + pad, pScratch, pShift);
+  }
+  else
+  {
+    for (i = 0U; i < pad; i++)
+    {
+      pDst[convLen + i] = 0;
+    }
+    arm_conv_fft_ola_q15(&S, pSrcB, srcBLen, 1U, pSrcA, srcALen, 0U, pDst, pScratch, pShift);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ConvFFT group
+ */
@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_f32.c
+ * Description:  Floating-point FIR filter with a circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Circ Finite Impulse Response (FIR) Filters with Circular State
+ *
+ * This group of functions implements the same filters as the FIR group for Q7, Q15, Q31,
+ * and floating-point data types, with the same coefficient layout and the same results.
+ * Only the state buffer differs.
+ *
+ * \par
+ * The standard FIR functions keep a linear state buffer of <code>numTaps + blockSize - 1</code>
+ * samples and copy the last <code>numTaps - 1</code> of them back to its start at the end of each call.
+ * For long filters run on short blocks that copy costs as much as the filtering itself;
+ * with <code>blockSize = 1</code> it is one extra move per tap.
+ * The functions here keep the state in a ring of <code>numTaps</code> samples instead and never move it.
+ *
+ * \par Algorithm:
+ * The ring is stored twice, one copy after the other, in a state array of <code>2 * numTaps</code> samples.
+ * Each input sample is written to both copies, at <code>stateIndex</code> and <code>stateIndex + numTaps</code>,
+ * so the <code>numTaps</code> samples that make up any output, wrapped or not, always lie contiguously
+ * from <code>pState[stateIndex + 1]</code>.
+ * The multiply-accumulate loops then run over plain arrays as in the FIR functions.
+ * The cost is a second store per input sample, independent of <code>numTaps</code>.
+ * \par
+ * <pre>
+ *    y[n] = b[0] * x[n] + b[1] * x[n-1] + b[2] * x[n-2] + ...+ b[numTaps-1] * x[n-numTaps+1]
+ * </pre>
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, stored in time reversed order
+ * as for the FIR functions:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * <code>pState</code> points to a state array of size <code>2 * numTaps</code>.
+ * Its size does not depend on <code>blockSize</code>, which may change from call to call.
+ * \par
+ * The filtering may be done in place, with <code>pSrc</code> equal to <code>pDst</code>.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a filter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+ * There are separate instance structure declarations for each of the 4 supported data types.
+ * The processing functions update <code>stateIndex</code>, so the instance structure cannot be placed into a const data section.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * numTaps, stateIndex, pState, pCoeffs. Set stateIndex and all of the values in pState to zero.
+ * <pre>
+ *arm_fir_circ_instance_f32 S = {numTaps, 0, pState, pCoeffs};
+ *arm_fir_circ_instance_q31 S = {numTaps, 0, pState, pCoeffs};
+ *arm_fir_circ_instance_q15 S = {numTaps, 0, pState, pCoeffs};
+ *arm_fir_circ_instance_q7 S =  {numTaps, 0, pState, pCoeffs};
+ * </pre>
+ *
+ * \par Fixed-Point Behavior
+ * The fixed-point functions use the accumulators, scaling and saturation of
+ * <code>arm_fir_q31()</code>, <code>arm_fir_q15()</code> and <code>arm_fir_q7()</code>
+ * and give bit exact results with them.
+ */
+
+/**
+ * @addtogroup FIR_Circ
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR filter with circular state.
+ * @param[in,out] *S        points to an instance of the floating-point circular state FIR structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of samples to process per call.
+ * @return        none.
+ */
+
+void arm_fir_circ_f32(
+  arm_fir_circ_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pWin;                               /* Oldest sample of the current output */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0;                                /* Accumulator */
+#if defined (ARM_MATH_DSP)
+  float32_t acc1, acc2, acc3;                    /* Accumulators */
+  float32_t x0, x1, x2, x3, c0;                  /* Temporary variables to hold state and coefficient values */
+#endif
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t stateIndex = S->stateIndex;           /* Ring position of the next input sample */
+  uint32_t chunk, i, tapCnt, blkCnt;             /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* Process up to the end of the ring at most */
+    chunk = numTaps - stateIndex;
+    if (chunk > blockSize)
+    {
+      chunk = blockSize;
+    }
+
+    /* The new samples go to the upper copy first: the outputs of this chunk
+     * still read older samples from the lower copy past stateIndex. */
+    px = &pState[numTaps + stateIndex];
+    for (i = 0U; i < chunk; i++)
+    {
+      px[i] = pSrc[i];
+    }
+
+    /* The numTaps samples of the first output end with pSrc[0] */
+    pWin = &pState[stateIndex + 1U];
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time, sharing each coefficient load */
+    blkCnt = chunk >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        /* Slide the samples by one */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        tapCnt--;
+      }
+
+      *pDst++ = acc0;
+      *pDst++ = acc1;
+      *pDst++ = acc2;
+      *pDst++ = acc3;
+
+      pWin += 4U;
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 outputs */
+    blkCnt = chunk % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = chunk;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      acc0 = 0.0f;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        acc0 += *px++ * *pb++;
+        tapCnt--;
+      }
+
+      *pDst++ = acc0;
+
+      pWin++;
+      blkCnt--;
+    }
+
+    /* Now the lower copy, for the outputs of the next lap. It is taken from
+     * the upper copy as pSrc may have been overwritten in place. */
+    px = &pState[stateIndex];
+    for (i = 0U; i < chunk; i++)
+    {
+      px[i] = px[numTaps + i];
+    }
+
+    pSrc += chunk;
+    blockSize -= chunk;
+    stateIndex += chunk;
+    if (stateIndex == numTaps)
+    {
+      stateIndex = 0U;
+    }
+  }
+
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of FIR_Circ group
+ */
@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_q31.c
+ * Description:  Q31 FIR filter with a circular state buffer
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @addtogroup FIR_Circ
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 FIR filter with circular state.
+ * @param[in,out] *S        points to an instance of the Q31 circular state FIR structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of samples to process per call.
+ * @return        none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As <code>arm_fir_q31()</code>: the products are accumulated in a 64-bit accumulator in 2.62 format,
+ * and the result is truncated to 1.31 format by discarding the low 31 bits, without saturation.
+ * To avoid overflows scale the input down by log2(numTaps) bits.
+ */
+
+void arm_fir_circ_q31(
+  arm_fir_circ_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* State pointer */
+  q31_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q31_t *pWin;                                   /* Oldest sample of the current output */
+  q31_t *px, *pb;                                /* Temporary pointers for state and coefficient buffers */
+  q63_t acc0;                                    /* Accumulator */
+#if defined (ARM_MATH_DSP)
+  q63_t acc1, acc2, acc3;                        /* Accumulators */
+  q31_t x0, x1, x2, x3, c0;                      /* Temporary variables to hold state and coefficient values */
+#endif
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t stateIndex = S->stateIndex;           /* Ring position of the next input sample */
+  uint32_t chunk, i, tapCnt, blkCnt;             /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    /* Process up to the end of the ring at most */
+    chunk = numTaps - stateIndex;
+    if (chunk > blockSize)
+    {
+      chunk = blockSize;
+    }
+
+    /* The new samples go to the upper copy first: the outputs of this chunk
+     * still read older samples from the lower copy past stateIndex. */
+    px = &pState[numTaps + stateIndex];
+    for (i = 0U; i < chunk; i++)
+    {
+      px[i] = pSrc[i];
+    }
+
+    /* The numTaps samples of the first output end with pSrc[0] */
+    pWin = &pState[stateIndex + 1U];
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Compute 4 outputs at a time, sharing each coefficient load */
+    blkCnt = chunk >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      acc0 = 0;
+      acc1 = 0;
+      acc2 = 0;
+      acc3 = 0;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      x0 = *px++;
+      x1 = *px++;
+      x2 = *px++;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        c0 = *pb++;
+        x3 = *px++;
+
+        acc0 += (q63_t) x0 * c0;
+        acc1 += (q63_t) x1 * c0;
+        acc2 += (q63_t) x2 * c0;
+        acc3 += (q63_t) x3 * c0;
+
+        /* Slide the samples by one */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        tapCnt--;
+      }
+
+      *pDst++ = (q31_t) (acc0 >> 31U);
+      *pDst++ = (q31_t) (acc1 >> 31U);
+      *pDst++ = (q31_t) (acc2 >> 31U);
+      *pDst++ = (q31_t) (acc3 >> 31U);
+
+      pWin += 4U;
+      blkCnt--;
+    }
+
+    /* Compute the remaining 1 to 3 outputs */
+    blkCnt = chunk % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = chunk;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      acc0 = 0;
+
+      px = pWin;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      while (tapCnt > 0U)
+      {
+        acc0 += (q63_t) *px++ * *pb++;
+        tapCnt--;
+      }
+
+      *pDst++ = (q31_t) (acc0 >> 31U);
+
+      pWin++;
+      blkCnt--;
+    }
+
+    /* Now the lower copy, for the outputs of the next lap. It is taken from
+     * the upper copy as pSrc may have been overwritten in place. */
+    px = &pState[stateIndex];
+    for (i = 0U; i < chunk; i++)
+    {
+      px[i] = px[numTaps + i];
+    }
+
+    pSrc += chunk;
+    blockSize -= chunk;
+    stateIndex += chunk;
+    if (stateIndex == numTaps)
+    {
+      stateIndex = 0U;
+    }
+  }
+
+  S->stateIndex = (uint16_t) stateIndex;
+}
+
+/**
+ * @} end of FIR_Circ group
+ */
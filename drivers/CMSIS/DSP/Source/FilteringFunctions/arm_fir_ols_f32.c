@@ -0,0 +1,213 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_ols_f32.c
+ * Description:  Floating-point FIR filter by partitioned overlap-save
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_OLS Partitioned Overlap-Save FIR Filter
+ *
+ * This function implements the same filter as <code>arm_fir_f32()</code> for
+ * streamed data, in the frequency domain.  <code>arm_fir_f32()</code> costs
+ * <code>numTaps</code> multiply-accumulates per sample; this filter costs two
+ * real FFTs of <code>2 * partSize</code> points per <code>partSize</code>
+ * samples, plus <code>numTaps / partSize</code> spectrum products.  For filters
+ * of several hundred taps and more it is many times faster.
+ *
+ * \par Algorithm
+ * The impulse response is cut into <code>numParts = ceil(numTaps / partSize)</code>
+ * partitions of <code>partSize</code> taps, each zero padded to
+ * <code>fftLen = 2 * partSize</code> points and transformed once by the
+ * initialization function.
+ * Each call takes the input in blocks of <code>partSize</code> samples.  The last
+ * <code>fftLen</code> input samples are transformed and the spectrum stored in a
+ * frequency domain delay line that keeps those of the last <code>numParts</code> blocks.
+ * The output spectrum is the sum of the products of each partition with the
+ * spectrum of the block as old as the partition:
+ * <pre>
+ *    Y = X[t] * H[0] + X[t-1] * H[1] + ... + X[t-numParts+1] * H[numParts-1]
+ * </pre>
+ * and the last <code>partSize</code> points of its inverse transform are the
+ * output block (overlap-save).  The first <code>partSize</code> points are
+ * corrupted by the circular convolution and dropped.
+ *
+ * \par Latency
+ * The output of each block is that of the same input block, as for
+ * <code>arm_fir_f32()</code>: there is no delay beyond collecting
+ * <code>partSize</code> samples.  Small partitions give low latency but more
+ * products per sample, large ones the reverse.  For a fixed <code>partSize</code>
+ * the FFT cost per sample is constant and the spectrum products make the cost
+ * per sample grow linearly with <code>numTaps / partSize</code>; with
+ * <code>partSize</code> near <code>numTaps</code> it grows with <code>log2(numTaps)</code>.
+ *
+ * \par Work memory
+ * The functions allocate nothing.  All sizes are in floating-point values and have
+ * macros for static allocation:
+ * - <code>pCoeffsFd</code>, partition spectra: <code>2 * partSize * numParts</code>,
+ *   <code>ARM_FIR_OLS_COEFFS_LEN(numTaps, partSize)</code>
+ * - <code>pState</code>, input block pair and delay line: <code>2 * partSize * (numParts + 1)</code>,
+ *   <code>ARM_FIR_OLS_STATE_LEN(numTaps, partSize)</code>
+ * - <code>pScratch</code>, passed to each call: <code>4 * partSize</code>,
+ *   <code>ARM_FIR_OLS_SCRATCH_LEN(partSize)</code>
+ * \par
+ * The scratch buffer holds nothing between calls and may be shared by filters
+ * that do not run concurrently.
+ *
+ * \par Instance Structure
+ * The partition spectra, state and FFT instance of a filter are stored together in an
+ * instance data structure.  A separate instance structure must be defined for each filter.
+ * Spectrum arrays may be shared among several instances of the same filter while state
+ * arrays cannot be shared.  The instance structure must be set up by
+ * <code>arm_fir_ols_init_f32()</code>, which transforms the coefficients.
+ */
+
+/**
+ * @addtogroup FIR_OLS
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point partitioned overlap-save FIR filter.
+ * @param[in,out] *S        points to an instance of the floating-point overlap-save FIR structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of samples to process, a multiple of <code>partSize</code>.
+ * @param[in]     *pScratch points to the work buffer of length 4*partSize.
+ * @return        ARM_MATH_SUCCESS, or ARM_MATH_LENGTH_ERROR, with nothing processed,
+ *                if <code>blockSize</code> is not a multiple of <code>partSize</code>.
+ *
+ * The filtering may be done in place, with <code>pSrc</code> equal to <code>pDst</code>.
+ */
+
+arm_status arm_fir_ols_f32(
+  arm_fir_ols_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  float32_t * pScratch)
+{
+  uint32_t partSize = S->partSize;               /* Samples per block */
+  uint32_t fftLen = 2U * partSize;               /* FFT length */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  uint32_t partIndex = S->partIndex;             /* Delay line slot of the newest spectrum */
+  float32_t *pTime = S->pState;                  /* Last two input blocks */
+  float32_t *pFdl = S->pState + fftLen;          /* Frequency domain delay line */
+  float32_t *pAcc = pScratch;                    /* Output spectrum */
+  float32_t *pTmp = pScratch + fftLen;           /* FFT input, product and output */
+  float32_t *pX, *pH, *pY;                       /* Spectrum pointers */
+  float32_t xRe, xIm, hRe, hIm;                  /* Bin values */
+  uint32_t blkCnt, binCnt, p, slot;              /* Loop counters */
+
+  /* partSize is a power of 2 */
+  if ((blockSize & (partSize - 1U)) != 0U)
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  blkCnt = blockSize / partSize;
+
+  while (blkCnt > 0U)
+  {
+    /* Slide the input by one block */
+    arm_copy_f32(pTime + partSize, pTime, partSize);
+    arm_copy_f32(pSrc, pTime + partSize, partSize);
+
+    /* The delay line runs backwards, so the partition index is the distance
+     * from the newest slot */
+    partIndex = (partIndex == 0U) ? (numParts - 1U) : (partIndex - 1U);
+
+    /* arm_rfft_fast_f32() overwrites its input */
+    arm_copy_f32(pTime, pTmp, fftLen);
+    arm_rfft_fast_f32(&S->rfft, pTmp, pFdl + (partIndex * fftLen), 0U);
+
+    /* Newest spectrum times the first partition.
+     * Bins 0 and fftLen/2 are real and packed in the first pair */
+    pX = pFdl + (partIndex * fftLen);
+    pH = S->pCoeffs;
+    pAcc[0] = pX[0] * pH[0];
+    pAcc[1] = pX[1] * pH[1];
+    arm_cmplx_mult_cmplx_f32(pX + 2, pH + 2, pAcc + 2, partSize - 1U);
+
+    slot = partIndex;
+
+    /* The other partitions are multiplied and accumulated in one pass */
+    for (p = 1U; p < numParts; p++)
+    {
+      pH += fftLen;
+      slot++;
+      if (slot == numParts)
+      {
+        slot = 0U;
+      }
+
+      pX = pFdl + (slot * fftLen);
+      pY = pAcc;
+
+      pY[0] += pX[0] * pH[0];
+      pY[1] += pX[1] * pH[1];
+
+      binCnt = partSize - 1U;
+      pX += 2;
+      pH += 2;
+      pY += 2;
+
+      while (binCnt > 0U)
+      {
+        xRe = *pX++;
+        xIm = *pX++;
+        hRe = *pH++;
+        hIm = *pH++;
+
+        /* y += x * h */
+        *pY++ += (xRe * hRe) - (xIm * hIm);
+        *pY++ += (xRe * hIm) + (xIm * hRe);
+
+        binCnt--;
+      }
+
+      pH -= fftLen;
+    }
+
+    /* The second half is the linear convolution */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pTmp, 1U);
+    arm_copy_f32(pTmp + partSize, pDst, partSize);
+
+    pSrc += partSize;
+    pDst += partSize;
+    blkCnt--;
+  }
+
+  S->partIndex = (uint16_t) partIndex;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of FIR_OLS group
+ */
@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_ols_init_f32.c
+ * Description:  Floating-point partitioned overlap-save FIR filter initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_OLS
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point partitioned overlap-save FIR filter.
+ * @param[in,out] *S         points to an instance of the floating-point overlap-save FIR structure.
+ * @param[in]     numTaps    Number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficients buffer.
+ * @param[out]    *pCoeffsFd points to the partition spectra buffer of length ARM_FIR_OLS_COEFFS_LEN(numTaps, partSize).
+ * @param[in]     *pState    points to the state buffer of length ARM_FIR_OLS_STATE_LEN(numTaps, partSize).
+ * @param[in]     partSize   samples per partition and per processed block, 16 to 2048, a power of 2.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numTaps</code> is 0 or <code>partSize</code> is not supported.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+ * as for <code>arm_fir_init_f32()</code>:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * It is only read here: the filter uses the spectra written to <code>pCoeffsFd</code>.
+ * \par
+ * The state buffer is cleared.
+ */
+
+arm_status arm_fir_ols_init_f32(
+  arm_fir_ols_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pCoeffsFd,
+  float32_t * pState,
+  uint16_t partSize)
+{
+  uint32_t fftLen = 2U * partSize;               /* FFT length */
+  uint32_t numParts;                             /* Number of partitions */
+  uint32_t p, i, k;                              /* Loop counters */
+
+  if ((numTaps == 0U) || (partSize < 16U) || ((partSize & (partSize - 1U)) != 0U) ||
+      (arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  numParts = ARM_FIR_OLS_NUM_PARTS(numTaps, partSize);
+
+  /* Transform each partition of the impulse response, zero padded to fftLen,
+   * using the state buffer as work memory */
+  for (p = 0U; p < numParts; p++)
+  {
+    for (i = 0U; i < fftLen; i++)
+    {
+      k = (p * partSize) + i;
+      pState[i] = ((i < partSize) && (k < numTaps)) ? pCoeffs[numTaps - 1U - k] : 0.0f;
+    }
+    arm_rfft_fast_f32(&S->rfft, pState, pCoeffsFd + (p * fftLen), 0U);
+  }
+
+  /* Clear the input blocks and the delay line */
+  memset(pState, 0, (fftLen * (numParts + 1U)) * sizeof(float32_t));
+
+  /* Assign the fields */
+  S->numTaps = numTaps;
+  S->partSize = partSize;
+  S->numParts = (uint16_t) numParts;
+  S->partIndex = 0U;
+  S->pState = pState;
+  S->pCoeffs = pCoeffsFd;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_OLS group
+ */
@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point FIR resampler
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Resampler
+ *
+ * These functions change the sample rate by a rational factor <code>L/M</code>, or by any
+ * factor in the fractional mode.  They are equivalent to an \ref FIR_Interpolate "FIR interpolator"
+ * by <code>L</code> followed by keeping one sample in <code>M</code>, but compute only the samples kept:
+ * the cost is <code>phaseLength</code> multiply-accumulates per output sample, where the cascade of
+ * <code>arm_fir_interpolate_f32()</code> and <code>arm_fir_decimate_f32()</code> computes <code>L</code>
+ * samples per input sample and then filters them again.
+ * \par
+ * The filter is designed at <code>L</code> times the input rate, as for the FIR interpolator, with a
+ * normalized cutoff frequency of <code>1/max(L, M)</code>, so that it removes both the images of the
+ * upsampling and what would alias in the downsampling.  Its gain should be <code>L</code>.
+ * The user of the function is responsible for providing the filter coefficients.
+ *
+ * \par Algorithm:
+ * Output sample <code>m</code> is at <code>m*M</code> on the upsampled time axis: at input sample
+ * <code>n = floor(m*M/L)</code>, and it is computed with polyphase component <code>p = m*M - n*L</code>:
+ * <pre>
+ *    y[m] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+ * </pre>
+ * With <code>M = 1</code> this is the output of the FIR interpolator.
+ * The coefficients and <code>phaseLength=numTaps/L</code> are those of the FIR interpolator, stored in
+ * time reversed order:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * \par
+ * The functions take a block of <code>blockSize</code> input samples and return the number of output
+ * samples written, which varies from block to block unless <code>blockSize*L</code> is a multiple of
+ * <code>M</code>.  <code>pDst</code> must have room for <code>ARM_FIR_RESAMPLE_MAX_OUT(blockSize, L, stepInt)</code>
+ * samples.  <code>pState</code> points to a state array of size <code>blockSize + phaseLength</code>.
+ *
+ * \par Fractional mode
+ * <code>arm_fir_resample_set_ratio_f32()</code> sets the step to any number of input samples per output
+ * sample, which may be changed between calls to follow the drift between two clocks.  The step is then
+ * kept as components and a 32-bit fraction of a component, and each output sample interpolates linearly
+ * between the outputs of the two nearest components, for twice the multiply-accumulates.  The more
+ * components, the smaller the error of the interpolation: <code>L</code> of 32 to 256 are typical, with
+ * a filter whose cutoff is set by the ratio instead of <code>L</code>.
+ * Output samples stay continuous across changes of the ratio.
+ *
+ * \par Fixed-Point Behavior
+ * The Q15 function accumulates in 64 bits, as <code>arm_fir_interpolate_q15()</code> does, and saturates
+ * the result to 1.15 format.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Output of one polyphase component of the floating-point FIR resampler.
+ * @param[in]  *pState    points to the oldest of the <code>phaseLen</code> input samples.
+ * @param[in]  *pCoeffs   points to the last coefficient of the component.
+ * @param[in]  L          number of components, the coefficient stride.
+ * @param[in]  phaseLen   length of each component.
+ * @return the output sample.
+ */
+
+static float32_t arm_fir_resample_dot_f32(
+  const float32_t * pState,
+  const float32_t * pCoeffs,
+  uint32_t L,
+  uint32_t phaseLen)
+{
+  float32_t sum0 = 0.0f, sum1 = 0.0f;            /* Accumulators */
+  uint32_t tapCnt;                               /* Loop counter */
+
+  /* Loop unrolling, two accumulators to hide the latency of the additions */
+  tapCnt = phaseLen >> 2U;
+
+  while (tapCnt > 0U)
+  {
+    sum0 += pState[0] * pCoeffs[0];
+    sum1 += pState[1] * pCoeffs[L];
+    sum0 += pState[2] * pCoeffs[2U * L];
+    sum1 += pState[3] * pCoeffs[3U * L];
+
+    pState += 4U;
+    pCoeffs += 4U * L;
+    tapCnt--;
+  }
+
+  tapCnt = phaseLen & 0x3U;
+
+  while (tapCnt > 0U)
+  {
+    sum0 += *pState++ * *pCoeffs;
+    pCoeffs += L;
+    tapCnt--;
+  }
+
+  return (sum0 + sum1);
+}
+
+/**
+ * @brief Processing function for the floating-point FIR resampler.
+ * @param[in,out] *S         points to an instance of the floating-point FIR resampler structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return the number of output samples written.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  uint32_t L = S->L;                             /* Number of components */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each component */
+  uint32_t stepSamples = S->stepInt / L;         /* Whole input samples per step */
+  uint32_t stepPhases = S->stepInt % L;          /* Components per step beyond them */
+  uint32_t pos = S->pos;                         /* Oldest input sample of the next output */
+  uint32_t phase = S->phase;                     /* Component of the next output */
+  uint32_t frac = S->phaseFrac;                  /* Fraction of a component */
+  uint32_t carry;                                /* Carry of the fraction */
+  uint32_t outCnt = 0U;                          /* Output samples written */
+  float32_t out, next;                           /* Outputs of two components */
+
+  /* The state buffer holds the previous phaseLen samples, the new ones follow */
+  arm_copy_f32((float32_t *) pSrc, pState + phaseLen, blockSize);
+
+  /* The next component of the last one is the first one, one input sample later */
+  while ((pos + (((phase + 1U == L) && (frac != 0U)) ? 1U : 0U)) <= blockSize)
+  {
+    out = arm_fir_resample_dot_f32(pState + pos, pCoeffs + (L - 1U - phase), L, phaseLen);
+
+    if (frac != 0U)
+    {
+      next = (phase + 1U < L) ?
+             arm_fir_resample_dot_f32(pState + pos, pCoeffs + (L - 2U - phase), L, phaseLen) :
+             arm_fir_resample_dot_f32(pState + pos + 1U, pCoeffs + (L - 1U), L, phaseLen);
+
+      out += (next - out) * ((float32_t) frac * 2.3283064365386963e-10f);
+    }
+
+    *pDst++ = out;
+    outCnt++;
+
+    /* Step to the next output */
+    carry = ((frac + S->stepFrac) < frac) ? 1U : 0U;
+    frac += S->stepFrac;
+    phase += stepPhases + carry;
+    pos += stepSamples;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      pos++;
+    }
+  }
+
+  /* Keep the last phaseLen samples for the next call */
+  pos -= blockSize;
+  memmove(pState, pState + blockSize, phaseLen * sizeof(float32_t));
+
+  S->pos = pos;
+  S->phase = phase;
+  S->phaseFrac = frac;
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,107 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_init_q15.c
+ * Description:  Q15 FIR resampler initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 FIR resampler.
+ * @param[in,out] *S         points to an instance of the Q15 FIR resampler structure.
+ * @param[in]     L          upsample factor, the number of polyphase components.
+ * @param[in]     M          downsample factor.
+ * @param[in]     numTaps    number of filter coefficients in the filter.
+ * @param[in]     *pCoeffs   points to the filter coefficient buffer.
+ * @param[in]     *pState    points to the state buffer.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return        The function returns ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR if the filter length
+ * <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>, or
+ * ARM_MATH_ARGUMENT_ERROR if <code>L</code> or <code>M</code> is 0.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+ * as for <code>arm_fir_interpolate_init_q15()</code>:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * The length of the filter <code>numTaps</code> must be a multiple of the interpolation factor <code>L</code>.
+ * \par
+ * <code>pState</code> points to the array of state variables.
+ * <code>pState</code> is of length <code>(numTaps/L)+blockSize</code> words
+ * where <code>blockSize</code> is the largest number of input samples processed by each call to
+ * <code>arm_fir_resample_q15()</code>.  The state buffer is cleared and the ratio is <code>M/L</code>
+ * input samples per output sample, with no fraction.
+ */
+
+arm_status arm_fir_resample_init_q15(
+  arm_fir_resample_instance_q15 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  q15_t * pCoeffs,
+  q15_t * pState,
+  uint32_t blockSize)
+{
+  if ((L == 0U) || (M == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* The filter length must be a multiple of the interpolation factor */
+  if ((numTaps % L) != 0U)
+  {
+    return (ARM_MATH_LENGTH_ERROR);
+  }
+
+  S->L = L;
+  S->phaseLength = numTaps / L;
+  S->stepInt = M;
+  S->stepFrac = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* The first output sample ends with the first input sample */
+  S->pos = 1U;
+  S->phase = 0U;
+  S->phaseFrac = 0U;
+
+  /* Clear state buffer and size of buffer is always phaseLength + blockSize */
+  memset(pState, 0, (blockSize + (uint32_t) S->phaseLength) * sizeof(q15_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q15.c
+ * Description:  Q15 FIR resampler
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Output of one polyphase component of the Q15 FIR resampler.
+ * @param[in]  *pState    points to the oldest of the <code>phaseLen</code> input samples.
+ * @param[in]  *pCoeffs   points to the last coefficient of the component.
+ * @param[in]  L          number of components, the coefficient stride.
+ * @param[in]  phaseLen   length of each component.
+ * @return the sum of the products in 34.30 format.
+ */
+
+static q63_t arm_fir_resample_dot_q15(
+  const q15_t * pState,
+  const q15_t * pCoeffs,
+  uint32_t L,
+  uint32_t phaseLen)
+{
+  q63_t sum = 0;                                 /* Accumulator */
+  uint32_t tapCnt;                               /* Loop counter */
+
+  /* Loop unrolling */
+  tapCnt = phaseLen >> 2U;
+
+  while (tapCnt > 0U)
+  {
+    sum += (q31_t) pState[0] * pCoeffs[0];
+    sum += (q31_t) pState[1] * pCoeffs[L];
+    sum += (q31_t) pState[2] * pCoeffs[2U * L];
+    sum += (q31_t) pState[3] * pCoeffs[3U * L];
+
+    pState += 4U;
+    pCoeffs += 4U * L;
+    tapCnt--;
+  }
+
+  tapCnt = phaseLen & 0x3U;
+
+  while (tapCnt > 0U)
+  {
+    sum += (q31_t) *pState++ * *pCoeffs;
+    pCoeffs += L;
+    tapCnt--;
+  }
+
+  return (sum);
+}
+
+/**
+ * @brief Processing function for the Q15 FIR resampler.
+ * @param[in,out] *S         points to an instance of the Q15 FIR resampler structure.
+ * @param[in]     *pSrc      points to the block of input data.
+ * @param[out]    *pDst      points to the block of output data.
+ * @param[in]     blockSize  number of input samples to process per call.
+ * @return the number of output samples written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+ * In the fractional mode the outputs of the two components are interpolated in the accumulator
+ * with a 16-bit weight.
+ * After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+ * Lastly, the accumulator is saturated to yield a result in 1.15 format.
+ */
+
+uint32_t arm_fir_resample_q15(
+  arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  uint32_t L = S->L;                             /* Number of components */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each component */
+  uint32_t stepSamples = S->stepInt / L;         /* Whole input samples per step */
+  uint32_t stepPhases = S->stepInt % L;          /* Components per step beyond them */
+  uint32_t pos = S->pos;                         /* Oldest input sample of the next output */
+  uint32_t phase = S->phase;                     /* Component of the next output */
+  uint32_t frac = S->phaseFrac;                  /* Fraction of a component */
+  uint32_t carry;                                /* Carry of the fraction */
+  uint32_t outCnt = 0U;                          /* Output samples written */
+  q63_t sum, next;                               /* Outputs of two components */
+
+  /* The state buffer holds the previous phaseLen samples, the new ones follow */
+  arm_copy_q15((q15_t *) pSrc, pState + phaseLen, blockSize);
+
+  /* The next component of the last one is the first one, one input sample later */
+  while ((pos + (((phase + 1U == L) && (frac != 0U)) ? 1U : 0U)) <= blockSize)
+  {
+    sum = arm_fir_resample_dot_q15(pState + pos, pCoeffs + (L - 1U - phase), L, phaseLen);
+
+    if (frac != 0U)
+    {
+      next = (phase + 1U < L) ?
+             arm_fir_resample_dot_q15(pState + pos, pCoeffs + (L - 2U - phase), L, phaseLen) :
+             arm_fir_resample_dot_q15(pState + pos + 1U, pCoeffs + (L - 1U), L, phaseLen);
+
+      sum += ((next - sum) * (q63_t) (frac >> 16)) >> 16;
+    }
+
+    *pDst++ = (q15_t) __SSAT((sum >> 15), 16);
+    outCnt++;
+
+    /* Step to the next output */
+    carry = ((frac + S->stepFrac) < frac) ? 1U : 0U;
+    frac += S->stepFrac;
+    phase += stepPhases + carry;
+    pos += stepSamples;
+
+    if (phase >= L)
+    {
+      phase -= L;
+      pos++;
+    }
+  }
+
+  /* Keep the last phaseLen samples for the next call */
+  pos -= blockSize;
+  memmove(pState, pState + blockSize, phaseLen * sizeof(q15_t));
+
+  S->pos = pos;
+  S->phase = phase;
+  S->phaseFrac = frac;
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_set_ratio_f32.c
+ * Description:  Floating-point FIR resampler ratio function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief  Sets the ratio of the floating-point FIR resampler, for the fractional mode.
+ * @param[in,out] *S     points to an instance of the floating-point FIR resampler structure.
+ * @param[in]     ratio  input samples per output sample, <code>1/L</code> or more.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>ratio</code> is less than <code>1/L</code>, in which case the ratio is not changed.
+ *
+ * <b>Description:</b>
+ * \par
+ * Sets the step between output samples to <code>ratio*L</code> polyphase components, in whole
+ * components and a 32-bit fraction.  It takes effect from the next output sample, so it may be
+ * called between any two blocks, for instance to follow the drift of a clock.  A ratio of
+ * <code>M/L</code> gives the rational mode of <code>arm_fir_resample_init_f32()</code> back.
+ * \par
+ * A ratio in single precision resolves about 0.06 ppm.  For a finer step, set
+ * <code>stepInt</code> and <code>stepFrac</code> of the instance directly.
+ */
+
+arm_status arm_fir_resample_set_ratio_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t ratio)
+{
+  double step = (double) ratio * (double) S->L;  /* Components per output sample */
+
+  if (!(step >= 1.0) || (step >= 4294967296.0))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->stepInt = (uint32_t) step;
+  S->stepFrac = (uint32_t) ((step - (double) S->stepInt) * 4294967296.0);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
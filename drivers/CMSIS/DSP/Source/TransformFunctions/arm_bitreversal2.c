@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_bitreversal2.c
+ * Description:  Bitreversal functions, C version of arm_bitreversal2.S
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Host (see arm_math_host.h)
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Cortex-M builds take arm_bitreversal2.S */
+#if defined (ARM_MATH_HOST)
+
+/*
+* @brief  In-place bit reversal function for arm_cfft_f32() and arm_cfft_q31().
+* @param[in, out] *pSrc        points to the in-place buffer of 32-bit data type.
+* @param[in]      bitRevLen    bit reversal table length.
+* @param[in]      *pBitRevTab  points to bit reversal table of swap pairs.
+* @return none.
+*
+* Each pair in the table holds the byte offsets of two complex 32-bit
+* values, 8 bytes each, that trade places.
+*/
+void arm_bitreversal_32(
+        uint32_t *pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t *pBitRevTab)
+{
+  uint32_t a, b, i, tmp;
+
+  for (i = 0U; i < bitRevLen; i += 2U)
+  {
+    a = pBitRevTab[i    ] >> 2U;
+    b = pBitRevTab[i + 1] >> 2U;
+
+    /* real */
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    /* imaginary */
+    tmp = pSrc[a + 1U];
+    pSrc[a + 1U] = pSrc[b + 1U];
+    pSrc[b + 1U] = tmp;
+  }
+}
+
+/*
+* @brief  In-place bit reversal function for arm_cfft_q15().
+* @param[in, out] *pSrc        points to the in-place buffer of 16-bit data type.
+* @param[in]      bitRevLen    bit reversal table length.
+* @param[in]      *pBitRevTab  points to bit reversal table of swap pairs.
+* @return none.
+*
+* The table is shared with the 32-bit transforms; a complex q15 value is
+* 4 bytes, so its offsets are halved.
+*/
+void arm_bitreversal_16(
+        uint16_t *pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t *pBitRevTab)
+{
+  uint16_t tmp;
+  uint32_t a, b, i;
+
+  for (i = 0U; i < bitRevLen; i += 2U)
+  {
+    a = pBitRevTab[i    ] >> 2U;
+    b = pBitRevTab[i + 1] >> 2U;
+
+    /* real */
+    tmp = pSrc[a];
+    pSrc[a] = pSrc[b];
+    pSrc[b] = tmp;
+
+    /* imaginary */
+    tmp = pSrc[a + 1U];
+    pSrc[a + 1U] = pSrc[b + 1U];
+    pSrc[b + 1U] = tmp;
+  }
+}
+
+#endif /* defined (ARM_MATH_HOST) */
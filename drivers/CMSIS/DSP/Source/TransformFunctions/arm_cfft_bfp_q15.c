@@ -0,0 +1,331 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bfp_q15.c
+ * Description:  Block floating-point Q15 complex FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup BlockFloatFFT Block Floating-Point FFT Functions
+ *
+ * \par
+ * <code>arm_cfft_q15()</code> and <code>arm_rfft_q15()</code> divide the data by 4
+ * at every radix 4 stage, whatever its level, so that no input can overflow: a
+ * 1024 point transform drops 10 bits.  A signal 40 dB below full scale keeps
+ * about one significant bit per bin, and white noise a few.
+ * The functions in this group scale only when the data needs it and return the
+ * total scaling as a block exponent: the data of all bins shares it, as a float
+ * mantissa shares the exponent of its value.
+ *
+ * \par Algorithm
+ * The transforms use the radix 4 and radix 2 decompositions, twiddle tables and
+ * bit reversal tables of <code>arm_cfft_q15()</code> and <code>arm_cfft_q31()</code>,
+ * and the instances set up for them.
+ * The input is first shifted left or right so that its largest value uses the
+ * bits the first stage may grow into, which also puts small inputs at full precision.
+ * Each stage then records the largest magnitude it writes, and the next stage
+ * shifts its results right only by the number of bits they could exceed the
+ * format by: 3 for a radix 4 butterfly, whose outputs grow up to 4 * sqrt(2)
+ * times, and 2 for radix 2.  The butterflies use 32-bit (Q15) or 64-bit (Q31)
+ * intermediates and round the shifted and rotated values.  Nothing saturates.
+ *
+ * \par Block exponent
+ * After the call, the data multiplied by <code>2^(*pBlockExp)</code> is the plain sum
+ * of the transform, without any 1/fftLen factor, in the units of the input:
+ * <pre>
+ *    X[k] = p1[k] * 2^(*pBlockExp) = sum(x[n] * exp(-+j * 2 * pi * n * k / fftLen))
+ * </pre>
+ * The result of <code>arm_cfft_q15()</code> for the same input corresponds to
+ * <code>*pBlockExp = log2(fftLen)</code>.  To get the inverse transform, scaled
+ * by 1/fftLen, subtract <code>log2(fftLen)</code>.  The exponent is negative when
+ * a small input was shifted up more than the transform grew.
+ *
+ * \par
+ * The real transforms split a complex transform of half the length, with the
+ * tables of <code>arm_rfft_q15()</code> and <code>arm_rfft_q31()</code>, the split
+ * being one more stage.  The inverse real transform leaves the block exponent of
+ * <code>fftLen * x[n]</code>.
+ */
+
+/**
+ * @addtogroup BlockFloatFFT
+ * @{
+ */
+
+/* Rounded arithmetic shift right by s, s = 0 leaves x as it is */
+#define BFP_SHIFT(x, s)   (((x) + ((1 << (s)) >> 1)) >> (s))
+
+/* Bit length of the magnitudes recorded by ORing |x| or ~|x|: the values are in [-2^bits, 2^bits) */
+#define BFP_BITS(m)       (32U - (uint32_t) __CLZ(m))
+
+/* Largest bit length of the input of a radix 4 and of a radix 2 stage */
+#define BFP_R4_BITS_Q15   12U
+#define BFP_R2_BITS_Q15   13U
+
+/**
+ * @brief  Radix 2 first stage of the block floating-point Q15 FFT, for lengths that are odd powers of 2.
+ * @param[in, out] *pSrc     points to the complex data, processed in place.
+ * @param[in]      fftLen    length of the FFT.
+ * @param[in]      *pCoef    points to the twiddle factor table.
+ * @param[in]      shift     right shift of the results.
+ * @param[in]      ifftFlag  1 for the inverse transform.
+ * @return the OR of the magnitudes of the results.
+ */
+
+static uint32_t arm_cfft_bfp_radix2_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pCoef,
+  uint32_t shift,
+  uint8_t ifftFlag)
+{
+  uint32_t n2 = fftLen >> 1U;                    /* Distance between butterfly inputs */
+  uint32_t i;                                    /* Loop counter */
+  uint32_t mag = 0U;                             /* OR of the result magnitudes */
+  q31_t ar, ai, br, bi;                          /* Butterfly values */
+  q31_t co, si;                                  /* Twiddle factor */
+  int32_t sign = (ifftFlag == 1U) ? -1 : 1;      /* Sign of the rotation */
+
+  for (i = 0U; i < n2; i++)
+  {
+    co = pCoef[2U * i];
+    si = pCoef[(2U * i) + 1U] * sign;
+
+    ar = pSrc[2U * i];
+    ai = pSrc[(2U * i) + 1U];
+    br = pSrc[2U * (i + n2)];
+    bi = pSrc[(2U * (i + n2)) + 1U];
+
+    /* Sum, and difference rotated by the conjugate of the twiddle (forward) */
+    pSrc[2U * i] = (q15_t) BFP_SHIFT(ar + br, shift);
+    pSrc[(2U * i) + 1U] = (q15_t) BFP_SHIFT(ai + bi, shift);
+    mag |= (uint32_t) ((pSrc[2U * i] ^ (pSrc[2U * i] >> 15)) | (pSrc[(2U * i) + 1U] ^ (pSrc[(2U * i) + 1U] >> 15)));
+
+    br = BFP_SHIFT(ar - br, shift);
+    bi = BFP_SHIFT(ai - bi, shift);
+    ar = ((br * co) + (bi * si) + 0x4000) >> 15;
+    ai = ((bi * co) - (br * si) + 0x4000) >> 15;
+    pSrc[2U * (i + n2)] = (q15_t) ar;
+    pSrc[(2U * (i + n2)) + 1U] = (q15_t) ai;
+    mag |= (uint32_t) ((ar ^ (ar >> 31)) | (ai ^ (ai >> 31)));
+  }
+
+  return (mag);
+}
+
+/**
+ * @brief  Radix 4 decimation in frequency stage of the block floating-point Q15 FFT.
+ * @param[in, out] *pSrc     points to the complex data, processed in place.
+ * @param[in]      fftLen    length of the FFT.
+ * @param[in]      n2        distance between the inputs of a butterfly.
+ * @param[in]      *pCoef    points to the twiddle factor table.
+ * @param[in]      modifier  twiddle index step between butterflies of a group.
+ * @param[in]      shift     right shift of the results.
+ * @param[in]      ifftFlag  1 for the inverse transform.
+ * @return the OR of the magnitudes of the results.
+ *
+ * The outputs are stored in the order of <code>arm_radix4_butterfly_q15()</code>:
+ * bins 0, 2, 1 and 3 of each butterfly, so the bit reversal tables apply.
+ */
+
+static uint32_t arm_cfft_bfp_radix4_q15(
+  q15_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n2,
+  const q15_t * pCoef,
+  uint32_t modifier,
+  uint32_t shift,
+  uint8_t ifftFlag)
+{
+  uint32_t n1 = n2 << 2U;                        /* Span of a butterfly */
+  uint32_t i0, i1, i2, i3, j, ic;                /* Loop counters and indices */
+  uint32_t mag = 0U;                             /* OR of the result magnitudes */
+  q31_t rr, ri, sr, si, tr, ti, ur, ui;          /* Sums and differences */
+  q31_t yr[4], yi[4];                            /* Butterfly outputs, in stored order */
+  q31_t co[4], sn[4];                            /* Twiddle factors of the outputs */
+  uint32_t k;                                    /* Output index */
+  int32_t sign = (ifftFlag == 1U) ? -1 : 1;      /* Sign of the rotation */
+
+  for (j = 0U; j < n2; j++)
+  {
+    ic = j * modifier;
+    co[1] = pCoef[4U * ic];
+    sn[1] = pCoef[(4U * ic) + 1U] * sign;
+    co[2] = pCoef[2U * ic];
+    sn[2] = pCoef[(2U * ic) + 1U] * sign;
+    co[3] = pCoef[6U * ic];
+    sn[3] = pCoef[(6U * ic) + 1U] * sign;
+
+    for (i0 = j; i0 < fftLen; i0 += n1)
+    {
+      i1 = i0 + n2;
+      i2 = i1 + n2;
+      i3 = i2 + n2;
+
+      rr = (q31_t) pSrc[2U * i0] + pSrc[2U * i2];
+      ri = (q31_t) pSrc[(2U * i0) + 1U] + pSrc[(2U * i2) + 1U];
+      sr = (q31_t) pSrc[2U * i0] - pSrc[2U * i2];
+      si = (q31_t) pSrc[(2U * i0) + 1U] - pSrc[(2U * i2) + 1U];
+      tr = (q31_t) pSrc[2U * i1] + pSrc[2U * i3];
+      ti = (q31_t) pSrc[(2U * i1) + 1U] + pSrc[(2U * i3) + 1U];
+      ur = ((q31_t) pSrc[2U * i1] - pSrc[2U * i3]) * sign;
+      ui = ((q31_t) pSrc[(2U * i1) + 1U] - pSrc[(2U * i3) + 1U]) * sign;
+
+      /* Bin 0, bin 2, bin 1 = S - jU and bin 3 = S + jU (forward) */
+      yr[0] = BFP_SHIFT(rr + tr, shift);
+      yi[0] = BFP_SHIFT(ri + ti, shift);
+      yr[1] = BFP_SHIFT(rr - tr, shift);
+      yi[1] = BFP_SHIFT(ri - ti, shift);
+      yr[2] = BFP_SHIFT(sr + ui, shift);
+      yi[2] = BFP_SHIFT(si - ur, shift);
+      yr[3] = BFP_SHIFT(sr - ui, shift);
+      yi[3] = BFP_SHIFT(si + ur, shift);
+
+      /* The first butterfly of each group has unit twiddles */
+      if (ic != 0U)
+      {
+        for (k = 1U; k < 4U; k++)
+        {
+          rr = ((yr[k] * co[k]) + (yi[k] * sn[k]) + 0x4000) >> 15;
+          yi[k] = ((yi[k] * co[k]) - (yr[k] * sn[k]) + 0x4000) >> 15;
+          yr[k] = rr;
+        }
+      }
+
+      pSrc[2U * i0] = (q15_t) yr[0];
+      pSrc[(2U * i0) + 1U] = (q15_t) yi[0];
+      pSrc[2U * i1] = (q15_t) yr[1];
+      pSrc[(2U * i1) + 1U] = (q15_t) yi[1];
+      pSrc[2U * i2] = (q15_t) yr[2];
+      pSrc[(2U * i2) + 1U] = (q15_t) yi[2];
+      pSrc[2U * i3] = (q15_t) yr[3];
+      pSrc[(2U * i3) + 1U] = (q15_t) yi[3];
+
+      for (k = 0U; k < 4U; k++)
+      {
+        mag |= (uint32_t) ((yr[k] ^ (yr[k] >> 31)) | (yi[k] ^ (yi[k] >> 31)));
+      }
+    }
+  }
+
+  return (mag);
+}
+
+/**
+ * @brief  Processing function for the block floating-point Q15 complex FFT.
+ * @param[in]      *S              points to an instance of the Q15 CFFT structure.
+ * @param[in, out] *p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+ * @param[out]     *pBlockExp      points to the block exponent of the output.
+ * @return none.
+ *
+ * The instance is that of <code>arm_cfft_q15()</code>, e.g. <code>arm_cfft_sR_q15_len256</code>.
+ */
+
+void arm_cfft_bfp_q15(
+  const arm_cfft_instance_q15 * S,
+  q15_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag,
+  int8_t * pBlockExp)
+{
+  uint32_t fftLen = S->fftLen;                   /* Length of the FFT */
+  uint32_t len4 = fftLen;                        /* Length of the radix 4 transforms */
+  uint32_t modifier = 1U;                        /* Twiddle index step */
+  uint32_t limit = BFP_R4_BITS_Q15;              /* Largest input bit length of the first stage */
+  uint32_t mag = 0U;                             /* OR of the magnitudes */
+  uint32_t bits, shift, n2, i;                   /* Loop counters and scaling */
+  int32_t exponent;                              /* Block exponent */
+
+  /* Odd powers of 2 start with a radix 2 stage, then run two radix 4 transforms of half the length */
+  if ((fftLen & 0x55555555U) == 0U)
+  {
+    len4 = fftLen >> 1U;
+    modifier = 2U;
+    limit = BFP_R2_BITS_Q15;
+  }
+
+  /* Normalize the input to the headroom of the first stage */
+  for (i = 0U; i < (2U * fftLen); i++)
+  {
+    mag |= (uint32_t) (p1[i] ^ (p1[i] >> 15));
+  }
+  bits = BFP_BITS(mag);
+
+  if (mag == 0U)
+  {
+    *pBlockExp = 0;
+    return;
+  }
+
+  exponent = (int32_t) bits - (int32_t) limit;
+  if (exponent < 0)
+  {
+    arm_shift_q15(p1, (int8_t) -exponent, p1, 2U * fftLen);
+  }
+  else if (exponent > 0)
+  {
+    for (i = 0U; i < (2U * fftLen); i++)
+    {
+      p1[i] = (q15_t) BFP_SHIFT((q31_t) p1[i], (uint32_t) exponent);
+    }
+  }
+  bits = limit;
+
+  if (modifier == 2U)
+  {
+    mag = arm_cfft_bfp_radix2_q15(p1, fftLen, S->pTwiddle, 0U, ifftFlag);
+    bits = BFP_BITS(mag);
+  }
+
+  for (n2 = len4 >> 2U; n2 > 0U; n2 >>= 2U)
+  {
+    shift = (bits > BFP_R4_BITS_Q15) ? (bits - BFP_R4_BITS_Q15) : 0U;
+    mag = arm_cfft_bfp_radix4_q15(p1, fftLen, n2, S->pTwiddle, modifier, shift, ifftFlag);
+    bits = BFP_BITS(mag);
+    exponent += (int32_t) shift;
+    modifier <<= 2U;
+  }
+
+  if (bitReverseFlag)
+  {
+    arm_bitreversal_16((uint16_t *) p1, S->bitRevLength, S->pBitRevTable);
+  }
+
+  *pBlockExp = (int8_t) exponent;
+}
+
+/**
+ * @} end of BlockFloatFFT group
+ */
@@ -0,0 +1,304 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_bfp_q31.c
+ * Description:  Block floating-point Q31 complex FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_bitreversal_32(
+  uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup BlockFloatFFT
+ * @{
+ */
+
+/* Bit length of the magnitudes recorded by ORing |x| or ~|x|: the values are in [-2^bits, 2^bits) */
+#define BFP_BITS(m)       (32U - (uint32_t) __CLZ(m))
+
+/* Largest bit length of the input of a radix 4 and of a radix 2 stage */
+#define BFP_R4_BITS_Q31   28U
+#define BFP_R2_BITS_Q31   29U
+
+/* Rounded product of x and the twiddle component c, Q31 */
+#define BFP_MUL_Q31(x, c) ((q63_t) (x) * (c))
+#define BFP_ROUND_Q31(p)  ((q31_t) (((p) + 0x40000000LL) >> 31))
+
+/**
+ * @brief  Radix 2 first stage of the block floating-point Q31 FFT, for lengths that are odd powers of 2.
+ * @param[in, out] *pSrc     points to the complex data, processed in place.
+ * @param[in]      fftLen    length of the FFT.
+ * @param[in]      *pCoef    points to the twiddle factor table.
+ * @param[in]      ifftFlag  1 for the inverse transform.
+ * @return the OR of the magnitudes of the results.
+ */
+
+static uint32_t arm_cfft_bfp_radix2_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  const q31_t * pCoef,
+  uint8_t ifftFlag)
+{
+  uint32_t n2 = fftLen >> 1U;                    /* Distance between butterfly inputs */
+  uint32_t i;                                    /* Loop counter */
+  uint32_t mag = 0U;                             /* OR of the result magnitudes */
+  q31_t ar, ai, br, bi;                          /* Butterfly values */
+  q31_t co, si;                                  /* Twiddle factor */
+
+  for (i = 0U; i < n2; i++)
+  {
+    co = pCoef[2U * i];
+    si = (ifftFlag == 1U) ? -pCoef[(2U * i) + 1U] : pCoef[(2U * i) + 1U];
+
+    ar = pSrc[2U * i];
+    ai = pSrc[(2U * i) + 1U];
+    br = pSrc[2U * (i + n2)];
+    bi = pSrc[(2U * (i + n2)) + 1U];
+
+    /* Sum, and difference rotated by the conjugate of the twiddle (forward) */
+    pSrc[2U * i] = ar + br;
+    pSrc[(2U * i) + 1U] = ai + bi;
+    mag |= (uint32_t) ((pSrc[2U * i] ^ (pSrc[2U * i] >> 31)) | (pSrc[(2U * i) + 1U] ^ (pSrc[(2U * i) + 1U] >> 31)));
+
+    br = ar - br;
+    bi = ai - bi;
+    ar = BFP_ROUND_Q31(BFP_MUL_Q31(br, co) + BFP_MUL_Q31(bi, si));
+    ai = BFP_ROUND_Q31(BFP_MUL_Q31(bi, co) - BFP_MUL_Q31(br, si));
+    pSrc[2U * (i + n2)] = ar;
+    pSrc[(2U * (i + n2)) + 1U] = ai;
+    mag |= (uint32_t) ((ar ^ (ar >> 31)) | (ai ^ (ai >> 31)));
+  }
+
+  return (mag);
+}
+
+/**
+ * @brief  Radix 4 decimation in frequency stage of the block floating-point Q31 FFT.
+ * @param[in, out] *pSrc     points to the complex data, processed in place.
+ * @param[in]      fftLen    length of the FFT.
+ * @param[in]      n2        distance between the inputs of a butterfly.
+ * @param[in]      *pCoef    points to the twiddle factor table.
+ * @param[in]      modifier  twiddle index step between butterflies of a group.
+ * @param[in]      shift     right shift of the inputs.
+ * @param[in]      ifftFlag  1 for the inverse transform.
+ * @return the OR of the magnitudes of the results.
+ *
+ * The inputs are shifted before the butterfly, so that its sums fit in 32 bits.
+ * The outputs are stored in the order of <code>arm_radix4_butterfly_q31()</code>.
+ */
+
+static uint32_t arm_cfft_bfp_radix4_q31(
+  q31_t * pSrc,
+  uint32_t fftLen,
+  uint32_t n2,
+  const q31_t * pCoef,
+  uint32_t modifier,
+  uint32_t shift,
+  uint8_t ifftFlag)
+{
+  uint32_t n1 = n2 << 2U;                        /* Span of a butterfly */
+  uint32_t i0, i1, i2, i3, j, ic;                /* Loop counters and indices */
+  uint32_t mag = 0U;                             /* OR of the result magnitudes */
+  q31_t ar, ai, br, bi, cr, ci, dr, di;          /* Butterfly inputs */
+  q31_t rr, ri, sr, si, tr, ti, ur, ui;          /* Sums and differences */
+  q31_t yr[4], yi[4];                            /* Butterfly outputs, in stored order */
+  q31_t co[4], sn[4];                            /* Twiddle factors of the outputs */
+  uint32_t k;                                    /* Output index */
+
+  for (j = 0U; j < n2; j++)
+  {
+    ic = j * modifier;
+    co[1] = pCoef[4U * ic];
+    sn[1] = pCoef[(4U * ic) + 1U];
+    co[2] = pCoef[2U * ic];
+    sn[2] = pCoef[(2U * ic) + 1U];
+    co[3] = pCoef[6U * ic];
+    sn[3] = pCoef[(6U * ic) + 1U];
+    if (ifftFlag == 1U)
+    {
+      sn[1] = -sn[1];
+      sn[2] = -sn[2];
+      sn[3] = -sn[3];
+    }
+
+    for (i0 = j; i0 < fftLen; i0 += n1)
+    {
+      i1 = i0 + n2;
+      i2 = i1 + n2;
+      i3 = i2 + n2;
+
+      ar = pSrc[2U * i0] >> shift;
+      ai = pSrc[(2U * i0) + 1U] >> shift;
+      br = pSrc[2U * i1] >> shift;
+      bi = pSrc[(2U * i1) + 1U] >> shift;
+      cr = pSrc[2U * i2] >> shift;
+      ci = pSrc[(2U * i2) + 1U] >> shift;
+      dr = pSrc[2U * i3] >> shift;
+      di = pSrc[(2U * i3) + 1U] >> shift;
+
+      rr = ar + cr;
+      ri = ai + ci;
+      sr = ar - cr;
+      si = ai - ci;
+      tr = br + dr;
+      ti = bi + di;
+      ur = (ifftFlag == 1U) ? (dr - br) : (br - dr);
+      ui = (ifftFlag == 1U) ? (di - bi) : (bi - di);
+
+      /* Bin 0, bin 2, bin 1 = S - jU and bin 3 = S + jU (forward) */
+      yr[0] = rr + tr;
+      yi[0] = ri + ti;
+      yr[1] = rr - tr;
+      yi[1] = ri - ti;
+      yr[2] = sr + ui;
+      yi[2] = si - ur;
+      yr[3] = sr - ui;
+      yi[3] = si + ur;
+
+      /* The first butterfly of each group has unit twiddles */
+      if (ic != 0U)
+      {
+        for (k = 1U; k < 4U; k++)
+        {
+          rr = BFP_ROUND_Q31(BFP_MUL_Q31(yr[k], co[k]) + BFP_MUL_Q31(yi[k], sn[k]));
+          yi[k] = BFP_ROUND_Q31(BFP_MUL_Q31(yi[k], co[k]) - BFP_MUL_Q31(yr[k], sn[k]));
+          yr[k] = rr;
+        }
+      }
+
+      pSrc[2U * i0] = yr[0];
+      pSrc[(2U * i0) + 1U] = yi[0];
+      pSrc[2U * i1] = yr[1];
+      pSrc[(2U * i1) + 1U] = yi[1];
+      pSrc[2U * i2] = yr[2];
+      pSrc[(2U * i2) + 1U] = yi[2];
+      pSrc[2U * i3] = yr[3];
+      pSrc[(2U * i3) + 1U] = yi[3];
+
+      for (k = 0U; k < 4U; k++)
+      {
+        mag |= (uint32_t) ((yr[k] ^ (yr[k] >> 31)) | (yi[k] ^ (yi[k] >> 31)));
+      }
+    }
+  }
+
+  return (mag);
+}
+
+/**
+ * @brief  Processing function for the block floating-point Q31 complex FFT.
+ * @param[in]      *S              points to an instance of the Q31 CFFT structure.
+ * @param[in, out] *p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @param[in]      bitReverseFlag  flag that enables (bitReverseFlag=1) or disables (bitReverseFlag=0) bit reversal of output.
+ * @param[out]     *pBlockExp      points to the block exponent of the output.
+ * @return none.
+ *
+ * The instance is that of <code>arm_cfft_q31()</code>, e.g. <code>arm_cfft_sR_q31_len256</code>.
+ * The radix 4 stages shift their inputs, by truncation, instead of their results:
+ * 3 bits of headroom in 31 cost less than 64-bit sums.
+ */
+
+void arm_cfft_bfp_q31(
+  const arm_cfft_instance_q31 * S,
+  q31_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag,
+  int8_t * pBlockExp)
+{
+  uint32_t fftLen = S->fftLen;                   /* Length of the FFT */
+  uint32_t len4 = fftLen;                        /* Length of the radix 4 transforms */
+  uint32_t modifier = 1U;                        /* Twiddle index step */
+  uint32_t limit = BFP_R4_BITS_Q31;              /* Largest input bit length of the first stage */
+  uint32_t mag = 0U;                             /* OR of the magnitudes */
+  uint32_t bits, shift, n2, i;                   /* Loop counters and scaling */
+  int32_t exponent;                              /* Block exponent */
+
+  /* Odd powers of 2 start with a radix 2 stage, then run two radix 4 transforms of half the length */
+  if ((fftLen & 0x55555555U) == 0U)
+  {
+    len4 = fftLen >> 1U;
+    modifier = 2U;
+    limit = BFP_R2_BITS_Q31;
+  }
+
+  /* Normalize the input to the headroom of the first stage */
+  for (i = 0U; i < (2U * fftLen); i++)
+  {
+    mag |= (uint32_t) (p1[i] ^ (p1[i] >> 31));
+  }
+  bits = BFP_BITS(mag);
+
+  if (mag == 0U)
+  {
+    *pBlockExp = 0;
+    return;
+  }
+
+  exponent = (int32_t) bits - (int32_t) limit;
+  if (exponent < 0)
+  {
+    arm_shift_q31(p1, (int8_t) -exponent, p1, 2U * fftLen);
+  }
+  else if (exponent > 0)
+  {
+    for (i = 0U; i < (2U * fftLen); i++)
+    {
+      p1[i] = p1[i] >> exponent;
+    }
+  }
+  bits = limit;
+
+  if (modifier == 2U)
+  {
+    mag = arm_cfft_bfp_radix2_q31(p1, fftLen, S->pTwiddle, ifftFlag);
+    bits = BFP_BITS(mag);
+  }
+
+  for (n2 = len4 >> 2U; n2 > 0U; n2 >>= 2U)
+  {
+    shift = (bits > BFP_R4_BITS_Q31) ? (bits - BFP_R4_BITS_Q31) : 0U;
+    mag = arm_cfft_bfp_radix4_q31(p1, fftLen, n2, S->pTwiddle, modifier, shift, ifftFlag);
+    bits = BFP_BITS(mag);
+    exponent += (int32_t) shift;
+    modifier <<= 2U;
+  }
+
+  if (bitReverseFlag)
+  {
+    arm_bitreversal_32((uint32_t *) p1, S->bitRevLength, S->pBitRevTable);
+  }
+
+  *pBlockExp = (int8_t) exponent;
+}
+
+/**
+ * @} end of BlockFloatFFT group
+ */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_ram_f32.c
+ * Description:  Floating-point complex FFT initialization with twiddle factors in RAM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point complex FFT with twiddle factors computed in RAM.
+ * @param[out] *S         points to an instance of the floating-point complex FFT structure.
+ * @param[in]  fftLen     length of the FFT, 16 to 4096, a power of 2.
+ * @param[out] *pTwiddle  points to the twiddle factor buffer of size <code>2*fftLen</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not supported or its bit reversal table is not compiled.
+ *
+ * \par Description:
+ * \par
+ * Sets up <code>S</code> for <code>arm_cfft_f32()</code> like the constant structures
+ * <code>arm_cfft_sR_f32_len16</code> ... <code>arm_cfft_sR_f32_len4096</code>, but writes the
+ * twiddle factors <code>{cos(2*pi*k/fftLen), sin(2*pi*k/fftLen)}</code> for
+ * <code>k = 0 ... fftLen-1</code> to <code>pTwiddle</code> instead of using the tables in flash.
+ * They are computed in double precision, and match the tables to the last bit or within one.
+ * \par
+ * Only the bit reversal table stays in flash: 40 bytes to 8 kB, against 16 to 32 kB
+ * for the twiddle table of a 2048 or 4096 point transform.  With
+ * <code>ARM_DSP_CONFIG_TABLES</code> it is selected alone by
+ * <code>ARM_TABLE_BITREVIDX_FLT_&lt;fftLen&gt;</code>, see arm_common_tables.h.
+ * \par
+ * The buffer must stay valid while <code>S</code> is in use, and may be shared by
+ * instances of the same length.
+ */
+
+arm_status arm_cfft_init_ram_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  uint32_t k;                                    /* Loop counter */
+  double angle;                                  /* Twiddle angle */
+
+  switch (fftLen)
+  {
+#if defined(ARM_TABLE_BITREVIDX_FLT_16)
+  case 16U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable16;
+    S->bitRevLength = ARMBITREVINDEXTABLE_16_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_32)
+  case 32U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable32;
+    S->bitRevLength = ARMBITREVINDEXTABLE_32_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_64)
+  case 64U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable64;
+    S->bitRevLength = ARMBITREVINDEXTABLE_64_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_128)
+  case 128U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable128;
+    S->bitRevLength = ARMBITREVINDEXTABLE_128_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_256)
+  case 256U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable256;
+    S->bitRevLength = ARMBITREVINDEXTABLE_256_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_512)
+  case 512U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable512;
+    S->bitRevLength = ARMBITREVINDEXTABLE_512_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_1024)
+  case 1024U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable1024;
+    S->bitRevLength = ARMBITREVINDEXTABLE_1024_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_2048)
+  case 2048U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable2048;
+    S->bitRevLength = ARMBITREVINDEXTABLE_2048_TABLE_LENGTH;
+    break;
+#endif
+#if defined(ARM_TABLE_BITREVIDX_FLT_4096)
+  case 4096U:
+    S->pBitRevTable = (uint16_t *) armBitRevIndexTable4096;
+    S->bitRevLength = ARMBITREVINDEXTABLE_4096_TABLE_LENGTH;
+    break;
+#endif
+  default:
+    /*  Reporting argument error if fftSize is not valid value */
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    angle = (6.283185307179586 * (double) k) / (double) fftLen;
+    pTwiddle[2U * k] = (float32_t) cos(angle);
+    pTwiddle[(2U * k) + 1U] = (float32_t) sin(angle);
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
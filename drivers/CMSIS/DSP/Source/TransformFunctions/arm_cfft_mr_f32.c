@@ -0,0 +1,450 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mr_f32.c
+ * Description:  Mixed radix floating-point complex FFT for lengths 2^a 3^b 5^c
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup MixedRadixFFT Mixed Radix FFT Functions
+ *
+ * \par
+ * <code>arm_cfft_f32()</code> and <code>arm_rfft_fast_f32()</code> only take
+ * power of 2 lengths.  The functions in this group take any length whose only
+ * prime factors are 2, 3 and 5: 60, 300 and 3600 points, for example, are
+ * transformed as they are instead of zero padded to 64, 512 and 4096, which
+ * costs time and changes the frequency of each bin.
+ *
+ * \par Algorithm
+ * The length is factored into stages of radix 4, 2, 3 and 5 by the
+ * initialization function (the plan).  Each stage is a Stockham pass: it reads
+ * one buffer and writes the other in natural order, so no bit reversal is
+ * needed, at the cost of a scratch buffer as large as the data.
+ * The radix 3 and 5 butterflies use the symmetric form of the DFT, which
+ * shares the sums and differences of opposite inputs between outputs.
+ * \par
+ * The real FFT of <code>fftLen</code> points computes a complex FFT of
+ * <code>fftLen/2</code> points of the even and odd samples and splits it, as
+ * <code>arm_rfft_fast_f32()</code> does, so <code>fftLen/2</code> must be a
+ * supported complex length.  Its output uses the same packed format: bin 0 and
+ * bin <code>fftLen/2</code>, both real, in the first pair, then bins 1 to
+ * <code>fftLen/2 - 1</code>.
+ *
+ * \par Twiddle factors and work memory
+ * The functions allocate nothing and use no tables from flash.  The initialization
+ * functions write the twiddle factors, <code>2 * fftLen</code> floating-point values,
+ * to a buffer owned by the caller, which is then read only: instances of the same
+ * length may share it, and it may be generated once and kept in flash.
+ * Each call needs a scratch buffer of <code>2 * fftLen</code> floating-point values for
+ * the complex FFT and <code>fftLen</code> for the real FFT, which holds nothing between calls.
+ *
+ * \par
+ * The inverse transforms are scaled by <code>1/fftLen</code>, as those of
+ * <code>arm_cfft_f32()</code> and <code>arm_rfft_fast_f32()</code>.
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/* Butterfly constants: cos and sin of 2*pi/3, 2*pi/5 and 4*pi/5 */
+#define MR_C3   (-0.5f)
+#define MR_S3   (0.866025403784439f)
+#define MR_C51  (0.309016994374947f)
+#define MR_S51  (0.951056516295154f)
+#define MR_C52  (-0.809016994374947f)
+#define MR_S52  (0.587785252292473f)
+
+/* In place multiplication of x by the conjugate of the twiddle (c, s), as stored */
+#define MR_TWIDDLE(xr, xi, c, s)               \
+  do                                           \
+  {                                            \
+    float32_t t_ = ((xr) * (c)) + ((xi) * (s)); \
+    (xi) = ((xi) * (c)) - ((xr) * (s));        \
+    (xr) = t_;                                 \
+  } while (0)
+
+/**
+ * @brief  Radix 2 Stockham pass.
+ * @param[in]  *pIn      points to the input of the pass.
+ * @param[out] *pOut     points to the output of the pass.
+ * @param[in]  fftLen    length of the FFT.
+ * @param[in]  ns        length of the transforms already done, the product of the earlier radices.
+ * @param[in]  *pTwid    points to the twiddle factors.
+ * @param[in]  twidStep  twiddle index of the second input of butterfly 1, in complex values.
+ * @return none.
+ */
+
+static void arm_cfft_mr_radix2_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t fftLen,
+  uint32_t ns,
+  const float32_t * pTwid,
+  uint32_t twidStep)
+{
+  uint32_t stride = fftLen >> 1U;                /* Distance between butterfly inputs */
+  uint32_t k, j, d;                              /* Loop counters and indices */
+  float32_t c1, s1;                              /* Twiddle factors */
+  float32_t ar0, ai0, ar1, ai1;                  /* Butterfly values */
+
+  for (k = 0U; k < ns; k++)
+  {
+    c1 = pTwid[2U * (k * twidStep)];
+    s1 = pTwid[(2U * (k * twidStep)) + 1U];
+
+    for (j = k, d = k; j < stride; j += ns, d += 2U * ns)
+    {
+      ar0 = pIn[2U * j];
+      ai0 = pIn[(2U * j) + 1U];
+      ar1 = pIn[2U * (j + stride)];
+      ai1 = pIn[(2U * (j + stride)) + 1U];
+
+      if (k != 0U)
+      {
+        MR_TWIDDLE(ar1, ai1, c1, s1);
+      }
+
+      pOut[2U * d] = ar0 + ar1;
+      pOut[(2U * d) + 1U] = ai0 + ai1;
+      pOut[2U * (d + ns)] = ar0 - ar1;
+      pOut[(2U * (d + ns)) + 1U] = ai0 - ai1;
+    }
+  }
+}
+
+/**
+ * @brief  Radix 3 Stockham pass.  Arguments as for the radix 2 pass.
+ */
+
+static void arm_cfft_mr_radix3_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t fftLen,
+  uint32_t ns,
+  const float32_t * pTwid,
+  uint32_t twidStep)
+{
+  uint32_t stride = fftLen / 3U;                 /* Distance between butterfly inputs */
+  uint32_t k, j, d;                              /* Loop counters and indices */
+  float32_t c1, s1, c2, s2;                      /* Twiddle factors */
+  float32_t ar0, ai0, ar1, ai1, ar2, ai2;        /* Butterfly inputs */
+  float32_t tr1, ti1, tr2, ti2, mr, mi;          /* Temporary variables */
+
+  for (k = 0U; k < ns; k++)
+  {
+    c1 = pTwid[2U * (k * twidStep)];
+    s1 = pTwid[(2U * (k * twidStep)) + 1U];
+    c2 = pTwid[2U * (2U * k * twidStep)];
+    s2 = pTwid[(2U * (2U * k * twidStep)) + 1U];
+
+    for (j = k, d = k; j < stride; j += ns, d += 3U * ns)
+    {
+      ar0 = pIn[2U * j];
+      ai0 = pIn[(2U * j) + 1U];
+      ar1 = pIn[2U * (j + stride)];
+      ai1 = pIn[(2U * (j + stride)) + 1U];
+      ar2 = pIn[2U * (j + (2U * stride))];
+      ai2 = pIn[(2U * (j + (2U * stride))) + 1U];
+
+      if (k != 0U)
+      {
+        MR_TWIDDLE(ar1, ai1, c1, s1);
+        MR_TWIDDLE(ar2, ai2, c2, s2);
+      }
+
+      tr1 = ar1 + ar2;
+      ti1 = ai1 + ai2;
+      /* -i * sin(2*pi/3) * (x1 - x2) */
+      tr2 = MR_S3 * (ai1 - ai2);
+      ti2 = MR_S3 * (ar2 - ar1);
+      mr = ar0 + (MR_C3 * tr1);
+      mi = ai0 + (MR_C3 * ti1);
+
+      pOut[2U * d] = ar0 + tr1;
+      pOut[(2U * d) + 1U] = ai0 + ti1;
+      pOut[2U * (d + ns)] = mr + tr2;
+      pOut[(2U * (d + ns)) + 1U] = mi + ti2;
+      pOut[2U * (d + (2U * ns))] = mr - tr2;
+      pOut[(2U * (d + (2U * ns))) + 1U] = mi - ti2;
+    }
+  }
+}
+
+/**
+ * @brief  Radix 4 Stockham pass.  Arguments as for the radix 2 pass.
+ */
+
+static void arm_cfft_mr_radix4_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t fftLen,
+  uint32_t ns,
+  const float32_t * pTwid,
+  uint32_t twidStep)
+{
+  uint32_t stride = fftLen >> 2U;                /* Distance between butterfly inputs */
+  uint32_t k, j, d;                              /* Loop counters and indices */
+  float32_t c1, s1, c2, s2, c3, s3;              /* Twiddle factors */
+  float32_t ar0, ai0, ar1, ai1, ar2, ai2, ar3, ai3; /* Butterfly inputs */
+  float32_t tr0, ti0, tr1, ti1, tr2, ti2, tr3, ti3; /* Temporary variables */
+
+  for (k = 0U; k < ns; k++)
+  {
+    c1 = pTwid[2U * (k * twidStep)];
+    s1 = pTwid[(2U * (k * twidStep)) + 1U];
+    c2 = pTwid[2U * (2U * k * twidStep)];
+    s2 = pTwid[(2U * (2U * k * twidStep)) + 1U];
+    c3 = pTwid[2U * (3U * k * twidStep)];
+    s3 = pTwid[(2U * (3U * k * twidStep)) + 1U];
+
+    for (j = k, d = k; j < stride; j += ns, d += 4U * ns)
+    {
+      ar0 = pIn[2U * j];
+      ai0 = pIn[(2U * j) + 1U];
+      ar1 = pIn[2U * (j + stride)];
+      ai1 = pIn[(2U * (j + stride)) + 1U];
+      ar2 = pIn[2U * (j + (2U * stride))];
+      ai2 = pIn[(2U * (j + (2U * stride))) + 1U];
+      ar3 = pIn[2U * (j + (3U * stride))];
+      ai3 = pIn[(2U * (j + (3U * stride))) + 1U];
+
+      if (k != 0U)
+      {
+        MR_TWIDDLE(ar1, ai1, c1, s1);
+        MR_TWIDDLE(ar2, ai2, c2, s2);
+        MR_TWIDDLE(ar3, ai3, c3, s3);
+      }
+
+      tr0 = ar0 + ar2;
+      ti0 = ai0 + ai2;
+      tr1 = ar0 - ar2;
+      ti1 = ai0 - ai2;
+      tr2 = ar1 + ar3;
+      ti2 = ai1 + ai3;
+      tr3 = ar1 - ar3;
+      ti3 = ai1 - ai3;
+
+      /* y1 = t1 - i * t3, y3 = t1 + i * t3 */
+      pOut[2U * d] = tr0 + tr2;
+      pOut[(2U * d) + 1U] = ti0 + ti2;
+      pOut[2U * (d + ns)] = tr1 + ti3;
+      pOut[(2U * (d + ns)) + 1U] = ti1 - tr3;
+      pOut[2U * (d + (2U * ns))] = tr0 - tr2;
+      pOut[(2U * (d + (2U * ns))) + 1U] = ti0 - ti2;
+      pOut[2U * (d + (3U * ns))] = tr1 - ti3;
+      pOut[(2U * (d + (3U * ns))) + 1U] = ti1 + tr3;
+    }
+  }
+}
+
+/**
+ * @brief  Radix 5 Stockham pass.  Arguments as for the radix 2 pass.
+ */
+
+static void arm_cfft_mr_radix5_f32(
+  const float32_t * pIn,
+  float32_t * pOut,
+  uint32_t fftLen,
+  uint32_t ns,
+  const float32_t * pTwid,
+  uint32_t twidStep)
+{
+  uint32_t stride = fftLen / 5U;                 /* Distance between butterfly inputs */
+  uint32_t k, j, d, r;                           /* Loop counters and indices */
+  float32_t tw[8];                               /* Twiddle factors 1 to 4 */
+  float32_t ar[5], ai[5];                        /* Butterfly inputs */
+  float32_t tr1, ti1, tr2, ti2, tr3, ti3, tr4, ti4; /* Temporary variables */
+  float32_t mr1, mi1, mr2, mi2, nr1, ni1, nr2, ni2; /* Temporary variables */
+
+  for (k = 0U; k < ns; k++)
+  {
+    for (r = 1U; r < 5U; r++)
+    {
+      tw[2U * (r - 1U)] = pTwid[2U * (r * k * twidStep)];
+      tw[(2U * (r - 1U)) + 1U] = pTwid[(2U * (r * k * twidStep)) + 1U];
+    }
+
+    for (j = k, d = k; j < stride; j += ns, d += 5U * ns)
+    {
+      ar[0] = pIn[2U * j];
+      ai[0] = pIn[(2U * j) + 1U];
+      for (r = 1U; r < 5U; r++)
+      {
+        ar[r] = pIn[2U * (j + (r * stride))];
+        ai[r] = pIn[(2U * (j + (r * stride))) + 1U];
+        if (k != 0U)
+        {
+          MR_TWIDDLE(ar[r], ai[r], tw[2U * (r - 1U)], tw[(2U * (r - 1U)) + 1U]);
+        }
+      }
+
+      tr1 = ar[1] + ar[4];
+      ti1 = ai[1] + ai[4];
+      tr2 = ar[2] + ar[3];
+      ti2 = ai[2] + ai[3];
+      tr3 = ar[1] - ar[4];
+      ti3 = ai[1] - ai[4];
+      tr4 = ar[2] - ar[3];
+      ti4 = ai[2] - ai[3];
+
+      mr1 = ar[0] + (MR_C51 * tr1) + (MR_C52 * tr2);
+      mi1 = ai[0] + (MR_C51 * ti1) + (MR_C52 * ti2);
+      mr2 = ar[0] + (MR_C52 * tr1) + (MR_C51 * tr2);
+      mi2 = ai[0] + (MR_C52 * ti1) + (MR_C51 * ti2);
+
+      /* n1 = -i * (s1 * t3 + s2 * t4), n2 = -i * (s2 * t3 - s1 * t4) */
+      nr1 = (MR_S51 * ti3) + (MR_S52 * ti4);
+      ni1 = -((MR_S51 * tr3) + (MR_S52 * tr4));
+      nr2 = (MR_S52 * ti3) - (MR_S51 * ti4);
+      ni2 = (MR_S51 * tr4) - (MR_S52 * tr3);
+
+      pOut[2U * d] = ar[0] + tr1 + tr2;
+      pOut[(2U * d) + 1U] = ai[0] + ti1 + ti2;
+      pOut[2U * (d + ns)] = mr1 + nr1;
+      pOut[(2U * (d + ns)) + 1U] = mi1 + ni1;
+      pOut[2U * (d + (2U * ns))] = mr2 + nr2;
+      pOut[(2U * (d + (2U * ns))) + 1U] = mi2 + ni2;
+      pOut[2U * (d + (3U * ns))] = mr2 - nr2;
+      pOut[(2U * (d + (3U * ns))) + 1U] = mi2 - ni2;
+      pOut[2U * (d + (4U * ns))] = mr1 - nr1;
+      pOut[(2U * (d + (4U * ns))) + 1U] = mi1 - ni1;
+    }
+  }
+}
+
+/**
+ * @brief  Forward mixed radix FFT, shared by the complex and real FFT functions.
+ * @param[in]  *S        points to an instance of the mixed radix complex FFT structure.
+ * @param[in]  *pSrc     points to the input, not modified unless it is <code>pDst</code>.
+ * @param[out] *pDst     points to the output.  May be <code>pSrc</code>.
+ * @param[in]  *pScratch points to the work buffer of 2*fftLen values.
+ * @return none.
+ *
+ * The passes alternate between <code>pDst</code> and <code>pScratch</code>, starting
+ * with the one that makes the last pass end in <code>pDst</code>.
+ */
+
+void arm_cfft_mr_stages_f32(
+  const arm_cfft_mr_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratch)
+{
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  uint32_t ns = 1U;                              /* Length of the transforms done */
+  uint32_t stage, radix, twidStep;               /* Stage parameters */
+  const float32_t *pIn = pSrc;                   /* Input of the pass */
+  float32_t *pOut = pScratch;                    /* Output of the pass */
+
+  if ((S->numStages & 1U) != 0U)
+  {
+    /* An odd pass count ends in the buffer the first pass writes */
+    if (pSrc == pDst)
+    {
+      arm_copy_f32(pDst, pScratch, 2U * fftLen);
+      pIn = pScratch;
+    }
+    pOut = pDst;
+  }
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    radix = S->radix[stage];
+    twidStep = (fftLen / (ns * radix)) * S->twidCoefModifier;
+
+    switch (radix)
+    {
+    case 4U:
+      arm_cfft_mr_radix4_f32(pIn, pOut, fftLen, ns, S->pTwiddle, twidStep);
+      break;
+    case 2U:
+      arm_cfft_mr_radix2_f32(pIn, pOut, fftLen, ns, S->pTwiddle, twidStep);
+      break;
+    case 3U:
+      arm_cfft_mr_radix3_f32(pIn, pOut, fftLen, ns, S->pTwiddle, twidStep);
+      break;
+    default:
+      arm_cfft_mr_radix5_f32(pIn, pOut, fftLen, ns, S->pTwiddle, twidStep);
+      break;
+    }
+
+    ns *= radix;
+    pIn = pOut;
+    pOut = (pOut == pDst) ? pScratch : pDst;
+  }
+}
+
+/**
+ * @brief Processing function for the mixed radix floating-point complex FFT.
+ * @param[in]      *S         points to an instance of the mixed radix complex FFT structure.
+ * @param[in, out] *p1        points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.
+ * @param[in]      *pScratch  points to the work buffer of size <code>2*fftLen</code>.
+ * @param[in]      ifftFlag   flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1) transform.
+ * @return none.
+ *
+ * The output is in natural order: there is no bit reversal flag.
+ */
+
+void arm_cfft_mr_f32(
+  const arm_cfft_mr_instance_f32 * S,
+  float32_t * p1,
+  float32_t * pScratch,
+  uint8_t ifftFlag)
+{
+  uint32_t fftLen = S->fftLen;                   /* FFT length */
+  float32_t invL;                                /* Inverse scale */
+  uint32_t i;                                    /* Loop counter */
+
+  if (ifftFlag == 1U)
+  {
+    /* The inverse transform is the conjugate of the forward transform of the conjugate */
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[(2U * i) + 1U] = -p1[(2U * i) + 1U];
+    }
+
+    arm_cfft_mr_stages_f32(S, p1, p1, pScratch);
+
+    invL = 1.0f / (float32_t) fftLen;
+    for (i = 0U; i < fftLen; i++)
+    {
+      p1[2U * i] *= invL;
+      p1[(2U * i) + 1U] *= -invL;
+    }
+  }
+  else
+  {
+    arm_cfft_mr_stages_f32(S, p1, p1, pScratch);
+  }
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mr_init_f32.c
+ * Description:  Mixed radix floating-point complex FFT initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the mixed radix floating-point complex FFT.
+ * @param[out] *S         points to an instance of the mixed radix complex FFT structure.
+ * @param[in]  fftLen     length of the FFT, 2 or more, with no prime factor other than 2, 3 and 5.
+ * @param[out] *pTwiddle  points to the twiddle factor buffer of size <code>2*fftLen</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * Factors <code>fftLen</code> into radix 4, 2, 3 and 5 stages, in that order, and writes
+ * the twiddle factors <code>{cos(2*pi*k/fftLen), sin(2*pi*k/fftLen)}</code> for
+ * <code>k = 0 ... fftLen-1</code> to <code>pTwiddle</code>.
+ * They are computed in double precision.
+ */
+
+arm_status arm_cfft_mr_init_f32(
+  arm_cfft_mr_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  static const uint8_t radices[4] = {4U, 2U, 3U, 5U}; /* Radices in stage order */
+  uint32_t n = fftLen;                           /* Length left to factor */
+  uint32_t r, k;                                 /* Loop counters */
+  double angle;                                  /* Twiddle angle */
+
+  if (fftLen < 2U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->numStages = 0U;
+
+  for (r = 0U; r < 4U; r++)
+  {
+    while ((n % radices[r]) == 0U)
+    {
+      S->radix[S->numStages] = radices[r];
+      S->numStages++;
+      n /= radices[r];
+
+      /* One radix 2 stage at most: pairs of them are radix 4 */
+      if (radices[r] == 2U)
+      {
+        break;
+      }
+    }
+  }
+
+  if (n != 1U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    angle = (6.283185307179586 * (double) k) / (double) fftLen;
+    pTwiddle[2U * k] = (float32_t) cos(angle);
+    pTwiddle[(2U * k) + 1U] = (float32_t) sin(angle);
+  }
+
+  S->fftLen = fftLen;
+  S->twidCoefModifier = 1U;
+  S->pTwiddle = pTwiddle;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
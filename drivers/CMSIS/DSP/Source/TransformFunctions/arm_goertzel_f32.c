@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel filter bank
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Filter Bank Functions
+ *
+ * \par
+ * A Goertzel filter bank computes the DFT of consecutive blocks of <code>blockLen</code>
+ * samples at a few frequencies, for <code>O(numBins)</code> operations per sample.
+ * Unlike the \ref SlidingDFT "sliding DFT" it gives one result per block instead of
+ * one per sample, keeps no delay line and takes any frequency, not only multiples of
+ * <code>1/blockLen</code>:
+ * <pre>
+ *    X(f) = sum(m = 0 ... blockLen-1) x[m] * exp(-j*2*pi*f*m)
+ * </pre>
+ * with <code>f</code> in cycles per sample, from 0 to 0.5.  For <code>f = k/blockLen</code>
+ * this is bin <code>k</code> of <code>arm_rfft_fast_f32()</code> of the block.
+ *
+ * \par Algorithm
+ * The Goertzel recurrence <code>s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]</code> loses
+ * precision at low frequencies: <code>2*cos(w)</code> is close to 2, its rounding moves
+ * the pole, and the result is the small difference of two large states.  The functions
+ * use Reinsch's modification instead, which is the same filter written in terms of
+ * <code>s[n-1]</code> and of <code>d[n] = s[n] - s[n-1]</code>, with the small coefficient
+ * <code>4*sin(w/2)^2</code>, for frequencies below 0.25; and of <code>d[n] = s[n] + s[n-1]</code>
+ * with <code>4*cos(w/2)^2</code> above.  Both coefficients are accurate where the plain one
+ * is not, and the result is formed from <code>d</code> without cancellation.
+ * \par
+ * The result is rotated by <code>exp(-j*w*(blockLen-1))</code>, so that its phase is that
+ * of the DFT of the block, and the states restart from zero for the next block.
+ *
+ * \par Block processing
+ * The processing functions take a block of samples of any size and return the number
+ * of results completed in it: each is <code>2*numBins</code> values, in the order of the
+ * frequencies, written one after the other to the output buffer, which must have room for
+ * <code>2*numBins*(blockSize/blockLen + 1)</code> values.  Samples left over are kept in the
+ * state for the next call.
+ * \par
+ * The Q31 functions keep 64-bit states and multiply them with <code>mult32x64()</code>,
+ * as <code>arm_biquad_cas_df1_32x64_q31()</code> does; the results are divided by
+ * <code>2^outShift</code>, <code>outShift = ceil(log2(blockLen))</code>, so that they cannot overflow.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[out]    *pDst      points to the results, <code>2*numBins</code> values per completed block.
+ * @return the number of results written.
+ */
+
+uint32_t arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  const float32_t *pCoeffs;                      /* Coefficients of a frequency */
+  float32_t *pState = S->pState;                 /* States */
+  uint32_t numResults = 0U;                      /* Results written */
+  uint32_t blkCnt;                               /* Samples up to the end of the block */
+  uint32_t b, i;                                 /* Loop counters */
+  float32_t s, d, kappa;                         /* State and Reinsch coefficient */
+  float32_t yR, yI;                              /* Result before the rotation */
+
+  while (blockSize > 0U)
+  {
+    blkCnt = (uint32_t) S->blockLen - S->count;
+    blkCnt = (blkCnt > blockSize) ? blockSize : blkCnt;
+
+    for (b = 0U; b < S->numBins; b++)
+    {
+      pCoeffs = S->pCoeffs + (6U * b);
+      kappa = pCoeffs[1];
+      s = pState[2U * b];
+      d = pState[(2U * b) + 1U];
+
+      if (pCoeffs[0] > 0.0f)
+      {
+        /* d[n] = s[n] - s[n-1] */
+        for (i = 0U; i < blkCnt; i++)
+        {
+          d += pSrc[i] - (kappa * s);
+          s += d;
+        }
+      }
+      else
+      {
+        /* d[n] = s[n] + s[n-1] */
+        for (i = 0U; i < blkCnt; i++)
+        {
+          d = (pSrc[i] + (kappa * s)) - d;
+          s = d - s;
+        }
+      }
+
+      pState[2U * b] = s;
+      pState[(2U * b) + 1U] = d;
+    }
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->count += (uint16_t) blkCnt;
+
+    if (S->count == S->blockLen)
+    {
+      for (b = 0U; b < S->numBins; b++)
+      {
+        /* y = s[N-1] - exp(-j*w)*s[N-2], formed from s[N-1] and d */
+        pCoeffs = S->pCoeffs + (6U * b);
+        s = pState[2U * b];
+        d = pState[(2U * b) + 1U];
+
+        yR = (0.5f * pCoeffs[1] * s) + (pCoeffs[0] * pCoeffs[2] * d);
+        yI = pCoeffs[0] * pCoeffs[3] * (s - d);
+
+        pDst[2U * b] = (pCoeffs[4] * yR) - (pCoeffs[5] * yI);
+        pDst[(2U * b) + 1U] = (pCoeffs[4] * yI) + (pCoeffs[5] * yR);
+      }
+
+      arm_fill_f32(0.0f, pState, 2U * S->numBins);
+      S->count = 0U;
+      pDst += 2U * S->numBins;
+      numResults++;
+    }
+  }
+
+  return (numResults);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Floating-point Goertzel filter bank initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Goertzel filter bank.
+ * @param[out] *S         points to an instance of the floating-point Goertzel structure.
+ * @param[in]  blockLen   number of samples per result, 1 or more.
+ * @param[in]  numBins    number of frequencies, 1 or more.
+ * @param[in]  *pFreqs    points to the <code>numBins</code> frequencies in cycles per sample, 0 to 0.5.
+ * @param[out] *pCoeffs   points to the coefficient buffer of size <code>ARM_GOERTZEL_COEFFS_LEN_F32(numBins)</code>.
+ * @param[out] *pState    points to the state buffer of size <code>2*numBins</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>blockLen</code>, <code>numBins</code> or a frequency is not supported.
+ *
+ * \par Description:
+ * \par
+ * Writes 6 coefficients per frequency <code>f</code>, <code>w = 2*pi*f</code>, computed in double precision:
+ * <pre>
+ *    {sign, kappa, cos(w), sin(w), cos(w*(blockLen-1)), -sin(w*(blockLen-1))}
+ * </pre>
+ * where <code>sign</code> is 1 and <code>kappa = 4*sin(w/2)^2</code> below 0.25 cycles per sample,
+ * -1 and <code>4*cos(w/2)^2</code> above.  The buffer is then read only and may be shared by
+ * banks of the same frequencies and block length.  The state is cleared.
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t blockLen,
+  uint16_t numBins,
+  const float32_t * pFreqs,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  float32_t *pC = pCoeffs;                       /* Coefficients of a frequency */
+  uint32_t b;                                    /* Loop counter */
+  double w;                                      /* Frequency in radians per sample */
+  double sign;                                   /* Form of Reinsch's recurrence */
+
+  if ((blockLen == 0U) || (numBins == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (b = 0U; b < numBins; b++)
+  {
+    if ((pFreqs[b] < 0.0f) || (pFreqs[b] > 0.5f))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    w = 6.283185307179586 * (double) pFreqs[b];
+    sign = (pFreqs[b] < 0.25f) ? 1.0 : -1.0;
+
+    pC[0] = (float32_t) sign;
+    pC[1] = (float32_t) ((sign > 0.0) ? (4.0 * sin(0.5 * w) * sin(0.5 * w)) :
+                                        (4.0 * cos(0.5 * w) * cos(0.5 * w)));
+    pC[2] = (float32_t) cos(w);
+    pC[3] = (float32_t) sin(w);
+    pC[4] = (float32_t) cos(w * (double) (blockLen - 1U));
+    pC[5] = (float32_t) -sin(w * (double) (blockLen - 1U));
+    pC += 6U;
+  }
+
+  arm_fill_f32(0.0f, pState, 2U * numBins);
+
+  S->blockLen = blockLen;
+  S->numBins = numBins;
+  S->count = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Q31 Goertzel filter bank initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/* Largest Reinsch coefficient exponent: below 2^-62 the coefficient is 0 */
+#define GOERTZEL_MAX_SHIFT  62U
+
+/* Bits the states may use, one below the 2^62 bound of the coefficient product */
+#define GOERTZEL_STATE_BITS 61
+
+/**
+ * @brief  Initialization function for the Q31 Goertzel filter bank.
+ * @param[out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]  blockLen   number of samples per result, 1 to 16384.
+ * @param[in]  numBins    number of frequencies, 1 or more.
+ * @param[in]  *pFreqs    points to the <code>numBins</code> frequencies in cycles per sample
+ *                        in 1.31 format, 0 to 0.5.
+ * @param[out] *pCoeffs   points to the coefficient buffer of size <code>ARM_GOERTZEL_COEFFS_LEN_Q31(numBins)</code>.
+ * @param[out] *pState    points to the state buffer of size <code>2*numBins</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>blockLen</code>, <code>numBins</code> or a frequency is not supported.
+ *
+ * \par Description:
+ * \par
+ * Writes 7 coefficients per frequency <code>f</code>, <code>w = 2*pi*f</code>, computed in double precision:
+ * <pre>
+ *    {sign, kappaMant, kappaShift, cos(w), sin(w), cos(w*(blockLen-1)), -sin(w*(blockLen-1))}
+ * </pre>
+ * where <code>sign</code> is 1 and <code>kappa = 4*sin(w/2)^2</code> below 0.25 cycles per sample,
+ * -1 and <code>4*cos(w/2)^2</code> above.  <code>kappa = kappaMant * 2^-(30+kappaShift)</code> keeps
+ * 31 significant bits however small it is; the others are in 1.31 format.
+ * \par
+ * The gain of the recurrence grows with <code>blockLen</code> and as the frequency nears 0 or 0.5,
+ * up to <code>blockLen^2</code>.  The input is shifted left into the 64-bit states by as many bits as
+ * that gain leaves free at the worst frequency of the bank, <code>inShift</code>, which is why
+ * <code>blockLen</code> is limited.  The state is cleared.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t blockLen,
+  uint16_t numBins,
+  const q31_t * pFreqs,
+  q31_t * pCoeffs,
+  q63_t * pState)
+{
+  q31_t *pC = pCoeffs;                           /* Coefficients of a frequency */
+  uint32_t b;                                    /* Loop counter */
+  uint32_t shift;                                /* Exponent of kappa */
+  uint32_t outShift = 0U;                        /* ceil(log2(blockLen)) */
+  int32_t gainBits = 0;                          /* Bits of the largest gain */
+  double w;                                      /* Frequency in radians per sample */
+  double sign;                                   /* Form of Reinsch's recurrence */
+  double kappa;                                  /* Reinsch coefficient */
+  double gain, maxGain = 0.0;                    /* Gain of the recurrence */
+
+  if ((blockLen == 0U) || (numBins == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (b = 0U; b < numBins; b++)
+  {
+    if ((pFreqs[b] < 0) || (pFreqs[b] > 0x40000000))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    w = 6.283185307179586 * ((double) pFreqs[b] / 2147483648.0);
+    sign = (pFreqs[b] < 0x20000000) ? 1.0 : -1.0;
+    kappa = (sign > 0.0) ? (4.0 * sin(0.5 * w) * sin(0.5 * w)) :
+                           (4.0 * cos(0.5 * w) * cos(0.5 * w));
+
+    /* Normalize kappa to [1, 2) times 2^-shift */
+    shift = 0U;
+    while ((kappa > 0.0) && (kappa < 1.0) && (shift < GOERTZEL_MAX_SHIFT))
+    {
+      kappa *= 2.0;
+      shift++;
+    }
+
+    pC[0] = (q31_t) sign;
+    pC[1] = clip_q63_to_q31((q63_t) floor((kappa * 1073741824.0) + 0.5));
+    pC[2] = (q31_t) shift;
+    pC[3] = clip_q63_to_q31((q63_t) floor((cos(w) * 2147483648.0) + 0.5));
+    pC[4] = clip_q63_to_q31((q63_t) floor((sin(w) * 2147483648.0) + 0.5));
+    pC[5] = clip_q63_to_q31((q63_t) floor((cos(w * (double) (blockLen - 1U)) * 2147483648.0) + 0.5));
+    pC[6] = clip_q63_to_q31((q63_t) floor((-sin(w * (double) (blockLen - 1U)) * 2147483648.0) + 0.5));
+    pC += 7U;
+
+    /* The states are bounded by blockLen * min(blockLen, 1/|sin(w)|) times the input, d by twice that */
+    gain = (fabs(sin(w)) * blockLen > 1.0) ? (1.0 / fabs(sin(w))) : (double) blockLen;
+    gain = 2.0 * blockLen * gain;
+    maxGain = (gain > maxGain) ? gain : maxGain;
+  }
+
+  while (ldexp(1.0, gainBits) < maxGain)
+  {
+    gainBits++;
+  }
+
+  /* Inputs are at most 2^31, shifted left by inShift */
+  if ((GOERTZEL_STATE_BITS - 31 - gainBits) < 0)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  while ((1UL << outShift) < blockLen)
+  {
+    outShift++;
+  }
+
+  memset(pState, 0, (2U * numBins) * sizeof(q63_t));
+
+  S->blockLen = blockLen;
+  S->numBins = numBins;
+  S->count = 0U;
+  S->inShift = (uint8_t) (GOERTZEL_STATE_BITS - 31 - gainBits);
+  S->outShift = (uint8_t) outShift;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
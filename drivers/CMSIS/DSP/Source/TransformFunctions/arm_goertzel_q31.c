@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel filter bank
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 Goertzel filter bank.
+ * @param[in,out] *S         points to an instance of the Q31 Goertzel structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[out]    *pDst      points to the results, <code>2*numBins</code> values per completed block.
+ * @return the number of results written.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is shifted left by <code>inShift</code> into 64-bit states, with the headroom the
+ * initialization function reserved for the gain of the recurrence, so the states cannot overflow.
+ * The results are written in 1.31 format divided by <code>2^outShift</code>, the smallest power
+ * of 2 not less than <code>blockLen</code>, and saturated.
+ */
+
+uint32_t arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst)
+{
+  const q31_t *pCoeffs;                          /* Coefficients of a frequency */
+  q63_t *pState = S->pState;                     /* States */
+  uint32_t inShift = S->inShift;                 /* Input shift */
+  uint32_t numResults = 0U;                      /* Results written */
+  uint32_t blkCnt;                               /* Samples up to the end of the block */
+  uint32_t b, i;                                 /* Loop counters */
+  uint32_t lShift, rShift;                       /* Shifts of the kappa product */
+  q31_t kappa;                                   /* Mantissa of the Reinsch coefficient */
+  q63_t s, d, sd;                                /* States */
+  q63_t yR, yI, outR, outI;                      /* Result */
+  q63_t rnd;                                     /* Rounding of the output shift */
+
+  while (blockSize > 0U)
+  {
+    blkCnt = (uint32_t) S->blockLen - S->count;
+    blkCnt = (blkCnt > blockSize) ? blockSize : blkCnt;
+
+    for (b = 0U; b < S->numBins; b++)
+    {
+      /* kappa * s = mult32x64(s, kappaMant) * 2^(2 - kappaShift) */
+      pCoeffs = S->pCoeffs + (7U * b);
+      kappa = pCoeffs[1];
+      lShift = (pCoeffs[2] < 2) ? (2U - (uint32_t) pCoeffs[2]) : 0U;
+      rShift = (pCoeffs[2] > 2) ? ((uint32_t) pCoeffs[2] - 2U) : 0U;
+      s = pState[2U * b];
+      d = pState[(2U * b) + 1U];
+
+      if (pCoeffs[0] > 0)
+      {
+        /* d[n] = s[n] - s[n-1] */
+        for (i = 0U; i < blkCnt; i++)
+        {
+          d += ((q63_t) pSrc[i] << inShift) - ((mult32x64(s, kappa) << lShift) >> rShift);
+          s += d;
+        }
+      }
+      else
+      {
+        /* d[n] = s[n] + s[n-1] */
+        for (i = 0U; i < blkCnt; i++)
+        {
+          d = (((q63_t) pSrc[i] << inShift) + ((mult32x64(s, kappa) << lShift) >> rShift)) - d;
+          s = d - s;
+        }
+      }
+
+      pState[2U * b] = s;
+      pState[(2U * b) + 1U] = d;
+    }
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->count += (uint16_t) blkCnt;
+
+    if (S->count == S->blockLen)
+    {
+      rnd = (1LL << (inShift + S->outShift)) >> 1;
+
+      for (b = 0U; b < S->numBins; b++)
+      {
+        /* y = s[N-1] - exp(-j*w)*s[N-2], formed from s[N-1] and d */
+        pCoeffs = S->pCoeffs + (7U * b);
+        lShift = (pCoeffs[2] < 2) ? (2U - (uint32_t) pCoeffs[2]) : 0U;
+        rShift = (pCoeffs[2] > 2) ? ((uint32_t) pCoeffs[2] - 2U) : 0U;
+        s = pState[2U * b];
+        d = pState[(2U * b) + 1U];
+        sd = mult32x64(d, pCoeffs[3]) << 1;
+
+        yR = (((mult32x64(s, pCoeffs[1]) << lShift) >> rShift) >> 1) + ((pCoeffs[0] > 0) ? sd : -sd);
+        yI = mult32x64(s - d, pCoeffs[4]) << 1;
+        yI = (pCoeffs[0] > 0) ? yI : -yI;
+
+        outR = (mult32x64(yR, pCoeffs[5]) - mult32x64(yI, pCoeffs[6])) << 1;
+        outI = (mult32x64(yI, pCoeffs[5]) + mult32x64(yR, pCoeffs[6])) << 1;
+
+        pDst[2U * b] = clip_q63_to_q31((outR + rnd) >> (inShift + S->outShift));
+        pDst[(2U * b) + 1U] = clip_q63_to_q31((outI + rnd) >> (inShift + S->outShift));
+      }
+
+      memset(pState, 0, (2U * S->numBins) * sizeof(q63_t));
+      S->count = 0U;
+      pDst += 2U * S->numBins;
+      numResults++;
+    }
+  }
+
+  return (numResults);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,222 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_bfp_q15.c
+ * Description:  Block floating-point Q15 real FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup BlockFloatFFT
+ * @{
+ */
+
+/* Bit length of the magnitudes recorded by ORing |x| or ~|x|: the values are in [-2^bits, 2^bits) */
+#define BFP_BITS(m)       (32U - (uint32_t) __CLZ(m))
+
+/* Largest bit length of the input of the split, whose outputs grow up to 2 * sqrt(2) times */
+#define BFP_SPLIT_BITS_Q15  13
+
+/* The split sums products halved: Q15 values times 2^14 */
+#define BFP_SPLIT_FRAC_Q15  14
+
+/**
+ * @brief  Shift of the split of <code>num</code> Q15 values to the headroom it needs.
+ * @param[in]  *pSrc  points to the values.
+ * @param[in]  num    number of values.
+ * @return the right shift of the split sums, at least 1.
+ */
+
+static uint32_t arm_split_bfp_shift_q15(
+  const q15_t * pSrc,
+  uint32_t num)
+{
+  uint32_t mag = 0U;                             /* OR of the magnitudes */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < num; i++)
+  {
+    mag |= (uint32_t) (pSrc[i] ^ (pSrc[i] >> 15));
+  }
+
+  return ((uint32_t) ((int32_t) BFP_SPLIT_FRAC_Q15 + (int32_t) BFP_BITS(mag) - BFP_SPLIT_BITS_Q15));
+}
+
+/**
+ * @brief  Split of the complex FFT of the even and odd samples into the real FFT.
+ * @param[in]  *pSrc     points to the complex FFT of <code>fftLen</code> points.
+ * @param[in]  fftLen    length of the complex FFT.
+ * @param[in]  *pATable  points to the A twiddle factor table.
+ * @param[in]  *pBTable  points to the B twiddle factor table.
+ * @param[out] *pDst     points to the real FFT, <code>4*fftLen</code> values.
+ * @param[in]  modifier  twiddle coefficient modifier.
+ * @param[in]  shift     right shift of the sums.
+ * @return none.
+ */
+
+static void arm_split_rfft_bfp_q15(
+  const q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pATable,
+  const q15_t * pBTable,
+  q15_t * pDst,
+  uint32_t modifier,
+  uint32_t shift)
+{
+  const q15_t *pCoefA = pATable + (2U * modifier); /* A twiddle factors */
+  const q15_t *pCoefB = pBTable + (2U * modifier); /* B twiddle factors */
+  const q15_t *pSrc1 = pSrc + 2;                 /* Bin k */
+  const q15_t *pSrc2 = pSrc + (2U * fftLen) - 2; /* Bin fftLen - k */
+  q31_t rnd = (q31_t) ((1U << shift) >> 1U);     /* Rounding of the shift */
+  q31_t outR, outI;                              /* Split sums */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 1U; i < fftLen; i++)
+  {
+    outR = ((pSrc1[0] * pCoefA[0]) >> 1) - ((pSrc1[1] * pCoefA[1]) >> 1) +
+           ((pSrc2[0] * pCoefB[0]) >> 1) + ((pSrc2[1] * pCoefB[1]) >> 1);
+    outI = ((pSrc2[0] * pCoefB[1]) >> 1) - ((pSrc2[1] * pCoefB[0]) >> 1) +
+           ((pSrc1[1] * pCoefA[0]) >> 1) + ((pSrc1[0] * pCoefA[1]) >> 1);
+
+    outR = (outR + rnd) >> shift;
+    outI = (outI + rnd) >> shift;
+
+    /* Bin k and its conjugate, bin 2 * fftLen - k */
+    pDst[2U * i] = (q15_t) outR;
+    pDst[(2U * i) + 1U] = (q15_t) outI;
+    pDst[(4U * fftLen) - (2U * i)] = (q15_t) outR;
+    pDst[((4U * fftLen) - (2U * i)) + 1U] = (q15_t) -outI;
+
+    pSrc1 += 2;
+    pSrc2 -= 2;
+    pCoefA += 2U * modifier;
+    pCoefB += 2U * modifier;
+  }
+
+  /* Bins 0 and fftLen are real */
+  pDst[2U * fftLen] = (q15_t) (((((q31_t) pSrc[0] - pSrc[1]) << BFP_SPLIT_FRAC_Q15) + rnd) >> shift);
+  pDst[(2U * fftLen) + 1U] = 0;
+  pDst[0] = (q15_t) (((((q31_t) pSrc[0] + pSrc[1]) << BFP_SPLIT_FRAC_Q15) + rnd) >> shift);
+  pDst[1] = 0;
+}
+
+/**
+ * @brief  Merge of the real spectrum into the complex spectrum of the even and odd samples.
+ * @param[in]  *pSrc     points to the real FFT, bins 0 to <code>fftLen</code>.
+ * @param[in]  fftLen    length of the complex FFT.
+ * @param[in]  *pATable  points to the A twiddle factor table.
+ * @param[in]  *pBTable  points to the B twiddle factor table.
+ * @param[out] *pDst     points to the complex spectrum, <code>2*fftLen</code> values.
+ * @param[in]  modifier  twiddle coefficient modifier.
+ * @param[in]  shift     right shift of the sums.
+ * @return none.
+ */
+
+static void arm_split_rifft_bfp_q15(
+  const q15_t * pSrc,
+  uint32_t fftLen,
+  const q15_t * pATable,
+  const q15_t * pBTable,
+  q15_t * pDst,
+  uint32_t modifier,
+  uint32_t shift)
+{
+  const q15_t *pCoefA = pATable;                 /* A twiddle factors */
+  const q15_t *pCoefB = pBTable;                 /* B twiddle factors */
+  const q15_t *pSrc1 = pSrc;                     /* Bin k */
+  const q15_t *pSrc2 = pSrc + (2U * fftLen);     /* Bin fftLen - k */
+  q31_t rnd = (q31_t) ((1U << shift) >> 1U);     /* Rounding of the shift */
+  q31_t outR, outI;                              /* Split sums */
+  uint32_t i;                                    /* Loop counter */
+
+  for (i = 0U; i < fftLen; i++)
+  {
+    outR = ((pSrc2[0] * pCoefB[0]) >> 1) - ((pSrc2[1] * pCoefB[1]) >> 1) +
+           ((pSrc1[0] * pCoefA[0]) >> 1) + ((pSrc1[1] * pCoefA[1]) >> 1);
+    outI = ((pSrc1[1] * pCoefA[0]) >> 1) - ((pSrc1[0] * pCoefA[1]) >> 1) -
+           ((pSrc2[0] * pCoefB[1]) >> 1) - ((pSrc2[1] * pCoefB[0]) >> 1);
+
+    pDst[2U * i] = (q15_t) ((outR + rnd) >> shift);
+    pDst[(2U * i) + 1U] = (q15_t) ((outI + rnd) >> shift);
+
+    pSrc1 += 2;
+    pSrc2 -= 2;
+    pCoefA += 2U * modifier;
+    pCoefB += 2U * modifier;
+  }
+}
+
+/**
+ * @brief  Processing function for the block floating-point Q15 real FFT.
+ * @param[in]  *S          points to an instance of the Q15 RFFT/RIFFT structure.
+ * @param[in]  *pSrc       points to the input buffer, modified by the forward transform.
+ * @param[out] *pDst       points to the output buffer.
+ * @param[out] *pBlockExp  points to the block exponent of the output.
+ * @return none.
+ *
+ * The instance is that of <code>arm_rfft_q15()</code>, set up by <code>arm_rfft_init_q15()</code>
+ * with <code>bitReverseFlag</code> 1, and the buffers are laid out the same way:
+ * the forward transform reads <code>fftLenReal</code> real values and writes all
+ * <code>fftLenReal</code> complex bins, <code>2*fftLenReal</code> values; the inverse
+ * transform reads bins 0 to <code>fftLenReal/2</code> and writes <code>fftLenReal</code> real values.
+ */
+
+void arm_rfft_bfp_q15(
+  const arm_rfft_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  int8_t * pBlockExp)
+{
+  uint32_t L2 = (uint32_t) S->fftLenReal >> 1U;  /* Length of the complex FFT */
+  uint32_t shift;                                /* Right shift of the split sums */
+  int8_t exponent;                               /* Block exponent of the complex FFT */
+
+  if (S->ifftFlagR == 1U)
+  {
+    /* Merge at the headroom of the complex IFFT, then transform */
+    shift = arm_split_bfp_shift_q15(pSrc, (2U * L2) + 2U);
+    arm_split_rifft_bfp_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst,
+                            S->twidCoefRModifier, shift);
+    arm_cfft_bfp_q15(S->pCfft, pDst, 1U, S->bitReverseFlagR, &exponent);
+
+    /* The complex IFFT of fftLenReal/2 points gives fftLenReal/2 times the samples */
+    *pBlockExp = (int8_t) ((int32_t) exponent + (int32_t) shift - BFP_SPLIT_FRAC_Q15 + 1);
+  }
+  else
+  {
+    arm_cfft_bfp_q15(S->pCfft, pSrc, 0U, S->bitReverseFlagR, &exponent);
+    shift = arm_split_bfp_shift_q15(pSrc, 2U * L2);
+    arm_split_rfft_bfp_q15(pSrc, L2, S->pTwiddleAReal, S->pTwiddleBReal, pDst,
+                           S->twidCoefRModifier, shift);
+
+    *pBlockExp = (int8_t) ((int32_t) exponent + (int32_t) shift - BFP_SPLIT_FRAC_Q15);
+  }
+}
+
+/**
+ * @} end of BlockFloatFFT group
+ */
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_init_ram_f32.c
+ * Description:  Floating-point real FFT initialization with twiddle factors in RAM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point real FFT with twiddle factors computed in RAM.
+ * @param[out] *S         points to an arm_rfft_fast_instance_f32 structure.
+ * @param[in]  fftLen     length of the real sequence, 32 to 4096, a power of 2.
+ * @param[out] *pTwiddle  points to the twiddle factor buffer of size <code>2*fftLen</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not supported or its bit reversal table is not compiled.
+ *
+ * \par Description:
+ * \par
+ * Sets up <code>S</code> for <code>arm_rfft_fast_f32()</code> as
+ * <code>arm_rfft_fast_init_f32()</code> does, but computes the twiddle factors of
+ * both stages in double precision instead of using the tables in flash:
+ * - the first <code>fftLen</code> values hold those of the complex FFT of
+ *   <code>fftLen/2</code> points, written by <code>arm_cfft_init_ram_f32()</code>
+ * - the last <code>fftLen</code> values hold <code>{sin(2*pi*k/fftLen), cos(2*pi*k/fftLen)}</code>
+ *   for <code>k = 0 ... fftLen/2-1</code>, used to split the complex spectrum.
+ * \par
+ * The bit reversal table of <code>fftLen/2</code> points stays in flash and is
+ * selected alone by <code>ARM_TABLE_BITREVIDX_FLT_&lt;fftLen/2&gt;</code>.
+ * For lengths that are not a power of 2, <code>arm_rfft_mr_init_f32()</code>
+ * also computes its tables and needs none in flash.
+ */
+
+arm_status arm_rfft_fast_init_ram_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  float32_t *pTwiddleRFFT = pTwiddle + fftLen;   /* Split stage twiddles */
+  uint32_t k;                                    /* Loop counter */
+  double angle;                                  /* Twiddle angle */
+
+  if (arm_cfft_init_ram_f32(&S->Sint, fftLen / 2U, pTwiddle) != ARM_MATH_SUCCESS)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < (fftLen / 2U); k++)
+  {
+    angle = (6.283185307179586 * (double) k) / (double) fftLen;
+    pTwiddleRFFT[2U * k] = (float32_t) sin(angle);
+    pTwiddleRFFT[(2U * k) + 1U] = (float32_t) cos(angle);
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of RealFFT group
+ */
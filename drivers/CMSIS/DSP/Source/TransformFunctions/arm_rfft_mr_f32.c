@@ -0,0 +1,159 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mr_f32.c
+ * Description:  Mixed radix floating-point real FFT for lengths 2^a 3^b 5^c
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_cfft_mr_stages_f32(
+  const arm_cfft_mr_instance_f32 * S,
+  const float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratch);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief Processing function for the mixed radix floating-point real FFT.
+ * @param[in]  *S         points to an instance of the mixed radix real FFT structure.
+ * @param[in]  *pSrc      points to the input buffer of size <code>fftLen</code>.
+ * @param[out] *pDst      points to the output buffer of size <code>fftLen</code>.  May be <code>pSrc</code>.
+ * @param[in]  *pScratch  points to the work buffer of size <code>fftLen</code>.
+ * @param[in]  ifftFlag   RFFT if flag is 0, RIFFT if flag is 1
+ * @return none.
+ *
+ * The forward transform takes <code>fftLen</code> real samples and gives the packed
+ * spectrum of <code>arm_rfft_fast_f32()</code>; the inverse transform takes that spectrum
+ * and gives the samples back.  Unlike <code>arm_rfft_fast_f32()</code>, the input is not
+ * modified unless it is also the output.
+ */
+
+void arm_rfft_mr_f32(
+  const arm_rfft_mr_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  float32_t * pScratch,
+  uint8_t ifftFlag)
+{
+  uint32_t halfLen = S->fftLenRFFT >> 1U;        /* Length of the complex FFT */
+  const float32_t *pTwid = S->pTwiddleRFFT;      /* Twiddle factors of fftLen points */
+  float32_t zr, zi, cr, ci;                      /* Bins k and halfLen - k */
+  float32_t er, ei, dr, di, tr, ti;              /* Even and odd sample spectra */
+  float32_t c, s;                                /* Twiddle factor */
+  float32_t invL;                                /* Inverse scale */
+  uint32_t k;                                    /* Loop counter */
+
+  if (ifftFlag == 0U)
+  {
+    /* Complex FFT of the even samples as real parts and the odd samples as imaginary parts */
+    arm_cfft_mr_stages_f32(&S->Sint, pSrc, pDst, pScratch);
+
+    /* Split it into the spectra of the even and odd samples and combine them.
+     * Bins 0 and halfLen are real and packed in the first pair. */
+    zr = pDst[0];
+    zi = pDst[1];
+    pDst[0] = zr + zi;
+    pDst[1] = zr - zi;
+
+    for (k = 1U; k <= (halfLen >> 1U); k++)
+    {
+      zr = pDst[2U * k];
+      zi = pDst[(2U * k) + 1U];
+      cr = pDst[2U * (halfLen - k)];
+      ci = -pDst[(2U * (halfLen - k)) + 1U];
+      c = pTwid[2U * k];
+      s = pTwid[(2U * k) + 1U];
+
+      /* E = (Z[k] + conj(Z[halfLen-k])) / 2, O = -i * (Z[k] - conj(Z[halfLen-k])) / 2 */
+      er = 0.5f * (zr + cr);
+      ei = 0.5f * (zi + ci);
+      dr = 0.5f * (zr - cr);
+      di = 0.5f * (zi - ci);
+
+      /* W^k * O */
+      tr = (di * c) - (dr * s);
+      ti = (-dr * c) - (di * s);
+
+      /* X[k] = E + W^k * O, X[halfLen-k] = conj(E - W^k * O) */
+      pDst[2U * k] = er + tr;
+      pDst[(2U * k) + 1U] = ei + ti;
+      pDst[2U * (halfLen - k)] = er - tr;
+      pDst[(2U * (halfLen - k)) + 1U] = ti - ei;
+    }
+  }
+  else
+  {
+    /* Spectrum of the complex sequence of even and odd samples, conjugated
+     * so that the forward transform gives the inverse */
+    zr = pSrc[0];
+    zi = pSrc[1];
+    pDst[0] = 0.5f * (zr + zi);
+    pDst[1] = -0.5f * (zr - zi);
+
+    for (k = 1U; k <= (halfLen >> 1U); k++)
+    {
+      zr = pSrc[2U * k];
+      zi = pSrc[(2U * k) + 1U];
+      cr = pSrc[2U * (halfLen - k)];
+      ci = -pSrc[(2U * (halfLen - k)) + 1U];
+      c = pTwid[2U * k];
+      s = pTwid[(2U * k) + 1U];
+
+      er = 0.5f * (zr + cr);
+      ei = 0.5f * (zi + ci);
+      dr = 0.5f * (zr - cr);
+      di = 0.5f * (zi - ci);
+
+      /* O = conj(W^k) * (X[k] - conj(X[halfLen-k])) / 2 */
+      tr = (dr * c) - (di * s);
+      ti = (dr * s) + (di * c);
+
+      /* Z[k] = E + i * O, Z[halfLen-k] = conj(E) + i * conj(O), both conjugated */
+      pDst[2U * k] = er - ti;
+      pDst[(2U * k) + 1U] = -(ei + tr);
+      pDst[2U * (halfLen - k)] = er + ti;
+      pDst[(2U * (halfLen - k)) + 1U] = ei - tr;
+    }
+
+    arm_cfft_mr_stages_f32(&S->Sint, pDst, pDst, pScratch);
+
+    invL = 1.0f / (float32_t) halfLen;
+    for (k = 0U; k < halfLen; k++)
+    {
+      pDst[2U * k] *= invL;
+      pDst[(2U * k) + 1U] *= -invL;
+    }
+  }
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
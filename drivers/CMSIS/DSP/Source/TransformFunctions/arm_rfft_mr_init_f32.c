@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mr_init_f32.c
+ * Description:  Mixed radix floating-point real FFT initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup MixedRadixFFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the mixed radix floating-point real FFT.
+ * @param[out] *S         points to an instance of the mixed radix real FFT structure.
+ * @param[in]  fftLen     length of the real sequence, 4 or more and even, with <code>fftLen/2</code> a supported complex FFT length.
+ * @param[out] *pTwiddle  points to the twiddle factor buffer of size <code>2*fftLen</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>fftLen</code> is not a supported value.
+ *
+ * \par Description:
+ * \par
+ * Plans the complex FFT of <code>fftLen/2</code> points and writes the twiddle factors
+ * of <code>fftLen</code> points to <code>pTwiddle</code>.  The complex FFT reads every
+ * other one, so both share the buffer.
+ */
+
+arm_status arm_rfft_mr_init_f32(
+  arm_rfft_mr_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle)
+{
+  uint32_t k;                                    /* Loop counter */
+  double angle;                                  /* Twiddle angle */
+
+  if (((fftLen & 1U) != 0U) ||
+      (arm_cfft_mr_init_f32(&S->Sint, fftLen >> 1U, pTwiddle) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < fftLen; k++)
+  {
+    angle = (6.283185307179586 * (double) k) / (double) fftLen;
+    pTwiddle[2U * k] = (float32_t) cos(angle);
+    pTwiddle[(2U * k) + 1U] = (float32_t) sin(angle);
+  }
+
+  S->Sint.twidCoefModifier = 2U;
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddle;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of MixedRadixFFT group
+ */
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SlidingDFT Sliding DFT Functions
+ *
+ * \par
+ * The sliding DFT keeps a few bins of the DFT of the last <code>winLen</code>
+ * samples up to date as each sample arrives, for <code>O(numBins)</code> operations
+ * per sample, where recomputing them with an FFT on every sample costs
+ * <code>O(winLen log winLen)</code>.  Bin <code>k</code> after sample <code>n</code> is
+ * <pre>
+ *    X[k] = sum(m = 0 ... winLen-1) x[n-winLen+1+m] * exp(-j*2*pi*k*m/winLen)
+ * </pre>
+ * the bin <code>k</code> of <code>arm_cfft_f32()</code> or <code>arm_rfft_fast_f32()</code>
+ * of the window, oldest sample first.  <code>winLen</code> may be any length.
+ *
+ * \par Algorithm
+ * The textbook sliding DFT multiplies each bin by <code>exp(j*2*pi*k/winLen)</code>
+ * on every sample.  Its pole sits on the unit circle, so the rounding of that
+ * coefficient and of every update accumulates without bound and the bins drift.
+ * These functions use the modulated form instead: each bin keeps the sum
+ * <pre>
+ *    Y[k] = sum(over the window) x[i] * exp(-j*2*pi*k*i/winLen)
+ * </pre>
+ * over the absolute sample index <code>i</code>, which only adds the newest sample and
+ * subtracts the oldest with the same twiddle factor, read from a table, and rotates
+ * <code>Y[k]</code> to the window when the bins are read.  Nothing is multiplied
+ * recursively, so errors cannot grow exponentially:
+ * - The Q31 function accumulates in 64 bits the same truncated products it adds and
+ *   later subtracts, so they cancel exactly and the sums never drift.
+ * - The floating-point function cannot cancel exactly, so it also restarts a second
+ *   sum at every multiple of <code>winLen</code> samples, which holds the whole
+ *   window <code>winLen</code> samples later and replaces the running sum then.
+ *   The error is that of <code>winLen</code> additions at most, whatever the run time,
+ *   for one more complex multiply-accumulate per bin and sample.
+ *
+ * \par Block processing
+ * The processing functions take a block of samples of any size and write the bins
+ * after its last sample, so a block of 1 sample gives the bins after every sample.
+ * Inside a block each bin is updated over all the samples in turn, which keeps its
+ * sums in registers.  All memory comes from the caller: the initialization functions
+ * write the twiddle factors of <code>winLen</code> points to a buffer that is then
+ * read only, and clear the state.
+ * \par
+ * The Q31 bins are scaled down by <code>2^winShift</code>, <code>winShift = ceil(log2(winLen))</code>,
+ * so that they cannot overflow.
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S         points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[out]    *pDst      points to the bins after the last sample, <code>2*numBins</code>
+ *                           values in the order of the bin indices, or NULL.
+ * @return none.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pDst)
+{
+  const float32_t *pTwiddle = S->pTwiddle;       /* Twiddle factors */
+  float32_t *pDelay = S->pState;                 /* Delay line */
+  float32_t *pSum = pDelay + S->winLen;          /* Running sums */
+  float32_t *pFresh = pSum + (2U * S->numBins);  /* Sums restarted at position 0 */
+  uint32_t winLen = S->winLen;                   /* Window length */
+  uint32_t pos = S->pos;                         /* Delay line position */
+  uint32_t blkCnt;                               /* Samples up to the end of the delay line */
+  uint32_t b, i, k, idx;                         /* Loop counters and indices */
+  float32_t sumR, sumI, freshR, freshI;          /* Sums of a bin */
+  float32_t in, diff, c, s;                      /* Temporary variables */
+
+  while (blockSize > 0U)
+  {
+    blkCnt = winLen - pos;
+    blkCnt = (blkCnt > blockSize) ? blockSize : blkCnt;
+
+    for (b = 0U; b < S->numBins; b++)
+    {
+      k = S->pBins[b];
+      idx = (k * pos) % winLen;
+
+      sumR = pSum[2U * b];
+      sumI = pSum[(2U * b) + 1U];
+      freshR = pFresh[2U * b];
+      freshI = pFresh[(2U * b) + 1U];
+
+      for (i = 0U; i < blkCnt; i++)
+      {
+        /* The newest sample enters and the oldest leaves with the same twiddle factor */
+        in = pSrc[i];
+        diff = in - pDelay[pos + i];
+        c = pTwiddle[2U * idx];
+        s = pTwiddle[(2U * idx) + 1U];
+
+        sumR += diff * c;
+        sumI -= diff * s;
+        freshR += in * c;
+        freshI -= in * s;
+
+        idx += k;
+        idx = (idx >= winLen) ? (idx - winLen) : idx;
+      }
+
+      pSum[2U * b] = sumR;
+      pSum[(2U * b) + 1U] = sumI;
+      pFresh[2U * b] = freshR;
+      pFresh[(2U * b) + 1U] = freshI;
+    }
+
+    arm_copy_f32((float32_t *) pSrc, pDelay + pos, blkCnt);
+    pSrc += blkCnt;
+    pos += blkCnt;
+    blockSize -= blkCnt;
+
+    /* The restarted sums now hold the whole window: they replace the running sums */
+    if (pos == winLen)
+    {
+      pos = 0U;
+      arm_copy_f32(pFresh, pSum, 2U * S->numBins);
+      arm_fill_f32(0.0f, pFresh, 2U * S->numBins);
+    }
+  }
+
+  S->pos = (uint16_t) pos;
+
+  if (pDst != NULL)
+  {
+    /* Rotate the sums to the window, whose oldest sample is at the delay line position */
+    for (b = 0U; b < S->numBins; b++)
+    {
+      idx = ((uint32_t) S->pBins[b] * pos) % winLen;
+      c = pTwiddle[2U * idx];
+      s = pTwiddle[(2U * idx) + 1U];
+      sumR = pSum[2U * b];
+      sumI = pSum[(2U * b) + 1U];
+
+      pDst[2U * b] = (sumR * c) - (sumI * s);
+      pDst[(2U * b) + 1U] = (sumI * c) + (sumR * s);
+    }
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_f32.c
+ * Description:  Floating-point sliding DFT initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding DFT.
+ * @param[out] *S         points to an instance of the floating-point sliding DFT structure.
+ * @param[in]  winLen     length of the sliding window, 2 or more.
+ * @param[in]  numBins    number of DFT bins, 1 or more.
+ * @param[in]  *pBins     points to the <code>numBins</code> bin indices, each less than <code>winLen</code>.
+ * @param[out] *pTwiddle  points to the twiddle factor buffer of size <code>2*winLen</code>.
+ * @param[out] *pState    points to the state buffer of size <code>ARM_SDFT_STATE_LEN_F32(winLen, numBins)</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>winLen</code>, <code>numBins</code> or a bin index is not supported.
+ *
+ * \par Description:
+ * \par
+ * Writes the twiddle factors <code>{cos(2*pi*k/winLen), sin(2*pi*k/winLen)}</code> for
+ * <code>k = 0 ... winLen-1</code> to <code>pTwiddle</code>, in double precision, and
+ * clears the state: the window starts filled with zeros.
+ * The bin indices are not copied and must stay valid.
+ */
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t winLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  float32_t * pTwiddle,
+  float32_t * pState)
+{
+  uint32_t k;                                    /* Loop counter */
+  double angle;                                  /* Twiddle angle */
+
+  if ((winLen < 2U) || (numBins == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= winLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  for (k = 0U; k < winLen; k++)
+  {
+    angle = (6.283185307179586 * (double) k) / (double) winLen;
+    pTwiddle[2U * k] = (float32_t) cos(angle);
+    pTwiddle[(2U * k) + 1U] = (float32_t) sin(angle);
+  }
+
+  arm_fill_f32(0.0f, pState, ARM_SDFT_STATE_LEN_F32(winLen, numBins));
+
+  S->winLen = winLen;
+  S->numBins = numBins;
+  S->pos = 0U;
+  S->pBins = pBins;
+  S->pTwiddle = pTwiddle;
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
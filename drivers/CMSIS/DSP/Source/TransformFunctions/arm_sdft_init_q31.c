@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q31.c
+ * Description:  Q31 sliding DFT initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding DFT.
+ * @param[out] *S         points to an instance of the Q31 sliding DFT structure.
+ * @param[in]  winLen     length of the sliding window, 2 or more.
+ * @param[in]  numBins    number of DFT bins, 1 or more.
+ * @param[in]  *pBins     points to the <code>numBins</code> bin indices, each less than <code>winLen</code>.
+ * @param[out] *pTwiddle  points to the twiddle factor buffer of size <code>2*winLen</code>.
+ * @param[out] *pState    points to the delay line of size <code>winLen</code>.
+ * @param[out] *pSums     points to the sums buffer of size <code>2*numBins</code>.
+ * @return     The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if
+ * <code>winLen</code>, <code>numBins</code> or a bin index is not supported.
+ *
+ * \par Description:
+ * \par
+ * Writes the twiddle factors <code>{cos(2*pi*k/winLen), sin(2*pi*k/winLen)}</code> for
+ * <code>k = 0 ... winLen-1</code> in 1.31 format to <code>pTwiddle</code>, computed in
+ * double precision and rounded, and clears the state: the window starts filled with zeros.
+ * The bin indices are not copied and must stay valid.
+ */
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t winLen,
+  uint16_t numBins,
+  const uint16_t * pBins,
+  q31_t * pTwiddle,
+  q31_t * pState,
+  q63_t * pSums)
+{
+  uint32_t k;                                    /* Loop counter */
+  uint32_t winShift = 0U;                        /* ceil(log2(winLen)) */
+  double angle;                                  /* Twiddle angle */
+
+  if ((winLen < 2U) || (numBins == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= winLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  while ((1UL << winShift) < winLen)
+  {
+    winShift++;
+  }
+
+  for (k = 0U; k < winLen; k++)
+  {
+    angle = (6.283185307179586 * (double) k) / (double) winLen;
+    pTwiddle[2U * k] = clip_q63_to_q31((q63_t) floor((cos(angle) * 2147483648.0) + 0.5));
+    pTwiddle[(2U * k) + 1U] = clip_q63_to_q31((q63_t) floor((sin(angle) * 2147483648.0) + 0.5));
+  }
+
+  arm_fill_q31(0, pState, winLen);
+  memset(pSums, 0, (2U * numBins) * sizeof(q63_t));
+
+  S->winLen = winLen;
+  S->numBins = numBins;
+  S->pos = 0U;
+  S->winShift = (uint8_t) winShift;
+  S->pBins = pBins;
+  S->pTwiddle = pTwiddle;
+  S->pState = pState;
+  S->pSums = pSums;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SlidingDFT
+ * @{
+ */
+
+/**
+ * @brief  Processing function for the Q31 sliding DFT.
+ * @param[in,out] *S         points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     *pSrc      points to the block of input samples.
+ * @param[in]     blockSize  number of samples to process.
+ * @param[out]    *pDst      points to the bins after the last sample, <code>2*numBins</code>
+ *                           values in the order of the bin indices, or NULL.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The products of the samples and the twiddle factors are truncated to 2.30 format and
+ * summed in 64-bit accumulators, which cannot overflow for any window length: a sample
+ * leaving the window subtracts exactly what it added, so the sums never drift.
+ * The bins are written in 1.31 format divided by <code>2^winShift</code>, the smallest
+ * power of 2 not less than <code>winLen</code>, and saturated.
+ */
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t * pDst)
+{
+  const q31_t *pTwiddle = S->pTwiddle;           /* Twiddle factors */
+  q31_t *pDelay = S->pState;                     /* Delay line */
+  q63_t *pSum = S->pSums;                        /* Running sums */
+  uint32_t winLen = S->winLen;                   /* Window length */
+  uint32_t pos = S->pos;                         /* Delay line position */
+  uint32_t blkCnt;                               /* Samples up to the end of the delay line */
+  uint32_t b, i, k, idx;                         /* Loop counters and indices */
+  q63_t sumR, sumI;                              /* Sums of a bin */
+  q31_t in, out, c, s;                           /* Temporary variables */
+  q31_t yR, yI;                                  /* Scaled sums */
+
+  while (blockSize > 0U)
+  {
+    blkCnt = winLen - pos;
+    blkCnt = (blkCnt > blockSize) ? blockSize : blkCnt;
+
+    for (b = 0U; b < S->numBins; b++)
+    {
+      k = S->pBins[b];
+      idx = (k * pos) % winLen;
+
+      sumR = pSum[2U * b];
+      sumI = pSum[(2U * b) + 1U];
+
+      for (i = 0U; i < blkCnt; i++)
+      {
+        /* The oldest sample subtracts the truncated products it added winLen samples ago */
+        in = pSrc[i];
+        out = pDelay[pos + i];
+        c = pTwiddle[2U * idx];
+        s = pTwiddle[(2U * idx) + 1U];
+
+        sumR += (((q63_t) in * c) >> 32) - (((q63_t) out * c) >> 32);
+        sumI -= (((q63_t) in * s) >> 32) - (((q63_t) out * s) >> 32);
+
+        idx += k;
+        idx = (idx >= winLen) ? (idx - winLen) : idx;
+      }
+
+      pSum[2U * b] = sumR;
+      pSum[(2U * b) + 1U] = sumI;
+    }
+
+    arm_copy_q31((q31_t *) pSrc, pDelay + pos, blkCnt);
+    pSrc += blkCnt;
+    pos += blkCnt;
+    blockSize -= blkCnt;
+
+    pos = (pos == winLen) ? 0U : pos;
+  }
+
+  S->pos = (uint16_t) pos;
+
+  if (pDst != NULL)
+  {
+    /* Scale the 2.30 sums to 1.31 divided by 2^winShift and rotate them to the window */
+    for (b = 0U; b < S->numBins; b++)
+    {
+      idx = ((uint32_t) S->pBins[b] * pos) % winLen;
+      c = pTwiddle[2U * idx];
+      s = pTwiddle[(2U * idx) + 1U];
+      sumR = pSum[2U * b] + ((1LL << (S->winShift - 1U)) >> 1);
+      sumI = pSum[(2U * b) + 1U] + ((1LL << (S->winShift - 1U)) >> 1);
+
+      yR = clip_q63_to_q31(sumR >> (S->winShift - 1U));
+      yI = clip_q63_to_q31(sumI >> (S->winShift - 1U));
+
+      pDst[2U * b] = clip_q63_to_q31((((q63_t) yR * c) - ((q63_t) yI * s)) >> 31);
+      pDst[(2U * b) + 1U] = clip_q63_to_q31((((q63_t) yI * c) + ((q63_t) yR * s)) >> 31);
+    }
+  }
+}
+
+/**
+ * @} end of SlidingDFT group
+ */
@@ -0,0 +1,96 @@
+//! @addtogroup Host
+//! @{
+//
+//****************************************************************************
+//! @file bench_util.h
+//! @brief This contains the timing shared by the host DSP benchmarks: a
+//!        monotonic clock in seconds and the best of BENCH_TRIALS runs of at
+//!        least BENCH_MIN_S each. A bench that needs other values defines
+//!        them before it includes this file.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+#include <time.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//each point is the best of BENCH_TRIALS runs of at least BENCH_MIN_S
+#ifndef BENCH_MIN_S
+#define BENCH_MIN_S       0.02
+#endif
+#ifndef BENCH_TRIALS
+#define BENCH_TRIALS      3u
+#endif
+
+typedef void (*BenchStep_t)(void *arg);
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Monotonic time
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Seconds since an arbitrary start
+//
+static inline double BenchNowS(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+//
+//! @brief Time a step: it is repeated for at least BENCH_MIN_S, and the
+//!        fastest of BENCH_TRIALS such runs is kept, as a stall of the
+//!        machine only ever makes a run slower
+//! @param[in]    step  Work to time
+//! @param[in]    arg   Passed to the step
+//! @param[out]   None
+//! @return       Seconds per step
+//
+static inline double BenchTime(BenchStep_t step, void *arg)
+{
+    double   best = 0.0;
+    uint32_t trial;
+
+    for (trial = 0; trial < BENCH_TRIALS; trial++)
+    {
+        uint32_t runs  = 0;
+        double   start = BenchNowS();
+        double   elapsed;
+
+        do
+        {
+            step(arg);
+            runs++;
+            elapsed = BenchNowS() - start;
+        } while (elapsed < BENCH_MIN_S);
+
+        elapsed /= runs;
+        best     = ((0u == trial) || (elapsed < best)) ? elapsed : best;
+    }
+
+    return best;
+}
+
+#endif // BENCH_UTIL_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
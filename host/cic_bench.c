@@ -0,0 +1,551 @@
+//! @addtogroup Host
+//! @brief CIC decimator check and benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file cic_bench.c
+//! @brief Checks arm_cic_decimate_q31() against the direct FIR of its N
+//!        moving sums of R samples, which it must match to the bit for
+//!        full scale inputs in blocks of varying size, up to R^N = 2^32.
+//!
+//!        Then, for total decimation factors of 64 to 250, designs a
+//!        compensation FIR for the CIC stages, measures the rejection of
+//!        what would alias into the passband, and designs a single stage
+//!        FIR decimator with at least the same rejection.  Both chains are
+//!        checked with a passband tone and an aliasing tone, and timed.
+//!
+//!        Times are in ns per input sample, and in cycles per input sample
+//!        when the clock of the machine is given.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/cic_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o cic_bench
+//!
+//!        Usage: cic_bench [cpu MHz]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_STREAM_LEN  64000u
+#define BENCH_MAX_STAGES  8u
+#define BENCH_MAX_TAPS    8192u
+#define BENCH_MAX_BLOCK   1024u
+//passband edge in cycles per output sample, what folds within it is rejected
+#define BENCH_PASS        0.2
+#define BENCH_COMP_ATTEN  80.0
+//frequency points per aliasing band
+#define BENCH_GRID        16u
+
+typedef struct
+{
+    uint16_t R;
+    uint8_t  numStages;
+    uint8_t  M;
+} BenchChain_t;
+
+typedef struct
+{
+    double rejection;
+    double ripple;
+} BenchResponse_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//
+//! @brief Kaiser window
+//! @param[in]    n     index
+//! @param[in]    len   window length
+//! @param[in]    beta  shape
+//! @param[out]   None
+//! @return       window value
+//
+static double Kaiser(uint32_t n, uint32_t len, double beta);
+
+//
+//! @brief Response of the CIC stages
+//! @param[in]    f  frequency in cycles per input sample
+//! @param[out]   None
+//! @return       magnitude, 1 at DC
+//
+static double CicResponse(const BenchChain_t *pChain, double f);
+
+//
+//! @brief Response of a linear phase FIR
+//! @param[in]    pCoeffs  coefficients
+//! @param[in]    len      length
+//! @param[in]    f        frequency in cycles per sample
+//! @param[out]   None
+//! @return       magnitude
+//
+static double FirResponse(const float64_t *pCoeffs, uint32_t len, double f);
+
+//
+//! @brief Worst rejection over the aliasing bands and passband ripple
+//! @param[in]    pChain  chain, with numStages 0 for the single stage FIR
+//! @param[in]    len     length of s_Fir
+//! @param[out]   None
+//! @return       rejection and ripple in dB
+//
+static BenchResponse_t Response(const BenchChain_t *pChain, uint32_t len);
+
+//
+//! @brief Design the compensation FIR of a chain into s_Fir
+//! @param[in]    pChain  chain
+//! @param[out]   None
+//! @return       length
+//
+static uint32_t DesignComp(const BenchChain_t *pChain);
+
+//
+//! @brief Design a single stage decimation FIR into s_Fir
+//! @param[in]    decim      decimation factor
+//! @param[in]    rejection  rejection to reach in dB
+//! @param[out]   None
+//! @return       length
+//
+static uint32_t DesignSingle(uint32_t decim, double rejection);
+
+//
+//! @brief Check the CIC stages against their direct FIR
+//! @param[in]    R          decimation factor
+//! @param[in]    numStages  number of stages
+//! @param[out]   None
+//! @return       1 if an output differs, else 0
+//
+static uint32_t CheckExact(uint16_t R, uint8_t numStages);
+
+//
+//! @brief Output level of a decimator for a tone, after settling
+//! @param[in]    cic   1 for the CIC chain, 0 for the single stage FIR
+//! @param[in]    f     tone in cycles per input sample
+//! @param[out]   None
+//! @return       output over input level in dB
+//
+static double ToneGain(uint32_t cic, double f);
+
+//
+//! @brief Time a decimator over the stream
+//! @param[in]    kind  0 CIC alone, 1 CIC and compensation, 2 single stage FIR
+//! @param[out]   None
+//! @return       ns per input sample
+//
+static double Time(uint32_t kind);
+
+static void Step(void *arg);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const BenchChain_t s_Chains[] = {{16, 4, 4}, {32, 4, 4}, {125, 4, 2}};
+static const uint16_t     s_Blocks[] = {1, 5, 64, 999, 1024};
+
+static float64_t s_Fir[BENCH_MAX_TAPS];
+static q31_t     s_CompCoeffs[BENCH_MAX_TAPS];
+static q31_t     s_SingleCoeffs[BENCH_MAX_TAPS];
+static q63_t     s_CicState[2u * BENCH_MAX_STAGES];
+static q31_t     s_CompState[BENCH_MAX_TAPS + BENCH_MAX_BLOCK];
+static q31_t     s_SingleState[BENCH_MAX_TAPS + BENCH_MAX_BLOCK];
+static q31_t     s_Scratch[BENCH_MAX_BLOCK];
+static int64_t   s_Boxcar[BENCH_MAX_STAGES * 2048u];
+
+static q31_t s_In[BENCH_STREAM_LEN];
+static q31_t s_Out[BENCH_STREAM_LEN];
+
+static arm_cic_decimate_instance_q31 s_Cic;
+static arm_fir_decimate_instance_q31 s_Comp;
+static arm_fir_decimate_instance_q31 s_Single;
+static uint32_t                      s_BlockSize;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    double   mhz    = (argc > 1) ? atof(argv[1]) : 0.0;
+    uint32_t failed = 0;
+    uint32_t i;
+    uint32_t k;
+
+    failed += CheckExact(16, 4);
+    failed += CheckExact(125, 4);
+    failed += CheckExact(256, 4);
+    failed += CheckExact(1000, 3);
+    failed += CheckExact(1625, 3);
+    failed += CheckExact(7, 8);
+
+    printf("\n%-10s %6s %6s %9s %9s %9s %9s %14s %14s %14s\n", "R*N*M", "comp", "single",
+           "reject", "ripple", "tone", "alias", "cic", "cic+comp", "single");
+    for (i = 0; i < sizeof(s_Chains) / sizeof(s_Chains[0]); i++)
+    {
+        const BenchChain_t *pChain = &s_Chains[i];
+        BenchChain_t        single = {0, 0, 0};
+        uint32_t            decim  = (uint32_t)pChain->R * pChain->M;
+        uint32_t            compLen;
+        uint32_t            singleLen;
+        BenchResponse_t     cicResp;
+        BenchResponse_t     singleResp;
+        double              tone[4];
+        double              t[3];
+
+        s_BlockSize = decim * (BENCH_MAX_BLOCK / decim);
+        single.R    = (uint16_t)decim;
+
+        //the compensation FIR, with the DC gain of the CIC stages made up
+        compLen = DesignComp(pChain);
+        cicResp = Response(pChain, compLen);
+        for (k = 0; k < compLen; k++)
+        {
+            s_CompCoeffs[k] = (q31_t)lrint(s_Fir[k] * 2147483648.0);
+        }
+        (void)arm_fir_decimate_init_q31(&s_Comp, (uint16_t)compLen, pChain->M, s_CompCoeffs, s_CompState,
+                                        s_BlockSize / pChain->R);
+        (void)arm_cic_decimate_init_q31(&s_Cic, pChain->numStages, pChain->R, s_CicState, &s_Comp, s_Scratch,
+                                        s_BlockSize);
+        for (k = 0; k < compLen; k++)
+        {
+            s_CompCoeffs[k] = (q31_t)lrint(s_Fir[k] * ldexp(1.0, s_Cic.outShift) /
+                                           pow(pChain->R, pChain->numStages) * 2147483648.0);
+        }
+
+        //the single stage FIR with at least the same rejection
+        singleLen  = DesignSingle(decim, cicResp.rejection);
+        singleResp = Response(&single, singleLen);
+        for (k = 0; k < singleLen; k++)
+        {
+            s_SingleCoeffs[k] = (q31_t)lrint(s_Fir[k] * 2147483648.0);
+        }
+        (void)arm_fir_decimate_init_q31(&s_Single, (uint16_t)singleLen, (uint8_t)decim, s_SingleCoeffs,
+                                        s_SingleState, s_BlockSize);
+
+        printf("%3u*%u*%-4u %6u %6u %9.1f %9.3f", (unsigned)pChain->R, (unsigned)pChain->numStages,
+               (unsigned)pChain->M, (unsigned)compLen, (unsigned)singleLen, cicResp.rejection, cicResp.ripple);
+        //a passband tone and one that folds onto it
+        tone[0]  = ToneGain(1, 0.125 / decim);
+        tone[1]  = ToneGain(1, 1.125 / decim);
+        tone[2]  = ToneGain(0, 0.125 / decim);
+        tone[3]  = ToneGain(0, 1.125 / decim);
+        failed  += (fabs(tone[0]) > 0.05) || (tone[1] > 3.0 - cicResp.rejection);
+        failed  += (fabs(tone[2]) > 0.05) || (tone[3] > 3.0 - singleResp.rejection);
+        printf(" %9.3f %9.1f", tone[0], tone[1]);
+        for (k = 0; k < 3u; k++)
+        {
+            t[k] = Time(k);
+            if (mhz > 0.0)
+            {
+                printf(" %5.2f (%5.1f)", t[k], t[k] * mhz / 1e3);
+            }
+            else
+            {
+                printf(" %14.2f", t[k]);
+            }
+        }
+        printf("\n%-10s %6s %6s %9.1f %9.3f %9.3f %9.1f\n", "", "", "", singleResp.rejection, singleResp.ripple,
+               tone[2], tone[3]);
+    }
+    printf("\nreject: worst rejection over what folds below %.1f of the output rate, dB\n"
+           "ripple: passband droop, dB; tone, alias: output level for a passband tone and one folding onto it, dB\n"
+           "cic, cic+comp, single: %s per input sample\n", BENCH_PASS, (mhz > 0.0) ? "ns (cycles)" : "ns");
+    printf("check: %s\n", (0u == failed) ? "pass" : "FAIL");
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static double Kaiser(uint32_t n, uint32_t len, double beta)
+{
+    double x = 2.0 * n / (len - 1u) - 1.0;
+    double a = beta * sqrt(fmax(0.0, 1.0 - x * x));
+    double i0a = 1.0;
+    double i0b = 1.0;
+    double ta  = 1.0;
+    double tb  = 1.0;
+    uint32_t k;
+
+    for (k = 1; k < 40u; k++)
+    {
+        ta  *= (a / (2.0 * k)) * (a / (2.0 * k));
+        tb  *= (beta / (2.0 * k)) * (beta / (2.0 * k));
+        i0a += ta;
+        i0b += tb;
+    }
+
+    return i0a / i0b;
+}//end Kaiser
+
+static double CicResponse(const BenchChain_t *pChain, double f)
+{
+    double s = sin(3.141592653589793 * f);
+    double h = (fabs(s) < 1e-12) ? 1.0 : sin(3.141592653589793 * f * pChain->R) / (pChain->R * s);
+
+    return pow(fabs(h), pChain->numStages);
+}//end CicResponse
+
+static double FirResponse(const float64_t *pCoeffs, uint32_t len, double f)
+{
+    double   c   = 0.5 * (len - 1u);
+    double   sum = 0.0;
+    uint32_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        sum += pCoeffs[n] * cos(6.283185307179586 * f * (n - c));
+    }
+
+    return fabs(sum);
+}//end FirResponse
+
+static BenchResponse_t Response(const BenchChain_t *pChain, uint32_t len)
+{
+    uint32_t        single = (0u == pChain->numStages);
+    uint32_t        decim  = single ? pChain->R : (uint32_t)pChain->R * pChain->M;
+    double          worst  = 0.0;
+    double          hi     = 0.0;
+    double          lo     = 1e9;
+    BenchResponse_t resp;
+    uint32_t        k;
+    uint32_t        j;
+
+    for (k = 0; k <= decim / 2u; k++)
+    {
+        for (j = 0; j <= BENCH_GRID; j++)
+        {
+            //k = 0 is the passband, the others fold onto it
+            double f = (k + BENCH_PASS * (2.0 * j / BENCH_GRID - 1.0)) / decim;
+            double h;
+
+            if ((f < 0.0) || (f > 0.5))
+            {
+                continue;
+            }
+            h = single ? FirResponse(s_Fir, len, f) :
+                         CicResponse(pChain, f) * FirResponse(s_Fir, len, f * pChain->R);
+            if (0u == k)
+            {
+                hi = fmax(hi, h);
+                lo = fmin(lo, h);
+            }
+            else
+            {
+                worst = fmax(worst, h);
+            }
+        }
+    }
+    resp.rejection = -20.0 * log10(worst);
+    resp.ripple    = 20.0 * log10(hi / lo);
+
+    return resp;
+}//end Response
+
+static uint32_t DesignComp(const BenchChain_t *pChain)
+{
+    //Kaiser's estimate for a transition from BENCH_PASS to 1 - BENCH_PASS of the output rate
+    double   width = (1.0 - 2.0 * BENCH_PASS) / pChain->M;
+    double   beta  = 0.1102 * (BENCH_COMP_ATTEN - 8.7);
+    uint32_t len   = (uint32_t)ceil((BENCH_COMP_ATTEN - 8.0) / (2.285 * 6.283185307179586 * width)) + 1u;
+    double   cut   = 0.5 / pChain->M;
+    double   c     = 0.5 * (len - 1u);
+    double   gain  = 0.0;
+    uint32_t n;
+    uint32_t j;
+
+    //the inverse of the droop of the CIC stages up to the cutoff, integrated numerically
+    for (n = 0; n < len; n++)
+    {
+        double sum = 0.0;
+
+        for (j = 0; j < 2048u; j++)
+        {
+            double f = (j + 0.5) * cut / 2048u;
+
+            sum += cos(6.283185307179586 * f * (n - c)) / CicResponse(pChain, f / pChain->R);
+        }
+        s_Fir[n] = 2.0 * sum * cut / 2048u * Kaiser(n, len, beta);
+        gain    += s_Fir[n];
+    }
+
+    //unit gain at DC
+    for (n = 0; n < len; n++)
+    {
+        s_Fir[n] /= gain;
+    }
+
+    return len;
+}//end DesignComp
+
+static uint32_t DesignSingle(uint32_t decim, double rejection)
+{
+    BenchChain_t single = {(uint16_t)decim, 0, 0};
+    double       width  = (1.0 - 2.0 * BENCH_PASS) / decim;
+    double       beta   = 0.1102 * (rejection - 8.7);
+    uint32_t     len    = (uint32_t)ceil((rejection - 8.0) / (2.285 * 6.283185307179586 * width)) + 1u;
+    uint32_t     n;
+
+    //a Kaiser windowed sinc, lengthened until it rejects as much as the CIC chain
+    for (;;)
+    {
+        double c = 0.5 * (len - 1u);
+
+        for (n = 0; n < len; n++)
+        {
+            double t = ((double)n - c) / decim;
+
+            s_Fir[n] = ((0.0 == t) ? 1.0 : sin(3.141592653589793 * t) / (3.141592653589793 * t)) / decim *
+                       Kaiser(n, len, beta);
+        }
+        if ((Response(&single, len).rejection >= rejection) || (len + decim / 16u > BENCH_MAX_TAPS))
+        {
+            return len;
+        }
+        len += decim / 16u;
+    }
+}//end DesignSingle
+
+static uint32_t CheckExact(uint16_t R, uint8_t numStages)
+{
+    uint32_t len   = numStages * (R - 1u) + 1u;
+    uint32_t count = 0;
+    uint32_t diff  = 0;
+    uint32_t n     = 0;
+    uint32_t blk   = 0;
+    uint32_t m;
+    uint32_t k;
+    uint32_t s;
+
+    //the coefficients of N moving sums of R samples
+    memset(s_Boxcar, 0, sizeof(s_Boxcar));
+    s_Boxcar[0] = 1;
+    for (s = 0; s < numStages; s++)
+    {
+        for (k = s * (R - 1u) + R - 1u; k > 0u; k--)
+        {
+            uint32_t j;
+
+            for (j = 1; (j < R) && (j <= k); j++)
+            {
+                s_Boxcar[k] += s_Boxcar[k - j];
+            }
+        }
+    }
+
+    //full scale input
+    srand(R);
+    for (n = 0; n < BENCH_STREAM_LEN; n++)
+    {
+        s_In[n] = (q31_t)(((uint32_t)rand() << 16) ^ (uint32_t)rand() ^ ((uint32_t)rand() << 31));
+    }
+    s_In[0] = INT32_MIN;
+    (void)arm_cic_decimate_init_q31(&s_Cic, numStages, R, s_CicState, NULL, NULL, 0);
+    for (n = 0; n < BENCH_STREAM_LEN;)
+    {
+        uint32_t blockSize = s_Blocks[blk++ % (sizeof(s_Blocks) / sizeof(s_Blocks[0]))];
+
+        blockSize = (n + blockSize > BENCH_STREAM_LEN) ? (BENCH_STREAM_LEN - n) : blockSize;
+        count += arm_cic_decimate_q31(&s_Cic, &s_In[n], &s_Out[count], blockSize);
+        n += blockSize;
+    }
+
+    for (m = 0; m < count; m++)
+    {
+        __int128 sum = 0;
+        int32_t  t   = (int32_t)((m + 1u) * R - 1u);
+
+        for (k = 0; (k < len) && ((int32_t)k <= t); k++)
+        {
+            sum += (__int128)s_Boxcar[k] * s_In[t - k];
+        }
+        diff += ((q31_t)(int64_t)(sum >> s_Cic.outShift) != s_Out[m]) ? 1u : 0u;
+    }
+
+    printf("exact R %4u N %u, R^N %.3g, shift %2u: %5u outputs, %u differ\n", (unsigned)R, (unsigned)numStages,
+           pow(R, numStages), (unsigned)s_Cic.outShift, (unsigned)count, (unsigned)diff);
+
+    return ((count != BENCH_STREAM_LEN / R) || (0u != diff)) ? 1u : 0u;
+}//end CheckExact
+
+static double ToneGain(uint32_t cic, double f)
+{
+    uint32_t decim = cic ? (uint32_t)s_Cic.R * s_Comp.M : s_Single.M;
+    uint32_t count = 0;
+    double   sum   = 0.0;
+    uint32_t n;
+    uint32_t m;
+
+    for (n = 0; n < BENCH_STREAM_LEN; n++)
+    {
+        s_In[n] = (q31_t)lrint(0.5 * 2147483648.0 * sin(6.283185307179586 * f * n));
+    }
+    memset(s_CicState, 0, sizeof(s_CicState));
+    s_Cic.count = 0;
+    memset(s_CompState, 0, sizeof(s_CompState));
+    memset(s_SingleState, 0, sizeof(s_SingleState));
+
+    for (n = 0; n + s_BlockSize <= BENCH_STREAM_LEN; n += s_BlockSize)
+    {
+        count += cic ? arm_cic_decimate_q31(&s_Cic, &s_In[n], &s_Out[count], s_BlockSize) :
+                 (arm_fir_decimate_q31(&s_Single, &s_In[n], &s_Out[count], s_BlockSize), s_BlockSize / decim);
+    }
+
+    //whole periods of the second half, past the delay of the filters
+    for (m = count - (count / 16u) * 8u; m < count; m++)
+    {
+        sum += ((double)s_Out[m] / 2147483648.0) * ((double)s_Out[m] / 2147483648.0);
+    }
+
+    return 10.0 * log10(sum / ((count / 16u) * 8u) / 0.125);
+}//end ToneGain
+
+static double Time(uint32_t kind)
+{
+    return BenchTime(Step, &kind) * 1e9 / (BENCH_STREAM_LEN / s_BlockSize * s_BlockSize);
+}//end Time
+
+static void Step(void *arg)
+{
+    uint32_t kind = *(const uint32_t*)arg;
+    uint32_t n;
+
+    for (n = 0; n + s_BlockSize <= BENCH_STREAM_LEN; n += s_BlockSize)
+    {
+        switch (kind)
+        {
+            case 0:
+                s_Cic.pComp = NULL;
+                (void)arm_cic_decimate_q31(&s_Cic, &s_In[n], s_Out, s_BlockSize);
+                s_Cic.pComp = &s_Comp;
+                break;
+            case 1:
+                (void)arm_cic_decimate_q31(&s_Cic, &s_In[n], s_Out, s_BlockSize);
+                break;
+            default:
+                arm_fir_decimate_q31(&s_Single, &s_In[n], s_Out, s_BlockSize);
+                break;
+        }
+    }
+}//end Step
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
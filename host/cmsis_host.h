@@ -0,0 +1,144 @@
+//! @addtogroup Host
+//! @{
+//
+//****************************************************************************
+//! @file cmsis_host.h
+//! @brief Host replacement for cmsis_gcc.h. Force-included in host builds
+//!        (-include host/cmsis_host.h) so the CMSIS core and HAL headers
+//!        compile for Linux without Cortex-M inline assembly.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef CMSIS_HOST_H
+#define CMSIS_HOST_H
+
+#ifndef HOST_BUILD
+#error "cmsis_host.h is for host builds only"
+#endif
+
+//keeps drivers/CMSIS/Include/cmsis_gcc.h from being pulled in
+#define __CMSIS_GCC_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+#define __ASM                    __asm
+#define __INLINE                 inline
+#define __STATIC_INLINE          static inline
+#define __STATIC_FORCEINLINE     __attribute__((always_inline)) static inline
+#define __NO_RETURN              __attribute__((__noreturn__))
+#define __USED                   __attribute__((used))
+#define __WEAK                   __attribute__((weak))
+#define __PACKED                 __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT          struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION           union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)             __attribute__((aligned(x)))
+#define __RESTRICT               __restrict
+
+#define __UNALIGNED_UINT16_READ(addr)        (*(const uint16_t *)(const void *)(addr))
+#define __UNALIGNED_UINT16_WRITE(addr, val)  (void)((*(uint16_t *)(void *)(addr)) = (val))
+#define __UNALIGNED_UINT32_READ(addr)        (*(const uint32_t *)(const void *)(addr))
+#define __UNALIGNED_UINT32_WRITE(addr, val)  (void)((*(uint32_t *)(void *)(addr)) = (val))
+
+#define __NOP()                  do { } while (0)
+#define __WFI()                  HostWaitForInterrupt()
+#define __WFE()                  HostWaitForInterrupt()
+#define __SEV()                  do { } while (0)
+#define __BKPT(value)            do { } while (0)
+#define __CLZ(x)                 ((uint8_t)(((x) == 0U) ? 32U : (uint32_t)__builtin_clz(x)))
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+//PRIMASK of the virtual core, set while "interrupts" are disabled
+extern volatile uint32_t g_HostPrimask;
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Let the host model run pending virtual interrupts, stands in for WFI
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void HostWaitForInterrupt(void);
+
+__STATIC_FORCEINLINE void __enable_irq(void)            { g_HostPrimask = 0U; }
+__STATIC_FORCEINLINE void __disable_irq(void)           { g_HostPrimask = 1U; }
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)       { return g_HostPrimask; }
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t mask)  { g_HostPrimask = mask; }
+__STATIC_FORCEINLINE void __ISB(void)                   { __sync_synchronize(); }
+__STATIC_FORCEINLINE void __DSB(void)                   { __sync_synchronize(); }
+__STATIC_FORCEINLINE void __DMB(void)                   { __sync_synchronize(); }
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value)     { return __builtin_bswap32(value); }
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0xFF00FF00U) >> 8) | ((value & 0x00FF00FFU) << 8);
+}
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+    op2 %= 32U;
+    return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0U;
+
+    for (uint32_t i = 0U; i < 32U; i++)
+    {
+        result = (result << 1) | (value & 1U);
+        value >>= 1;
+    }
+
+    return result;
+}
+__STATIC_FORCEINLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+    if ((sat >= 1U) && (sat <= 32U))
+    {
+        const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+        const int32_t min = -1 - max;
+
+        if (val > max)
+        {
+            return max;
+        }
+        else if (val < min)
+        {
+            return min;
+        }
+    }
+
+    return val;
+}
+__STATIC_FORCEINLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+    if (sat <= 31U)
+    {
+        const uint32_t max = ((1U << sat) - 1U);
+
+        if (val > (int32_t)max)
+        {
+            return max;
+        }
+        else if (val < 0)
+        {
+            return 0U;
+        }
+    }
+
+    return (uint32_t)val;
+}
+
+#endif // CMSIS_HOST_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -0,0 +1,507 @@
+//! @addtogroup Host
+//! @brief FFT convolution check and crossover benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file conv_fft_bench.c
+//! @brief Checks arm_conv_fft_f32() and arm_correlate_fft_f32() against
+//!        arm_conv_f32() and arm_correlate_f32(), and the q15 versions
+//!        against a double precision reference, for short and long
+//!        sequences in either order and for results that overflow 1.15.
+//!
+//!        Then measures the cost model of arm_conv_fft_len() on this
+//!        machine (the ARM_CONV_FFT_COST_ values to build the library with)
+//!        and times direct and FFT convolution of VOC event templates of 4
+//!        to 1024 samples against windows of 512 and 4096 samples: the
+//!        direct convolution, the FFT function at each length, the choice of
+//!        arm_conv_fft_len() with the library constants and the choice of
+//!        arm_conv_fft_len_cost() with the measured ones, next to the fastest
+//!        measured. The run fails if the latter is more than BENCH_MAX_LOSS
+//!        slower than the fastest anywhere; a point over half of it is
+//!        timed again before it counts, the two lengths in turn. The library constants
+//!        are Cortex-M4 estimates, their losses on the host are reported
+//!        and not checked.
+//!
+//!        The host build runs the plain C path of arm_conv_f32(), which
+//!        tests every product of the triangle; the direct timing is a loop
+//!        of srcALen * srcBLen MACs instead, the work of the Cortex-M4 path.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/conv_fft_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o conv_fft_bench
+//!
+//!        Usage: conv_fft_bench [max fft length]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+//each point is the best of BENCH_TRIALS runs of at least BENCH_MIN_S
+#define BENCH_MIN_S       0.01
+#define BENCH_TRIALS      5u
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_MAX_LEN     8192u
+#define BENCH_MAX_FFT     4096u
+#define BENCH_MAX_OUT     (2u * BENCH_MAX_LEN)
+//runs of the cost model measurement, the median is taken
+#define BENCH_COST_RUNS   5u
+//rounds of timing again a point over half the bound, and attempts at it
+#define BENCH_RETIME      3u
+#define BENCH_ATTEMPTS    3u
+//largest loss of the FFT length picked with the measured constants: one
+//octave off costs up to about 15%, the Cortex-M4 constants 35% and more
+#define BENCH_MAX_LOSS    0.2
+
+typedef void (*BenchRun_t)(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen);
+
+typedef struct
+{
+    BenchRun_t run;
+    uint32_t   windowLen;
+    uint32_t   kernLen;
+    uint16_t   fftLen;
+}BenchPoint_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static int CompareTime(const void *a, const void *b);
+static uint32_t CheckF32(uint32_t lenA, uint32_t lenB);
+static uint32_t CheckQ15(uint32_t lenA, uint32_t lenB, double amplitude);
+
+//
+//! @brief Best time of a run
+//! @param[in]    run        Convolution to time
+//! @param[in]    windowLen  Length of the longer sequence
+//! @param[in]    kernLen    Length of the shorter sequence
+//! @param[in]    fftLen     FFT length, unused by the direct run
+//! @param[out]   None
+//! @return       Seconds per run
+//
+static double Time(BenchRun_t run, uint32_t windowLen, uint32_t kernLen, uint16_t fftLen);
+
+//
+//! @brief Best time of the direct or the FFT convolution
+//! @param[in]    windowLen  Length of the longer sequence
+//! @param[in]    kernLen    Length of the shorter sequence
+//! @param[in]    fftLen     FFT length, 0 for the direct convolution
+//! @param[out]   None
+//! @return       Seconds per run
+//
+static double TimeLen(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen);
+
+//
+//! @brief Time the fastest and the picked length again, afresh and in turn,
+//!        as the fastest of many noisy times is biased low. A bad pick stays
+//!        slow, a stall of the machine does not: up to BENCH_ATTEMPTS rounds
+//!        are made until the loss is under half the bound, the least counts.
+//! @param[in]    windowLen  Length of the longer sequence
+//! @param[in]    kernLen    Length of the shorter sequence
+//! @param[in]    bestAt     Length measured fastest, 0 for the direct one
+//! @param[in]    at         Length picked, 0 for the direct one
+//! @param[out]   best       Time of bestAt in the round that counts
+//! @param[out]   picked     Time of at in the round that counts
+//! @return       Loss of at against bestAt
+//
+static double Retime(uint32_t windowLen, uint32_t kernLen, uint16_t bestAt, uint16_t at,
+                     double *best, double *picked);
+
+static void Step(void *arg);
+
+static void RunDirect(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen);
+static void RunFft(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen);
+static void RunRfft(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const uint32_t s_Windows[] = {512, 4096};
+static const uint32_t s_Kernels[] = {4, 8, 16, 32, 64, 128, 256, 512, 1024};
+
+static float32_t s_A[BENCH_MAX_LEN];
+static float32_t s_B[BENCH_MAX_LEN];
+static float32_t s_Ref[BENCH_MAX_OUT];
+static float32_t s_Out[BENCH_MAX_OUT];
+static q15_t     s_AQ15[BENCH_MAX_LEN];
+static q15_t     s_BQ15[BENCH_MAX_LEN];
+static q15_t     s_OutQ15[BENCH_MAX_OUT];
+static float32_t s_Scratch[4u * BENCH_MAX_FFT];
+
+static arm_rfft_fast_instance_f32 s_Rfft;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint16_t maxFft = (argc > 1) ? (uint16_t)atoi(argv[1]) : (uint16_t)BENCH_MAX_FFT;
+    uint32_t failed = 0;
+    uint32_t w;
+    uint32_t k;
+    uint32_t i;
+    double   mac[BENCH_COST_RUNS];
+    double   fft[BENCH_COST_RUNS];
+    double   other[BENCH_COST_RUNS];
+    double   worst = 0.0;
+    double   worstBuilt = 0.0;
+    uint16_t costRfft;
+    uint16_t costPoint;
+
+    srand(1);
+    for (i = 0; i < BENCH_MAX_LEN; i++)
+    {
+        s_A[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+        s_B[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+    }
+
+    failed += CheckF32(1000u, 37u);
+    failed += CheckF32(37u, 1000u);
+    failed += CheckF32(300u, 300u);
+    failed += CheckF32(5000u, 700u);
+    failed += CheckF32(64u, 1u);
+    failed += CheckQ15(1000u, 37u, 0.02);
+    failed += CheckQ15(37u, 1000u, 0.02);
+    failed += CheckQ15(3000u, 500u, 0.9);
+    printf("check: %s\n", (0u == failed) ? "pass" : "FAIL");
+
+    //cost model in units of a direct MAC, 16 per MAC as arm_conv_fft_len().
+    //The MAC is timed with a short kernel, where the choice is close and a
+    //MAC costs more than in a long one. The other work is the difference of
+    //two times, the median of a few runs keeps one bad run from moving it
+    for (i = 0; i < BENCH_COST_RUNS; i++)
+    {
+        mac[i]   = Time(RunDirect, 4096u, 16u, 0u) / (4096.0 * 16.0);
+        fft[i]   = Time(RunRfft, 0u, 0u, 1024u) / (1024.0 * 10.0);
+        other[i] = (Time(RunFft, 8192u, 1u, 1024u) / 8.0 - 2.0 * fft[i] * 1024.0 * 10.0) / 1024.0;
+    }
+    qsort(mac, BENCH_COST_RUNS, sizeof(mac[0]), CompareTime);
+    qsort(fft, BENCH_COST_RUNS, sizeof(fft[0]), CompareTime);
+    qsort(other, BENCH_COST_RUNS, sizeof(other[0]), CompareTime);
+    i = BENCH_COST_RUNS / 2u;
+
+    printf("\ndirect %.2f ns/MAC, rfft %.2f ns per N*log2(N), other %.2f ns per point\n",
+           mac[i] * 1e9, fft[i] * 1e9, other[i] * 1e9);
+    costRfft  = (uint16_t)lround(16.0 * fft[i] / mac[i]);
+    costPoint = (uint16_t)lround(16.0 * other[i] / mac[i]);
+    printf("this machine: -DARM_CONV_FFT_COST_RFFT=%uU -DARM_CONV_FFT_COST_POINT=%uU\n",
+           (unsigned)costRfft, (unsigned)costPoint);
+
+    for (w = 0; w < sizeof(s_Windows) / sizeof(s_Windows[0]); w++)
+    {
+        printf("\nwindow %u, us per convolution\n", (unsigned)s_Windows[w]);
+        printf("%6s %10s %10s %6s %10s %6s %6s %10s %6s %6s\n", "kernel", "direct", "fft best",
+               "at", "built", "at", "loss", "measured", "at", "loss");
+
+        for (k = 0; k < sizeof(s_Kernels) / sizeof(s_Kernels[0]); k++)
+        {
+            uint32_t kern   = s_Kernels[k];
+            double   direct = Time(RunDirect, s_Windows[w], kern, 0u);
+            double   best   = direct;
+            uint16_t bestAt = 0;
+            uint16_t pick   = arm_conv_fft_len(s_Windows[w], kern, maxFft);
+            uint16_t model  = arm_conv_fft_len_cost(s_Windows[w], kern, maxFft, costRfft, costPoint);
+            double   picked = direct;
+            double   modeled = direct;
+            double   loss;
+            double   lossBuilt;
+            uint32_t n;
+
+            for (n = 32u; n <= maxFft; n <<= 1)
+            {
+                double t;
+
+                if (n < kern)
+                {
+                    continue;
+                }
+                t = Time(RunFft, s_Windows[w], kern, (uint16_t)n);
+                if (t < best)
+                {
+                    best   = t;
+                    bestAt = (uint16_t)n;
+                }
+                if (n == pick)
+                {
+                    picked = t;
+                }
+                if (n == model)
+                {
+                    modeled = t;
+                }
+            }
+
+            //a point near the bound is timed again before it counts
+            lossBuilt = (picked - best) / best;
+            if (lossBuilt > BENCH_MAX_LOSS / 2.0)
+            {
+                double again = best;
+
+                lossBuilt = Retime(s_Windows[w], kern, bestAt, pick, &again, &picked);
+            }
+            loss = (modeled - best) / best;
+            if (loss > BENCH_MAX_LOSS / 2.0)
+            {
+                loss = Retime(s_Windows[w], kern, bestAt, model, &best, &modeled);
+            }
+
+            worst      = fmax(worst, loss);
+            worstBuilt = fmax(worstBuilt, lossBuilt);
+            printf("%6u %10.1f %10.1f %6u %10.1f %6u %5.0f%% %10.1f %6u %5.0f%%\n", (unsigned)kern,
+                   direct * 1e6, best * 1e6, (unsigned)bestAt, picked * 1e6, (unsigned)pick,
+                   100.0 * lossBuilt, modeled * 1e6, (unsigned)model, 100.0 * loss);
+        }
+    }
+    printf("\nat 0 is the direct function.\n"
+           "built: arm_conv_fft_len() with the library constants. These are Cortex-M4\n"
+           "estimates, not a host default: worst loss %.0f%%, not checked.\n"
+           "measured: arm_conv_fft_len_cost() with the constants above, worst loss %.0f%%,\n"
+           "bound %.0f%%: %s\n", 100.0 * worstBuilt, 100.0 * worst, 100.0 * BENCH_MAX_LOSS,
+           (worst > BENCH_MAX_LOSS) ? "FAIL" : "pass");
+    failed += (worst > BENCH_MAX_LOSS) ? 1u : 0u;
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static int CompareTime(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+
+    return (x > y) - (x < y);
+}//end CompareTime
+
+static uint32_t CheckF32(uint32_t lenA, uint32_t lenB)
+{
+    uint32_t  kern   = (lenA < lenB) ? lenA : lenB;
+    uint16_t  fftLen = 32u;
+    uint32_t  corrLen = 2u * ((lenA > lenB) ? lenA : lenB) - 1u;
+    double    errConv = 0.0;
+    double    errCorr = 0.0;
+    double    peak    = 0.0;
+    uint32_t  failed  = 0;
+    uint32_t  i;
+
+    //the smallest length that fits the kernel, the most segments
+    while (fftLen < kern)
+    {
+        fftLen <<= 1;
+    }
+
+    arm_conv_f32(s_A, lenA, s_B, lenB, s_Ref);
+    if (ARM_MATH_SUCCESS != arm_conv_fft_f32(s_A, lenA, s_B, lenB, s_Out, fftLen, s_Scratch))
+    {
+        failed++;
+    }
+    for (i = 0; i < lenA + lenB - 1u; i++)
+    {
+        errConv = fmax(errConv, fabs((double)s_Ref[i] - s_Out[i]));
+        peak    = fmax(peak, fabs((double)s_Ref[i]));
+    }
+
+    //arm_correlate_f32() leaves the padding untouched
+    memset(s_Ref, 0, corrLen * sizeof(s_Ref[0]));
+    memset(s_Out, 0x55, corrLen * sizeof(s_Out[0]));
+    arm_correlate_f32(s_A, lenA, s_B, lenB, s_Ref);
+    if (ARM_MATH_SUCCESS != arm_correlate_fft_f32(s_A, lenA, s_B, lenB, s_Out, fftLen, s_Scratch))
+    {
+        failed++;
+    }
+    for (i = 0; i < corrLen; i++)
+    {
+        errCorr = fmax(errCorr, fabs((double)s_Ref[i] - s_Out[i]));
+    }
+
+    failed += ((errConv > 1e-5 * peak) || (errCorr > 1e-5 * peak)) ? 1u : 0u;
+    printf("check f32 %4u x %4u, fft %4u: conv %.1e, correlate %.1e of %.1f\n", (unsigned)lenA,
+           (unsigned)lenB, (unsigned)fftLen, errConv, errCorr, peak);
+
+    return failed;
+}//end CheckF32
+
+static uint32_t CheckQ15(uint32_t lenA, uint32_t lenB, double amplitude)
+{
+    uint32_t kern    = (lenA < lenB) ? lenA : lenB;
+    uint32_t convLen = lenA + lenB - 1u;
+    uint32_t corrLen = 2u * ((lenA > lenB) ? lenA : lenB) - 1u;
+    uint32_t pad     = (lenA > lenB) ? lenA - lenB : 0u;
+    uint16_t fftLen  = 32u;
+    int8_t   shiftConv;
+    int8_t   shiftCorr;
+    double   errConv = 0.0;
+    double   errCorr = 0.0;
+    double   peak    = 0.0;
+    uint32_t failed  = 0;
+    uint32_t i;
+    uint32_t j;
+
+    while (fftLen < kern)
+    {
+        fftLen <<= 1;
+    }
+
+    for (i = 0; i < BENCH_MAX_LEN; i++)
+    {
+        s_AQ15[i] = (q15_t)(s_A[i] * 2.0 * amplitude * 32767.0);
+        s_BQ15[i] = (q15_t)(s_B[i] * 2.0 * amplitude * 32767.0);
+    }
+
+    //reference in 1.15 LSBs, not truncated
+    if (ARM_MATH_SUCCESS != arm_conv_fft_q15(s_AQ15, lenA, s_BQ15, lenB, s_OutQ15, fftLen,
+                                             s_Scratch, &shiftConv))
+    {
+        failed++;
+    }
+    for (i = 0; i < convLen; i++)
+    {
+        double ref = 0.0;
+
+        for (j = 0; j < lenA; j++)
+        {
+            if ((i >= j) && (i - j < lenB))
+            {
+                ref += (double)s_AQ15[j] * s_BQ15[i - j];
+            }
+        }
+        ref /= 32768.0;
+        peak     = fmax(peak, fabs(ref));
+        errConv  = fmax(errConv, fabs(ref - ldexp((double)s_OutQ15[i], shiftConv)));
+    }
+
+    if (ARM_MATH_SUCCESS != arm_correlate_fft_q15(s_AQ15, lenA, s_BQ15, lenB, s_OutQ15, fftLen,
+                                                  s_Scratch, &shiftCorr))
+    {
+        failed++;
+    }
+    for (i = 0; i < corrLen; i++)
+    {
+        double ref = 0.0;
+
+        //c[pad + n] = sum a[k] * b[lenB - 1 - n + k]
+        if ((i >= pad) && (i - pad < convLen))
+        {
+            for (j = 0; j < lenA; j++)
+            {
+                int64_t m = (int64_t)lenB - 1 - (int64_t)(i - pad) + (int64_t)j;
+
+                if ((m >= 0) && (m < (int64_t)lenB))
+                {
+                    ref += (double)s_AQ15[j] * s_BQ15[m];
+                }
+            }
+        }
+        ref /= 32768.0;
+        errCorr = fmax(errCorr, fabs(ref - ldexp((double)s_OutQ15[i], shiftCorr)));
+    }
+
+    //rounded to the output LSB: half of it, plus the single precision FFT
+    failed += ((errConv > ldexp(1.0, shiftConv)) || (errCorr > ldexp(1.0, shiftCorr))) ? 1u : 0u;
+    printf("check q15 %4u x %4u, fft %4u: conv %.2f LSB << %d, correlate %.2f LSB << %d, peak %.0f\n",
+           (unsigned)lenA, (unsigned)lenB, (unsigned)fftLen, errConv / ldexp(1.0, shiftConv),
+           (int)shiftConv, errCorr / ldexp(1.0, shiftCorr), (int)shiftCorr, peak);
+
+    return failed;
+}//end CheckQ15
+
+static double Time(BenchRun_t run, uint32_t windowLen, uint32_t kernLen, uint16_t fftLen)
+{
+    BenchPoint_t point = {run, windowLen, kernLen, fftLen};
+
+    return BenchTime(Step, &point);
+}//end Time
+
+static double TimeLen(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen)
+{
+    return Time((0u == fftLen) ? RunDirect : RunFft, windowLen, kernLen, fftLen);
+}//end TimeLen
+
+static double Retime(uint32_t windowLen, uint32_t kernLen, uint16_t bestAt, uint16_t at,
+                     double *best, double *picked)
+{
+    double   loss = HUGE_VAL;
+    uint32_t attempt;
+    uint32_t n;
+
+    for (attempt = 0; (attempt < BENCH_ATTEMPTS) && (loss > BENCH_MAX_LOSS / 2.0); attempt++)
+    {
+        double b = HUGE_VAL;
+        double t = HUGE_VAL;
+
+        for (n = 0; n < BENCH_RETIME; n++)
+        {
+            b = fmin(b, TimeLen(windowLen, kernLen, bestAt));
+            t = fmin(t, TimeLen(windowLen, kernLen, at));
+        }
+
+        if ((t - b) / b < loss)
+        {
+            loss    = (t - b) / b;
+            *best   = b;
+            *picked = t;
+        }
+    }
+
+    return loss;
+}//end Retime
+
+static void Step(void *arg)
+{
+    const BenchPoint_t *point = (const BenchPoint_t*)arg;
+
+    point->run(point->windowLen, point->kernLen, point->fftLen);
+}//end Step
+
+static void RunDirect(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen)
+{
+    uint32_t i;
+    uint32_t j;
+
+    (void)fftLen;
+
+    memset(s_Out, 0, (windowLen + kernLen - 1u) * sizeof(s_Out[0]));
+    for (i = 0; i < windowLen; i++)
+    {
+        for (j = 0; j < kernLen; j++)
+        {
+            s_Out[i + j] += s_A[i] * s_B[j];
+        }
+    }
+}//end RunDirect
+
+static void RunFft(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen)
+{
+    (void)arm_conv_fft_f32(s_A, windowLen, s_B, kernLen, s_Out, fftLen, s_Scratch);
+}//end RunFft
+
+static void RunRfft(uint32_t windowLen, uint32_t kernLen, uint16_t fftLen)
+{
+    (void)windowLen;
+    (void)kernLen;
+
+    (void)arm_rfft_fast_init_f32(&s_Rfft, fftLen);
+    memcpy(s_Scratch, s_A, fftLen * sizeof(s_A[0]));
+    arm_rfft_fast_f32(&s_Rfft, s_Scratch, s_Out, 0u);
+}//end RunRfft
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
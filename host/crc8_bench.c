@@ -0,0 +1,279 @@
+//! @addtogroup Host
+//! @brief Sensirion CRC-8 check and throughput benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file crc8_bench.c
+//! @brief Checks sensirion_crc8() against sensirion_crc8_bitwise() for every
+//!        single byte value and every length up to 64, and
+//!        sensirion_crc8_check_words() against a word at a time bitwise check
+//!        for clean and corrupted responses of 1 to SENSIRION_CRC8_MAX_WORDS
+//!        words, then reports bytes per cycle of the bitwise, table and
+//!        batched word paths over a 4 KB buffer. Cycles are read with rdtsc
+//!        on x86 and derived from the given clock in MHz elsewhere.
+//!
+//!        These are host figures; the ratio between the paths is what
+//!        carries over to the Cortex-M4, the absolute numbers do not.
+//!
+//!        Build from the repo root (embedded-sgp submodule checked out):
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication -Isgp30
+//!            -Iembedded-sgp/embedded-common
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/crc8_bench.c host/hal_host.c sgp30/sensirion_crc8.c
+//!            sgp30/sensirion_hw_i2c_implementation.c application/prof.c
+//!            -o crc8_bench
+//!
+//!        Usage: crc8_bench [MHz]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+//user defined header files
+#include "sensirion_crc8.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_LEN        4096u
+#define BENCH_BYTES      (64u * 1024u * 1024u)
+#define BENCH_CHECK_LEN  64u
+#define BENCH_FRAMES     (BENCH_LEN / SENSIRION_CRC8_FRAME_SIZE)
+
+typedef uint32_t (*BenchCrc_t)(const uint8_t *data, uint32_t len);
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static uint64_t Cycles(void);
+static uint32_t Check(void);
+static uint32_t CheckWords(void);
+static int8_t   WordsBitwise(const uint8_t *buf, uint16_t num_words);
+static uint32_t RunBitwise(const uint8_t *data, uint32_t len);
+static uint32_t RunTable(const uint8_t *data, uint32_t len);
+static uint32_t RunWords(const uint8_t *data, uint32_t len);
+static uint32_t RunWordsBitwise(const uint8_t *data, uint32_t len);
+static void Throughput(const char *name, BenchCrc_t fn, uint32_t bytes);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static uint8_t s_Buf[BENCH_LEN];
+//the same bytes framed as words with their CRCs, as read from the sensor
+static uint8_t s_Frames[BENCH_FRAMES * SENSIRION_CRC8_FRAME_SIZE];
+static double  s_Mhz;
+//keeps the timed loops from being optimised away
+static volatile uint32_t s_Sink;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t i;
+    uint32_t failed;
+
+    s_Mhz = (argc > 1) ? atof(argv[1]) : 1000.0;
+
+    srand(1);
+    for (i = 0; i < sizeof(s_Buf); i++)
+    {
+        s_Buf[i] = (uint8_t)rand();
+    }
+
+    for (i = 0; i < BENCH_FRAMES; i++)
+    {
+        uint8_t *frame = &s_Frames[i * SENSIRION_CRC8_FRAME_SIZE];
+
+        frame[0] = s_Buf[2u * i];
+        frame[1] = s_Buf[2u * i + 1u];
+        frame[2] = sensirion_crc8_bitwise(frame, 2);
+    }
+
+    failed  = Check();
+    failed += CheckWords();
+    printf("check      %u mismatches\n", (unsigned)failed);
+
+    Throughput("bitwise", RunBitwise, BENCH_BYTES / 16u);
+    Throughput("table", RunTable, BENCH_BYTES);
+    Throughput("words bit", RunWordsBitwise, BENCH_BYTES / 16u);
+    Throughput("words", RunWords, BENCH_BYTES);
+
+    return (0 == failed) ? 0 : 2;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint64_t Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)(((double)ts.tv_sec * 1e9 + (double)ts.tv_nsec) * s_Mhz / 1000.0);
+#endif
+}//end Cycles
+
+static uint32_t Check(void)
+{
+    uint32_t failed = 0;
+    uint32_t len;
+    uint32_t i;
+
+    for (i = 0; i < 256u; i++)
+    {
+        uint8_t b = (uint8_t)i;
+
+        if (sensirion_crc8(&b, 1) != sensirion_crc8_bitwise(&b, 1))
+        {
+            failed++;
+            printf("mismatch at byte 0x%02x\n", (unsigned)i);
+        }
+    }
+
+    for (len = 0; len <= BENCH_CHECK_LEN; len++)
+    {
+        if (sensirion_crc8(s_Buf, (uint16_t)len) != sensirion_crc8_bitwise(s_Buf, (uint16_t)len))
+        {
+            failed++;
+            printf("mismatch at length %u\n", (unsigned)len);
+        }
+    }
+
+    //the datasheet example: 0xBEEF gives 0x92
+    if (0x92 != sensirion_crc8((const uint8_t[]){0xBE, 0xEF}, 2))
+    {
+        failed++;
+        printf("mismatch on the datasheet example\n");
+    }
+
+    return failed;
+}//end Check
+
+static uint32_t CheckWords(void)
+{
+    uint32_t failed = 0;
+    uint32_t words;
+    uint32_t bit;
+
+    for (words = 1; words <= SENSIRION_CRC8_MAX_WORDS; words++)
+    {
+        uint8_t  buf[SENSIRION_CRC8_MAX_WORDS * SENSIRION_CRC8_FRAME_SIZE];
+        uint32_t len = words * SENSIRION_CRC8_FRAME_SIZE;
+
+        memcpy(buf, &s_Frames[words * SENSIRION_CRC8_FRAME_SIZE], len);
+
+        if ( (STATUS_OK != sensirion_crc8_check_words(buf, (uint16_t)words)) ||
+             (STATUS_OK != WordsBitwise(buf, (uint16_t)words)) )
+        {
+            failed++;
+            printf("clean response of %u words rejected\n", (unsigned)words);
+        }
+
+        //CRC-8 catches every single bit error, in the data or the CRC
+        for (bit = 0; bit < len * 8u; bit++)
+        {
+            buf[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+
+            if ( (STATUS_FAIL != sensirion_crc8_check_words(buf, (uint16_t)words)) ||
+                 (STATUS_FAIL != WordsBitwise(buf, (uint16_t)words)) )
+            {
+                failed++;
+                printf("bit %u of %u words not caught\n", (unsigned)bit, (unsigned)words);
+            }
+
+            buf[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+        }
+    }
+
+    return failed;
+}//end CheckWords
+
+static int8_t WordsBitwise(const uint8_t *buf, uint16_t num_words)
+{
+    uint16_t i;
+
+    //as the common layer does it: one word at a time, first bad one returns
+    for (i = 0; i < num_words; i++, buf += SENSIRION_CRC8_FRAME_SIZE)
+    {
+        if (sensirion_crc8_bitwise(buf, 2) != buf[2])
+        {
+            return STATUS_FAIL;
+        }
+    }
+
+    return STATUS_OK;
+}//end WordsBitwise
+
+static uint32_t RunBitwise(const uint8_t *data, uint32_t len)
+{
+    return sensirion_crc8_bitwise(data, (uint16_t)len);
+}//end RunBitwise
+
+static uint32_t RunTable(const uint8_t *data, uint32_t len)
+{
+    return sensirion_crc8(data, (uint16_t)len);
+}//end RunTable
+
+static uint32_t RunWords(const uint8_t *data, uint32_t len)
+{
+    (void)data;
+
+    return (uint32_t)sensirion_crc8_check_words(s_Frames, (uint16_t)(len / SENSIRION_CRC8_FRAME_SIZE));
+}//end RunWords
+
+static uint32_t RunWordsBitwise(const uint8_t *data, uint32_t len)
+{
+    (void)data;
+
+    return (uint32_t)WordsBitwise(s_Frames, (uint16_t)(len / SENSIRION_CRC8_FRAME_SIZE));
+}//end RunWordsBitwise
+
+static void Throughput(const char *name, BenchCrc_t fn, uint32_t bytes)
+{
+    //the word paths take whole frames, bytes counted include the CRCs
+    uint32_t len  = (fn == RunWords || fn == RunWordsBitwise) ? sizeof(s_Frames) : BENCH_LEN;
+    uint32_t runs = bytes / len;
+    uint32_t sum  = 0;
+    uint32_t i;
+    uint64_t start;
+    uint64_t cycles;
+
+    //warm the table and caches
+    sum += fn(s_Buf, len);
+
+    start = Cycles();
+    for (i = 0; i < runs; i++)
+    {
+        sum += fn(s_Buf, len);
+    }
+    cycles = Cycles() - start;
+    s_Sink = sum;
+
+    printf("%-10s %.3f bytes/cycle, %.2f cycles/byte\n", name,
+           cycles ? (double)runs * len / (double)cycles : 0.0,
+           (double)cycles / ((double)runs * len));
+}//end Throughput
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,181 @@
+//! @addtogroup Host
+//! @brief Double buffered DMA stream emulation driver
+//! @{
+//!
+//****************************************************************************/
+//! @file dma_stream_bench.c
+//! @brief Runs dma_stream.c on Linux with the ping-pong DMA fed from a raw
+//!        file of 16-bit samples at a configurable rate. Each block goes
+//!        through a processing callback (peak/mean, plus optional busy work
+//!        standing in for a filter chain) and the stream counters show
+//!        whether processing keeps up with the rate.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/dma_stream_bench.c host/hal_host.c application/dma_stream.c
+//!            -o dma_stream_bench
+//!
+//!        Usage: dma_stream_bench <s16 file> [samples/s] [block] [work us] [isr]
+//!        samples/s 0 delivers as fast as possible; isr 1 processes in the
+//!        DMA interrupt instead of the main loop.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "dma_stream.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_BLOCK_MAX   4096u
+
+typedef struct
+{
+    uint32_t work_us;
+    int16_t  peak;
+    int64_t  sum;
+    uint64_t samples;
+    uint64_t busy_ns;
+}BenchCtx_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static uint64_t NowNs(void);
+static void Process(void *ctx, void *block, uint32_t count);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static int16_t           s_Buf[2][BENCH_BLOCK_MAX];
+static DMA_HandleTypeDef s_Dma;
+static DmaStream_t       s_Stream;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t   rate    = (argc > 2) ? (uint32_t)atoi(argv[2]) : 48000u;
+    uint32_t   block   = (argc > 3) ? (uint32_t)atoi(argv[3]) : 256u;
+    uint32_t   flags   = ((argc > 5) && atoi(argv[5])) ? DMA_STREAM_FLAG_PROCESS_IN_ISR : 0u;
+    BenchCtx_t ctx     = {0};
+    DmaStreamStats_t stats;
+    uint64_t   start;
+    uint64_t   elapsed;
+
+    if ((argc < 2) || (0 == block) || (block > BENCH_BLOCK_MAX))
+    {
+        fprintf(stderr, "usage: %s <s16 file> [samples/s] [block <= %u] [work us] [isr]\n",
+                argv[0], (unsigned)BENCH_BLOCK_MAX);
+        return 1;
+    }
+    ctx.work_us = (argc > 4) ? (uint32_t)atoi(argv[4]) : 0u;
+
+    s_Dma.Init.Direction        = DMA_PERIPH_TO_MEMORY;
+    s_Dma.Init.PeriphInc        = DMA_PINC_DISABLE;
+    s_Dma.Init.MemInc           = DMA_MINC_ENABLE;
+    s_Dma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+    s_Dma.Init.Mode             = DMA_CIRCULAR;
+    HAL_DMA_Init(&s_Dma);
+
+    DmaStreamInit(&s_Stream, &s_Dma, 0, s_Buf[0], s_Buf[1], block, Process, &ctx,
+                  (uint8_t)flags);
+    if (HAL_OK != DmaStreamStart(&s_Stream))
+    {
+        return 1;
+    }
+    HalHostDmaSetTargets(&s_Dma, s_Buf[0], s_Buf[1]);
+
+    if (0 != HalHostDmaFileOpen(&s_Dma, argv[1], rate * (uint32_t)sizeof(int16_t)))
+    {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    start = NowNs();
+    while (0 != HalHostDmaFileStep())
+    {
+        DmaStreamPoll(&s_Stream);
+    }
+    DmaStreamPoll(&s_Stream);
+    elapsed = NowNs() - start;
+
+    DmaStreamGetStats(&s_Stream, &stats);
+
+    printf("%u samples/s, %u samples per block, %s processing, %u us work\n",
+           (unsigned)rate, (unsigned)block, flags ? "ISR" : "main loop",
+           (unsigned)ctx.work_us);
+    printf("blocks     %u completed, %u processed, %u overruns, %u errors\n",
+           (unsigned)stats.blocks, (unsigned)stats.processed,
+           (unsigned)stats.overruns, (unsigned)stats.errors);
+    printf("samples    %llu, peak %d, mean %.2f\n", (unsigned long long)ctx.samples,
+           ctx.peak, ctx.samples ? (double)ctx.sum / (double)ctx.samples : 0.0);
+    if (stats.processed)
+    {
+        printf("cost       %.1f us per block, block period %.1f us, %.1f s wall\n",
+               (double)ctx.busy_ns / 1000.0 / stats.processed,
+               rate ? 1e6 * block / rate : 0.0, (double)elapsed / 1e9);
+    }
+
+    return (0 == stats.overruns) ? 0 : 2;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}//end NowNs
+
+static void Process(void *ctx, void *block, uint32_t count)
+{
+    BenchCtx_t    *bench   = ctx;
+    const int16_t *samples = block;
+    uint64_t       start   = NowNs();
+    uint32_t       i;
+
+    for (i = 0; i < count; i++)
+    {
+        int16_t mag = (samples[i] < 0) ? (int16_t)-(samples[i] + 1) : samples[i];
+
+        bench->sum += samples[i];
+        if (mag > bench->peak)
+        {
+            bench->peak = mag;
+        }
+    }
+    bench->samples += count;
+
+    //stand-in for a filter chain
+    while (NowNs() - start < (uint64_t)bench->work_us * 1000u)
+    {
+    }
+
+    bench->busy_ns += NowNs() - start;
+}//end Process
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,452 @@
+//! @addtogroup Host
+//! @brief CMSIS-DSP host profile check and throughput benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file dsp_host_bench.c
+//! @brief Builds the CMSIS-DSP library with ARM_MATH_HOST and runs the
+//!        stages a replay of fleet data would use over one device-day of
+//!        1 Hz samples (86400): q15 to float, calibration gain and offset,
+//!        a 32 tap FIR in f32 and q15, a 2 stage biquad, hourly mean,
+//!        variance, min and max, and 1024 point real FFT frames. It reports
+//!        each stage and the whole chain in Msamples/s and device-days per
+//!        second.
+//!
+//!        First the real FFT, the q15 and q31 complex FFTs and the f32 FIR
+//!        are checked against a direct double precision reference, which
+//!        also covers the C bit reversal the host profile adds.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/dsp_host_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c
+//!            -lm -o dsp_host_bench
+//!
+//!        Add -march=native for the widest vectors, and -ffast-math to let
+//!        the float sums vectorize too (see arm_math_host.h).
+//!
+//!        Usage: dsp_host_bench [devices]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+#include "arm_const_structs.h"
+//each stage is repeated once for at least BENCH_MIN_S
+#define BENCH_MIN_S      0.2
+#define BENCH_TRIALS     1u
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+//1 Hz samples in a device-day
+#define BENCH_DAY        86400u
+#define BENCH_HOUR       3600u
+//filter block, divides BENCH_DAY
+#define BENCH_BLOCK      960u
+#define BENCH_FIR_TAPS   32u
+#define BENCH_BIQUADS    2u
+#define BENCH_FFT_LEN    1024u
+#define BENCH_CFFT_LEN   256u
+
+typedef void (*BenchStage_t)(void);
+
+typedef struct
+{
+    const char   *name;
+    BenchStage_t run;
+}BenchEntry_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static uint32_t CheckRfft(void);
+static uint32_t CheckCfftQ15(void);
+static uint32_t CheckCfftQ31(void);
+static uint32_t CheckFir(void);
+
+//
+//! @brief Time a stage over one device-day of samples
+//! @param[in]    run  Stage
+//! @param[out]   None
+//! @return       Seconds per device-day
+//
+static double Time(BenchStage_t run);
+
+static void Step(void *arg);
+
+static void StageToFloat(void);
+static void StageCalibrate(void);
+static void StageFirF32(void);
+static void StageFirQ15(void);
+static void StageBiquad(void);
+static void StageStats(void);
+static void StageRfft(void);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const BenchEntry_t s_Stages[] =
+{
+    {"q15_to_float", StageToFloat},
+    {"scale+offset", StageCalibrate},
+    {"fir_f32", StageFirF32},
+    {"fir_q15", StageFirQ15},
+    {"biquad_f32", StageBiquad},
+    {"hour stats", StageStats},
+    {"rfft_fast", StageRfft},
+};
+
+static q15_t     s_Raw[BENCH_DAY];
+static float32_t s_In[BENCH_DAY];
+static float32_t s_Out[BENCH_DAY];
+static q15_t     s_OutQ15[BENCH_DAY];
+static float32_t s_Stats[BENCH_DAY / BENCH_HOUR][4];
+
+static float32_t s_FirCoeffs[BENCH_FIR_TAPS];
+static q15_t     s_FirCoeffsQ15[BENCH_FIR_TAPS];
+static float32_t s_FirState[BENCH_FIR_TAPS + BENCH_BLOCK - 1u];
+static q15_t     s_FirStateQ15[BENCH_FIR_TAPS + BENCH_BLOCK - 1u];
+static float32_t s_BiquadState[4u * BENCH_BIQUADS];
+//2nd order Butterworth low pass at 0.05 fs, twice; a1, a2 negated as
+//arm_biquad_cascade_df1_f32() expects
+static const float32_t s_BiquadCoeffs[5u * BENCH_BIQUADS] =
+{
+    0.020083366f, 0.040166731f, 0.020083366f, 1.561018076f, -0.641351538f,
+    0.020083366f, 0.040166731f, 0.020083366f, 1.561018076f, -0.641351538f,
+};
+
+static arm_fir_instance_f32            s_Fir;
+static arm_fir_instance_q15            s_FirQ15;
+static arm_biquad_casd_df1_inst_f32    s_Biquad;
+static arm_rfft_fast_instance_f32      s_Rfft;
+static float32_t s_Frame[BENCH_FFT_LEN];
+static float32_t s_Spectrum[BENCH_FFT_LEN];
+
+//keeps the timed stages from being optimised away
+static volatile float32_t s_Sink;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t devices = (argc > 1) ? (uint32_t)atoi(argv[1]) : 1000u;
+    uint32_t failed  = 0;
+    double   total   = 0.0;
+    uint32_t i;
+
+    //a slow drift, a daily cycle and noise, as TVOC readings in q15
+    srand(1);
+    for (i = 0; i < BENCH_DAY; i++)
+    {
+        double x = 0.3 + 0.2 * sin(2.0 * PI * (double)i / (double)BENCH_DAY) +
+                   0.05 * sin(2.0 * PI * (double)i / 600.0) +
+                   0.02 * ((double)rand() / RAND_MAX - 0.5);
+
+        s_Raw[i] = (q15_t)(x * 32768.0);
+    }
+
+    //windowed sinc low pass at 0.05 fs
+    for (i = 0; i < BENCH_FIR_TAPS; i++)
+    {
+        double n = (double)i - (BENCH_FIR_TAPS - 1u) / 2.0;
+        double w = 0.54 - 0.46 * cos(2.0 * PI * (double)i / (BENCH_FIR_TAPS - 1u));
+
+        s_FirCoeffs[i] = (float32_t)(0.1 * w * ((0.0 == n) ? 1.0 : sin(0.1 * PI * n) /
+                                                                  (0.1 * PI * n)));
+    }
+    arm_float_to_q15(s_FirCoeffs, s_FirCoeffsQ15, BENCH_FIR_TAPS);
+
+    arm_fir_init_f32(&s_Fir, BENCH_FIR_TAPS, s_FirCoeffs, s_FirState, BENCH_BLOCK);
+    (void)arm_fir_init_q15(&s_FirQ15, BENCH_FIR_TAPS, s_FirCoeffsQ15, s_FirStateQ15,
+                           BENCH_BLOCK);
+    arm_biquad_cascade_df1_init_f32(&s_Biquad, BENCH_BIQUADS, (float32_t *)s_BiquadCoeffs,
+                                    s_BiquadState);
+    (void)arm_rfft_fast_init_f32(&s_Rfft, BENCH_FFT_LEN);
+
+    failed += CheckRfft();
+    failed += CheckCfftQ15();
+    failed += CheckCfftQ31();
+    failed += CheckFir();
+
+    StageToFloat();
+
+    printf("%-14s %12s %14s\n", "stage", "Msamples/s", "device-days/s");
+    for (i = 0; i < sizeof(s_Stages) / sizeof(s_Stages[0]); i++)
+    {
+        double day = Time(s_Stages[i].run);
+
+        total += day;
+        printf("%-14s %12.1f %14.0f\n", s_Stages[i].name, (double)BENCH_DAY / day / 1e6,
+               1.0 / day);
+    }
+    printf("%-14s %12.1f %14.0f\n", "chain", (double)BENCH_DAY / total / 1e6, 1.0 / total);
+    printf("%u devices: a day of data in %.3f s, a year in %.1f s\n", (unsigned)devices,
+           total * devices, total * devices * 365.0);
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static double Time(BenchStage_t run)
+{
+    return BenchTime(Step, &run);
+}//end Time
+
+static void Step(void *arg)
+{
+    (*(const BenchStage_t*)arg)();
+}//end Step
+
+static uint32_t CheckRfft(void)
+{
+    double   err = 0.0;
+    double   peak = 0.0;
+    uint32_t k;
+    uint32_t n;
+
+    for (n = 0; n < BENCH_FFT_LEN; n++)
+    {
+        s_Frame[n] = (float32_t)s_Raw[n] / 32768.0f;
+    }
+    memcpy(s_Spectrum, s_Frame, sizeof(s_Frame));
+    //the transform works in place on its input
+    arm_rfft_fast_f32(&s_Rfft, s_Spectrum, s_Out, 0);
+
+    //s_Out holds X[0].re, X[N/2].re, then X[k] for k = 1 to N/2 - 1
+    for (k = 0; k < BENCH_FFT_LEN / 2u; k++)
+    {
+        double re = 0.0;
+        double im = 0.0;
+        double nyq = 0.0;
+
+        for (n = 0; n < BENCH_FFT_LEN; n++)
+        {
+            double a = 2.0 * PI * (double)k * (double)n / BENCH_FFT_LEN;
+
+            re  += s_Frame[n] * cos(a);
+            im  -= s_Frame[n] * sin(a);
+            nyq += (n & 1u) ? -s_Frame[n] : s_Frame[n];
+        }
+
+        if (0u == k)
+        {
+            err = fmax(err, fabs(re - s_Out[0]));
+            err = fmax(err, fabs(nyq - s_Out[1]));
+        }
+        else
+        {
+            err = fmax(err, fabs(re - s_Out[2u * k]));
+            err = fmax(err, fabs(im - s_Out[2u * k + 1u]));
+        }
+        peak = fmax(peak, hypot(re, im));
+    }
+
+    printf("check rfft_fast_f32 %u: max error %.2e of peak %.1f\n", (unsigned)BENCH_FFT_LEN,
+           err, peak);
+
+    return (err < 1e-4 * peak) ? 0u : 1u;
+}//end CheckRfft
+
+static uint32_t CheckCfftQ15(void)
+{
+    static q15_t buf[2u * BENCH_CFFT_LEN];
+    static q15_t in[2u * BENCH_CFFT_LEN];
+    double       err = 0.0;
+    uint32_t     k;
+    uint32_t     n;
+
+    //two tones off the bin centres
+    for (n = 0; n < BENCH_CFFT_LEN; n++)
+    {
+        in[2u * n]      = (q15_t)(12000.0 * cos(2.0 * PI * 13.3 * n / BENCH_CFFT_LEN));
+        in[2u * n + 1u] = (q15_t)(8000.0 * sin(2.0 * PI * 40.7 * n / BENCH_CFFT_LEN));
+    }
+    memcpy(buf, in, sizeof(in));
+    arm_cfft_q15(&arm_cfft_sR_q15_len256, buf, 0, 1);
+
+    //the q15 transform scales down by the length
+    for (k = 0; k < BENCH_CFFT_LEN; k++)
+    {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (n = 0; n < BENCH_CFFT_LEN; n++)
+        {
+            double a = 2.0 * PI * (double)k * (double)n / BENCH_CFFT_LEN;
+
+            re += in[2u * n] * cos(a) + in[2u * n + 1u] * sin(a);
+            im += in[2u * n + 1u] * cos(a) - in[2u * n] * sin(a);
+        }
+
+        err = fmax(err, fabs(re / BENCH_CFFT_LEN - buf[2u * k]));
+        err = fmax(err, fabs(im / BENCH_CFFT_LEN - buf[2u * k + 1u]));
+    }
+
+    printf("check cfft_q15 %u: max error %.1f LSB\n", (unsigned)BENCH_CFFT_LEN, err);
+
+    return (err < 16.0) ? 0u : 1u;
+}//end CheckCfftQ15
+
+static uint32_t CheckCfftQ31(void)
+{
+    static q31_t buf[2u * BENCH_CFFT_LEN];
+    static q31_t in[2u * BENCH_CFFT_LEN];
+    double       err = 0.0;
+    uint32_t     k;
+    uint32_t     n;
+
+    for (n = 0; n < BENCH_CFFT_LEN; n++)
+    {
+        in[2u * n]      = (q31_t)(6e8 * cos(2.0 * PI * 13.3 * n / BENCH_CFFT_LEN));
+        in[2u * n + 1u] = (q31_t)(4e8 * sin(2.0 * PI * 40.7 * n / BENCH_CFFT_LEN));
+    }
+    memcpy(buf, in, sizeof(in));
+    arm_cfft_q31(&arm_cfft_sR_q31_len256, buf, 0, 1);
+
+    for (k = 0; k < BENCH_CFFT_LEN; k++)
+    {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (n = 0; n < BENCH_CFFT_LEN; n++)
+        {
+            double a = 2.0 * PI * (double)k * (double)n / BENCH_CFFT_LEN;
+
+            re += in[2u * n] * cos(a) + in[2u * n + 1u] * sin(a);
+            im += in[2u * n + 1u] * cos(a) - in[2u * n] * sin(a);
+        }
+
+        err = fmax(err, fabs(re / BENCH_CFFT_LEN - buf[2u * k]));
+        err = fmax(err, fabs(im / BENCH_CFFT_LEN - buf[2u * k + 1u]));
+    }
+
+    //relative to the q15 LSB, 65536 q31 LSB
+    printf("check cfft_q31 %u: max error %.3f q15 LSB\n", (unsigned)BENCH_CFFT_LEN,
+           err / 65536.0);
+
+    return (err < 65536.0) ? 0u : 1u;
+}//end CheckCfftQ31
+
+static uint32_t CheckFir(void)
+{
+    double   err = 0.0;
+    uint32_t n;
+    uint32_t k;
+
+    for (n = 0; n < BENCH_BLOCK; n++)
+    {
+        s_In[n] = (float32_t)s_Raw[n] / 32768.0f;
+    }
+    memset(s_FirState, 0, sizeof(s_FirState));
+    arm_fir_f32(&s_Fir, s_In, s_Out, BENCH_BLOCK);
+
+    for (n = 0; n < BENCH_BLOCK; n++)
+    {
+        double y = 0.0;
+
+        for (k = 0; (k < BENCH_FIR_TAPS) && (k <= n); k++)
+        {
+            y += (double)s_FirCoeffs[k] * s_In[n - k];
+        }
+        err = fmax(err, fabs(y - s_Out[n]));
+    }
+
+    printf("check fir_f32 %u taps: max error %.2e\n", (unsigned)BENCH_FIR_TAPS, err);
+
+    return (err < 1e-5) ? 0u : 1u;
+}//end CheckFir
+
+static void StageToFloat(void)
+{
+    arm_q15_to_float(s_Raw, s_In, BENCH_DAY);
+}//end StageToFloat
+
+static void StageCalibrate(void)
+{
+    arm_scale_f32(s_In, 1.25f, s_Out, BENCH_DAY);
+    arm_offset_f32(s_Out, -0.01f, s_Out, BENCH_DAY);
+    s_Sink = s_Out[BENCH_DAY - 1u];
+}//end StageCalibrate
+
+static void StageFirF32(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_DAY; i += BENCH_BLOCK)
+    {
+        arm_fir_f32(&s_Fir, &s_In[i], &s_Out[i], BENCH_BLOCK);
+    }
+    s_Sink = s_Out[BENCH_DAY - 1u];
+}//end StageFirF32
+
+static void StageFirQ15(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_DAY; i += BENCH_BLOCK)
+    {
+        arm_fir_q15(&s_FirQ15, &s_Raw[i], &s_OutQ15[i], BENCH_BLOCK);
+    }
+    s_Sink = s_OutQ15[BENCH_DAY - 1u];
+}//end StageFirQ15
+
+static void StageBiquad(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < BENCH_DAY; i += BENCH_BLOCK)
+    {
+        arm_biquad_cascade_df1_f32(&s_Biquad, &s_In[i], &s_Out[i], BENCH_BLOCK);
+    }
+    s_Sink = s_Out[BENCH_DAY - 1u];
+}//end StageBiquad
+
+static void StageStats(void)
+{
+    uint32_t h;
+    uint32_t index;
+
+    for (h = 0; h < BENCH_DAY / BENCH_HOUR; h++)
+    {
+        const float32_t *hour = &s_In[h * BENCH_HOUR];
+
+        arm_mean_f32((float32_t *)hour, BENCH_HOUR, &s_Stats[h][0]);
+        arm_var_f32((float32_t *)hour, BENCH_HOUR, &s_Stats[h][1]);
+        arm_min_f32((float32_t *)hour, BENCH_HOUR, &s_Stats[h][2], &index);
+        arm_max_f32((float32_t *)hour, BENCH_HOUR, &s_Stats[h][3], &index);
+    }
+    s_Sink = s_Stats[0][1];
+}//end StageStats
+
+static void StageRfft(void)
+{
+    uint32_t i;
+
+    for (i = 0; i + BENCH_FFT_LEN <= BENCH_DAY; i += BENCH_FFT_LEN)
+    {
+        memcpy(s_Frame, &s_In[i], sizeof(s_Frame));
+        arm_rfft_fast_f32(&s_Rfft, s_Frame, s_Spectrum, 0);
+    }
+    s_Sink = s_Spectrum[1];
+}//end StageRfft
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
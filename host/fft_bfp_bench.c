@@ -0,0 +1,459 @@
+//! @addtogroup Host
+//! @brief Block floating-point FFT check and benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file fft_bfp_bench.c
+//! @brief Compares the SNR of arm_cfft_bfp_q15/q31() and arm_rfft_bfp_q15/q31()
+//!        with that of arm_cfft_q15/q31(), arm_rfft_q15/q31() and the f32
+//!        transforms, against a double precision DFT of the input each one
+//!        is given, for inputs from full scale down to -60 dBFS.
+//!
+//!        The fixed-point CMSIS transforms scale their output down by a power
+//!        of 2 that depends on the length; it is found from the least squares
+//!        gain and rounded to a power of 2.  The block floating-point outputs
+//!        are scaled by their block exponent.
+//!
+//!        Then times each transform at 256 and 1024 points.  On the host the
+//!        fixed-point CMSIS paths are the plain C ones without SIMD, so the
+//!        times only compare the algorithms, not the Cortex-M4 cycles.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/fft_bfp_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o fft_bfp_bench
+//!
+//!        Usage: fft_bfp_bench [cpu MHz]
+//!        With the clock of the host the times are printed in cycles too.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+#include "arm_const_structs.h"
+//each point is the best of BENCH_TRIALS runs of at least BENCH_MIN_S
+#define BENCH_MIN_S       0.05
+#define BENCH_TRIALS      7u
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_MAX_LEN     1024u
+//the block floating-point transforms must keep at least this SNR at any level
+#define BENCH_MIN_SNR_Q15 55.0
+#define BENCH_MIN_SNR_Q31 140.0
+
+typedef enum
+{
+    BENCH_CFFT_Q15 = 0,
+    BENCH_CFFT_BFP_Q15,
+    BENCH_CFFT_Q31,
+    BENCH_CFFT_BFP_Q31,
+    BENCH_CFFT_F32,
+    BENCH_RFFT_Q15,
+    BENCH_RFFT_BFP_Q15,
+    BENCH_RFFT_Q31,
+    BENCH_RFFT_BFP_Q31,
+    BENCH_RFFT_F32,
+    BENCH_KINDS
+} BenchKind_t;
+
+typedef struct
+{
+    BenchKind_t kind;
+    uint32_t    fftLen;
+}BenchPoint_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//
+//! @brief Fill the input with two tones and noise at a level
+//! @param[in]    levelDb  peak level in dBFS
+//! @param[out]   None
+//! @return       None
+//
+static void MakeInput(double levelDb);
+
+//
+//! @brief Double precision DFT of the input of a transform, in Q31 units
+//! @param[in]    kind     transform
+//! @param[in]    fftLen   DFT length
+//! @param[out]   None
+//! @return       None
+//
+static void Reference(BenchKind_t kind, uint32_t fftLen);
+
+//
+//! @brief Run a transform once on a copy of the input
+//! @param[in]    kind     transform
+//! @param[in]    fftLen   transform length
+//! @param[out]   None
+//! @return       block exponent, 0 for the others
+//
+static int32_t Run(BenchKind_t kind, uint32_t fftLen);
+
+//
+//! @brief SNR of a transform against the reference
+//! @param[in]    kind     transform
+//! @param[in]    fftLen   transform length
+//! @param[out]   None
+//! @return       SNR in dB
+//
+static double Snr(BenchKind_t kind, uint32_t fftLen);
+
+//
+//! @brief Time a transform
+//! @param[in]    kind     transform
+//! @param[in]    fftLen   transform length
+//! @param[out]   None
+//! @return       best time per transform in s
+//
+static double Time(BenchKind_t kind, uint32_t fftLen);
+
+static void Step(void *arg);
+
+//****************************************************************************/
+//                           Private Data
+//****************************************************************************/
+static const char *const s_Names[BENCH_KINDS] =
+{
+    "cfft_q15", "cfft_bfp_q15", "cfft_q31", "cfft_bfp_q31", "cfft_f32",
+    "rfft_q15", "rfft_bfp_q15", "rfft_q31", "rfft_bfp_q31", "rfft_f32",
+};
+static const uint16_t s_Lens[]   = {256, 1024};
+static const double   s_Levels[] = {0.0, -20.0, -40.0, -60.0};
+
+static double    s_In[2u * BENCH_MAX_LEN];
+static double    s_Ref[2u * BENCH_MAX_LEN];
+static q15_t     s_InQ15[2u * BENCH_MAX_LEN];
+static q31_t     s_InQ31[2u * BENCH_MAX_LEN];
+static float32_t s_InF32[2u * BENCH_MAX_LEN];
+static q15_t     s_BufQ15[4u * BENCH_MAX_LEN];
+static q31_t     s_BufQ31[4u * BENCH_MAX_LEN];
+static float32_t s_BufF32[2u * BENCH_MAX_LEN];
+static q15_t     s_OutQ15[2u * BENCH_MAX_LEN];
+static q31_t     s_OutQ31[2u * BENCH_MAX_LEN];
+static float32_t s_OutF32[2u * BENCH_MAX_LEN];
+static double    s_Out[2u * BENCH_MAX_LEN];
+
+static arm_rfft_instance_q15      s_RfftQ15;
+static arm_rfft_instance_q31      s_RfftQ31;
+static arm_rfft_fast_instance_f32 s_RfftF32;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    double   mhz    = (argc > 1) ? atof(argv[1]) : 0.0;
+    uint32_t failed = 0;
+    uint32_t i;
+    uint32_t l;
+    uint32_t k;
+
+    for (i = 0; i < sizeof(s_Lens) / sizeof(s_Lens[0]); i++)
+    {
+        uint32_t fftLen = s_Lens[i];
+
+        printf("SNR dB, %u points\n%-14s", (unsigned)fftLen, "dBFS");
+        for (l = 0; l < sizeof(s_Levels) / sizeof(s_Levels[0]); l++)
+        {
+            printf(" %8.0f", s_Levels[l]);
+        }
+        printf("\n");
+
+        for (k = 0; k < BENCH_KINDS; k++)
+        {
+            printf("%-14s", s_Names[k]);
+            for (l = 0; l < sizeof(s_Levels) / sizeof(s_Levels[0]); l++)
+            {
+                double snr;
+
+                MakeInput(s_Levels[l]);
+                Reference((BenchKind_t)k, fftLen);
+                snr = Snr((BenchKind_t)k, fftLen);
+                printf(" %8.1f", snr);
+
+                if (((BENCH_CFFT_BFP_Q15 == k) || (BENCH_RFFT_BFP_Q15 == k)) &&
+                    (snr < BENCH_MIN_SNR_Q15))
+                {
+                    failed++;
+                }
+                if (((BENCH_CFFT_BFP_Q31 == k) || (BENCH_RFFT_BFP_Q31 == k)) &&
+                    (snr < BENCH_MIN_SNR_Q31))
+                {
+                    failed++;
+                }
+            }
+            printf("\n");
+        }
+        printf("\n");
+    }
+    printf("check: %s\n", (0u == failed) ? "pass" : "FAIL");
+
+    MakeInput(-20.0);
+    printf("\n%-14s", (mhz > 0.0) ? "us (cycles)" : "us");
+    for (i = 0; i < sizeof(s_Lens) / sizeof(s_Lens[0]); i++)
+    {
+        printf(" %18u", (unsigned)s_Lens[i]);
+    }
+    printf("\n");
+    for (k = 0; k < BENCH_KINDS; k++)
+    {
+        printf("%-14s", s_Names[k]);
+        for (i = 0; i < sizeof(s_Lens) / sizeof(s_Lens[0]); i++)
+        {
+            double t = Time((BenchKind_t)k, s_Lens[i]);
+
+            if (mhz > 0.0)
+            {
+                printf(" %8.2f (%7.0f)", t * 1e6, t * mhz * 1e6);
+            }
+            else
+            {
+                printf(" %18.2f", t * 1e6);
+            }
+        }
+        printf("\n");
+    }
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static void MakeInput(double levelDb)
+{
+    double   peak = pow(10.0, levelDb / 20.0);
+    uint32_t n;
+
+    //the peak of 0.6 + 0.3 + 0.1 stays below full scale, the tones are off bin
+    srand(1);
+    for (n = 0; n < 2u * BENCH_MAX_LEN; n++)
+    {
+        double x = 0.6 * sin(0.0491 * n) + 0.3 * cos(0.7013 * n) +
+                   0.1 * (2.0 * rand() / RAND_MAX - 1.0);
+
+        s_InQ15[n] = (q15_t)lrint(x * peak * 32767.0);
+        s_InQ31[n] = (q31_t)lrint(x * peak * 2147483647.0);
+        s_InF32[n] = (float32_t)(x * peak);
+    }
+}//end MakeInput
+
+static void Reference(BenchKind_t kind, uint32_t fftLen)
+{
+    uint32_t isReal = (kind >= BENCH_RFFT_Q15) ? 1u : 0u;
+    uint32_t k;
+    uint32_t n;
+
+    //the input each transform sees, so that its own quantization is not counted
+    for (n = 0; n < 2u * fftLen; n++)
+    {
+        switch (kind)
+        {
+            case BENCH_CFFT_Q15:
+            case BENCH_CFFT_BFP_Q15:
+            case BENCH_RFFT_Q15:
+            case BENCH_RFFT_BFP_Q15:
+                s_In[n] = (double)s_InQ15[n] * 65536.0;
+                break;
+            case BENCH_CFFT_F32:
+            case BENCH_RFFT_F32:
+                s_In[n] = (double)s_InF32[n] * 2147483648.0;
+                break;
+            default:
+                s_In[n] = (double)s_InQ31[n];
+                break;
+        }
+    }
+
+    for (k = 0; k < fftLen; k++)
+    {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (n = 0; n < fftLen; n++)
+        {
+            double a  = -6.283185307179586 * (double)((k * n) % fftLen) / fftLen;
+            double xr = isReal ? s_In[n] : s_In[2u * n];
+            double xi = isReal ? 0.0 : s_In[2u * n + 1u];
+
+            re += xr * cos(a) - xi * sin(a);
+            im += xr * sin(a) + xi * cos(a);
+        }
+        s_Ref[2u * k]      = re;
+        s_Ref[2u * k + 1u] = im;
+    }
+}//end Reference
+
+static int32_t Run(BenchKind_t kind, uint32_t fftLen)
+{
+    const arm_cfft_instance_q15 *pCfftQ15 = (256u == fftLen) ? &arm_cfft_sR_q15_len256 :
+                                                               &arm_cfft_sR_q15_len1024;
+    const arm_cfft_instance_q31 *pCfftQ31 = (256u == fftLen) ? &arm_cfft_sR_q31_len256 :
+                                                               &arm_cfft_sR_q31_len1024;
+    const arm_cfft_instance_f32 *pCfftF32 = (256u == fftLen) ? &arm_cfft_sR_f32_len256 :
+                                                               &arm_cfft_sR_f32_len1024;
+    int8_t exponent = 0;
+
+    //every transform works in place or overwrites its input, so works on a copy
+    switch (kind)
+    {
+        case BENCH_CFFT_Q15:
+            memcpy(s_BufQ15, s_InQ15, 2u * fftLen * sizeof(q15_t));
+            arm_cfft_q15(pCfftQ15, s_BufQ15, 0u, 1u);
+            memcpy(s_OutQ15, s_BufQ15, 2u * fftLen * sizeof(q15_t));
+            break;
+        case BENCH_CFFT_BFP_Q15:
+            memcpy(s_BufQ15, s_InQ15, 2u * fftLen * sizeof(q15_t));
+            arm_cfft_bfp_q15(pCfftQ15, s_BufQ15, 0u, 1u, &exponent);
+            memcpy(s_OutQ15, s_BufQ15, 2u * fftLen * sizeof(q15_t));
+            break;
+        case BENCH_CFFT_Q31:
+            memcpy(s_BufQ31, s_InQ31, 2u * fftLen * sizeof(q31_t));
+            arm_cfft_q31(pCfftQ31, s_BufQ31, 0u, 1u);
+            memcpy(s_OutQ31, s_BufQ31, 2u * fftLen * sizeof(q31_t));
+            break;
+        case BENCH_CFFT_BFP_Q31:
+            memcpy(s_BufQ31, s_InQ31, 2u * fftLen * sizeof(q31_t));
+            arm_cfft_bfp_q31(pCfftQ31, s_BufQ31, 0u, 1u, &exponent);
+            memcpy(s_OutQ31, s_BufQ31, 2u * fftLen * sizeof(q31_t));
+            break;
+        case BENCH_CFFT_F32:
+            memcpy(s_OutF32, s_InF32, 2u * fftLen * sizeof(float32_t));
+            arm_cfft_f32(pCfftF32, s_OutF32, 0u, 1u);
+            break;
+        case BENCH_RFFT_Q15:
+            (void)arm_rfft_init_q15(&s_RfftQ15, fftLen, 0u, 1u);
+            memcpy(s_BufQ15, s_InQ15, fftLen * sizeof(q15_t));
+            arm_rfft_q15(&s_RfftQ15, s_BufQ15, &s_BufQ15[fftLen]);
+            memcpy(s_OutQ15, &s_BufQ15[fftLen], 2u * fftLen * sizeof(q15_t));
+            break;
+        case BENCH_RFFT_BFP_Q15:
+            (void)arm_rfft_init_q15(&s_RfftQ15, fftLen, 0u, 1u);
+            memcpy(s_BufQ15, s_InQ15, fftLen * sizeof(q15_t));
+            arm_rfft_bfp_q15(&s_RfftQ15, s_BufQ15, &s_BufQ15[fftLen], &exponent);
+            memcpy(s_OutQ15, &s_BufQ15[fftLen], 2u * fftLen * sizeof(q15_t));
+            break;
+        case BENCH_RFFT_Q31:
+            (void)arm_rfft_init_q31(&s_RfftQ31, fftLen, 0u, 1u);
+            memcpy(s_BufQ31, s_InQ31, fftLen * sizeof(q31_t));
+            arm_rfft_q31(&s_RfftQ31, s_BufQ31, &s_BufQ31[fftLen]);
+            memcpy(s_OutQ31, &s_BufQ31[fftLen], 2u * fftLen * sizeof(q31_t));
+            break;
+        case BENCH_RFFT_BFP_Q31:
+            (void)arm_rfft_init_q31(&s_RfftQ31, fftLen, 0u, 1u);
+            memcpy(s_BufQ31, s_InQ31, fftLen * sizeof(q31_t));
+            arm_rfft_bfp_q31(&s_RfftQ31, s_BufQ31, &s_BufQ31[fftLen], &exponent);
+            memcpy(s_OutQ31, &s_BufQ31[fftLen], 2u * fftLen * sizeof(q31_t));
+            break;
+        default:
+            (void)arm_rfft_fast_init_f32(&s_RfftF32, fftLen);
+            memcpy(s_BufF32, s_InF32, fftLen * sizeof(float32_t));
+            arm_rfft_fast_f32(&s_RfftF32, s_BufF32, s_OutF32, 0u);
+            break;
+    }
+
+    return exponent;
+}//end Run
+
+static double Snr(BenchKind_t kind, uint32_t fftLen)
+{
+    int32_t  exponent = Run(kind, fftLen);
+    uint32_t bins     = (kind >= BENCH_RFFT_Q15) ? (fftLen / 2u) : fftLen;
+    double   scale;
+    double   signal = 0.0;
+    double   noise  = 0.0;
+    double   cross  = 0.0;
+    double   power  = 0.0;
+    uint32_t k;
+
+    //bins 0 to bins - 1, the real transforms are compared on half the spectrum
+    for (k = 0; k < 2u * bins; k++)
+    {
+        switch (kind)
+        {
+            case BENCH_CFFT_Q15:
+            case BENCH_CFFT_BFP_Q15:
+            case BENCH_RFFT_Q15:
+            case BENCH_RFFT_BFP_Q15:
+                s_Out[k] = (double)s_OutQ15[k] * 65536.0;
+                break;
+            case BENCH_CFFT_F32:
+                s_Out[k] = (double)s_OutF32[k] * 2147483648.0;
+                break;
+            case BENCH_RFFT_F32:
+                //packed: the real Nyquist bin takes the imaginary part of bin 0
+                s_Out[k] = (1u == k) ? 0.0 : (double)s_OutF32[k] * 2147483648.0;
+                break;
+            default:
+                s_Out[k] = (double)s_OutQ31[k];
+                break;
+        }
+    }
+
+    if ((BENCH_CFFT_BFP_Q15 == kind) || (BENCH_RFFT_BFP_Q15 == kind) ||
+        (BENCH_CFFT_BFP_Q31 == kind) || (BENCH_RFFT_BFP_Q31 == kind))
+    {
+        scale = ldexp(1.0, exponent);
+    }
+    else if ((BENCH_CFFT_F32 == kind) || (BENCH_RFFT_F32 == kind))
+    {
+        scale = 1.0;
+    }
+    else
+    {
+        //the least squares gain rounded to the power of 2 of the documented scaling
+        for (k = 0; k < 2u * bins; k++)
+        {
+            cross += s_Out[k] * s_Ref[k];
+            power += s_Out[k] * s_Out[k];
+        }
+        scale = (power > 0.0) ? ldexp(1.0, (int)lrint(log2(cross / power))) : 1.0;
+    }
+
+    for (k = 0; k < 2u * bins; k++)
+    {
+        double ref = ((BENCH_RFFT_F32 == kind) && (1u == k)) ? 0.0 : s_Ref[k];
+        double err = s_Out[k] * scale - ref;
+
+        signal += ref * ref;
+        noise  += err * err;
+    }
+
+    return (noise > 0.0) ? 10.0 * log10(signal / noise) : 999.9;
+}//end Snr
+
+static double Time(BenchKind_t kind, uint32_t fftLen)
+{
+    BenchPoint_t point = {kind, fftLen};
+
+    return BenchTime(Step, &point);
+}//end Time
+
+static void Step(void *arg)
+{
+    const BenchPoint_t *point = (const BenchPoint_t*)arg;
+
+    (void)Run(point->kind, point->fftLen);
+}//end Step
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,354 @@
+//! @addtogroup Host
+//! @brief Mixed radix FFT check and benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file fft_mr_bench.c
+//! @brief Checks arm_cfft_mr_f32() and arm_rfft_mr_f32() against a double
+//!        precision DFT and their inverses against the input, for lengths
+//!        with factors 2, 3, 4 and 5 up to 4000 points, and the real FFT
+//!        against arm_rfft_fast_f32() at 1024 points.
+//!
+//!        Then times the windows of 60, 300 and 3600 samples (minutes and
+//!        hours at 1 Hz) transformed as they are, against copying them zero
+//!        padded to the next power of 2 and using arm_rfft_fast_f32() and
+//!        arm_cfft_f32(), which is what the application had to do.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/fft_mr_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o fft_mr_bench
+//!
+//!        Usage: fft_mr_bench
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+#include "arm_const_structs.h"
+//each point is the best of BENCH_TRIALS runs of at least BENCH_MIN_S
+#define BENCH_MIN_S       0.05
+#define BENCH_TRIALS      7u
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_MAX_LEN     4096u
+
+typedef void (*BenchRun_t)(uint32_t fftLen);
+
+typedef struct
+{
+    BenchRun_t run;
+    uint32_t   fftLen;
+}BenchPoint_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//
+//! @brief Check the complex FFT of a length and its inverse
+//! @param[in]    fftLen  FFT length
+//! @param[out]   None
+//! @return       1 if an error is beyond single precision rounding, else 0
+//
+static uint32_t CheckComplex(uint16_t fftLen);
+
+//
+//! @brief Check the real FFT of a length and its inverse
+//! @param[in]    fftLen  FFT length
+//! @param[out]   None
+//! @return       1 if an error is beyond single precision rounding, else 0
+//
+static uint32_t CheckReal(uint16_t fftLen);
+
+//
+//! @brief Best time of a run
+//! @param[in]    run     Transform to time
+//! @param[in]    fftLen  Window length
+//! @param[out]   None
+//! @return       Seconds per run
+//
+static double Time(BenchRun_t run, uint32_t fftLen);
+
+static void Step(void *arg);
+
+static void RunRealMr(uint32_t fftLen);
+static void RunRealPadded(uint32_t fftLen);
+static void RunComplexMr(uint32_t fftLen);
+static void RunComplexPadded(uint32_t fftLen);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const uint16_t s_ComplexLens[] = {2, 3, 4, 5, 6, 8, 15, 16, 45, 60, 300, 1024, 3600, 4000};
+static const uint16_t s_RealLens[]    = {4, 6, 10, 60, 300, 1024, 3600, 4000};
+static const uint16_t s_Windows[]     = {60, 300, 3600};
+
+static float32_t s_In[2u * BENCH_MAX_LEN];
+static float32_t s_Buf[2u * BENCH_MAX_LEN];
+static float32_t s_Out[2u * BENCH_MAX_LEN];
+static float32_t s_Scratch[2u * BENCH_MAX_LEN];
+static float32_t s_Twiddle[2u * BENCH_MAX_LEN];
+static double    s_Ref[2u * BENCH_MAX_LEN];
+
+static arm_cfft_mr_instance_f32   s_Cfft;
+static arm_rfft_mr_instance_f32   s_Rfft;
+static arm_rfft_fast_instance_f32 s_RfftFast;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(void)
+{
+    uint32_t failed = 0;
+    uint32_t i;
+
+    srand(1);
+    for (i = 0; i < 2u * BENCH_MAX_LEN; i++)
+    {
+        s_In[i] = (float32_t)rand() / RAND_MAX - 0.5f;
+    }
+
+    for (i = 0; i < sizeof(s_ComplexLens) / sizeof(s_ComplexLens[0]); i++)
+    {
+        failed += CheckComplex(s_ComplexLens[i]);
+    }
+    for (i = 0; i < sizeof(s_RealLens) / sizeof(s_RealLens[0]); i++)
+    {
+        failed += CheckReal(s_RealLens[i]);
+    }
+
+    //lengths with another prime factor, or odd real lengths, are refused
+    failed += (ARM_MATH_SUCCESS == arm_cfft_mr_init_f32(&s_Cfft, 0u, s_Twiddle)) ? 1u : 0u;
+    failed += (ARM_MATH_SUCCESS == arm_cfft_mr_init_f32(&s_Cfft, 1u, s_Twiddle)) ? 1u : 0u;
+    failed += (ARM_MATH_SUCCESS == arm_cfft_mr_init_f32(&s_Cfft, 14u, s_Twiddle)) ? 1u : 0u;
+    failed += (ARM_MATH_SUCCESS == arm_rfft_mr_init_f32(&s_Rfft, 15u, s_Twiddle)) ? 1u : 0u;
+    failed += (ARM_MATH_SUCCESS == arm_rfft_mr_init_f32(&s_Rfft, 2u, s_Twiddle)) ? 1u : 0u;
+    printf("check: %s\n", (0u == failed) ? "pass" : "FAIL");
+
+    printf("\nus per transform\n%6s %10s %10s %10s %10s %10s %10s\n", "window", "real mr",
+           "padded", "to", "cplx mr", "padded", "to");
+    for (i = 0; i < sizeof(s_Windows) / sizeof(s_Windows[0]); i++)
+    {
+        uint32_t padded = 64u;
+
+        while (padded < s_Windows[i])
+        {
+            padded <<= 1;
+        }
+
+        (void)arm_rfft_mr_init_f32(&s_Rfft, s_Windows[i], s_Twiddle);
+        printf("%6u %10.2f", (unsigned)s_Windows[i], Time(RunRealMr, s_Windows[i]) * 1e6);
+        printf(" %10.2f %10u", Time(RunRealPadded, s_Windows[i]) * 1e6, (unsigned)padded);
+        (void)arm_cfft_mr_init_f32(&s_Cfft, s_Windows[i], s_Twiddle);
+        printf(" %10.2f", Time(RunComplexMr, s_Windows[i]) * 1e6);
+        printf(" %10.2f %10u\n", Time(RunComplexPadded, s_Windows[i]) * 1e6, (unsigned)padded);
+    }
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint32_t CheckComplex(uint16_t fftLen)
+{
+    double   err  = 0.0;
+    double   back = 0.0;
+    double   peak = 0.0;
+    uint32_t k;
+    uint32_t n;
+
+    if (ARM_MATH_SUCCESS != arm_cfft_mr_init_f32(&s_Cfft, fftLen, s_Twiddle))
+    {
+        printf("check complex %4u: init failed\n", (unsigned)fftLen);
+        return 1u;
+    }
+
+    for (k = 0; k < fftLen; k++)
+    {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (n = 0; n < fftLen; n++)
+        {
+            double a = -6.283185307179586 * (double)((k * n) % fftLen) / fftLen;
+
+            re += s_In[2u * n] * cos(a) - s_In[2u * n + 1u] * sin(a);
+            im += s_In[2u * n] * sin(a) + s_In[2u * n + 1u] * cos(a);
+        }
+        s_Ref[2u * k]      = re;
+        s_Ref[2u * k + 1u] = im;
+    }
+
+    memcpy(s_Buf, s_In, 2u * fftLen * sizeof(s_Buf[0]));
+    arm_cfft_mr_f32(&s_Cfft, s_Buf, s_Scratch, 0u);
+    for (k = 0; k < 2u * fftLen; k++)
+    {
+        err  = fmax(err, fabs(s_Ref[k] - s_Buf[k]));
+        peak = fmax(peak, fabs(s_Ref[k]));
+    }
+
+    arm_cfft_mr_f32(&s_Cfft, s_Buf, s_Scratch, 1u);
+    for (k = 0; k < 2u * fftLen; k++)
+    {
+        back = fmax(back, fabs((double)s_In[k] - s_Buf[k]));
+    }
+
+    printf("check complex %4u, %u stages: %.1e of %.1f, inverse %.1e\n", (unsigned)fftLen,
+           (unsigned)s_Cfft.numStages, err, peak, back);
+
+    return ((err > 1e-5 * peak) || (back > 1e-5)) ? 1u : 0u;
+}//end CheckComplex
+
+static uint32_t CheckReal(uint16_t fftLen)
+{
+    double   err  = 0.0;
+    double   fast = 0.0;
+    double   back = 0.0;
+    double   peak = 0.0;
+    uint32_t k;
+    uint32_t n;
+
+    if (ARM_MATH_SUCCESS != arm_rfft_mr_init_f32(&s_Rfft, fftLen, s_Twiddle))
+    {
+        printf("check real %4u: init failed\n", (unsigned)fftLen);
+        return 1u;
+    }
+
+    //packed: bins 0 and fftLen/2 first, then bins 1 to fftLen/2 - 1
+    for (k = 0; k <= fftLen / 2u; k++)
+    {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (n = 0; n < fftLen; n++)
+        {
+            double a = -6.283185307179586 * (double)((k * n) % fftLen) / fftLen;
+
+            re += s_In[n] * cos(a);
+            im += s_In[n] * sin(a);
+        }
+        if (0u == k)
+        {
+            s_Ref[0] = re;
+        }
+        else if (fftLen / 2u == k)
+        {
+            s_Ref[1] = re;
+        }
+        else
+        {
+            s_Ref[2u * k]      = re;
+            s_Ref[2u * k + 1u] = im;
+        }
+    }
+
+    arm_rfft_mr_f32(&s_Rfft, s_In, s_Out, s_Scratch, 0u);
+    for (k = 0; k < fftLen; k++)
+    {
+        err  = fmax(err, fabs(s_Ref[k] - s_Out[k]));
+        peak = fmax(peak, fabs(s_Ref[k]));
+    }
+
+    if (1024u == fftLen)
+    {
+        (void)arm_rfft_fast_init_f32(&s_RfftFast, fftLen);
+        memcpy(s_Buf, s_In, fftLen * sizeof(s_Buf[0]));
+        arm_rfft_fast_f32(&s_RfftFast, s_Buf, s_Scratch, 0u);
+        for (k = 0; k < fftLen; k++)
+        {
+            fast = fmax(fast, fabs((double)s_Scratch[k] - s_Out[k]));
+        }
+    }
+
+    //in place, as the output may be the input
+    arm_rfft_mr_f32(&s_Rfft, s_Out, s_Out, s_Scratch, 1u);
+    for (k = 0; k < fftLen; k++)
+    {
+        back = fmax(back, fabs((double)s_In[k] - s_Out[k]));
+    }
+
+    printf("check real    %4u: %.1e of %.1f, inverse %.1e", (unsigned)fftLen, err, peak, back);
+    if (1024u == fftLen)
+    {
+        printf(", rfft_fast %.1e", fast);
+    }
+    printf("\n");
+
+    return ((err > 1e-5 * peak) || (back > 1e-5) || (fast > 1e-5 * peak)) ? 1u : 0u;
+}//end CheckReal
+
+static double Time(BenchRun_t run, uint32_t fftLen)
+{
+    BenchPoint_t point = {run, fftLen};
+
+    return BenchTime(Step, &point);
+}//end Time
+
+static void Step(void *arg)
+{
+    const BenchPoint_t *point = (const BenchPoint_t*)arg;
+
+    point->run(point->fftLen);
+}//end Step
+
+static void RunRealMr(uint32_t fftLen)
+{
+    //the instance holds the length, and the input is left as it is
+    (void)fftLen;
+
+    arm_rfft_mr_f32(&s_Rfft, s_In, s_Out, s_Scratch, 0u);
+}//end RunRealMr
+
+static void RunRealPadded(uint32_t fftLen)
+{
+    uint32_t padded = 64u;
+
+    while (padded < fftLen)
+    {
+        padded <<= 1;
+    }
+
+    //arm_rfft_fast_f32() overwrites its input, which has to be a copy anyway
+    (void)arm_rfft_fast_init_f32(&s_RfftFast, (uint16_t)padded);
+    memcpy(s_Buf, s_In, fftLen * sizeof(s_Buf[0]));
+    memset(&s_Buf[fftLen], 0, (padded - fftLen) * sizeof(s_Buf[0]));
+    arm_rfft_fast_f32(&s_RfftFast, s_Buf, s_Out, 0u);
+}//end RunRealPadded
+
+static void RunComplexMr(uint32_t fftLen)
+{
+    memcpy(s_Buf, s_In, 2u * fftLen * sizeof(s_Buf[0]));
+    arm_cfft_mr_f32(&s_Cfft, s_Buf, s_Scratch, 0u);
+}//end RunComplexMr
+
+static void RunComplexPadded(uint32_t fftLen)
+{
+    const arm_cfft_instance_f32 *pCfft = (fftLen <= 64u) ? &arm_cfft_sR_f32_len64 :
+                                         (fftLen <= 512u) ? &arm_cfft_sR_f32_len512 :
+                                                            &arm_cfft_sR_f32_len4096;
+
+    memcpy(s_Buf, s_In, 2u * fftLen * sizeof(s_Buf[0]));
+    memset(&s_Buf[2u * fftLen], 0, 2u * (pCfft->fftLen - fftLen) * sizeof(s_Buf[0]));
+    arm_cfft_f32(pCfft, s_Buf, 0u, 1u);
+}//end RunComplexPadded
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
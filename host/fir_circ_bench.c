@@ -0,0 +1,297 @@
+//! @addtogroup Host
+//! @brief Circular state FIR check and benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file fir_circ_bench.c
+//! @brief Checks that arm_fir_circ_f32/q31/q15/q7() give the same output
+//!        bits as arm_fir_f32/q31/q15/q7() over a stream fed in blocks of
+//!        random size, in place and not, then times both f32 and q15
+//!        filters across tap counts and block sizes, in ns per sample.
+//!
+//!        arm_fir_*() copies numTaps - 1 samples of state at the end of
+//!        each call, so its cost per sample grows as numTaps / blockSize;
+//!        the circular state functions store each sample twice instead,
+//!        whatever the block size.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/fir_circ_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o fir_circ_bench
+//!
+//!        Usage: fir_circ_bench [seed]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+//each point is the best of BENCH_TRIALS runs of at least BENCH_MIN_S
+#define BENCH_MIN_S       0.01
+#define BENCH_TRIALS      5u
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_MAX_TAPS    512u
+#define BENCH_MAX_BLOCK   256u
+//samples run through each filter for the check
+#define BENCH_CHECK_LEN   4096u
+
+typedef struct
+{
+    uint32_t                  circ;
+    uint32_t                  q15;
+    uint32_t                  blockSize;
+    arm_fir_instance_f32      firF32;
+    arm_fir_instance_q15      firQ15;
+    arm_fir_circ_instance_f32 circF32;
+    arm_fir_circ_instance_q15 circQ15;
+}BenchPoint_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//
+//! @brief Run a plain and a circular state filter of each type over the
+//!        same stream in random blocks and compare the outputs
+//! @param[in]    numTaps  Filter length
+//! @param[in]    inPlace  1 to filter the circular state one in place
+//! @param[out]   None
+//! @return       Number of types that differ
+//
+static uint32_t Check(uint16_t numTaps, uint32_t inPlace);
+
+//
+//! @brief Time one filter over blocks of a size
+//! @param[in]    circ       1 for the circular state filter
+//! @param[in]    q15        1 for the q15 filter, else f32
+//! @param[in]    numTaps    Filter length
+//! @param[in]    blockSize  Samples per call
+//! @param[out]   None
+//! @return       ns per sample
+//
+static double Time(uint32_t circ, uint32_t q15, uint16_t numTaps, uint32_t blockSize);
+
+static void Step(void *arg);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const uint16_t s_Taps[]   = {8, 32, 128, 512};
+static const uint32_t s_Blocks[] = {1, 4, 16, 64, 256};
+
+static float32_t s_CoeffsF32[BENCH_MAX_TAPS];
+static q31_t     s_CoeffsQ31[BENCH_MAX_TAPS];
+static q15_t     s_CoeffsQ15[BENCH_MAX_TAPS];
+static q7_t      s_CoeffsQ7[BENCH_MAX_TAPS];
+
+static float32_t s_InF32[BENCH_CHECK_LEN];
+static q31_t     s_InQ31[BENCH_CHECK_LEN];
+static q15_t     s_InQ15[BENCH_CHECK_LEN];
+static q7_t      s_InQ7[BENCH_CHECK_LEN];
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t seed   = (argc > 1) ? (uint32_t)atoi(argv[1]) : 1u;
+    uint32_t failed = 0;
+    uint32_t t;
+    uint32_t b;
+    uint32_t q15;
+
+    srand(seed);
+    for (t = 0; t < BENCH_MAX_TAPS; t++)
+    {
+        //small taps so the fixed point sums stay in range
+        s_CoeffsF32[t] = ((float32_t)rand() / RAND_MAX - 0.5f) / 16.0f;
+        s_CoeffsQ31[t] = (q31_t)(s_CoeffsF32[t] * 2147483648.0f);
+        s_CoeffsQ15[t] = (q15_t)(s_CoeffsF32[t] * 32768.0f);
+        s_CoeffsQ7[t]  = (q7_t)(s_CoeffsF32[t] * 128.0f);
+    }
+    for (t = 0; t < BENCH_CHECK_LEN; t++)
+    {
+        s_InF32[t] = (float32_t)rand() / RAND_MAX - 0.5f;
+        s_InQ31[t] = (q31_t)(s_InF32[t] * 2147483648.0f);
+        s_InQ15[t] = (q15_t)(s_InF32[t] * 32768.0f);
+        s_InQ7[t]  = (q7_t)(s_InF32[t] * 128.0f);
+    }
+
+    //q15 FIR lengths must be even, keep to those
+    for (t = 0; t < sizeof(s_Taps) / sizeof(s_Taps[0]); t++)
+    {
+        failed += Check(s_Taps[t], 0u);
+        failed += Check(s_Taps[t], 1u);
+    }
+    failed += Check(6u, 0u);
+    printf("check: %s\n", (0u == failed) ? "bit exact" : "MISMATCH");
+
+    for (q15 = 0; q15 < 2u; q15++)
+    {
+        printf("\n%s, ns per sample: fir / fir_circ\n%6s", q15 ? "q15" : "f32", "taps");
+        for (b = 0; b < sizeof(s_Blocks) / sizeof(s_Blocks[0]); b++)
+        {
+            printf("   block %-10u", (unsigned)s_Blocks[b]);
+        }
+        printf("\n");
+
+        for (t = 0; t < sizeof(s_Taps) / sizeof(s_Taps[0]); t++)
+        {
+            printf("%6u", (unsigned)s_Taps[t]);
+            for (b = 0; b < sizeof(s_Blocks) / sizeof(s_Blocks[0]); b++)
+            {
+                double plain = Time(0u, q15, s_Taps[t], s_Blocks[b]);
+                double circ  = Time(1u, q15, s_Taps[t], s_Blocks[b]);
+
+                printf("  %7.1f/%-7.1f %4.1fx", plain, circ, plain / circ);
+            }
+            printf("\n");
+        }
+    }
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint32_t Check(uint16_t numTaps, uint32_t inPlace)
+{
+    static float32_t stateF32[BENCH_MAX_TAPS + BENCH_MAX_BLOCK], circF32[2u * BENCH_MAX_TAPS];
+    static q31_t     stateQ31[BENCH_MAX_TAPS + BENCH_MAX_BLOCK], circQ31[2u * BENCH_MAX_TAPS];
+    static q15_t     stateQ15[BENCH_MAX_TAPS + BENCH_MAX_BLOCK], circQ15[2u * BENCH_MAX_TAPS];
+    static q7_t      stateQ7[BENCH_MAX_TAPS + BENCH_MAX_BLOCK], circQ7[2u * BENCH_MAX_TAPS];
+    static float32_t refF32[BENCH_CHECK_LEN], outF32[BENCH_CHECK_LEN];
+    static q31_t     refQ31[BENCH_CHECK_LEN], outQ31[BENCH_CHECK_LEN];
+    static q15_t     refQ15[BENCH_CHECK_LEN], outQ15[BENCH_CHECK_LEN];
+    static q7_t      refQ7[BENCH_CHECK_LEN], outQ7[BENCH_CHECK_LEN];
+    arm_fir_instance_f32      firF32;
+    arm_fir_instance_q31      firQ31;
+    arm_fir_instance_q15      firQ15;
+    arm_fir_instance_q7       firQ7;
+    arm_fir_circ_instance_f32 circInstF32;
+    arm_fir_circ_instance_q31 circInstQ31;
+    arm_fir_circ_instance_q15 circInstQ15;
+    arm_fir_circ_instance_q7  circInstQ7;
+    uint32_t                  done = 0;
+    uint32_t                  failed = 0;
+
+    //the plain filters are run with BENCH_MAX_BLOCK blocks, as their init
+    //sizes the state for it
+    arm_fir_init_f32(&firF32, numTaps, s_CoeffsF32, stateF32, BENCH_MAX_BLOCK);
+    arm_fir_init_q31(&firQ31, numTaps, s_CoeffsQ31, stateQ31, BENCH_MAX_BLOCK);
+    (void)arm_fir_init_q15(&firQ15, numTaps, s_CoeffsQ15, stateQ15, BENCH_MAX_BLOCK);
+    arm_fir_init_q7(&firQ7, numTaps, s_CoeffsQ7, stateQ7, BENCH_MAX_BLOCK);
+    arm_fir_circ_init_f32(&circInstF32, numTaps, s_CoeffsF32, circF32);
+    arm_fir_circ_init_q31(&circInstQ31, numTaps, s_CoeffsQ31, circQ31);
+    arm_fir_circ_init_q15(&circInstQ15, numTaps, s_CoeffsQ15, circQ15);
+    arm_fir_circ_init_q7(&circInstQ7, numTaps, s_CoeffsQ7, circQ7);
+
+    memcpy(outF32, s_InF32, sizeof(outF32));
+    memcpy(outQ31, s_InQ31, sizeof(outQ31));
+    memcpy(outQ15, s_InQ15, sizeof(outQ15));
+    memcpy(outQ7, s_InQ7, sizeof(outQ7));
+
+    for (done = 0; done < BENCH_CHECK_LEN; done += BENCH_MAX_BLOCK)
+    {
+        arm_fir_f32(&firF32, &s_InF32[done], &refF32[done], BENCH_MAX_BLOCK);
+        arm_fir_q31(&firQ31, &s_InQ31[done], &refQ31[done], BENCH_MAX_BLOCK);
+        arm_fir_q15(&firQ15, &s_InQ15[done], &refQ15[done], BENCH_MAX_BLOCK);
+        arm_fir_q7(&firQ7, &s_InQ7[done], &refQ7[done], BENCH_MAX_BLOCK);
+    }
+
+    //random blocks, often wrapping the ring more than once
+    for (done = 0; done < BENCH_CHECK_LEN;)
+    {
+        uint32_t n = (uint32_t)rand() % (2u * numTaps + 2u);
+
+        n = (n > BENCH_CHECK_LEN - done) ? BENCH_CHECK_LEN - done : n;
+        arm_fir_circ_f32(&circInstF32, inPlace ? &outF32[done] : &s_InF32[done], &outF32[done], n);
+        arm_fir_circ_q31(&circInstQ31, inPlace ? &outQ31[done] : &s_InQ31[done], &outQ31[done], n);
+        arm_fir_circ_q15(&circInstQ15, inPlace ? &outQ15[done] : &s_InQ15[done], &outQ15[done], n);
+        arm_fir_circ_q7(&circInstQ7, inPlace ? &outQ7[done] : &s_InQ7[done], &outQ7[done], n);
+        done += n;
+    }
+
+    failed += (0 != memcmp(refF32, outF32, sizeof(refF32))) ? 1u : 0u;
+    failed += (0 != memcmp(refQ31, outQ31, sizeof(refQ31))) ? 1u : 0u;
+    failed += (0 != memcmp(refQ15, outQ15, sizeof(refQ15))) ? 1u : 0u;
+    failed += (0 != memcmp(refQ7, outQ7, sizeof(refQ7))) ? 1u : 0u;
+
+    if (0u != failed)
+    {
+        printf("check %u taps%s: %u types differ\n", (unsigned)numTaps,
+               inPlace ? " in place" : "", (unsigned)failed);
+    }
+
+    return failed;
+}//end Check
+
+static double Time(uint32_t circ, uint32_t q15, uint16_t numTaps, uint32_t blockSize)
+{
+    static float32_t stateF32[BENCH_MAX_TAPS + BENCH_MAX_BLOCK], circStateF32[2u * BENCH_MAX_TAPS];
+    static q15_t     stateQ15[BENCH_MAX_TAPS + BENCH_MAX_BLOCK], circStateQ15[2u * BENCH_MAX_TAPS];
+    //the step stops at the last whole block
+    uint32_t         samples = BENCH_CHECK_LEN - BENCH_CHECK_LEN % blockSize;
+    BenchPoint_t     point;
+
+    point.circ      = circ;
+    point.q15       = q15;
+    point.blockSize = blockSize;
+    arm_fir_init_f32(&point.firF32, numTaps, s_CoeffsF32, stateF32, blockSize);
+    (void)arm_fir_init_q15(&point.firQ15, numTaps, s_CoeffsQ15, stateQ15, blockSize);
+    arm_fir_circ_init_f32(&point.circF32, numTaps, s_CoeffsF32, circStateF32);
+    arm_fir_circ_init_q15(&point.circQ15, numTaps, s_CoeffsQ15, circStateQ15);
+
+    return BenchTime(Step, &point) * 1e9 / (double)samples;
+}//end Time
+
+static void Step(void *arg)
+{
+    static float32_t outF32[BENCH_CHECK_LEN];
+    static q15_t     outQ15[BENCH_CHECK_LEN];
+    BenchPoint_t    *point     = (BenchPoint_t*)arg;
+    uint32_t         blockSize = point->blockSize;
+    uint32_t         i;
+
+    for (i = 0; i + blockSize <= BENCH_CHECK_LEN; i += blockSize)
+    {
+        if (point->q15)
+        {
+            if (point->circ)
+            {
+                arm_fir_circ_q15(&point->circQ15, &s_InQ15[i], &outQ15[i], blockSize);
+            }
+            else
+            {
+                arm_fir_q15(&point->firQ15, &s_InQ15[i], &outQ15[i], blockSize);
+            }
+        }
+        else if (point->circ)
+        {
+            arm_fir_circ_f32(&point->circF32, &s_InF32[i], &outF32[i], blockSize);
+        }
+        else
+        {
+            arm_fir_f32(&point->firF32, &s_InF32[i], &outF32[i], blockSize);
+        }
+    }
+}//end Step
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,234 @@
+//! @addtogroup Host
+//! @brief Partitioned overlap-save FIR check and benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file fir_ols_bench.c
+//! @brief Checks arm_fir_ols_f32() against arm_fir_f32() over a stream, in
+//!        place and not, for filters longer and shorter than a partition,
+//!        then times both at 256, 1024 and 4096 taps for partitions of 64
+//!        to 1024 samples, arm_fir_f32() taking the same blocks.
+//!
+//!        arm_fir_f32() costs numTaps MACs per sample. The overlap-save
+//!        filter costs two FFTs of 2 * partSize points and numTaps / partSize
+//!        spectrum products per partSize samples: the table shows where each
+//!        partition size pays off.
+//!
+//!        Times are in ns per sample, and in cycles per sample when the
+//!        clock of the machine is given.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/fir_ols_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o fir_ols_bench
+//!
+//!        Usage: fir_ols_bench [cpu MHz]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_MAX_TAPS    4096u
+#define BENCH_MAX_PART    1024u
+//samples run through each filter, for the check and per timed run
+#define BENCH_STREAM_LEN  16384u
+
+typedef struct
+{
+    uint32_t                 ols;
+    uint16_t                 partSize;
+    arm_fir_instance_f32     fir;
+    arm_fir_ols_instance_f32 olsInst;
+}BenchPoint_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//
+//! @brief Run both filters over the stream and compare the outputs
+//! @param[in]    numTaps   Filter length
+//! @param[in]    partSize  Partition size
+//! @param[in]    inPlace   1 to filter in place
+//! @param[out]   None
+//! @return       1 if the outputs differ beyond rounding, else 0
+//
+static uint32_t Check(uint16_t numTaps, uint16_t partSize, uint32_t inPlace);
+
+//
+//! @brief Time one filter over the stream
+//! @param[in]    ols       1 for the overlap-save filter, else arm_fir_f32()
+//! @param[in]    numTaps   Filter length
+//! @param[in]    partSize  Samples per call
+//! @param[out]   None
+//! @return       ns per sample
+//
+static double Time(uint32_t ols, uint16_t numTaps, uint16_t partSize);
+
+static void Step(void *arg);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const uint16_t s_Taps[]  = {256, 1024, 4096};
+static const uint16_t s_Parts[] = {64, 256, 1024};
+
+static float32_t s_Coeffs[BENCH_MAX_TAPS];
+static float32_t s_In[BENCH_STREAM_LEN];
+static float32_t s_Ref[BENCH_STREAM_LEN];
+static float32_t s_Out[BENCH_STREAM_LEN];
+
+static float32_t s_FirState[BENCH_MAX_TAPS + BENCH_MAX_PART - 1u];
+static float32_t s_OlsCoeffs[ARM_FIR_OLS_COEFFS_LEN(BENCH_MAX_TAPS, BENCH_MAX_PART)];
+static float32_t s_OlsState[ARM_FIR_OLS_STATE_LEN(BENCH_MAX_TAPS, BENCH_MAX_PART)];
+static float32_t s_OlsScratch[ARM_FIR_OLS_SCRATCH_LEN(BENCH_MAX_PART)];
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    double   mhz    = (argc > 1) ? atof(argv[1]) : 0.0;
+    uint32_t failed = 0;
+    uint32_t t;
+    uint32_t p;
+
+    srand(1);
+    for (t = 0; t < BENCH_MAX_TAPS; t++)
+    {
+        s_Coeffs[t] = ((float32_t)rand() / RAND_MAX - 0.5f) / 16.0f;
+    }
+    for (t = 0; t < BENCH_STREAM_LEN; t++)
+    {
+        s_In[t] = (float32_t)rand() / RAND_MAX - 0.5f;
+    }
+
+    failed += Check(1000u, 64u, 0u);
+    failed += Check(1000u, 64u, 1u);
+    failed += Check(4096u, 256u, 0u);
+    failed += Check(10u, 64u, 0u);
+    failed += Check(64u, 64u, 1u);
+    failed += Check(4096u, 1024u, 0u);
+    printf("check: %s\n", (0u == failed) ? "pass" : "FAIL");
+
+    printf("\n%s per sample: fir / fir_ols\n%6s", (mhz > 0.0) ? "cycles" : "ns", "taps");
+    for (p = 0; p < sizeof(s_Parts) / sizeof(s_Parts[0]); p++)
+    {
+        printf("    part %-12u", (unsigned)s_Parts[p]);
+    }
+    printf("\n");
+
+    for (t = 0; t < sizeof(s_Taps) / sizeof(s_Taps[0]); t++)
+    {
+        printf("%6u", (unsigned)s_Taps[t]);
+        for (p = 0; p < sizeof(s_Parts) / sizeof(s_Parts[0]); p++)
+        {
+            double scale = (mhz > 0.0) ? mhz / 1000.0 : 1.0;
+            double fir   = Time(0u, s_Taps[t], s_Parts[p]) * scale;
+            double ols   = Time(1u, s_Taps[t], s_Parts[p]) * scale;
+
+            printf(" %8.1f / %-8.1f", fir, ols);
+        }
+        printf("\n");
+    }
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint32_t Check(uint16_t numTaps, uint16_t partSize, uint32_t inPlace)
+{
+    arm_fir_instance_f32     fir;
+    arm_fir_ols_instance_f32 ols;
+    double                   err  = 0.0;
+    double                   peak = 0.0;
+    uint32_t                 i;
+
+    arm_fir_init_f32(&fir, numTaps, s_Coeffs, s_FirState, partSize);
+    if (ARM_MATH_SUCCESS != arm_fir_ols_init_f32(&ols, numTaps, s_Coeffs, s_OlsCoeffs,
+                                                 s_OlsState, partSize))
+    {
+        printf("check %4u taps, part %4u: init failed\n", (unsigned)numTaps, (unsigned)partSize);
+        return 1u;
+    }
+
+    //a partial block is refused before it touches the state, which the
+    //stream below would show
+    if (ARM_MATH_LENGTH_ERROR != arm_fir_ols_f32(&ols, s_In, s_Ref, partSize + 1u, s_OlsScratch))
+    {
+        printf("check %4u taps, part %4u: partial block accepted\n", (unsigned)numTaps,
+               (unsigned)partSize);
+        return 1u;
+    }
+
+    memcpy(s_Out, s_In, sizeof(s_Out));
+    for (i = 0; i < BENCH_STREAM_LEN; i += partSize)
+    {
+        arm_fir_f32(&fir, &s_In[i], &s_Ref[i], partSize);
+        (void)arm_fir_ols_f32(&ols, inPlace ? &s_Out[i] : &s_In[i], &s_Out[i], partSize, s_OlsScratch);
+    }
+
+    for (i = 0; i < BENCH_STREAM_LEN; i++)
+    {
+        err  = fmax(err, fabs((double)s_Ref[i] - s_Out[i]));
+        peak = fmax(peak, fabs((double)s_Ref[i]));
+    }
+
+    printf("check %4u taps, part %4u%s: %.1e of %.2f\n", (unsigned)numTaps, (unsigned)partSize,
+           inPlace ? ", in place" : "", err, peak);
+
+    return (err > 1e-5 * peak) ? 1u : 0u;
+}//end Check
+
+static double Time(uint32_t ols, uint16_t numTaps, uint16_t partSize)
+{
+    BenchPoint_t point;
+
+    point.ols      = ols;
+    point.partSize = partSize;
+    arm_fir_init_f32(&point.fir, numTaps, s_Coeffs, s_FirState, partSize);
+    (void)arm_fir_ols_init_f32(&point.olsInst, numTaps, s_Coeffs, s_OlsCoeffs, s_OlsState, partSize);
+
+    return BenchTime(Step, &point) * 1e9 / BENCH_STREAM_LEN;
+}//end Time
+
+static void Step(void *arg)
+{
+    BenchPoint_t *point = (BenchPoint_t*)arg;
+    uint32_t      i;
+
+    for (i = 0; i < BENCH_STREAM_LEN; i += point->partSize)
+    {
+        if (point->ols)
+        {
+            (void)arm_fir_ols_f32(&point->olsInst, &s_In[i], &s_Out[i], point->partSize, s_OlsScratch);
+        }
+        else
+        {
+            arm_fir_f32(&point->fir, &s_In[i], &s_Out[i], point->partSize);
+        }
+    }
+}//end Step
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,1542 @@
+//! @addtogroup Host
+//! @brief Host implementation of the HAL subset used by the app
+//! @{
+//!
+//****************************************************************************/
+//! @file hal_host.c
+//! @brief Implements the HAL calls made by application/ and sgp30/ on Linux.
+//!        Time is virtual: HAL_Delay() returns at once and only moves the
+//!        clock, so a run is as fast as the code under test allows and
+//!        repeatable. I2C and UART transfers and flash operations take
+//!        their time on the bus or in the array from the clock; the RTC
+//!        wakeup timer fires from it. I2C devices are plugged in per
+//!        address, and faults are injected per peripheral on request.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+//DMA streams the model hands out, in HAL_DMA_Init() order
+#define HOST_DMA_STREAMS   4
+//I2C devices that can be attached to the master bus
+#define HOST_I2C_DEVICES   8
+//RTC clock, the LSI init.c selects
+#define HOST_RTC_HZ        32000u
+//RTC_DR counts years from 2000
+#define HOST_RTC_DAY_S     86400u
+
+//STM32F411xE flash: sectors 0-3 16 KB, 4 64 KB, 5-7 128 KB
+#define HOST_FLASH_SIZE    (512u * 1024u)
+#define HOST_FLASH_SECTORS 8u
+//datasheet typical times at x32 parallelism
+#define HOST_FLASH_WORD_US 16u
+
+typedef struct
+{
+    uint32_t skip;
+    uint32_t count;
+    uint32_t ppm;
+    uint32_t injected;
+}HostFault_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Monotonic wall clock
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Nanoseconds
+//
+static uint64_t NowNs(void);
+
+//
+//! @brief Run the virtual clock forward, raising due RTC wakeups
+//! @param[in]    ns  Nanoseconds
+//! @param[out]   None
+//! @return       None
+//
+static void AdvanceNs(uint64_t ns);
+
+//
+//! @brief Advance to a wakeup time or the RTC wakeup before it, as WFI
+//! @param[in]    wake  Virtual time in ns
+//! @param[out]   None
+//! @return       None
+//
+static void SleepTo(uint64_t wake);
+
+//
+//! @brief RTCCLK ticks in a span of virtual time, and back, with the drift
+//! @param[in]    ns / ticks  Span
+//! @param[out]   None
+//! @return       Ticks / ns, rounded down / up
+//
+static uint64_t RtcTicks(uint64_t ns);
+static uint64_t RtcNs(uint64_t ticks);
+
+//
+//! @brief RTCCLK ticks per ck_spre second, from the handle's prescalers
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Ticks
+//
+static uint64_t RtcSecondTicks(void);
+
+//
+//! @brief Calendar now in seconds since 2000-01-01 00:00:00
+//! @param[in]    None
+//! @param[out]   sub  ck_apre ticks into the second, may be NULL
+//! @return       Seconds
+//
+static uint32_t RtcSeconds(uint32_t *sub);
+
+//
+//! @brief Set the calendar, restarting the prescalers
+//! @param[in]    sec  Seconds since 2000-01-01 00:00:00
+//! @param[out]   None
+//! @return       None
+//
+static void RtcSet(uint32_t sec);
+
+//
+//! @brief Binary to BCD and back
+//
+static uint8_t ToBcd(uint8_t value);
+static uint8_t FromBcd(uint8_t value);
+
+//
+//! @brief Deterministic pseudo random numbers, xorshift32
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Next value
+//
+static uint32_t Random(void);
+
+//
+//! @brief Decide whether an opportunity of a fault fails
+//! @param[in]    fault  Fault
+//! @param[out]   None
+//! @return       1 to inject
+//
+static uint32_t FaultHit(HalHostFault_t fault);
+
+//
+//! @brief Find the device model at an address
+//! @param[in]    address  7-bit address
+//! @param[out]   None
+//! @return       Device or NULL
+//
+static const HalHostI2cDevice_t* I2cFind(uint8_t address);
+
+//
+//! @brief Common part of the I2C master transfers: bus time and faults
+//! @param[in]    hi2c     Handle
+//! @param[in]    count    Data bytes
+//! @param[in]    timeout  Timeout in ms
+//! @param[out]   None
+//! @return       HAL_OK to go ahead, else the injected result
+//
+static HAL_StatusTypeDef I2cBus(I2C_HandleTypeDef *hi2c, uint16_t count,
+                                uint32_t timeout);
+
+//
+//! @brief Slave side of a master read: load the data register from the
+//!        transmit buffer, completing the sequence with its last byte
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+static void I2cSlaveLoad(void);
+
+//
+//! @brief Slave side of a NACK or STOP: end the transfer and listen mode
+//!        the way the HAL interrupt handlers do
+//! @param[in]    nack  1 for a NACK from the master, 0 for a STOP
+//! @param[out]   None
+//! @return       None
+//
+static void I2cSlaveEnd(uint8_t nack);
+
+//
+//! @brief Account one flash operation against an armed power cut
+//! @param[in]    None
+//! @param[out]   None
+//! @return       1 if this operation is the one cut
+//
+static uint32_t FlashCut(void);
+
+//
+//! @brief Fill the memory target in use from the file and complete it
+//! @param[in]    None
+//! @param[out]   None
+//! @return       1 if a block was delivered, 0 at end of file
+//
+static uint32_t FileDeliver(void);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+volatile uint32_t g_HostPrimask = 0;
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static uint64_t s_NowNs     = 0;
+static uint32_t s_UartBytes = 0;
+static uint32_t s_Random    = 1;
+static HostFault_t s_Faults[HAL_HOST_FAULT_COUNT];
+static const char * const s_FaultNames[HAL_HOST_FAULT_COUNT] =
+{
+    "i2c_nack",
+    "i2c_timeout",
+    "i2c_bitflip",
+    "uart_drop",
+    "uart_noise",
+    "dma_error",
+    "flash_prog",
+    "flash_erase",
+};
+static HalHostI2cRead_t  s_I2cRead  = NULL;
+static HalHostI2cWrite_t s_I2cWrite = NULL;
+static const HalHostI2cDevice_t *s_I2cDevices[HOST_I2C_DEVICES];
+//slave bus: the listening handle, what the master addressed, the one byte
+//data register of the slave transmitter
+static I2C_HandleTypeDef *s_I2cSlave       = NULL;
+static uint8_t            s_I2cSlaveDir    = 0;
+static uint8_t            s_I2cSlaveDr     = 0xFF;
+static uint8_t            s_I2cSlaveDrFull = 0;
+//RTC calendar: RTCCLK ticks counted from the last time set; wakeup timer
+//in the same ticks, period 0 when stopped
+static RTC_HandleTypeDef *s_Rtc          = NULL;
+static uint64_t           s_RtcSetNs     = 0;
+static uint32_t           s_RtcSetSec    = 0;
+static uint32_t           s_RtcCounter   = 0;
+static uint64_t           s_RtcPeriod    = 0;
+static uint64_t           s_RtcDue       = 0;
+static uint64_t           s_RtcDueNs     = 0;
+static int32_t            s_RtcDriftPpm  = 0;
+
+//Register blocks the handles point to instead of the peripheral addresses,
+//so the HAL register macros work on the host
+static USART_TypeDef      s_Usart;
+static DMA_Stream_TypeDef s_DmaStreams[HOST_DMA_STREAMS];
+static uint32_t           s_DmaStreamCount = 0;
+
+//double buffer file feed
+static DMA_HandleTypeDef *s_FileDma     = NULL;
+static void              *s_FileTarget[2];
+static FILE              *s_File        = NULL;
+static uint64_t           s_FileBlockNs = 0;
+static uint64_t           s_FileDueNs   = 0;
+//flash model
+static uint8_t             s_Flash[HOST_FLASH_SIZE];
+static uint8_t             s_FlashReady  = 0;
+static uint8_t             s_FlashLocked = 1;
+static uint8_t             s_FlashDead   = 0;
+static uint8_t             s_FlashCut    = 0;
+static uint32_t            s_FlashCutIn  = UINT32_MAX;
+static HalHostFlashStats_t s_FlashStats;
+static const uint32_t      s_FlashSectorKb[HOST_FLASH_SECTORS] = {16, 16, 16, 16, 64, 128, 128, 128};
+static const uint32_t      s_FlashEraseMs[HOST_FLASH_SECTORS]  = {250, 250, 250, 250, 550, 1000, 1000, 1000};
+static UART_HandleTypeDef *s_RxUart = NULL;
+static uint16_t           s_RxPos   = 0;
+static HalHostIrq_t       s_UartIrq = NULL;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void HalHostSetI2cDevice(HalHostI2cRead_t read, HalHostI2cWrite_t write)
+{
+    s_I2cRead  = read;
+    s_I2cWrite = write;
+}//end HalHostSetI2cDevice
+
+int HalHostI2cAttach(const HalHostI2cDevice_t *device)
+{
+    uint32_t i;
+
+    if (NULL != I2cFind(device->address))
+    {
+        return -1;
+    }
+
+    for (i = 0; i < HOST_I2C_DEVICES; i++)
+    {
+        if (NULL == s_I2cDevices[i])
+        {
+            s_I2cDevices[i] = device;
+            return 0;
+        }
+    }
+
+    return -1;
+}//end HalHostI2cAttach
+
+void HalHostSetTick(uint32_t tick)
+{
+    uint64_t ns = (uint64_t)tick * 1000000u;
+
+    if (ns > s_NowNs)
+    {
+        AdvanceNs(ns - s_NowNs);
+    }
+}//end HalHostSetTick
+
+uint64_t HalHostMicros(void)
+{
+    return s_NowNs / 1000u;
+}//end HalHostMicros
+
+void HalHostAdvanceUs(uint64_t us)
+{
+    AdvanceNs(us * 1000u);
+}//end HalHostAdvanceUs
+
+void HalHostSleepUs(uint64_t us)
+{
+    SleepTo(s_NowNs + us * 1000u);
+}//end HalHostSleepUs
+
+void HalHostRtcSetDrift(int32_t ppm)
+{
+    s_RtcDriftPpm = ppm;
+}//end HalHostRtcSetDrift
+
+void HalHostFaultSeed(uint32_t seed)
+{
+    s_Random = (0u == seed) ? 1u : seed;
+}//end HalHostFaultSeed
+
+void HalHostFaultAfter(HalHostFault_t fault, uint32_t skip, uint32_t count)
+{
+    s_Faults[fault].skip  = skip;
+    s_Faults[fault].count = count;
+}//end HalHostFaultAfter
+
+void HalHostFaultRate(HalHostFault_t fault, uint32_t ppm)
+{
+    s_Faults[fault].ppm = ppm;
+}//end HalHostFaultRate
+
+uint32_t HalHostFaultCount(HalHostFault_t fault)
+{
+    return s_Faults[fault].injected;
+}//end HalHostFaultCount
+
+const char* HalHostFaultName(HalHostFault_t fault)
+{
+    return s_FaultNames[fault];
+}//end HalHostFaultName
+
+uint32_t HalHostUartBytes(void)
+{
+    return s_UartBytes;
+}//end HalHostUartBytes
+
+void HalHostSetUartIrq(HalHostIrq_t irq)
+{
+    s_UartIrq = irq;
+}//end HalHostSetUartIrq
+
+uint32_t HalHostUartRxFeed(const uint8_t *data, uint32_t count)
+{
+    uint32_t done = 0;
+
+    if ((NULL == s_RxUart) || (NULL == s_RxUart->hdmarx))
+    {
+        return 0;
+    }
+
+    while (done < count)
+    {
+        uint16_t size = s_RxUart->RxXferSize;
+        uint16_t half = size / 2u;
+        //stop at the next half/complete event so the callbacks see it
+        uint16_t stop = (s_RxPos < half) ? half : size;
+        uint32_t n    = stop - s_RxPos;
+
+        if (n > count - done)
+        {
+            n = count - done;
+        }
+
+        if ((0u == s_Faults[HAL_HOST_FAULT_UART_DROP].count) &&
+            (0u == s_Faults[HAL_HOST_FAULT_UART_DROP].ppm) &&
+            (0u == s_Faults[HAL_HOST_FAULT_UART_NOISE].count) &&
+            (0u == s_Faults[HAL_HOST_FAULT_UART_NOISE].ppm))
+        {
+            memcpy(&s_RxUart->pRxBuffPtr[s_RxPos], &data[done], n);
+            s_RxPos += (uint16_t)n;
+            done    += n;
+        }
+        else
+        {
+            //a byte at a time so each one can be hit
+            uint8_t byte = data[done++];
+
+            if (FaultHit(HAL_HOST_FAULT_UART_DROP))
+            {
+                continue;
+            }
+            if (FaultHit(HAL_HOST_FAULT_UART_NOISE))
+            {
+                byte     ^= (uint8_t)(1u << (Random() & 7u));
+                s_Usart.SR |= USART_SR_NE;
+            }
+            s_RxUart->pRxBuffPtr[s_RxPos++] = byte;
+        }
+        s_RxUart->hdmarx->Instance->NDTR = (uint32_t)(size - s_RxPos);
+
+        if (s_RxPos == half)
+        {
+            HAL_UART_RxHalfCpltCallback(s_RxUart);
+        }
+        else if (s_RxPos == size)
+        {
+            s_RxPos          = 0;
+            s_RxUart->hdmarx->Instance->NDTR = size;
+            HAL_UART_RxCpltCallback(s_RxUart);
+        }
+    }
+
+    return done;
+}//end HalHostUartRxFeed
+
+void HalHostUartRxIdle(void)
+{
+    s_Usart.SR |= USART_SR_IDLE;
+    if (NULL != s_UartIrq)
+    {
+        s_UartIrq();
+    }
+    s_Usart.SR &= ~(USART_SR_IDLE | USART_SR_NE);
+}//end HalHostUartRxIdle
+
+uint8_t* HalHostFlash(uint32_t address)
+{
+    if ((address < FLASH_BASE) || (address - FLASH_BASE >= HOST_FLASH_SIZE))
+    {
+        return NULL;
+    }
+
+    if (0 == s_FlashReady)
+    {
+        memset(s_Flash, 0xFF, sizeof(s_Flash));
+        s_FlashReady = 1;
+    }
+
+    return &s_Flash[address - FLASH_BASE];
+}//end HalHostFlash
+
+void HalHostFlashCutAfter(uint32_t ops)
+{
+    s_FlashCutIn = ops;
+    s_FlashCut   = 0;
+}//end HalHostFlashCutAfter
+
+uint32_t HalHostFlashPowerOn(void)
+{
+    uint32_t cut = s_FlashCut;
+
+    s_FlashCutIn  = UINT32_MAX;
+    s_FlashCut    = 0;
+    s_FlashDead   = 0;
+    s_FlashLocked = 1;
+
+    return cut;
+}//end HalHostFlashPowerOn
+
+void HalHostFlashGetStats(HalHostFlashStats_t *stats)
+{
+    *stats = s_FlashStats;
+}//end HalHostFlashGetStats
+
+void HostWaitForInterrupt(void)
+{
+    //sleep to the next 1 ms tick or RTC wakeup, whichever comes first
+    SleepTo((s_NowNs / 1000000u + 1u) * 1000000u);
+}
+
+HAL_StatusTypeDef HAL_Init(void)
+{
+    return HAL_OK;
+}
+
+void HAL_IncTick(void)
+{
+    AdvanceNs(1000000u);
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(s_NowNs / 1000000u);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    AdvanceNs((uint64_t)Delay * 1000000u);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+    (void)IRQn;
+    (void)PreemptPriority;
+    (void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    (void)IRQn;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    (void)IRQn;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+    (void)GPIOx;
+    (void)GPIO_Init;
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+    (void)GPIOx;
+    (void)GPIO_Pin;
+}
+
+void HalHostDmaSetTargets(DMA_HandleTypeDef *hdma, void *buf0, void *buf1)
+{
+    s_FileDma       = hdma;
+    s_FileTarget[0] = buf0;
+    s_FileTarget[1] = buf1;
+}//end HalHostDmaSetTargets
+
+int HalHostDmaFileOpen(DMA_HandleTypeDef *hdma, const char *path,
+                       uint32_t bytes_per_s)
+{
+    uint32_t width = (DMA_MDATAALIGN_WORD == hdma->Init.MemDataAlignment) ? 4u :
+                     (DMA_MDATAALIGN_HALFWORD == hdma->Init.MemDataAlignment) ? 2u : 1u;
+
+    if (NULL != s_File)
+    {
+        fclose(s_File);
+    }
+
+    s_File = fopen(path, "rb");
+    if (NULL == s_File)
+    {
+        return -1;
+    }
+
+    s_FileDma     = hdma;
+    s_FileBlockNs = (0u == bytes_per_s) ? 0u :
+                    (uint64_t)hdma->Instance->NDTR * width * 1000000000u / bytes_per_s;
+    s_FileDueNs   = NowNs() + s_FileBlockNs;
+
+    return 0;
+}//end HalHostDmaFileOpen
+
+uint32_t HalHostDmaFileStep(void)
+{
+    uint32_t delivered = 0;
+    uint64_t now;
+
+    if ((NULL == s_File) || (NULL == s_FileDma))
+    {
+        return 0;
+    }
+
+    now = NowNs();
+    if (now < s_FileDueNs)
+    {
+        struct timespec ts;
+
+        ts.tv_sec  = (time_t)((s_FileDueNs - now) / 1000000000u);
+        ts.tv_nsec = (long)((s_FileDueNs - now) % 1000000000u);
+        nanosleep(&ts, NULL);
+        now = s_FileDueNs;
+    }
+
+    //a slow consumer finds several blocks due at once, as on target
+    do
+    {
+        if (0 == FileDeliver())
+        {
+            return delivered;
+        }
+        delivered++;
+        s_FileDueNs += s_FileBlockNs;
+    } while ((0 != s_FileBlockNs) && (s_FileDueNs <= now));
+
+    return delivered;
+}//end HalHostDmaFileStep
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
+{
+    huart->Instance = &s_Usart;
+    huart->gState   = HAL_UART_STATE_READY;
+    huart->RxState  = HAL_UART_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData,
+                                    uint16_t Size, uint32_t Timeout)
+{
+    (void)pData;
+    (void)Timeout;
+
+    s_UartBytes += Size;
+
+    //blocking: 10 bit times per byte
+    if (0u != huart->Init.BaudRate)
+    {
+        AdvanceNs((uint64_t)Size * 10u * 1000000000u / huart->Init.BaudRate);
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData,
+                                       uint16_t Size)
+{
+    huart->pRxBuffPtr = pData;
+    huart->RxXferSize = Size;
+    huart->RxState    = HAL_UART_STATE_BUSY_RX;
+    s_RxUart          = huart;
+    s_RxPos           = 0;
+    if (NULL != huart->hdmarx)
+    {
+        huart->hdmarx->Instance->NDTR = Size;
+    }
+
+    return HAL_OK;
+}
+
+void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
+{
+    (void)huart;
+}
+
+__WEAK void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+    (void)huart;
+}
+
+__WEAK void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+    (void)huart;
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
+{
+    if (s_DmaStreamCount >= HOST_DMA_STREAMS)
+    {
+        return HAL_ERROR;
+    }
+
+    hdma->Instance = &s_DmaStreams[s_DmaStreamCount++];
+    hdma->State    = HAL_DMA_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
+                                                uint32_t DstAddress, uint32_t SecondMemAddress,
+                                                uint32_t DataLength)
+{
+    if ((NULL == hdma->XferCpltCallback) || (NULL == hdma->XferM1CpltCallback) ||
+        (NULL == hdma->XferErrorCallback) || (HAL_DMA_STATE_READY != hdma->State))
+    {
+        return HAL_ERROR;
+    }
+
+    hdma->State           = HAL_DMA_STATE_BUSY;
+    hdma->Instance->CR   |= DMA_SxCR_DBM | DMA_SxCR_EN;
+    hdma->Instance->CR   &= ~DMA_SxCR_CT;
+    hdma->Instance->NDTR  = DataLength;
+    hdma->Instance->M1AR  = SecondMemAddress;
+    if (DMA_MEMORY_TO_PERIPH == hdma->Init.Direction)
+    {
+        hdma->Instance->PAR  = DstAddress;
+        hdma->Instance->M0AR = SrcAddress;
+    }
+    else
+    {
+        hdma->Instance->PAR  = SrcAddress;
+        hdma->Instance->M0AR = DstAddress;
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
+{
+    hdma->Instance->CR &= ~(DMA_SxCR_EN | DMA_SxCR_DBM);
+    hdma->State         = HAL_DMA_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
+{
+    hdma->State = HAL_DMA_STATE_RESET;
+
+    return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
+{
+    (void)hdma;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    if (s_FlashDead)
+    {
+        return HAL_ERROR;
+    }
+
+    s_FlashLocked = 0;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+    s_FlashLocked = 1;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+    uint32_t size = 1u << TypeProgram;
+    uint8_t *dst  = HalHostFlash(Address);
+    uint32_t i;
+
+    if (s_FlashDead || s_FlashLocked || (NULL == dst) ||
+        (Address - FLASH_BASE + size > HOST_FLASH_SIZE) || (0 != (Address & (size - 1u))))
+    {
+        return HAL_ERROR;
+    }
+
+    if (FaultHit(HAL_HOST_FAULT_FLASH_PROGRAM))
+    {
+        return HAL_ERROR;
+    }
+
+    //a torn write only gets some of its zero bits in
+    if (FlashCut())
+    {
+        Data |= ((uint64_t)Random() << 32) | (uint64_t)Random();
+    }
+
+    //NOR flash: programming only clears bits
+    for (i = 0; i < size; i++)
+    {
+        dst[i] &= (uint8_t)(Data >> (8u * i));
+    }
+
+    if (s_FlashDead)
+    {
+        return HAL_ERROR;
+    }
+
+    s_FlashStats.programs++;
+    s_FlashStats.bytes   += size;
+    s_FlashStats.busy_us += HOST_FLASH_WORD_US;
+    AdvanceNs(HOST_FLASH_WORD_US * 1000u);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *SectorError)
+{
+    uint32_t sector;
+    uint32_t offset;
+
+    *SectorError = 0xFFFFFFFFU;
+
+    if (s_FlashDead || s_FlashLocked || (FLASH_TYPEERASE_SECTORS != pEraseInit->TypeErase) ||
+        (pEraseInit->Sector + pEraseInit->NbSectors > HOST_FLASH_SECTORS))
+    {
+        return HAL_ERROR;
+    }
+
+    for (sector = pEraseInit->Sector; sector < pEraseInit->Sector + pEraseInit->NbSectors; sector++)
+    {
+        uint32_t size = s_FlashSectorKb[sector] * 1024u;
+        uint32_t i;
+
+        for (offset = 0, i = 0; i < sector; i++)
+        {
+            offset += s_FlashSectorKb[i] * 1024u;
+        }
+
+        if (FaultHit(HAL_HOST_FAULT_FLASH_ERASE))
+        {
+            *SectorError = sector;
+            return HAL_ERROR;
+        }
+
+        if (FlashCut())
+        {
+            memset(HalHostFlash(FLASH_BASE + offset), 0xFF, size / 2u);
+            *SectorError = sector;
+            return HAL_ERROR;
+        }
+
+        memset(HalHostFlash(FLASH_BASE + offset), 0xFF, size);
+        s_FlashStats.erases++;
+        s_FlashStats.busy_us += s_FlashEraseMs[sector] * 1000u;
+        AdvanceNs((uint64_t)s_FlashEraseMs[sector] * 1000000u);
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+    hi2c->State = HAL_I2C_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
+{
+    hi2c->State     = HAL_I2C_STATE_RESET;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+
+    if (hi2c == s_I2cSlave)
+    {
+        s_I2cSlave = NULL;
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress,
+                                          uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    uint8_t                   address = (uint8_t)(DevAddress >> 1);
+    const HalHostI2cDevice_t *device  = I2cFind(address);
+    HAL_StatusTypeDef         ret     = I2cBus(hi2c, Size, Timeout);
+
+    if (HAL_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL != device)
+    {
+        ret = device->write(device->ctx, pData, Size);
+    }
+    else
+    {
+        ret = (NULL != s_I2cWrite) ? s_I2cWrite(address, pData, Size) : HAL_ERROR;
+    }
+
+    hi2c->ErrorCode = (HAL_OK == ret) ? HAL_I2C_ERROR_NONE : HAL_I2C_ERROR_AF;
+
+    return ret;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAddress,
+                                         uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+    uint8_t                   address = (uint8_t)(DevAddress >> 1);
+    const HalHostI2cDevice_t *device  = I2cFind(address);
+    HAL_StatusTypeDef         ret     = I2cBus(hi2c, Size, Timeout);
+
+    if (HAL_OK != ret)
+    {
+        return ret;
+    }
+
+    if (NULL != device)
+    {
+        ret = device->read(device->ctx, pData, Size);
+    }
+    else
+    {
+        ret = (NULL != s_I2cRead) ? s_I2cRead(address, pData, Size) : HAL_ERROR;
+    }
+
+    if ((HAL_OK == ret) && (0u != Size) && FaultHit(HAL_HOST_FAULT_I2C_BITFLIP))
+    {
+        pData[Random() % Size] ^= (uint8_t)(1u << (Random() & 7u));
+    }
+
+    hi2c->ErrorCode = (HAL_OK == ret) ? HAL_I2C_ERROR_NONE : HAL_I2C_ERROR_AF;
+
+    return ret;
+}
+
+HAL_StatusTypeDef HAL_I2C_EnableListen_IT(I2C_HandleTypeDef *hi2c)
+{
+    if (HAL_I2C_STATE_READY != hi2c->State)
+    {
+        return HAL_BUSY;
+    }
+
+    hi2c->State     = HAL_I2C_STATE_LISTEN;
+    hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+    s_I2cSlave      = hi2c;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Transmit_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData,
+                                                uint16_t Size, uint32_t XferOptions)
+{
+    if ((HAL_I2C_STATE_LISTEN != (hi2c->State & HAL_I2C_STATE_LISTEN)) || (NULL == pData) ||
+        (0u == Size))
+    {
+        return HAL_ERROR;
+    }
+
+    //the first byte is loaded by the TXE interrupt, once the callback returns
+    hi2c->State       = HAL_I2C_STATE_BUSY_TX_LISTEN;
+    hi2c->pBuffPtr    = pData;
+    hi2c->XferSize    = Size;
+    hi2c->XferCount   = Size;
+    hi2c->XferOptions = XferOptions;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Slave_Seq_Receive_IT(I2C_HandleTypeDef *hi2c, uint8_t *pData,
+                                               uint16_t Size, uint32_t XferOptions)
+{
+    if ((HAL_I2C_STATE_LISTEN != (hi2c->State & HAL_I2C_STATE_LISTEN)) || (NULL == pData) ||
+        (0u == Size))
+    {
+        return HAL_ERROR;
+    }
+
+    hi2c->State       = HAL_I2C_STATE_BUSY_RX_LISTEN;
+    hi2c->pBuffPtr    = pData;
+    hi2c->XferSize    = Size;
+    hi2c->XferCount   = Size;
+    hi2c->XferOptions = XferOptions;
+
+    return HAL_OK;
+}
+
+__WEAK void HAL_I2C_AddrCallback(I2C_HandleTypeDef *hi2c, uint8_t TransferDirection,
+                                 uint16_t AddrMatchCode)
+{
+    (void)hi2c;
+    (void)TransferDirection;
+    (void)AddrMatchCode;
+}
+
+__WEAK void HAL_I2C_SlaveTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+__WEAK void HAL_I2C_SlaveRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+__WEAK void HAL_I2C_ListenCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+__WEAK void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    (void)hi2c;
+}
+
+HAL_StatusTypeDef HalHostI2cSlaveStart(uint8_t address, uint8_t read)
+{
+    I2C_HandleTypeDef *hi2c = s_I2cSlave;
+
+    //start and address byte
+    AdvanceNs(10u * 1000000000ull / ((NULL != hi2c) ? hi2c->Init.ClockSpeed : 100000u));
+
+    if ((NULL == hi2c) || (address != (uint8_t)(hi2c->Init.OwnAddress1 >> 1)) ||
+        (HAL_I2C_STATE_LISTEN != (hi2c->State & HAL_I2C_STATE_LISTEN)))
+    {
+        return HAL_ERROR;
+    }
+
+    //a repeated start ends a transmit the master left unfinished
+    s_I2cSlaveDir    = read ? 2u : 1u;
+    s_I2cSlaveDrFull = 0;
+    hi2c->State      = HAL_I2C_STATE_LISTEN;
+    HAL_I2C_AddrCallback(hi2c, read ? I2C_DIRECTION_RECEIVE : I2C_DIRECTION_TRANSMIT,
+                         (uint16_t)hi2c->Init.OwnAddress1);
+
+    if (read)
+    {
+        I2cSlaveLoad();
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HalHostI2cSlaveWrite(const uint8_t *data, uint16_t count)
+{
+    I2C_HandleTypeDef *hi2c = s_I2cSlave;
+    uint16_t           i;
+
+    if ((NULL == hi2c) || (1u != s_I2cSlaveDir))
+    {
+        return HAL_ERROR;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        AdvanceNs(9u * 1000000000ull / hi2c->Init.ClockSpeed);
+
+        if ((HAL_I2C_STATE_BUSY_RX_LISTEN != hi2c->State) || (0u == hi2c->XferCount))
+        {
+            return HAL_ERROR;
+        }
+
+        *hi2c->pBuffPtr++ = data[i];
+        hi2c->XferCount--;
+
+        if (0u == hi2c->XferCount)
+        {
+            hi2c->State = HAL_I2C_STATE_LISTEN;
+            HAL_I2C_SlaveRxCpltCallback(hi2c);
+        }
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HalHostI2cSlaveRead(uint8_t *data, uint16_t count, uint8_t nack)
+{
+    I2C_HandleTypeDef *hi2c = s_I2cSlave;
+    uint16_t           i;
+
+    if ((NULL == hi2c) || (2u != s_I2cSlaveDir))
+    {
+        return HAL_ERROR;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        AdvanceNs(9u * 1000000000ull / hi2c->Init.ClockSpeed);
+
+        //the byte moves to the shift register and TXE reloads the data register
+        data[i]          = s_I2cSlaveDrFull ? s_I2cSlaveDr : 0xFF;
+        s_I2cSlaveDrFull = 0;
+        I2cSlaveLoad();
+    }
+
+    if (nack)
+    {
+        s_I2cSlaveDir = 0;
+        I2cSlaveEnd(1);
+    }
+
+    return HAL_OK;
+}
+
+void HalHostI2cSlaveStop(void)
+{
+    //after a NACK the slave has already left the transfer
+    if ((NULL != s_I2cSlave) && (0u != s_I2cSlaveDir))
+    {
+        I2cSlaveEnd(0);
+    }
+
+    s_I2cSlaveDir = 0;
+}
+
+HAL_StatusTypeDef HAL_RTC_Init(RTC_HandleTypeDef *hrtc)
+{
+    s_Rtc       = hrtc;
+    hrtc->State = HAL_RTC_STATE_READY;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_SetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format)
+{
+    uint32_t day = RtcSeconds(NULL) / HOST_RTC_DAY_S;
+    uint32_t h   = sTime->Hours;
+    uint32_t m   = sTime->Minutes;
+    uint32_t sec = sTime->Seconds;
+
+    (void)hrtc;
+
+    if (RTC_FORMAT_BCD == Format)
+    {
+        h   = FromBcd((uint8_t)h);
+        m   = FromBcd((uint8_t)m);
+        sec = FromBcd((uint8_t)sec);
+    }
+
+    RtcSet(day * HOST_RTC_DAY_S + h * 3600u + m * 60u + sec);
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_GetTime(RTC_HandleTypeDef *hrtc, RTC_TimeTypeDef *sTime, uint32_t Format)
+{
+    uint32_t sub;
+    uint32_t sod = RtcSeconds(&sub) % HOST_RTC_DAY_S;
+
+    sTime->Hours          = (uint8_t)(sod / 3600u);
+    sTime->Minutes        = (uint8_t)(sod / 60u % 60u);
+    sTime->Seconds        = (uint8_t)(sod % 60u);
+    sTime->TimeFormat     = RTC_HOURFORMAT12_AM;
+    //SSR counts down from PREDIV_S
+    sTime->SecondFraction = hrtc->Init.SynchPrediv;
+    sTime->SubSeconds     = hrtc->Init.SynchPrediv - sub;
+
+    if (RTC_FORMAT_BCD == Format)
+    {
+        sTime->Hours   = ToBcd(sTime->Hours);
+        sTime->Minutes = ToBcd(sTime->Minutes);
+        sTime->Seconds = ToBcd(sTime->Seconds);
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_SetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format)
+{
+    uint32_t y  = sDate->Year;
+    uint32_t mo = sDate->Month;
+    uint32_t d  = sDate->Date;
+    uint32_t sub;
+    uint32_t now = RtcSeconds(&sub);
+    int32_t  era;
+    uint32_t yoe;
+    uint32_t doy;
+    uint32_t days;
+
+    (void)hrtc;
+
+    if (RTC_FORMAT_BCD == Format)
+    {
+        y  = FromBcd((uint8_t)y);
+        mo = FromBcd((uint8_t)mo);
+        d  = FromBcd((uint8_t)d);
+    }
+
+    //days from civil, March based years; 2000-03-01 is day 60
+    y    = 2000u + y - ((mo <= 2u) ? 1u : 0u);
+    era  = (int32_t)(y / 400u);
+    yoe  = y - (uint32_t)era * 400u;
+    doy  = (153u * (mo + ((mo > 2u) ? (uint32_t)-3 : 9u)) + 2u) / 5u + d - 1u;
+    days = (uint32_t)era * 146097u + yoe * 365u + yoe / 4u - yoe / 100u + doy - 730425u;
+
+    //the time of day and the prescalers carry on
+    s_RtcSetSec += (days - now / HOST_RTC_DAY_S) * HOST_RTC_DAY_S;
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_GetDate(RTC_HandleTypeDef *hrtc, RTC_DateTypeDef *sDate, uint32_t Format)
+{
+    //civil from days, days counted from 2000-03-01
+    uint32_t days = RtcSeconds(NULL) / HOST_RTC_DAY_S;
+    uint32_t z    = days + 730425u;
+    uint32_t era  = z / 146097u;
+    uint32_t doe  = z - era * 146097u;
+    uint32_t yoe  = (doe - doe / 1460u + doe / 36524u - doe / 146096u) / 365u;
+    uint32_t doy  = doe - (365u * yoe + yoe / 4u - yoe / 100u);
+    uint32_t mp   = (5u * doy + 2u) / 153u;
+    uint32_t mo   = (mp < 10u) ? mp + 3u : mp - 9u;
+    uint32_t y    = yoe + era * 400u + ((mo <= 2u) ? 1u : 0u);
+
+    (void)hrtc;
+
+    sDate->Year    = (uint8_t)(y - 2000u);
+    sDate->Month   = (uint8_t)mo;
+    sDate->Date    = (uint8_t)(doy - (153u * mp + 2u) / 5u + 1u);
+    //2000-01-01 was a Saturday, RTC_WEEKDAY_MONDAY is 1
+    sDate->WeekDay = (uint8_t)((days + 5u) % 7u + 1u);
+
+    if (RTC_FORMAT_BCD == Format)
+    {
+        sDate->Year  = ToBcd(sDate->Year);
+        sDate->Month = ToBcd(sDate->Month);
+        sDate->Date  = ToBcd(sDate->Date);
+    }
+
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTCEx_SetWakeUpTimer_IT(RTC_HandleTypeDef *hrtc, uint32_t WakeUpCounter,
+                                              uint32_t WakeUpClock)
+{
+    //RTCCLK/16../2, or the 1 Hz ck_spre with bit 16 of the count in bit 1
+    static const uint32_t div[4] = {16u, 8u, 4u, 2u};
+    uint64_t count = (uint64_t)WakeUpCounter + 1u;
+    uint64_t now;
+
+    s_Rtc        = hrtc;
+    s_RtcCounter = WakeUpCounter;
+    now          = RtcTicks(s_NowNs - s_RtcSetNs);
+
+    if (WakeUpClock & RTC_WAKEUPCLOCK_CK_SPRE_16BITS)
+    {
+        //counts ck_spre edges, which fall where the seconds roll over
+        count      += (WakeUpClock & 0x2u) ? 0x10000u : 0u;
+        s_RtcPeriod = count * RtcSecondTicks();
+        s_RtcDue    = (now / RtcSecondTicks() + count) * RtcSecondTicks();
+    }
+    else
+    {
+        s_RtcPeriod = count * div[WakeUpClock & 3u];
+        s_RtcDue    = now + s_RtcPeriod;
+    }
+
+    s_RtcDueNs  = s_RtcSetNs + RtcNs(s_RtcDue);
+    hrtc->State = HAL_RTC_STATE_READY;
+
+    return HAL_OK;
+}
+
+uint32_t HAL_RTCEx_DeactivateWakeUpTimer(RTC_HandleTypeDef *hrtc)
+{
+    (void)hrtc;
+
+    s_RtcPeriod = 0;
+
+    return HAL_OK;
+}
+
+uint32_t HAL_RTCEx_GetWakeUpTimer(RTC_HandleTypeDef *hrtc)
+{
+    (void)hrtc;
+
+    return s_RtcCounter;
+}
+
+void HAL_RTCEx_WakeUpTimerIRQHandler(RTC_HandleTypeDef *hrtc)
+{
+    HAL_RTCEx_WakeUpTimerEventCallback(hrtc);
+    hrtc->State = HAL_RTC_STATE_READY;
+}
+
+__WEAK void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
+{
+    (void)hrtc;
+}
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static void AdvanceNs(uint64_t ns)
+{
+    uint64_t end = s_NowNs + ns;
+
+    //a wakeup that fell due while interrupts were masked is raised late,
+    //missed periods collapse into one as the WUTF flag does
+    while ((0u != s_RtcPeriod) && (s_RtcDueNs <= end) && (0u == g_HostPrimask))
+    {
+        if (s_RtcDueNs > s_NowNs)
+        {
+            s_NowNs = s_RtcDueNs;
+        }
+        while (s_RtcDueNs <= s_NowNs)
+        {
+            s_RtcDue  += s_RtcPeriod;
+            s_RtcDueNs = s_RtcSetNs + RtcNs(s_RtcDue);
+        }
+
+        if (NULL != s_Rtc)
+        {
+            HAL_RTCEx_WakeUpTimerIRQHandler(s_Rtc);
+        }
+    }
+
+    //the handler may have moved the clock on itself
+    if (end > s_NowNs)
+    {
+        s_NowNs = end;
+    }
+}//end AdvanceNs
+
+static void SleepTo(uint64_t wake)
+{
+    if ((0u != s_RtcPeriod) && (s_RtcDueNs > s_NowNs) && (s_RtcDueNs < wake))
+    {
+        wake = s_RtcDueNs;
+    }
+
+    AdvanceNs(wake - s_NowNs);
+}//end SleepTo
+
+static uint64_t RtcTicks(uint64_t ns)
+{
+    //a fast clock fits more ticks in the same time
+    return (uint64_t)((unsigned __int128)ns * HOST_RTC_HZ * (uint64_t)(1000000 + s_RtcDriftPpm) /
+                      1000000000000000u);
+}//end RtcTicks
+
+static uint64_t RtcNs(uint64_t ticks)
+{
+    uint64_t den = (uint64_t)HOST_RTC_HZ * (uint64_t)(1000000 + s_RtcDriftPpm);
+
+    return (uint64_t)(((unsigned __int128)ticks * 1000000000000000u + den - 1u) / den);
+}//end RtcNs
+
+static uint64_t RtcSecondTicks(void)
+{
+    if ((NULL == s_Rtc) || (0u == s_Rtc->Init.SynchPrediv))
+    {
+        return HOST_RTC_HZ;
+    }
+
+    return ((uint64_t)s_Rtc->Init.AsynchPrediv + 1u) * ((uint64_t)s_Rtc->Init.SynchPrediv + 1u);
+}//end RtcSecondTicks
+
+static uint32_t RtcSeconds(uint32_t *sub)
+{
+    uint64_t ticks = RtcTicks(s_NowNs - s_RtcSetNs);
+    uint64_t apre  = (NULL != s_Rtc) ? (uint64_t)s_Rtc->Init.AsynchPrediv + 1u : 1u;
+
+    if (NULL != sub)
+    {
+        *sub = (uint32_t)((ticks % RtcSecondTicks()) / apre);
+    }
+
+    return s_RtcSetSec + (uint32_t)(ticks / RtcSecondTicks());
+}//end RtcSeconds
+
+static void RtcSet(uint32_t sec)
+{
+    s_RtcSetSec = sec;
+    s_RtcSetNs  = s_NowNs;
+
+    //the wakeup timer keeps its time left, now against the new count
+    if (0u != s_RtcPeriod)
+    {
+        s_RtcDue   = RtcTicks(s_RtcDueNs - s_RtcSetNs);
+        s_RtcDueNs = s_RtcSetNs + RtcNs(s_RtcDue);
+    }
+}//end RtcSet
+
+static uint8_t ToBcd(uint8_t value)
+{
+    return (uint8_t)(((value / 10u) << 4) | (value % 10u));
+}//end ToBcd
+
+static uint8_t FromBcd(uint8_t value)
+{
+    return (uint8_t)((value >> 4) * 10u + (value & 0x0Fu));
+}//end FromBcd
+
+static uint32_t Random(void)
+{
+    s_Random ^= s_Random << 13;
+    s_Random ^= s_Random >> 17;
+    s_Random ^= s_Random << 5;
+
+    return s_Random;
+}//end Random
+
+static uint32_t FaultHit(HalHostFault_t fault)
+{
+    HostFault_t *f   = &s_Faults[fault];
+    uint32_t     hit = 0;
+
+    if (0u != f->count)
+    {
+        if (0u != f->skip)
+        {
+            f->skip--;
+        }
+        else
+        {
+            f->count--;
+            hit = 1;
+        }
+    }
+
+    if ((0u == hit) && (0u != f->ppm) && ((Random() % 1000000u) < f->ppm))
+    {
+        hit = 1;
+    }
+
+    f->injected += hit;
+
+    return hit;
+}//end FaultHit
+
+static const HalHostI2cDevice_t* I2cFind(uint8_t address)
+{
+    uint32_t i;
+
+    for (i = 0; i < HOST_I2C_DEVICES; i++)
+    {
+        if ((NULL != s_I2cDevices[i]) && (address == s_I2cDevices[i]->address))
+        {
+            return s_I2cDevices[i];
+        }
+    }
+
+    return NULL;
+}//end I2cFind
+
+static HAL_StatusTypeDef I2cBus(I2C_HandleTypeDef *hi2c, uint16_t count,
+                                uint32_t timeout)
+{
+    uint32_t speed = (0u != hi2c->Init.ClockSpeed) ? hi2c->Init.ClockSpeed : 100000u;
+
+    if (FaultHit(HAL_HOST_FAULT_I2C_TIMEOUT))
+    {
+        hi2c->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+        AdvanceNs((uint64_t)timeout * 1000000u);
+        return HAL_TIMEOUT;
+    }
+
+    //start, address and data bytes of 9 clocks each, stop
+    AdvanceNs(((uint64_t)count + 1u) * 9u * 1000000000u / speed);
+
+    if (FaultHit(HAL_HOST_FAULT_I2C_NACK))
+    {
+        hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+        return HAL_ERROR;
+    }
+
+    return HAL_OK;
+}//end I2cBus
+
+static void I2cSlaveLoad(void)
+{
+    I2C_HandleTypeDef *hi2c = s_I2cSlave;
+
+    if ((HAL_I2C_STATE_BUSY_TX_LISTEN != hi2c->State) || (0u == hi2c->XferCount))
+    {
+        return;
+    }
+
+    s_I2cSlaveDr     = *hi2c->pBuffPtr++;
+    s_I2cSlaveDrFull = 1;
+    hi2c->XferCount--;
+
+    if (0u == hi2c->XferCount)
+    {
+        hi2c->State = HAL_I2C_STATE_LISTEN;
+        HAL_I2C_SlaveTxCpltCallback(hi2c);
+    }
+}//end I2cSlaveLoad
+
+static void I2cSlaveEnd(uint8_t nack)
+{
+    I2C_HandleTypeDef *hi2c = s_I2cSlave;
+
+    s_I2cSlaveDrFull = 0;
+
+    if (HAL_I2C_STATE_LISTEN != (hi2c->State & HAL_I2C_STATE_LISTEN))
+    {
+        return;
+    }
+
+    //a NACK before the buffer is used up is an acknowledge failure
+    if (nack && (HAL_I2C_STATE_BUSY_TX_LISTEN == hi2c->State))
+    {
+        hi2c->ErrorCode |= HAL_I2C_ERROR_AF;
+        hi2c->State      = HAL_I2C_STATE_LISTEN;
+        HAL_I2C_ErrorCallback(hi2c);
+    }
+
+    hi2c->State = HAL_I2C_STATE_READY;
+    HAL_I2C_ListenCpltCallback(hi2c);
+}//end I2cSlaveEnd
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}//end NowNs
+
+static uint32_t FlashCut(void)
+{
+    if (UINT32_MAX == s_FlashCutIn)
+    {
+        return 0;
+    }
+
+    if (0 != s_FlashCutIn)
+    {
+        s_FlashCutIn--;
+        return 0;
+    }
+
+    s_FlashCutIn = UINT32_MAX;
+    s_FlashCut   = 1;
+    s_FlashDead  = 1;
+
+    return 1;
+}//end FlashCut
+
+static uint32_t FileDeliver(void)
+{
+    DMA_HandleTypeDef *hdma  = s_FileDma;
+    uint32_t           width = (DMA_MDATAALIGN_WORD == hdma->Init.MemDataAlignment) ? 4u :
+                               (DMA_MDATAALIGN_HALFWORD == hdma->Init.MemDataAlignment) ? 2u : 1u;
+    uint32_t           done  = (hdma->Instance->CR & DMA_SxCR_CT) ? 1u : 0u;
+    size_t             size  = (size_t)hdma->Instance->NDTR * width;
+
+    if ((HAL_DMA_STATE_BUSY != hdma->State) ||
+        (fread(s_FileTarget[done], 1, size, s_File) != size))
+    {
+        return 0;
+    }
+
+    //a transfer error disables the stream
+    if (FaultHit(HAL_HOST_FAULT_DMA_ERROR))
+    {
+        hdma->Instance->CR &= ~DMA_SxCR_EN;
+        hdma->ErrorCode     = HAL_DMA_ERROR_TE;
+        hdma->State         = HAL_DMA_STATE_READY;
+        hdma->XferErrorCallback(hdma);
+        return 0;
+    }
+
+    //the stream switches target, then the finished one is reported
+    hdma->Instance->CR ^= DMA_SxCR_CT;
+    if (0u == done)
+    {
+        hdma->XferCpltCallback(hdma);
+    }
+    else
+    {
+        hdma->XferM1CpltCallback(hdma);
+    }
+
+    return 1;
+}//end FileDeliver
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,324 @@
+//! @addtogroup Host
+//! @{
+//
+//****************************************************************************
+//! @file hal_host.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the host implementation of the HAL subset used by the app
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef HAL_HOST_H
+#define HAL_HOST_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+#include "stm32f4xx_hal.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//I2C master transfer handlers, address is the 7-bit device address
+typedef HAL_StatusTypeDef (*HalHostI2cRead_t)(uint8_t address, uint8_t *data,
+                                              uint16_t count);
+typedef HAL_StatusTypeDef (*HalHostI2cWrite_t)(uint8_t address, const uint8_t *data,
+                                               uint16_t count);
+//Peripheral interrupt handler the model raises, e.g. UARTRxIrqHandler
+typedef void (*HalHostIrq_t)(void);
+
+//
+//! @brief I2C device model on the master bus. A handler returns HAL_OK if
+//!        the device acknowledges, HAL_ERROR for a NACK.
+//
+typedef struct
+{
+    uint8_t             address;   //!< 7-bit address
+    HAL_StatusTypeDef (*read)(void *ctx, uint8_t *data, uint16_t count);
+    HAL_StatusTypeDef (*write)(void *ctx, const uint8_t *data, uint16_t count);
+    void               *ctx;
+}HalHostI2cDevice_t;
+
+//Faults the model can inject, each at its own opportunities
+typedef enum
+{
+    HAL_HOST_FAULT_I2C_NACK = 0,    //!< master transfer not acknowledged
+    HAL_HOST_FAULT_I2C_TIMEOUT,     //!< bus stuck, HAL_TIMEOUT after Timeout ms
+    HAL_HOST_FAULT_I2C_BITFLIP,     //!< one bit of a master read flipped
+    HAL_HOST_FAULT_UART_DROP,       //!< received byte lost
+    HAL_HOST_FAULT_UART_NOISE,      //!< received byte with a bit flipped, SR.NE
+    HAL_HOST_FAULT_DMA_ERROR,       //!< transfer error on a file fed block
+    HAL_HOST_FAULT_FLASH_PROGRAM,   //!< program refused, nothing written
+    HAL_HOST_FAULT_FLASH_ERASE,     //!< erase refused, sector unchanged
+    HAL_HOST_FAULT_COUNT
+}HalHostFault_t;
+
+typedef struct
+{
+    uint32_t programs;   //!< HAL_FLASH_Program() calls that succeeded
+    uint32_t bytes;      //!< bytes programmed
+    uint32_t erases;     //!< sectors erased
+    uint64_t busy_us;    //!< time the flash would have been busy, datasheet
+                         //!< typical figures at x32 parallelism
+}HalHostFlashStats_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Route I2C master transfers to addresses without an attached
+//!        device to one implementation, e.g. a trace replay
+//! @param[in]    read   Called for HAL_I2C_Master_Receive
+//! @param[in]    write  Called for HAL_I2C_Master_Transmit
+//! @param[out]   None
+//! @return       None
+//
+void HalHostSetI2cDevice(HalHostI2cRead_t read, HalHostI2cWrite_t write);
+
+//
+//! @brief Plug a device model onto the I2C master bus. The structure is
+//!        kept, not copied. A transfer also moves the virtual clock by its
+//!        time on the bus at the handle's ClockSpeed.
+//! @param[in]    device  Device
+//! @param[out]   None
+//! @return       0, or -1 if the bus is full or the address taken
+//
+int HalHostI2cAttach(const HalHostI2cDevice_t *device);
+
+//
+//! @brief Master on the slave bus: START, or repeated START, and address.
+//!        The slave handle that called HAL_I2C_EnableListen_IT() with this
+//!        own address gets HAL_I2C_AddrCallback() from the model, as from
+//!        its event interrupt. Call from the main context, between app
+//!        calls, never from a callback.
+//! @param[in]    address  7-bit slave address
+//! @param[in]    read     1 for a master read, 0 for a master write
+//! @param[out]   None
+//! @return       HAL_OK if the slave acknowledges, HAL_ERROR for a NACK
+//
+HAL_StatusTypeDef HalHostI2cSlaveStart(uint8_t address, uint8_t read);
+
+//
+//! @brief Master on the slave bus: write bytes after HalHostI2cSlaveStart()
+//!        with read 0. Bytes go into the buffer of the running
+//!        HAL_I2C_Slave_Seq_Receive_IT(), with HAL_I2C_SlaveRxCpltCallback()
+//!        when it is full. With no buffer the slave does not acknowledge.
+//! @param[in]    data   Bytes
+//! @param[in]    count  Number of bytes
+//! @param[out]   None
+//! @return       HAL_OK if every byte is acknowledged, HAL_ERROR at the
+//!               first NACK, the rest are not sent
+//
+HAL_StatusTypeDef HalHostI2cSlaveWrite(const uint8_t *data, uint16_t count);
+
+//
+//! @brief Master on the slave bus: read bytes after HalHostI2cSlaveStart()
+//!        with read 1, from the buffer of the running
+//!        HAL_I2C_Slave_Seq_Transmit_IT(). The data register is reloaded as
+//!        each byte starts, so the slave takes one byte more than the
+//!        master reads, as the peripheral does. HAL_I2C_SlaveTxCpltCallback()
+//!        comes when the last byte is loaded; past the end of the buffer the
+//!        slave releases SDA and the master reads 0xFF. A NACK on the last
+//!        byte ends the transfer: HAL_I2C_ListenCpltCallback() if the buffer
+//!        was used up, else HAL_I2C_ErrorCallback() with HAL_I2C_ERROR_AF
+//!        first, as the HAL does.
+//! @param[in]    count  Number of bytes
+//! @param[in]    nack   1 to NACK the last byte, 0 to acknowledge it and
+//!                      read on with another call
+//! @param[out]   data   Bytes read
+//! @return       HAL_OK, or HAL_ERROR if no read is addressed
+//
+HAL_StatusTypeDef HalHostI2cSlaveRead(uint8_t *data, uint16_t count, uint8_t nack);
+
+//
+//! @brief Master on the slave bus: STOP. A slave still in the transfer,
+//!        not NACKed, gets HAL_I2C_ListenCpltCallback() and leaves listen
+//!        mode.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void HalHostI2cSlaveStop(void);
+
+//
+//! @brief Move the virtual clock forward, never backwards
+//! @param[in]    tick  New HAL_GetTick() value in ms
+//! @param[out]   None
+//! @return       None
+//
+void HalHostSetTick(uint32_t tick);
+
+//
+//! @brief Virtual time. It only moves through HAL_Delay(), WFI, bus and
+//!        flash operations and the calls below, so runs are repeatable.
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Microseconds since start
+//
+uint64_t HalHostMicros(void);
+
+//
+//! @brief Move the virtual clock forward, raising the RTC wakeups that fall
+//!        due on the way, each at its own time
+//! @param[in]    us  Microseconds
+//! @param[out]   None
+//! @return       None
+//
+void HalHostAdvanceUs(uint64_t us);
+
+//
+//! @brief WFI with a wakeup armed: move the virtual clock to the wakeup or
+//!        to the next RTC wakeup interrupt, whichever comes first
+//! @param[in]    us  Time to the armed wakeup in us
+//! @param[out]   None
+//! @return       None
+//
+void HalHostSleepUs(uint64_t us);
+
+//
+//! @brief Skew the RTC clock against the virtual clock, as an LSI or LSE
+//!        off its nominal frequency. Set it before the calendar.
+//! @param[in]    ppm  Parts per million, positive runs fast
+//! @param[out]   None
+//! @return       None
+//
+void HalHostRtcSetDrift(int32_t ppm);
+
+//
+//! @brief Seed the generator behind fault rates and torn bits
+//! @param[in]    seed  Any value but 0
+//! @param[out]   None
+//! @return       None
+//
+void HalHostFaultSeed(uint32_t seed);
+
+//
+//! @brief Inject a fault at the next opportunities: let skip through, then
+//!        fail count in a row
+//! @param[in]    fault  Fault
+//! @param[in]    skip   Opportunities let through first
+//! @param[in]    count  Opportunities failed after that
+//! @param[out]   None
+//! @return       None
+//
+void HalHostFaultAfter(HalHostFault_t fault, uint32_t skip, uint32_t count);
+
+//
+//! @brief Inject a fault at random, on top of HalHostFaultAfter()
+//! @param[in]    fault  Fault
+//! @param[in]    ppm    Chance per opportunity in parts per million, 0 off
+//! @param[out]   None
+//! @return       None
+//
+void HalHostFaultRate(HalHostFault_t fault, uint32_t ppm);
+
+//
+//! @brief Number of times a fault was injected
+//! @param[in]    fault  Fault
+//! @param[out]   None
+//! @return       Count since start
+//
+uint32_t HalHostFaultCount(HalHostFault_t fault);
+
+//
+//! @brief Name of a fault for reports
+//! @param[in]    fault  Fault
+//! @param[out]   None
+//! @return       Name
+//
+const char* HalHostFaultName(HalHostFault_t fault);
+
+//
+//! @brief Number of bytes sent through HAL_UART_Transmit so far
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Byte count
+//
+uint32_t HalHostUartBytes(void);
+
+//! @brief Set the handler run for USART interrupts raised by the model
+//! @param[in]    irq  Handler, e.g. UARTRxIrqHandler
+//! @param[out]   None
+//! @return       None
+void HalHostSetUartIrq(HalHostIrq_t irq);
+
+//! @brief Receive bytes on the UART as the RX DMA stream would: written at
+//!        the stream position, NDTR counted down, half/complete callbacks
+//!        raised, wrapping in circular mode
+//! @param[in]    data   Received bytes
+//! @param[in]    count  Number of bytes
+//! @param[out]   None
+//! @return       Bytes accepted, 0 if no DMA reception is running
+uint32_t HalHostUartRxFeed(const uint8_t *data, uint32_t count);
+
+//! @brief Signal an idle line: sets USART SR.IDLE and raises the interrupt
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+void HalHostUartRxIdle(void);
+
+//! @brief Tell the model where the double buffer targets of a stream are.
+//!        M0AR/M1AR only hold 32 bits, host pointers do not fit.
+//! @param[in]    hdma  Handle started with HAL_DMAEx_MultiBufferStart_IT
+//! @param[in]    buf0  Memory target 0
+//! @param[in]    buf1  Memory target 1
+//! @param[out]   None
+//! @return       None
+void HalHostDmaSetTargets(DMA_HandleTypeDef *hdma, void *buf0, void *buf1);
+
+//! @brief Feed a double buffered peripheral to memory stream from a file
+//! @param[in]    hdma         Stream to feed
+//! @param[in]    path         Raw sample file
+//! @param[in]    bytes_per_s  Delivery rate in wall clock time, 0 for as
+//!                            fast as HalHostDmaFileStep() is called
+//! @param[out]   None
+//! @return       0 on success, -1 if the file cannot be opened
+int HalHostDmaFileOpen(DMA_HandleTypeDef *hdma, const char *path,
+                       uint32_t bytes_per_s);
+
+//! @brief Deliver every block that is due: wait for the next one, then fill
+//!        the memory target in use, flip CT and raise its complete callback
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Blocks delivered, 0 at end of file
+uint32_t HalHostDmaFileStep(void);
+
+//! @brief Host address of a location in the modelled flash. The model
+//!        holds the whole 512 KB at FLASH_BASE, erased at start.
+//! @param[in]    address  Target flash address
+//! @param[out]   None
+//! @return       Pointer into the model, NULL outside the flash
+uint8_t* HalHostFlash(uint32_t address);
+
+//! @brief Arm a power cut: after ops more successful program or erase
+//!        calls, the next one is torn (a program clears only some of its
+//!        bits, an erase clears only the first half of the sector) and
+//!        every flash call fails until HalHostFlashPowerOn()
+//! @param[in]    ops  Operations to let through
+//! @param[out]   None
+//! @return       None
+void HalHostFlashCutAfter(uint32_t ops);
+
+//! @brief Restore power after a cut, flash contents are kept
+//! @param[in]    None
+//! @param[out]   None
+//! @return       1 if a cut happened since it was armed
+uint32_t HalHostFlashPowerOn(void);
+
+//! @brief Get flash operation counters
+//! @param[in]    None
+//! @param[out]   stats  Counters since start
+//! @return       None
+void HalHostFlashGetStats(HalHostFlashStats_t *stats);
+
+#endif // HAL_HOST_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
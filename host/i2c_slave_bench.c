@@ -0,0 +1,440 @@
+//! @addtogroup Host
+//! @brief I2C slave register map test
+//! @{
+//!
+//****************************************************************************/
+//! @file i2c_slave_bench.c
+//! @brief Plays the host MCU against i2c_slave_app.c on the slave bus model
+//!        of hal_host.c, and checks every byte read against a model of the
+//!        register map and FIFO built from the same I2CSlavePublish() calls:
+//!        - register reads from any address, through a repeated start or a
+//!          separate write transaction, past the end of the map too
+//!        - samples published while a read is on the bus, which must not
+//!          show in it (the triple buffered map) or reorder the FIFO
+//!        - FIFO reads of whole and partial entries, the pop of what was
+//!          read, the wrap of the ring, overflow with the oldest entry or,
+//!          during a FIFO read, the newest dropped
+//!        - writes longer than the register address, NACKed by the slave
+//!
+//!        Then reports the virtual bus time and the host CPU time per
+//!        transaction.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/i2c_slave_bench.c host/hal_host.c application/i2c_slave_app.c
+//!            -o i2c_slave_bench
+//!
+//!        Usage: i2c_slave_bench [transactions]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "app_config.h"
+#include "i2c_slave_app.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_MAP_LEN      ((uint32_t)sizeof(I2CSlaveRegMap_t))
+#define BENCH_ENTRY_LEN    ((uint32_t)sizeof(I2CSlaveSample_t))
+#define BENCH_FIFO_MASK    (I2C_SLAVE_FIFO_DEPTH - 1u)
+//longest read, a full FIFO and a bit
+#define BENCH_READ_MAX     ((I2C_SLAVE_FIFO_DEPTH + 2u) * BENCH_ENTRY_LEN)
+
+typedef struct
+{
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t mismatches;
+    uint32_t map_reads;
+    uint32_t fifo_reads;
+    uint32_t fifo_popped;
+    uint32_t published;
+    uint32_t during_read;
+    uint32_t overflows;
+    uint32_t nacked_writes;
+}BenchStats_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static uint64_t NowNs(void);
+static uint32_t Random(uint32_t range);
+
+//
+//! @brief Publish a random sample to the app and to the model
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+static void Publish(void);
+
+//
+//! @brief Set the register pointer, alone in a transaction or before a
+//!        repeated start
+//! @param[in]    reg   Register address
+//! @param[in]    stop  1 to end the transaction
+//! @param[out]   None
+//! @return       1 if the slave acknowledged
+//
+static uint32_t SetPointer(uint8_t reg, uint8_t stop);
+
+//
+//! @brief Read the map from a register and compare with the model
+//! @param[in]    reg  Register address
+//! @param[in]    len  Bytes to read
+//! @param[out]   None
+//! @return       None
+//
+static void ReadMap(uint8_t reg, uint32_t len);
+
+//
+//! @brief Read the FIFO and compare with the model, then pop the model
+//! @param[in]    len  Bytes to read
+//! @param[out]   None
+//! @return       None
+//
+static void ReadFifo(uint32_t len);
+
+//
+//! @brief Pop the model FIFO at the end of a FIFO read
+//! @param[in]    entries  Entries loaded by the slave, at most those read
+//! @param[out]   None
+//! @return       None
+//
+static void FifoPop(uint32_t entries);
+
+//
+//! @brief Read len bytes, with samples published at a random point
+//! @param[in]    len  Bytes to read
+//! @param[out]   data Bytes read
+//! @return       None
+//
+static void ReadBytes(uint8_t *data, uint32_t len);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static uint32_t         s_Seed = 12345u;
+static BenchStats_t     s_Stats;
+//model of the published map and FIFO
+static I2CSlaveRegMap_t s_Map;
+static I2CSlaveSample_t s_Fifo[I2C_SLAVE_FIFO_DEPTH];
+static uint16_t         s_Head      = 0;
+static uint16_t         s_Tail      = 0;
+static uint32_t         s_FifoRead  = 0;
+static uint64_t         s_TvocSum   = 0;
+static uint64_t         s_Co2EqSum  = 0;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t transactions = (argc > 1) ? (uint32_t)atoi(argv[1]) : 200000u;
+    uint64_t bus_us;
+    uint64_t ns;
+    uint32_t i;
+
+    memset(&s_Map, 0, sizeof(s_Map));
+    s_Map.id         = I2C_SLAVE_ID;
+    s_Map.version    = I2C_SLAVE_MAP_VERSION;
+    s_Map.tvoc_min   = 0xFFFF;
+    s_Map.co2_eq_min = 0xFFFF;
+
+    if (0 != I2CSlaveInit())
+    {
+        printf("I2CSlaveInit failed\n");
+        return 2;
+    }
+
+    //nothing published yet: the initial map and an empty FIFO
+    ReadMap(I2C_SLAVE_REG_ID, BENCH_MAP_LEN);
+    ReadFifo(BENCH_ENTRY_LEN);
+
+    bus_us = HalHostMicros();
+    ns     = NowNs();
+
+    for (i = 0; i < transactions; i++)
+    {
+        uint32_t action = Random(100);
+
+        if (action < 30u)
+        {
+            Publish();
+        }
+        else if (action < 60u)
+        {
+            uint8_t reg = (uint8_t)Random(BENCH_MAP_LEN + 4u);
+
+            ReadMap(reg, 1u + Random(BENCH_MAP_LEN + 4u - reg));
+        }
+        else if (action < 95u)
+        {
+            //a few whole entries, sometimes a partial one or the lot
+            uint32_t entries = 1u + Random((Random(8) == 0u) ? (I2C_SLAVE_FIFO_DEPTH + 1u) : 4u);
+
+            ReadFifo((Random(4) == 0u) ? (1u + Random(entries * BENCH_ENTRY_LEN)) :
+                                         (entries * BENCH_ENTRY_LEN));
+        }
+        else
+        {
+            //a write longer than the pointer: the second byte is NACKed
+            uint8_t bytes[2] = {I2C_SLAVE_REG_TVOC, 0x55};
+
+            if ( (HAL_OK != HalHostI2cSlaveStart(I2C_SLAVE_OWN_ADDRESS, 0)) ||
+                 (HAL_ERROR != HalHostI2cSlaveWrite(bytes, sizeof(bytes))) )
+            {
+                s_Stats.mismatches++;
+            }
+
+            HalHostI2cSlaveStop();
+            s_Stats.nacked_writes++;
+            s_Stats.transactions++;
+            ReadMap(0xFF, 2u);
+        }
+    }
+
+    ns     = NowNs() - ns;
+    bus_us = HalHostMicros() - bus_us;
+
+    printf("%u transactions, %u bytes read, %u samples published (%u during a read)\n",
+           (unsigned)s_Stats.transactions, (unsigned)s_Stats.bytes,
+           (unsigned)s_Stats.published, (unsigned)s_Stats.during_read);
+    printf("map reads  %u\n", (unsigned)s_Stats.map_reads);
+    printf("fifo reads %u, %u entries popped, %u overflows, FIFO depth %u\n",
+           (unsigned)s_Stats.fifo_reads, (unsigned)s_Stats.fifo_popped,
+           (unsigned)s_Stats.overflows, (unsigned)I2C_SLAVE_FIFO_DEPTH);
+    printf("writes     %u longer than the pointer, NACKed\n", (unsigned)s_Stats.nacked_writes);
+    printf("bus        %.1f us per transaction at 100 kHz\n",
+           (double)bus_us / s_Stats.transactions);
+    printf("host CPU   %.0f ns per transaction, app callbacks, model and checks\n",
+           (double)ns / s_Stats.transactions);
+    printf("check      %u mismatches: %s\n", (unsigned)s_Stats.mismatches,
+           (0u == s_Stats.mismatches) ? "pass" : "FAIL");
+
+    return (0u == s_Stats.mismatches) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}//end NowNs
+
+static uint32_t Random(uint32_t range)
+{
+    s_Seed ^= s_Seed << 13;
+    s_Seed ^= s_Seed >> 17;
+    s_Seed ^= s_Seed << 5;
+
+    return s_Seed % range;
+}//end Random
+
+static void Publish(void)
+{
+    uint16_t tvoc     = (uint16_t)Random(60000);
+    uint16_t co2      = (uint16_t)(400u + Random(60000));
+    uint32_t baseline = (Random(8) == 0u) ? (0x80000000u | Random(0x7FFFFFFF)) : 0u;
+
+    I2CSlavePublish(tvoc, co2, baseline);
+    s_Stats.published++;
+
+    s_Map.seq++;
+    s_Map.tvoc_ppb     = tvoc;
+    s_Map.co2_eq_ppm   = co2;
+    s_Map.sample_count = s_Stats.published;
+    s_Map.iaq_baseline = (0u != baseline) ? baseline : s_Map.iaq_baseline;
+    s_Map.tvoc_min     = (tvoc < s_Map.tvoc_min) ? tvoc : s_Map.tvoc_min;
+    s_Map.tvoc_max     = (tvoc > s_Map.tvoc_max) ? tvoc : s_Map.tvoc_max;
+    s_Map.co2_eq_min   = (co2 < s_Map.co2_eq_min) ? co2 : s_Map.co2_eq_min;
+    s_Map.co2_eq_max   = (co2 > s_Map.co2_eq_max) ? co2 : s_Map.co2_eq_max;
+    s_TvocSum         += tvoc;
+    s_Co2EqSum        += co2;
+    s_Map.tvoc_mean    = (uint16_t)(s_TvocSum / s_Stats.published);
+    s_Map.co2_eq_mean  = (uint16_t)(s_Co2EqSum / s_Stats.published);
+
+    //full: the oldest goes, unless the host is reading it, then the newest
+    if ((uint16_t)(s_Head - s_Tail) >= I2C_SLAVE_FIFO_DEPTH)
+    {
+        s_Map.fifo_overflow++;
+        s_Stats.overflows++;
+
+        if (s_FifoRead)
+        {
+            s_Map.fifo_count = (uint16_t)(s_Head - s_Tail);
+            return;
+        }
+
+        s_Tail++;
+    }
+
+    s_Fifo[s_Head & BENCH_FIFO_MASK].seq        = s_Stats.published;
+    s_Fifo[s_Head & BENCH_FIFO_MASK].tvoc_ppb   = tvoc;
+    s_Fifo[s_Head & BENCH_FIFO_MASK].co2_eq_ppm = co2;
+    s_Head++;
+    s_Map.fifo_count = (uint16_t)(s_Head - s_Tail);
+}//end Publish
+
+static uint32_t SetPointer(uint8_t reg, uint8_t stop)
+{
+    uint32_t ok = (HAL_OK == HalHostI2cSlaveStart(I2C_SLAVE_OWN_ADDRESS, 0)) &&
+                  (HAL_OK == HalHostI2cSlaveWrite(&reg, 1));
+
+    if (stop)
+    {
+        HalHostI2cSlaveStop();
+    }
+
+    return ok;
+}//end SetPointer
+
+static void ReadMap(uint8_t reg, uint32_t len)
+{
+    uint8_t  expect[BENCH_READ_MAX];
+    uint8_t  data[BENCH_READ_MAX];
+    uint8_t  stop = (uint8_t)(Random(2) == 0u);
+    uint32_t i;
+
+    //0xFF stands for the last pointer written, from the NACKed write
+    if (0xFF != reg)
+    {
+        s_Stats.mismatches += SetPointer(reg, stop) ? 0u : 1u;
+    }
+    else
+    {
+        reg  = I2C_SLAVE_REG_TVOC;
+        stop = 1;
+    }
+
+    //the map as published when the read is addressed, filler past its end
+    for (i = 0; i < len; i++)
+    {
+        expect[i] = ((reg + i) < BENCH_MAP_LEN) ? ((const uint8_t*)&s_Map)[reg + i] : 0xFF;
+    }
+
+    if (HAL_OK != HalHostI2cSlaveStart(I2C_SLAVE_OWN_ADDRESS, 1))
+    {
+        s_Stats.mismatches++;
+    }
+
+    ReadBytes(data, len);
+    HalHostI2cSlaveStop();
+
+    s_Stats.mismatches += (0 == memcmp(data, expect, len)) ? 0u : 1u;
+    s_Stats.map_reads++;
+    s_Stats.transactions += stop ? 2u : 1u;
+    s_Stats.bytes        += len;
+}//end ReadMap
+
+static void ReadFifo(uint32_t len)
+{
+    uint8_t  expect[BENCH_READ_MAX];
+    uint8_t  data[BENCH_READ_MAX];
+    uint16_t tail  = s_Tail & BENCH_FIFO_MASK;
+    uint32_t avail = (uint16_t)(s_Head - s_Tail);
+    uint32_t i;
+
+    //only the entries up to the end of the ring go in one read
+    if (avail > (I2C_SLAVE_FIFO_DEPTH - (uint32_t)tail))
+    {
+        avail = I2C_SLAVE_FIFO_DEPTH - (uint32_t)tail;
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        expect[i] = (i < avail * BENCH_ENTRY_LEN) ? ((const uint8_t*)&s_Fifo[tail])[i] : 0xFF;
+    }
+
+    s_Stats.mismatches += SetPointer(I2C_SLAVE_REG_FIFO_DATA, (uint8_t)(Random(2) == 0u)) ? 0u : 1u;
+
+    if (HAL_OK != HalHostI2cSlaveStart(I2C_SLAVE_OWN_ADDRESS, 1))
+    {
+        s_Stats.mismatches++;
+    }
+
+    s_FifoRead = avail;
+    ReadBytes(data, len);
+    HalHostI2cSlaveStop();
+
+    //the slave loads one byte ahead, whole entries loaded are popped
+    if (0u != s_FifoRead)
+    {
+        FifoPop((len + 1u) / BENCH_ENTRY_LEN);
+    }
+
+    s_Stats.mismatches += (0 == memcmp(data, expect, len)) ? 0u : 1u;
+    s_Stats.fifo_reads++;
+    s_Stats.transactions += 1u;
+    s_Stats.bytes        += len;
+}//end ReadFifo
+
+static void FifoPop(uint32_t entries)
+{
+    if (entries > s_FifoRead)
+    {
+        entries = s_FifoRead;
+    }
+
+    s_Tail              += (uint16_t)entries;
+    s_Stats.fifo_popped += entries;
+    s_FifoRead           = 0;
+}//end FifoPop
+
+static void ReadBytes(uint8_t *data, uint32_t len)
+{
+    uint32_t split = Random(len);
+    uint32_t count = Random(4);
+    uint32_t i;
+
+    //the main loop publishes while the host is clocking the read out
+    if ((0u != split) && (0u != count))
+    {
+        (void)HalHostI2cSlaveRead(data, (uint16_t)split, 0);
+
+        //transmit complete once the last entry is loaded, before the NACK
+        if ( (0u != s_FifoRead) && ((split + 1u) >= s_FifoRead * BENCH_ENTRY_LEN) )
+        {
+            FifoPop(s_FifoRead);
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            Publish();
+            s_Stats.during_read++;
+        }
+    }
+    else
+    {
+        split = 0;
+    }
+
+    (void)HalHostI2cSlaveRead(data + split, (uint16_t)(len - split), 1);
+}//end ReadBytes
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
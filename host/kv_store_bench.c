@@ -0,0 +1,322 @@
+//! @addtogroup Host
+//! @brief Key-value store benchmark and power loss test
+//! @{
+//!
+//****************************************************************************/
+//! @file kv_store_bench.c
+//! @brief Runs kv_store.c on the flash model of hal_host.c and reports:
+//!        - write amplification (bytes programmed per value byte) and erase
+//!          rate for random updates with compaction in the background
+//!        - lookup latency
+//!        - boot time index rebuild
+//!        - power loss: cuts the flash at random points of writes and
+//!          compactions, reboots and checks every key holds its last
+//!          written value (or, for the write that was cut, the old one)
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/kv_store_bench.c host/hal_host.c application/kv_store.c
+//!            application/crc32.c -o kv_store_bench
+//!
+//!        Usage: kv_store_bench [writes] [keys] [power loss trials]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "app_config.h"
+#include "kv_store.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_LOOKUPS     1000000u
+#define BENCH_BOOTS       200u
+//flash operations a power loss trial runs for at most before the cut
+#define BENCH_CUT_MAX     4000u
+
+typedef struct
+{
+    int32_t len;                         //-1 if the key is absent
+    uint8_t val[APP_KV_VALUE_MAX];
+}BenchKey_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static uint64_t NowNs(void);
+static void Fill(uint8_t *val, uint16_t len);
+static uint32_t Matches(uint16_t key, const BenchKey_t *expect);
+static void WriteAmplification(uint32_t writes, uint16_t keys);
+static void Lookup(uint16_t keys);
+static void Boot(void);
+static uint32_t PowerLoss(uint32_t trials, uint16_t keys);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static BenchKey_t s_Model[APP_KV_MAX_KEYS];
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t writes = (argc > 1) ? (uint32_t)atoi(argv[1]) : 100000u;
+    uint32_t keys   = (argc > 2) ? (uint32_t)atoi(argv[2]) : 16u;
+    uint32_t trials = (argc > 3) ? (uint32_t)atoi(argv[3]) : 20000u;
+    uint32_t failed;
+
+    if ((0 == keys) || (keys > APP_KV_MAX_KEYS))
+    {
+        fprintf(stderr, "usage: %s [writes] [keys <= %u] [trials]\n", argv[0],
+                (unsigned)APP_KV_MAX_KEYS);
+        return 1;
+    }
+
+    srand(1);
+    printf("%u sectors of %u KB, %u keys, values up to %u bytes\n",
+           (unsigned)APP_KV_SECTOR_COUNT, (unsigned)(APP_KV_SECTOR_SIZE / 1024u),
+           (unsigned)keys, (unsigned)APP_KV_VALUE_MAX);
+
+    WriteAmplification(writes, (uint16_t)keys);
+    Lookup((uint16_t)keys);
+    Boot();
+    failed = PowerLoss(trials, (uint16_t)keys);
+
+    return (0 == failed) ? 0 : 2;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}//end NowNs
+
+static void Fill(uint8_t *val, uint16_t len)
+{
+    uint16_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        val[i] = (uint8_t)rand();
+    }
+}//end Fill
+
+static uint32_t Matches(uint16_t key, const BenchKey_t *expect)
+{
+    uint8_t  val[APP_KV_VALUE_MAX];
+    uint16_t len = 0;
+    int16_t  ret = KvStoreRead(key, val, sizeof(val), &len);
+
+    if (expect->len < 0)
+    {
+        return (KV_ERR_NOT_FOUND == ret) ? 1u : 0u;
+    }
+
+    return ((KV_OK == ret) && (len == (uint16_t)expect->len) &&
+            (0 == memcmp(val, expect->val, len))) ? 1u : 0u;
+}//end Matches
+
+static void WriteAmplification(uint32_t writes, uint16_t keys)
+{
+    HalHostFlashStats_t flash;
+    KvStoreStats_t      stats;
+    uint8_t             val[APP_KV_VALUE_MAX];
+    uint32_t            i;
+    uint32_t            errors = 0;
+    uint64_t            worst  = 0;
+    uint64_t            start;
+
+    KvStoreInit();
+
+    for (i = 0; i < writes; i++)
+    {
+        uint16_t len = (uint16_t)(4u + (uint32_t)rand() % (APP_KV_VALUE_MAX - 3u));
+        uint64_t t;
+
+        Fill(val, len);
+        start = NowNs();
+        if (KV_OK != KvStoreWrite((uint16_t)((uint32_t)rand() % keys), val, len))
+        {
+            errors++;
+        }
+        t = NowNs() - start;
+        worst = (t > worst) ? t : worst;
+
+        KvStoreService();
+    }
+
+    KvStoreGetStats(&stats);
+    HalHostFlashGetStats(&flash);
+
+    printf("writes     %u, %u failed, worst write %.1f us host time\n",
+           (unsigned)writes, (unsigned)errors, (double)worst / 1000.0);
+    printf("bytes      %u value, %u programmed, %u copied by compaction\n",
+           (unsigned)stats.user_bytes, (unsigned)stats.flash_bytes,
+           (unsigned)stats.copied_bytes);
+    printf("write amp  %.2f programmed/value bytes, %.2f erases per 1000 writes\n",
+           stats.user_bytes ? (double)stats.flash_bytes / stats.user_bytes : 0.0,
+           writes ? 1000.0 * stats.erases / writes : 0.0);
+    printf("flash busy %.1f ms per write modelled (%.1f s total)\n",
+           writes ? (double)flash.busy_us / 1000.0 / writes : 0.0,
+           (double)flash.busy_us / 1e6);
+}//end WriteAmplification
+
+static void Lookup(uint16_t keys)
+{
+    uint8_t  val[APP_KV_VALUE_MAX];
+    uint16_t order[1024];
+    uint32_t i;
+    uint32_t found = 0;
+    uint64_t start;
+
+    for (i = 0; i < 1024u; i++)
+    {
+        order[i] = (uint16_t)((uint32_t)rand() % keys);
+    }
+
+    start = NowNs();
+    for (i = 0; i < BENCH_LOOKUPS; i++)
+    {
+        found += (KV_OK == KvStoreRead(order[i & 1023u], val, sizeof(val), NULL)) ? 1u : 0u;
+    }
+
+    printf("lookup     %.1f ns per read (%u of %u found)\n",
+           (double)(NowNs() - start) / BENCH_LOOKUPS, (unsigned)found,
+           (unsigned)BENCH_LOOKUPS);
+}//end Lookup
+
+static void Boot(void)
+{
+    KvStoreStats_t stats;
+    uint64_t       start = NowNs();
+    uint32_t       i;
+
+    for (i = 0; i < BENCH_BOOTS; i++)
+    {
+        KvStoreInit();
+    }
+
+    KvStoreGetStats(&stats);
+    printf("boot       %.1f us per index rebuild, %u records scanned, %u bytes live\n",
+           (double)(NowNs() - start) / 1000.0 / BENCH_BOOTS, (unsigned)stats.records,
+           (unsigned)stats.live_bytes);
+}//end Boot
+
+static uint32_t PowerLoss(uint32_t trials, uint16_t keys)
+{
+    uint32_t trial;
+    uint32_t failed = 0;
+    uint32_t cuts   = 0;
+    uint16_t key;
+
+    //start from what the store holds now
+    KvStoreInit();
+    for (key = 0; key < APP_KV_MAX_KEYS; key++)
+    {
+        uint16_t len = 0;
+
+        s_Model[key].len = (KV_OK == KvStoreRead(key, s_Model[key].val,
+                                                 sizeof(s_Model[key].val), &len)) ?
+                           (int32_t)len : -1;
+    }
+
+    for (trial = 0; trial < trials; trial++)
+    {
+        BenchKey_t next;
+        uint16_t   cut_key = UINT16_MAX;
+        BenchKey_t cut_val;
+
+        HalHostFlashCutAfter((uint32_t)rand() % BENCH_CUT_MAX);
+
+        //run until a write fails for lack of power
+        while (UINT16_MAX == cut_key)
+        {
+            int16_t ret;
+
+            key = (uint16_t)((uint32_t)rand() % keys);
+
+            if (0 == rand() % 8)
+            {
+                next.len = -1;
+                ret      = KvStoreDelete(key);
+                if (KV_ERR_NOT_FOUND == ret)
+                {
+                    ret = KV_OK;
+                }
+            }
+            else
+            {
+                next.len = (int32_t)(4u + (uint32_t)rand() % (APP_KV_VALUE_MAX - 3u));
+                Fill(next.val, (uint16_t)next.len);
+                ret = KvStoreWrite(key, next.val, (uint16_t)next.len);
+            }
+
+            if (KV_OK == ret)
+            {
+                s_Model[key] = next;
+            }
+            else
+            {
+                cut_key = key;
+                cut_val = next;
+            }
+
+            //a cut in here fails the next write before it programs anything
+            KvStoreService();
+        }
+
+        cuts += HalHostFlashPowerOn();
+        KvStoreInit();
+
+        for (key = 0; key < keys; key++)
+        {
+            if (Matches(key, &s_Model[key]))
+            {
+                continue;
+            }
+            //the write the power cut may have landed
+            if ((key == cut_key) && Matches(key, &cut_val))
+            {
+                s_Model[key] = cut_val;
+                continue;
+            }
+
+            failed++;
+            printf("trial %u: key %u lost\n", (unsigned)trial, (unsigned)key);
+            break;
+        }
+    }
+
+    printf("power loss %u trials, %u cuts, %u failed\n", (unsigned)trials,
+           (unsigned)cuts, (unsigned)failed);
+
+    return failed;
+}//end PowerLoss
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
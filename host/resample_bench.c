@@ -0,0 +1,429 @@
+//! @addtogroup Host
+//! @brief FIR resampler check and benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file resample_bench.c
+//! @brief Checks arm_fir_resample_f32/q15() against arm_fir_interpolate_f32/
+//!        q15() keeping every M-th output, which must match to the bit in Q15
+//!        and to the rounding of the sums in floating point, for
+//!        ratios L/M of 3/2 to 147/160 fed in blocks of varying size.  Then
+//!        checks the fractional mode, with 64 components and a ratio that
+//!        drifts by 50 ppm during the stream, against the ideal resampling
+//!        of a tone.
+//!
+//!        Then times the resampler against the cascades of interpolating by
+//!        L and decimating by M with arm_fir_decimate_f32/q15(), with one tap
+//!        (which keeps every M-th sample, the least a cascade can do) and
+//!        with a second filter as long as the first.
+//!
+//!        Times are in ns per output sample, and in cycles per output sample
+//!        when the clock of the machine is given.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/resample_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o resample_bench
+//!
+//!        Usage: resample_bench [cpu MHz]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_PHASE_LEN   16u
+#define BENCH_MAX_L       160u
+#define BENCH_MAX_TAPS    (BENCH_PHASE_LEN * BENCH_MAX_L)
+#define BENCH_MAX_BLOCK   600u
+//input samples of the checks
+#define BENCH_STREAM_LEN  6000u
+//the fractional mode
+#define BENCH_FRAC_L      64u
+#define BENCH_FRAC_LEN    24u
+#define BENCH_FRAC_TONE   0.05
+
+typedef enum
+{
+    BENCH_RESAMPLE_F32 = 0,
+    BENCH_KEEP_F32,
+    BENCH_DECIMATE_F32,
+    BENCH_RESAMPLE_Q15,
+    BENCH_KEEP_Q15,
+    BENCH_DECIMATE_Q15,
+    BENCH_KINDS
+} BenchKind_t;
+
+typedef struct
+{
+    BenchKind_t kind;
+    uint16_t    L;
+    uint16_t    M;
+    uint32_t    blockSize;
+    uint32_t    outputs;     //!< output samples of the last step
+}BenchPoint_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//
+//! @brief Design a windowed sinc lowpass at L times the input rate
+//! @param[in]    L        upsample factor, the gain of the filter
+//! @param[in]    cutoff   cutoff as a fraction of the input Nyquist frequency
+//! @param[in]    numTaps  filter length
+//! @param[out]   None
+//! @return       None
+//
+static void Design(uint32_t L, double cutoff, uint32_t numTaps);
+
+//
+//! @brief Check the resamplers against the interpolators over a stream
+//! @param[in]    L  upsample factor
+//! @param[in]    M  downsample factor
+//! @param[out]   None
+//! @return       1 if the outputs differ, else 0
+//
+static uint32_t CheckRational(uint16_t L, uint16_t M);
+
+//
+//! @brief Check the fractional mode against the ideal resampling of a tone
+//! @param[in]    ratio  nominal input samples per output sample
+//! @param[out]   None
+//! @return       1 if the SNR is too low, else 0
+//
+static uint32_t CheckFractional(double ratio);
+
+//
+//! @brief Time a rate converter over a stream of blocks
+//! @param[in]    kind  converter
+//! @param[in]    L     upsample factor
+//! @param[in]    M     downsample factor
+//! @param[out]   None
+//! @return       ns per output sample
+//
+static double Time(BenchKind_t kind, uint16_t L, uint16_t M);
+
+static void Step(void *arg);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const char *const s_Names[BENCH_KINDS] =
+{
+    "resample_f32", "interp+keep", "interp+decim", "resample_q15", "interp+keep", "interp+decim",
+};
+static const uint16_t s_Ratios[][2] = {{3, 2}, {2, 3}, {160, 147}, {147, 160}, {1, 4}, {4, 1}};
+static const uint16_t s_Blocks[]    = {1, 7, 64, 333, 600};
+
+static float32_t s_CoeffsF32[BENCH_MAX_TAPS];
+static q15_t     s_CoeffsQ15[BENCH_MAX_TAPS];
+static float32_t s_One[1] = {1.0f};
+static q15_t     s_OneQ15[1] = {0x7FFF};
+
+static float32_t s_InF32[BENCH_STREAM_LEN];
+static q15_t     s_InQ15[BENCH_STREAM_LEN];
+static float32_t s_OutF32[4u * BENCH_STREAM_LEN * 4u];
+static q15_t     s_OutQ15[4u * BENCH_STREAM_LEN * 4u];
+static float32_t s_MidF32[BENCH_MAX_L * BENCH_MAX_BLOCK];
+static q15_t     s_MidQ15[BENCH_MAX_L * BENCH_MAX_BLOCK];
+static float32_t s_RefF32[BENCH_MAX_L * BENCH_MAX_BLOCK];
+static q15_t     s_RefQ15[BENCH_MAX_L * BENCH_MAX_BLOCK];
+
+static float32_t s_StateF32[BENCH_MAX_TAPS + BENCH_MAX_L * BENCH_MAX_BLOCK];
+static q15_t     s_StateQ15[BENCH_MAX_TAPS + BENCH_MAX_L * BENCH_MAX_BLOCK];
+static float32_t s_DecStateF32[BENCH_MAX_TAPS + BENCH_MAX_L * BENCH_MAX_BLOCK];
+static q15_t     s_DecStateQ15[BENCH_MAX_TAPS + BENCH_MAX_L * BENCH_MAX_BLOCK];
+
+static arm_fir_resample_instance_f32    s_ResampleF32;
+static arm_fir_resample_instance_q15    s_ResampleQ15;
+static arm_fir_interpolate_instance_f32 s_InterpF32;
+static arm_fir_interpolate_instance_q15 s_InterpQ15;
+static arm_fir_decimate_instance_f32    s_DecimF32;
+static arm_fir_decimate_instance_q15    s_DecimQ15;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    double   mhz    = (argc > 1) ? atof(argv[1]) : 0.0;
+    uint32_t failed = 0;
+    uint32_t i;
+    uint32_t k;
+
+    srand(1);
+    for (i = 0; i < BENCH_STREAM_LEN; i++)
+    {
+        s_InF32[i] = 0.5f * sinf(0.031f * i) + 0.4f * ((float32_t)rand() / RAND_MAX - 0.5f);
+        s_InQ15[i] = (q15_t)lrintf(s_InF32[i] * 32768.0f);
+    }
+
+    for (i = 0; i < sizeof(s_Ratios) / sizeof(s_Ratios[0]); i++)
+    {
+        failed += CheckRational(s_Ratios[i][0], s_Ratios[i][1]);
+    }
+    failed += CheckFractional(147.0 / 160.0);
+    failed += CheckFractional(160.0 / 147.0);
+    printf("check: %s\n", (0u == failed) ? "pass" : "FAIL");
+
+    printf("\n%s per output sample, %u taps per component\n%-8s",
+           (mhz > 0.0) ? "ns (cycles)" : "ns", (unsigned)BENCH_PHASE_LEN, "L/M");
+    for (k = 0; k < BENCH_KINDS; k++)
+    {
+        printf(" %15s", s_Names[k]);
+    }
+    printf("\n");
+    for (i = 0; i < sizeof(s_Ratios) / sizeof(s_Ratios[0]); i++)
+    {
+        printf("%3u/%-4u", (unsigned)s_Ratios[i][0], (unsigned)s_Ratios[i][1]);
+        for (k = 0; k < BENCH_KINDS; k++)
+        {
+            double t = Time((BenchKind_t)k, s_Ratios[i][0], s_Ratios[i][1]);
+
+            if (mhz > 0.0)
+            {
+                printf(" %6.1f (%6.0f)", t, t * mhz / 1e3);
+            }
+            else
+            {
+                printf(" %15.1f", t);
+            }
+        }
+        printf("\n");
+    }
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static void Design(uint32_t L, double cutoff, uint32_t numTaps)
+{
+    double   c = 0.5 * (numTaps - 1u);
+    uint32_t i;
+
+    //Blackman windowed sinc, stored time reversed, which changes nothing as it is symmetric
+    for (i = 0; i < numTaps; i++)
+    {
+        double t = ((double)i - c) * cutoff / L;
+        double w = 0.42 - 0.5 * cos(6.283185307179586 * (i + 0.5) / numTaps) +
+                   0.08 * cos(12.566370614359172 * (i + 0.5) / numTaps);
+        double h = cutoff * ((0.0 == t) ? 1.0 : sin(3.141592653589793 * t) / (3.141592653589793 * t)) * w;
+
+        s_CoeffsF32[i] = (float32_t)h;
+        s_CoeffsQ15[i] = (q15_t)lrint(fmin(h, 32767.0 / 32768.0) * 32768.0);
+    }
+}//end Design
+
+static uint32_t CheckRational(uint16_t L, uint16_t M)
+{
+    uint32_t numTaps = BENCH_PHASE_LEN * L;
+    uint32_t outF32  = 0;
+    uint32_t outQ15  = 0;
+    double   diffF32 = 0.0;
+    uint32_t diffQ15 = 0;
+    uint32_t n       = 0;
+    uint32_t blk     = 0;
+    uint32_t m;
+
+    Design(L, 1.0 / ((M > L) ? ((double)M / L) : 1.0), numTaps);
+    (void)arm_fir_resample_init_f32(&s_ResampleF32, L, M, numTaps, s_CoeffsF32, s_StateF32,
+                                    BENCH_MAX_BLOCK);
+    (void)arm_fir_resample_init_q15(&s_ResampleQ15, L, M, numTaps, s_CoeffsQ15, s_StateQ15,
+                                    BENCH_MAX_BLOCK);
+    while (n < BENCH_STREAM_LEN)
+    {
+        uint32_t blockSize = s_Blocks[blk++ % (sizeof(s_Blocks) / sizeof(s_Blocks[0]))];
+
+        blockSize = (n + blockSize > BENCH_STREAM_LEN) ? (BENCH_STREAM_LEN - n) : blockSize;
+        outF32 += arm_fir_resample_f32(&s_ResampleF32, &s_InF32[n], &s_OutF32[outF32], blockSize);
+        outQ15 += arm_fir_resample_q15(&s_ResampleQ15, &s_InQ15[n], &s_OutQ15[outQ15], blockSize);
+        n += blockSize;
+    }
+
+    //the interpolators over the same stream, in blocks of 600, keeping samples m*M
+    (void)arm_fir_interpolate_init_f32(&s_InterpF32, (uint8_t)L, numTaps, s_CoeffsF32, s_StateF32,
+                                       BENCH_MAX_BLOCK);
+    (void)arm_fir_interpolate_init_q15(&s_InterpQ15, (uint8_t)L, numTaps, s_CoeffsQ15, s_StateQ15,
+                                       BENCH_MAX_BLOCK);
+    m = 0;
+    for (n = 0; n < BENCH_STREAM_LEN; n += BENCH_MAX_BLOCK)
+    {
+        arm_fir_interpolate_f32(&s_InterpF32, &s_InF32[n], s_RefF32, BENCH_MAX_BLOCK);
+        arm_fir_interpolate_q15(&s_InterpQ15, &s_InQ15[n], s_RefQ15, BENCH_MAX_BLOCK);
+        for (; (m * M < (n + BENCH_MAX_BLOCK) * L) && (m < outF32); m++)
+        {
+            diffF32  = fmax(diffF32, fabs(s_OutF32[m] - s_RefF32[m * M - n * L]));
+            diffQ15 += (s_OutQ15[m] != s_RefQ15[m * M - n * L]) ? 1u : 0u;
+        }
+    }
+
+    printf("rational %3u/%-3u: %5u outputs, f32 within %.1e and %u q15 differ from the interpolator\n",
+           (unsigned)L, (unsigned)M, (unsigned)outF32, diffF32, (unsigned)diffQ15);
+
+    return ((outF32 != outQ15) || (outF32 != (BENCH_STREAM_LEN * L + M - 1u) / M) ||
+            (diffF32 > 1e-6) || (0u != diffQ15)) ? 1u : 0u;
+}//end CheckRational
+
+static uint32_t CheckFractional(double ratio)
+{
+    uint32_t numTaps = BENCH_FRAC_L * BENCH_FRAC_LEN;
+    double   delay   = 0.5 * (numTaps - 1u) / BENCH_FRAC_L;
+    double   t       = 0.0;
+    double   sigF32  = 0.0;
+    double   errF32  = 0.0;
+    double   errQ15  = 0.0;
+    uint32_t outF32  = 0;
+    uint32_t outQ15  = 0;
+    uint32_t n       = 0;
+    uint32_t blk     = 0;
+    uint32_t m;
+
+    //cut off at 0.9 of the lower of the two Nyquist frequencies
+    Design(BENCH_FRAC_L, 0.9 * ((ratio > 1.0) ? (1.0 / ratio) : 1.0), numTaps);
+    (void)arm_fir_resample_init_f32(&s_ResampleF32, BENCH_FRAC_L, 1u, numTaps, s_CoeffsF32,
+                                    s_StateF32, BENCH_MAX_BLOCK);
+    (void)arm_fir_resample_init_q15(&s_ResampleQ15, BENCH_FRAC_L, 1u, numTaps, s_CoeffsQ15,
+                                    s_StateQ15, BENCH_MAX_BLOCK);
+    for (m = 0; m < BENCH_STREAM_LEN; m++)
+    {
+        s_InF32[m] = (float32_t)(0.5 * sin(6.283185307179586 * BENCH_FRAC_TONE * m));
+        s_InQ15[m] = (q15_t)lrintf(s_InF32[m] * 32768.0f);
+    }
+
+    while (n < BENCH_STREAM_LEN)
+    {
+        uint32_t blockSize = s_Blocks[blk % (sizeof(s_Blocks) / sizeof(s_Blocks[0]))];
+        double   drift     = 1.0 + 50e-6 * sin(0.7 * blk++);
+        uint32_t count;
+
+        //a clock drifting by up to 50 ppm, followed block by block
+        (void)arm_fir_resample_set_ratio_f32(&s_ResampleF32, (float32_t)(ratio * drift));
+        (void)arm_fir_resample_set_ratio_q15(&s_ResampleQ15, (float32_t)(ratio * drift));
+
+        blockSize = (n + blockSize > BENCH_STREAM_LEN) ? (BENCH_STREAM_LEN - n) : blockSize;
+        count   = arm_fir_resample_f32(&s_ResampleF32, &s_InF32[n], &s_OutF32[outF32], blockSize);
+        outQ15 += arm_fir_resample_q15(&s_ResampleQ15, &s_InQ15[n], &s_OutQ15[outQ15], blockSize);
+        n += blockSize;
+
+        //the output times, from the step the resampler actually uses
+        for (m = outF32; m < outF32 + count; m++)
+        {
+            if (t > BENCH_FRAC_LEN + 1u)
+            {
+                double ref = 0.5 * sin(6.283185307179586 * BENCH_FRAC_TONE * (t - delay));
+
+                sigF32 += ref * ref;
+                errF32 += (s_OutF32[m] - ref) * (s_OutF32[m] - ref);
+                errQ15 += (s_OutQ15[m] / 32768.0 - ref) * (s_OutQ15[m] / 32768.0 - ref);
+            }
+            t += (s_ResampleF32.stepInt + s_ResampleF32.stepFrac / 4294967296.0) / BENCH_FRAC_L;
+        }
+        outF32 += count;
+    }
+
+    errF32 = 10.0 * log10(sigF32 / errF32);
+    errQ15 = 10.0 * log10(sigF32 / errQ15);
+    printf("fractional %.4f +-50 ppm, %u components: %u outputs, SNR f32 %.1f dB, q15 %.1f dB\n",
+           ratio, (unsigned)BENCH_FRAC_L, (unsigned)outF32, errF32, errQ15);
+
+    return ((outF32 != outQ15) || (errF32 < 80.0) || (errQ15 < 70.0)) ? 1u : 0u;
+}//end CheckFractional
+
+static double Time(BenchKind_t kind, uint16_t L, uint16_t M)
+{
+    uint32_t     numTaps   = BENCH_PHASE_LEN * L;
+    uint32_t     blockSize = M * ((480u + M - 1u) / M);
+    BenchPoint_t point     = {kind, L, M, blockSize, 0u};
+    double       best;
+
+    //blocks of about 480 input samples, a multiple of M for the decimators
+    Design(L, 1.0 / ((M > L) ? ((double)M / L) : 1.0), numTaps);
+    (void)arm_fir_resample_init_f32(&s_ResampleF32, L, M, numTaps, s_CoeffsF32, s_StateF32,
+                                    blockSize);
+    (void)arm_fir_resample_init_q15(&s_ResampleQ15, L, M, numTaps, s_CoeffsQ15, s_StateQ15,
+                                    blockSize);
+    (void)arm_fir_interpolate_init_f32(&s_InterpF32, (uint8_t)L, numTaps, s_CoeffsF32, s_StateF32,
+                                       blockSize);
+    (void)arm_fir_interpolate_init_q15(&s_InterpQ15, (uint8_t)L, numTaps, s_CoeffsQ15, s_StateQ15,
+                                       blockSize);
+    if (BENCH_KEEP_F32 == kind)
+    {
+        (void)arm_fir_decimate_init_f32(&s_DecimF32, 1u, (uint8_t)M, s_One, s_DecStateF32, L * blockSize);
+    }
+    else
+    {
+        (void)arm_fir_decimate_init_f32(&s_DecimF32, numTaps, (uint8_t)M, s_CoeffsF32, s_DecStateF32,
+                                        L * blockSize);
+    }
+    if (BENCH_KEEP_Q15 == kind)
+    {
+        (void)arm_fir_decimate_init_q15(&s_DecimQ15, 1u, (uint8_t)M, s_OneQ15, s_DecStateQ15, L * blockSize);
+    }
+    else
+    {
+        (void)arm_fir_decimate_init_q15(&s_DecimQ15, numTaps, (uint8_t)M, s_CoeffsQ15, s_DecStateQ15,
+                                        L * blockSize);
+    }
+
+    best = BenchTime(Step, &point);
+
+    return best * 1e9 / point.outputs;
+}//end Time
+
+static void Step(void *arg)
+{
+    BenchPoint_t *point     = (BenchPoint_t*)arg;
+    uint16_t      L         = point->L;
+    uint16_t      M         = point->M;
+    uint32_t      blockSize = point->blockSize;
+    uint32_t      outputs   = 0;
+    uint32_t      n;
+
+    for (n = 0; n + blockSize <= BENCH_STREAM_LEN; n += blockSize)
+    {
+        switch (point->kind)
+        {
+            case BENCH_RESAMPLE_F32:
+                outputs += arm_fir_resample_f32(&s_ResampleF32, &s_InF32[n], s_OutF32, blockSize);
+                break;
+            case BENCH_RESAMPLE_Q15:
+                outputs += arm_fir_resample_q15(&s_ResampleQ15, &s_InQ15[n], s_OutQ15, blockSize);
+                break;
+            case BENCH_KEEP_F32:
+            case BENCH_DECIMATE_F32:
+                arm_fir_interpolate_f32(&s_InterpF32, &s_InF32[n], s_MidF32, blockSize);
+                arm_fir_decimate_f32(&s_DecimF32, s_MidF32, s_OutF32, L * blockSize);
+                outputs += L * blockSize / M;
+                break;
+            default:
+                arm_fir_interpolate_q15(&s_InterpQ15, &s_InQ15[n], s_MidQ15, blockSize);
+                arm_fir_decimate_q15(&s_DecimQ15, s_MidQ15, s_OutQ15, L * blockSize);
+                outputs += L * blockSize / M;
+                break;
+        }
+    }
+    point->outputs = outputs;
+}//end Step
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
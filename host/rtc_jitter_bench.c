@@ -0,0 +1,307 @@
+//! @addtogroup Host
+//! @brief Sampling clock jitter benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file rtc_jitter_bench.c
+//! @brief Runs the acquisition loop on the host HAL model with the SGP30
+//!        device model for a span of virtual time, once per sampling clock:
+//!        - delay: SgpPollStep() then HAL_Delay(1000), the original loop
+//!        - deadline: a deadline on the HAL tick, SgpPoll() with
+//!          APP_SAMPLE_CLOCK_RTC 0
+//!        - rtc: the RTC wakeup timer, SgpPoll() with APP_SAMPLE_CLOCK_RTC 1
+//!
+//!        For each it reports the samples taken against the span in
+//!        seconds, the interval between sample starts (mean, standard
+//!        deviation, min, max), how far the last sample has drifted from
+//!        a 1 s grid started at the first, and the largest error of the
+//!        logged RTC stamps against the time the samples started. The RTC
+//!        can be skewed against the virtual clock to see an LSI off its
+//!        nominal frequency.
+//!
+//!        Build from the repo root (embedded-sgp submodule checked out):
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication -Isgp30
+//!            -Iembedded-sgp/embedded-common -Iembedded-sgp/sgp30
+//!            -Iembedded-sgp/sgp-common
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/rtc_jitter_bench.c host/sgp30_model.c host/hal_host.c
+//!            application/sgp_app.c application/uart_app.c
+//!            application/i2c_slave_app.c application/prof.c
+//!            application/sample_sched.c application/kv_store.c
+//!            application/crc32.c application/idle.c
+//!            application/rtc_clock.c application/event_log.c
+//!            sgp30/sensirion_hw_i2c_implementation.c sgp30/sensirion_crc8.c
+//!            sgp30/sensirion_trace.c
+//!            embedded-sgp/embedded-common/sensirion_common.c
+//!            embedded-sgp/sgp30/sgp30.c -lm -o rtc_jitter_bench
+//!
+//!        Usage: rtc_jitter_bench [hours] [rtc drift ppm] [i2c fault ppm] [seed]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "sgp30_model.h"
+#include "sgp_app.h"
+#include "uart_app.h"
+#include "prof.h"
+#include "sample_sched.h"
+#include "kv_store.h"
+#include "idle.h"
+#include "rtc_clock.h"
+#include "event_log.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_PERIOD_US   ((uint64_t)SAMPLE_SCHED_PERIOD_MS * 1000u)
+
+typedef enum
+{
+    BENCH_LOOP_DELAY = 0,
+    BENCH_LOOP_DEADLINE,
+    BENCH_LOOP_RTC,
+    BENCH_LOOP_COUNT
+}BenchLoop_t;
+
+typedef struct
+{
+    uint32_t samples;
+    uint32_t missed;      //!< wakeups not served, rtc loop only
+    uint64_t first_us;    //!< start of the first sample
+    uint64_t last_us;     //!< start of the last sample
+    double   sum;         //!< interval sum and sum of squares in us
+    double   sum_sq;
+    uint64_t min;
+    uint64_t max;
+    int64_t  stamp_err;   //!< largest stamp error in us, signed
+}BenchJitter_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Run one loop for a span of virtual time
+//! @param[in]    loop   Sampling clock
+//! @param[in]    hours  Span
+//! @param[out]   stats  Results
+//! @return       None
+//
+static void Run(BenchLoop_t loop, uint32_t hours, BenchJitter_t *stats);
+
+//
+//! @brief Account a sample started at the given time, stamped by the
+//!        newest event log record
+//! @param[in]    start_us  Virtual time the sample started
+//! @param[out]   stats     Results
+//! @return       None
+//
+static void Account(uint64_t start_us, BenchJitter_t *stats);
+
+//
+//! @brief Microseconds since 2000-01-01 of an RTC stamp
+//! @param[in]    time    Packed calendar time
+//! @param[in]    subsec  Fraction of the second in 1/65536 s
+//! @param[out]   None
+//! @return       Time in us
+//
+static int64_t StampMicros(uint32_t time, uint16_t subsec);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const char *const s_Names[BENCH_LOOP_COUNT] = {"delay", "deadline", "rtc"};
+
+//RTC and virtual time of the first sample of a run
+static int64_t  s_StampBase;
+static uint64_t s_TrueBase;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t      hours   = (argc > 1) ? (uint32_t)atoi(argv[1]) : 24u;
+    int32_t       ppm     = (argc > 2) ? (int32_t)atoi(argv[2]) : 0;
+    uint32_t      i2c_ppm = (argc > 3) ? (uint32_t)atoi(argv[3]) : 0u;
+    uint32_t      seed    = (argc > 4) ? (uint32_t)atoi(argv[4]) : 1u;
+    BenchJitter_t stats[BENCH_LOOP_COUNT];
+    int           loop;
+
+    HalHostFaultSeed(seed);
+    HalHostFaultRate(HAL_HOST_FAULT_I2C_NACK, i2c_ppm);
+    HalHostFaultRate(HAL_HOST_FAULT_I2C_BITFLIP, i2c_ppm);
+    HalHostRtcSetDrift(ppm);
+
+    if (0 != Sgp30ModelAttach(seed))
+    {
+        fprintf(stderr, "I2C address taken\n");
+        return 1;
+    }
+
+    ProfInit();
+    IdleInit();
+    UARTInit();
+    KvStoreInit();
+    (void)RtcClockInit();
+
+    for (loop = 0; loop < BENCH_LOOP_COUNT; loop++)
+    {
+        Run((BenchLoop_t)loop, hours, &stats[loop]);
+    }
+
+    printf("%u h, %u s, RTC %+d ppm, I2C faults %u ppm\n", (unsigned)hours,
+           (unsigned)(hours * 3600u), (int)ppm, (unsigned)i2c_ppm);
+    printf("%-9s %8s %6s %12s %10s %10s %10s %10s %12s\n", "clock", "samples", "missed",
+           "mean ms", "std us", "min ms", "max ms", "drift ms", "stamp err us");
+
+    for (loop = 0; loop < BENCH_LOOP_COUNT; loop++)
+    {
+        const BenchJitter_t *s     = &stats[loop];
+        double               n     = (s->samples > 1u) ? (double)(s->samples - 1u) : 1.0;
+        double               mean  = s->sum / n;
+        double               var   = s->sum_sq / n - mean * mean;
+        //against a 1 s grid started at the first sample
+        double               drift = (double)(s->last_us - s->first_us) -
+                                     n * (double)BENCH_PERIOD_US;
+
+        printf("%-9s %8u %6u %12.6f %10.1f %10.3f %10.3f %10.1f %12lld\n", s_Names[loop],
+               (unsigned)s->samples, (unsigned)s->missed, mean / 1e3,
+               (var > 0.0) ? sqrt(var) : 0.0, (double)s->min / 1e3, (double)s->max / 1e3,
+               drift / 1e3, (long long)s->stamp_err);
+    }
+
+    return 0;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static void Run(BenchLoop_t loop, uint32_t hours, BenchJitter_t *stats)
+{
+    uint64_t   end_us   = HalHostMicros() + (uint64_t)hours * 3600u * 1000000u;
+    uint32_t   deadline;
+    uint32_t   due;
+    RtcStamp_t stamp;
+
+    stats->samples   = 0;
+    stats->missed    = 0;
+    stats->sum       = 0.0;
+    stats->sum_sq    = 0.0;
+    stats->min       = UINT64_MAX;
+    stats->max       = 0;
+    stats->stamp_err = 0;
+
+    EventLogInit();
+    SgpInit();
+    SgpPollStart();
+    deadline = HAL_GetTick();
+
+    if (BENCH_LOOP_RTC == loop)
+    {
+        (void)RtcClockStart(SAMPLE_SCHED_PERIOD_MS / 1000u);
+    }
+
+    //the sampling part of SgpPoll(), per clock
+    while (HalHostMicros() < end_us)
+    {
+        uint64_t start_us;
+
+        switch (loop)
+        {
+        case BENCH_LOOP_DELAY:
+            start_us = HalHostMicros();
+            SgpPollStep();
+            Account(start_us, stats);
+            HAL_Delay(SAMPLE_SCHED_PERIOD_MS);
+            break;
+
+        case BENCH_LOOP_DEADLINE:
+            start_us = HalHostMicros();
+            SgpPollStep();
+            Account(start_us, stats);
+            deadline += SAMPLE_SCHED_PERIOD_MS;
+            do
+            {
+                KvStoreService();
+            } while (IdleUntil(deadline));
+            break;
+
+        default:
+            while (0u == (due = RtcClockTake(&stamp)))
+            {
+                KvStoreService();
+                (void)IdleUntil(HAL_GetTick() + SAMPLE_SCHED_PERIOD_MS);
+            }
+            stats->missed += due - 1u;
+            start_us = HalHostMicros();
+            SgpPollStepAt(&stamp, EVENT_LOG_FLAG_WAKEUP);
+            Account(start_us, stats);
+            break;
+        }
+    }
+
+    RtcClockStop();
+}//end Run
+
+static void Account(uint64_t start_us, BenchJitter_t *stats)
+{
+    EventLogRecord_t record;
+    int64_t          err;
+
+    if (0 != EventLogGet(0, &record))
+    {
+        return;
+    }
+
+    if (0u == stats->samples)
+    {
+        stats->first_us = start_us;
+        s_StampBase     = StampMicros(record.time, record.subsec);
+        s_TrueBase      = start_us;
+    }
+    else
+    {
+        uint64_t interval = start_us - stats->last_us;
+
+        stats->sum    += (double)interval;
+        stats->sum_sq += (double)interval * (double)interval;
+        stats->min     = (interval < stats->min) ? interval : stats->min;
+        stats->max     = (interval > stats->max) ? interval : stats->max;
+    }
+
+    //stamp against the virtual clock, both counted from the first sample
+    err = (StampMicros(record.time, record.subsec) - s_StampBase) -
+          (int64_t)(start_us - s_TrueBase);
+    if (llabs(err) > llabs(stats->stamp_err))
+    {
+        stats->stamp_err = err;
+    }
+
+    stats->last_us = start_us;
+    stats->samples++;
+}//end Account
+
+static int64_t StampMicros(uint32_t time, uint16_t subsec)
+{
+    return (int64_t)RtcStampSeconds(time) * 1000000 +
+           ((int64_t)subsec * 1000000) / RTC_STAMP_SUBSEC_HZ;
+}//end StampMicros
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
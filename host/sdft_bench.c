@@ -0,0 +1,548 @@
+//! @addtogroup Host
+//! @brief Sliding DFT and Goertzel bank check and benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file sdft_bench.c
+//! @brief Checks arm_sdft_f32/q31() against a double precision DFT of the
+//!        last window after 2^14 to 2^20 samples fed in blocks of 1 to 333,
+//!        next to the textbook sliding DFT, whose bins drift, and checks
+//!        arm_goertzel_f32/q31() against a double precision DFT of each
+//!        block, next to the plain Goertzel recurrence, which loses
+//!        precision at low frequencies.  Errors are relative to the full
+//!        scale bin, winLen times the peak of the input.
+//!
+//!        Then times updating 1 to 16 bins against recomputing them with
+//!        arm_rfft_fast_f32() on every sample (the sliding DFT) and once per
+//!        window (the Goertzel bank).
+//!
+//!        Times are in ns per sample, and in cycles per sample when the
+//!        clock of the machine is given.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O3 -DARM_MATH_HOST -fno-math-errno
+//!            -Idrivers/CMSIS/DSP/Include host/sdft_bench.c
+//!            drivers/CMSIS/DSP/Source/*/*.c -lm -o sdft_bench
+//!
+//!        Usage: sdft_bench [cpu MHz]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//user defined header files
+#include "arm_math.h"
+#include "bench_util.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_MAX_LEN     4096u
+#define BENCH_MAX_BINS    16u
+//samples per timed run
+#define BENCH_STREAM_LEN  4096u
+//largest error relative to the full scale bin
+#define BENCH_MAX_ERR_F32 1e-5
+#define BENCH_MAX_ERR_Q31 1e-8
+
+typedef enum
+{
+    BENCH_SDFT_F32_1 = 0,
+    BENCH_SDFT_F32,
+    BENCH_SDFT_Q31,
+    BENCH_GOERTZEL_F32,
+    BENCH_GOERTZEL_Q31,
+    BENCH_RFFT_SAMPLE,
+    BENCH_RFFT_WINDOW,
+    BENCH_KINDS
+} BenchKind_t;
+
+typedef struct
+{
+    BenchKind_t kind;
+    uint16_t    winLen;
+}BenchPoint_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+
+//
+//! @brief Sample n of the test signal, two tones and noise below 0.7
+//! @param[in]    n  sample index
+//! @param[out]   None
+//! @return       the sample
+//
+static double Signal(uint32_t n);
+
+//
+//! @brief Double precision DFT bins of the window ending before sample end
+//! @param[in]    end      index of the sample after the window
+//! @param[in]    winLen   window length
+//! @param[in]    freq     frequency of each bin in cycles per sample
+//! @param[in]    numBins  number of bins
+//! @param[in]    isQ31    nonzero for the Q31 samples, else the f32 ones
+//! @param[out]   None
+//! @return       None
+//
+static void Reference(uint32_t end, uint32_t winLen, const double *freq, uint32_t numBins,
+                      uint32_t isQ31);
+
+//
+//! @brief Largest error of bins against the reference
+//! @param[in]    pBins    bins, complex
+//! @param[in]    scale    factor of the bins
+//! @param[in]    numBins  number of bins
+//! @param[in]    winLen   window length
+//! @param[out]   None
+//! @return       error relative to the full scale bin
+//
+static double Error(const double *pBins, double scale, uint32_t numBins, uint32_t winLen);
+
+//
+//! @brief Run the sliding DFTs over a long stream, checking the bins on the way
+//! @param[in]    winLen   window length
+//! @param[out]   None
+//! @return       1 if a check failed, else 0
+//
+static uint32_t CheckSdft(uint16_t winLen);
+
+//
+//! @brief Run the Goertzel banks over three blocks and check each result
+//! @param[in]    blockLen block length
+//! @param[out]   None
+//! @return       1 if a check failed, else 0
+//
+static uint32_t CheckGoertzel(uint16_t blockLen);
+
+//
+//! @brief Time the update of a number of bins
+//! @param[in]    kind     method
+//! @param[in]    winLen   window or block length
+//! @param[in]    numBins  number of bins
+//! @param[out]   None
+//! @return       ns per sample
+//
+static double Time(BenchKind_t kind, uint16_t winLen, uint16_t numBins);
+
+static void Step(void *arg);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const char *const s_Names[BENCH_KINDS] =
+{
+    "sdft_f32 1", "sdft_f32", "sdft_q31", "goertzel_f32", "goertzel_q31", "rfft/sample",
+    "rfft/window",
+};
+static const uint16_t s_Bins[BENCH_MAX_BINS] = {1, 3, 17, 100, 128, 5, 7, 9, 11, 13, 15, 19, 21,
+                                                23, 25, 27};
+static const uint16_t s_Blocks[] = {1, 5, 64, 333};
+static const uint16_t s_TimeBins[] = {1, 4, 16};
+static const uint16_t s_TimeLens[] = {256, 1024};
+
+static float32_t s_InF32[BENCH_STREAM_LEN];
+static q31_t     s_InQ31[BENCH_STREAM_LEN];
+static double    s_Ref[2u * BENCH_MAX_BINS];
+static double    s_Bin[2u * BENCH_MAX_BINS];
+static float32_t s_OutF32[2u * BENCH_MAX_BINS * (BENCH_STREAM_LEN + 1u)];
+static q31_t     s_OutQ31[2u * BENCH_MAX_BINS * (BENCH_STREAM_LEN + 1u)];
+
+static float32_t s_TwiddleF32[2u * BENCH_MAX_LEN];
+static q31_t     s_TwiddleQ31[2u * BENCH_MAX_LEN];
+static float32_t s_StateF32[ARM_SDFT_STATE_LEN_F32(BENCH_MAX_LEN, BENCH_MAX_BINS)];
+static q31_t     s_StateQ31[BENCH_MAX_LEN];
+static q63_t     s_SumsQ31[2u * BENCH_MAX_BINS];
+static float32_t s_CoeffsF32[ARM_GOERTZEL_COEFFS_LEN_F32(BENCH_MAX_BINS)];
+static q31_t     s_CoeffsQ31[ARM_GOERTZEL_COEFFS_LEN_Q31(BENCH_MAX_BINS)];
+static q63_t     s_GStateQ31[2u * BENCH_MAX_BINS];
+static float32_t s_Window[BENCH_MAX_LEN];
+static float32_t s_Spectrum[BENCH_MAX_LEN];
+
+static arm_sdft_instance_f32      s_SdftF32;
+static arm_sdft_instance_q31      s_SdftQ31;
+static arm_goertzel_instance_f32  s_GoertzelF32;
+static arm_goertzel_instance_q31  s_GoertzelQ31;
+static arm_rfft_fast_instance_f32 s_Rfft;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    double   mhz    = (argc > 1) ? atof(argv[1]) : 0.0;
+    uint32_t failed = 0;
+    uint32_t i;
+    uint32_t l;
+    uint32_t k;
+
+    failed += CheckSdft(256u);
+    failed += CheckSdft(1000u);
+    failed += CheckGoertzel(1000u);
+    failed += CheckGoertzel(4096u);
+    printf("check: %s\n", (0u == failed) ? "pass" : "FAIL");
+
+    for (i = 0; i < BENCH_STREAM_LEN; i++)
+    {
+        s_InF32[i] = (float32_t)Signal(i);
+        s_InQ31[i] = (q31_t)lrint(Signal(i) * 2147483648.0);
+    }
+
+    for (l = 0; l < sizeof(s_TimeLens) / sizeof(s_TimeLens[0]); l++)
+    {
+        printf("\n%s per sample, %u point window\n%-14s", (mhz > 0.0) ? "ns (cycles)" : "ns",
+               (unsigned)s_TimeLens[l], "bins");
+        for (k = 0; k < sizeof(s_TimeBins) / sizeof(s_TimeBins[0]); k++)
+        {
+            printf(" %16u", (unsigned)s_TimeBins[k]);
+        }
+        printf("\n");
+
+        for (i = 0; i < BENCH_KINDS; i++)
+        {
+            printf("%-14s", s_Names[i]);
+            for (k = 0; k < sizeof(s_TimeBins) / sizeof(s_TimeBins[0]); k++)
+            {
+                double t = Time((BenchKind_t)i, s_TimeLens[l], s_TimeBins[k]);
+
+                if (mhz > 0.0)
+                {
+                    printf(" %7.1f (%6.0f)", t, t * mhz / 1e3);
+                }
+                else
+                {
+                    printf(" %16.1f", t);
+                }
+            }
+            printf("\n");
+        }
+    }
+
+    return (0u == failed) ? 0 : 1;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static double Signal(uint32_t n)
+{
+    //a hash of n as noise, so that any sample can be regenerated
+    uint32_t h = n * 2654435761u;
+
+    h ^= h >> 15;
+    h *= 2246822519u;
+    h ^= h >> 13;
+
+    return 0.4 * sin(0.0123 * n) + 0.2 * sin(0.7 * n + 1.0) + 0.1 * ((double)h / 4294967296.0 - 0.5);
+}//end Signal
+
+static void Reference(uint32_t end, uint32_t winLen, const double *freq, uint32_t numBins,
+                      uint32_t isQ31)
+{
+    uint32_t b;
+    uint32_t m;
+
+    for (b = 0; b < numBins; b++)
+    {
+        double re = 0.0;
+        double im = 0.0;
+
+        for (m = 0; m < winLen; m++)
+        {
+            double x = isQ31 ? (double)(q31_t)lrint(Signal(end - winLen + m) * 2147483648.0) / 2147483648.0 :
+                               (double)(float32_t)Signal(end - winLen + m);
+            double a = -6.283185307179586 * freq[b] * m;
+
+            re += x * cos(a);
+            im += x * sin(a);
+        }
+        s_Ref[2u * b]      = re;
+        s_Ref[2u * b + 1u] = im;
+    }
+}//end Reference
+
+static double Error(const double *pBins, double scale, uint32_t numBins, uint32_t winLen)
+{
+    double   err = 0.0;
+    uint32_t k;
+
+    for (k = 0; k < 2u * numBins; k++)
+    {
+        err = fmax(err, fabs(pBins[k] * scale - s_Ref[k]));
+    }
+
+    return err / (0.7 * winLen);
+}//end Error
+
+static uint32_t CheckSdft(uint16_t winLen)
+{
+    const uint32_t numBins = 5u;
+    double   freq[BENCH_MAX_BINS];
+    double   naive[2u * BENCH_MAX_BINS] = {0.0};
+    uint32_t failed = 0;
+    uint32_t n      = 0;
+    uint32_t next   = 1u << 14;
+    uint32_t blk    = 0;
+    uint32_t b;
+    uint32_t i;
+
+    for (b = 0; b < numBins; b++)
+    {
+        freq[b] = (double)s_Bins[b] / winLen;
+    }
+
+    (void)arm_sdft_init_f32(&s_SdftF32, winLen, numBins, s_Bins, s_TwiddleF32, s_StateF32);
+    (void)arm_sdft_init_q31(&s_SdftQ31, winLen, numBins, s_Bins, s_TwiddleQ31, s_StateQ31,
+                            s_SumsQ31);
+
+    printf("sliding DFT %4u, bins 1 3 17 100 128: error of f32, q31, textbook f32\n",
+           (unsigned)winLen);
+    while (next <= (1u << 20))
+    {
+        uint32_t blockSize = s_Blocks[blk++ % (sizeof(s_Blocks) / sizeof(s_Blocks[0]))];
+
+        blockSize = (n + blockSize > next) ? (next - n) : blockSize;
+        for (i = 0; i < blockSize; i++)
+        {
+            s_InF32[i] = (float32_t)Signal(n + i);
+            s_InQ31[i] = (q31_t)lrint(Signal(n + i) * 2147483648.0);
+        }
+
+        //the textbook recurrence, X[k] = (X[k] + x[n] - x[n-winLen]) * exp(j*2*pi*k/winLen)
+        for (i = 0; i < blockSize; i++)
+        {
+            float32_t old = (n + i >= winLen) ? (float32_t)Signal(n + i - winLen) : 0.0f;
+
+            for (b = 0; b < numBins; b++)
+            {
+                float32_t c  = s_TwiddleF32[2u * s_Bins[b]];
+                float32_t s  = s_TwiddleF32[2u * s_Bins[b] + 1u];
+                float32_t re = (float32_t)naive[2u * b] + s_InF32[i] - old;
+                float32_t im = (float32_t)naive[2u * b + 1u];
+
+                naive[2u * b]      = re * c - im * s;
+                naive[2u * b + 1u] = re * s + im * c;
+            }
+        }
+
+        arm_sdft_f32(&s_SdftF32, s_InF32, blockSize, s_OutF32);
+        arm_sdft_q31(&s_SdftQ31, s_InQ31, blockSize, s_OutQ31);
+        n += blockSize;
+
+        if (n == next)
+        {
+            double errF32;
+            double errQ31;
+            double errNaive;
+
+            Reference(n, winLen, freq, numBins, 0u);
+            for (b = 0; b < 2u * numBins; b++)
+            {
+                s_Bin[b] = s_OutF32[b];
+            }
+            errF32   = Error(s_Bin, 1.0, numBins, winLen);
+            errNaive = Error(naive, 1.0, numBins, winLen);
+
+            Reference(n, winLen, freq, numBins, 1u);
+            for (b = 0; b < 2u * numBins; b++)
+            {
+                s_Bin[b] = (double)s_OutQ31[b] / 2147483648.0;
+            }
+            errQ31 = Error(s_Bin, ldexp(1.0, s_SdftQ31.winShift), numBins, winLen);
+
+            printf("  after %7u samples: %.1e %.1e %.1e\n", (unsigned)n, errF32, errQ31, errNaive);
+            failed += ((errF32 > BENCH_MAX_ERR_F32) || (errQ31 > BENCH_MAX_ERR_Q31)) ? 1u : 0u;
+            next <<= 2;
+        }
+    }
+
+    return (0u == failed) ? 0u : 1u;
+}//end CheckSdft
+
+static uint32_t CheckGoertzel(uint16_t blockLen)
+{
+    static const double freq[] = {0.0, 0.25 / 4096.0, 1.0 / 4096.0, 0.0123 / 6.283185307179586,
+                                  0.2499, 0.25, 0.3777, 0.5};
+    const uint32_t numBins = sizeof(freq) / sizeof(freq[0]);
+    float32_t freqF32[sizeof(freq) / sizeof(freq[0])];
+    q31_t     freqQ31[sizeof(freq) / sizeof(freq[0])];
+    double    refF32[sizeof(freq) / sizeof(freq[0])];
+    double    refQ31[sizeof(freq) / sizeof(freq[0])];
+    double    errF32   = 0.0;
+    double    errQ31   = 0.0;
+    double    errPlain = 0.0;
+    uint32_t  resF32   = 0;
+    uint32_t  resQ31   = 0;
+    uint32_t  n;
+    uint32_t  b;
+    uint32_t  r;
+
+    for (b = 0; b < numBins; b++)
+    {
+        freqF32[b] = (float32_t)freq[b];
+        freqQ31[b] = (q31_t)lrint(freq[b] * 2147483648.0);
+        //the reference is at the frequencies as each bank was given them
+        refF32[b]  = freqF32[b];
+        refQ31[b]  = (double)freqQ31[b] / 2147483648.0;
+    }
+    if ((ARM_MATH_SUCCESS != arm_goertzel_init_f32(&s_GoertzelF32, blockLen, numBins, freqF32,
+                                                   s_CoeffsF32, s_StateF32)) ||
+        (ARM_MATH_SUCCESS != arm_goertzel_init_q31(&s_GoertzelQ31, blockLen, numBins, freqQ31,
+                                                   s_CoeffsQ31, s_GStateQ31)))
+    {
+        printf("goertzel %4u: init failed\n", (unsigned)blockLen);
+        return 1u;
+    }
+
+    //three blocks fed in pieces of 100 samples, across the block boundaries
+    for (n = 0; n < 3u * blockLen; n += 100u)
+    {
+        uint32_t blockSize = (n + 100u > 3u * blockLen) ? (3u * blockLen - n) : 100u;
+
+        for (r = 0; r < blockSize; r++)
+        {
+            s_InF32[r] = (float32_t)Signal(n + r);
+            s_InQ31[r] = (q31_t)lrint(Signal(n + r) * 2147483648.0);
+        }
+        resF32 += arm_goertzel_f32(&s_GoertzelF32, s_InF32, blockSize, &s_OutF32[2u * numBins * resF32]);
+        resQ31 += arm_goertzel_q31(&s_GoertzelQ31, s_InQ31, blockSize, &s_OutQ31[2u * numBins * resQ31]);
+    }
+
+    for (r = 0; r < resF32; r++)
+    {
+        double plain[2u * BENCH_MAX_BINS];
+
+        //the plain recurrence s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2] in single precision
+        for (b = 0; b < numBins; b++)
+        {
+            float32_t coeff = (float32_t)(2.0 * cos(6.283185307179586 * refF32[b]));
+            float32_t s1    = 0.0f;
+            float32_t s2    = 0.0f;
+            double    w     = 6.283185307179586 * refF32[b];
+            double    yR;
+            double    yI;
+
+            for (n = 0; n < blockLen; n++)
+            {
+                float32_t s0 = (float32_t)Signal(r * blockLen + n) + coeff * s1 - s2;
+
+                s2 = s1;
+                s1 = s0;
+            }
+            yR = s1 - cos(w) * s2;
+            yI = sin(w) * s2;
+            plain[2u * b]      = yR * cos(w * (blockLen - 1u)) + yI * sin(w * (blockLen - 1u));
+            plain[2u * b + 1u] = yI * cos(w * (blockLen - 1u)) - yR * sin(w * (blockLen - 1u));
+        }
+
+        Reference((r + 1u) * blockLen, blockLen, refF32, numBins, 0u);
+        for (b = 0; b < 2u * numBins; b++)
+        {
+            s_Bin[b] = s_OutF32[2u * numBins * r + b];
+        }
+        errF32   = fmax(errF32, Error(s_Bin, 1.0, numBins, blockLen));
+        errPlain = fmax(errPlain, Error(plain, 1.0, numBins, blockLen));
+
+        Reference((r + 1u) * blockLen, blockLen, refQ31, numBins, 1u);
+        for (b = 0; b < 2u * numBins; b++)
+        {
+            s_Bin[b] = (double)s_OutQ31[2u * numBins * r + b] / 2147483648.0;
+        }
+        errQ31 = fmax(errQ31, Error(s_Bin, ldexp(1.0, s_GoertzelQ31.outShift), numBins, blockLen));
+    }
+
+    printf("goertzel %4u, 0 to 0.5 cycles per sample, %u results: f32 %.1e, q31 %.1e "
+           "(input shift %u), plain f32 %.1e\n", (unsigned)blockLen, (unsigned)resF32, errF32,
+           errQ31, (unsigned)s_GoertzelQ31.inShift, errPlain);
+
+    return ((3u != resF32) || (3u != resQ31) || (errF32 > BENCH_MAX_ERR_F32) ||
+            (errQ31 > BENCH_MAX_ERR_Q31)) ? 1u : 0u;
+}//end CheckGoertzel
+
+static double Time(BenchKind_t kind, uint16_t winLen, uint16_t numBins)
+{
+    float32_t    freqF32[BENCH_MAX_BINS];
+    q31_t        freqQ31[BENCH_MAX_BINS];
+    BenchPoint_t point = {kind, winLen};
+    double       best;
+    uint32_t     b;
+    uint32_t     n;
+
+    for (b = 0; b < numBins; b++)
+    {
+        freqF32[b] = (float32_t)s_Bins[b] / winLen;
+        freqQ31[b] = (q31_t)lrint((double)s_Bins[b] / winLen * 2147483648.0);
+    }
+    (void)arm_sdft_init_f32(&s_SdftF32, winLen, numBins, s_Bins, s_TwiddleF32, s_StateF32);
+    (void)arm_sdft_init_q31(&s_SdftQ31, winLen, numBins, s_Bins, s_TwiddleQ31, s_StateQ31,
+                            s_SumsQ31);
+    (void)arm_goertzel_init_f32(&s_GoertzelF32, winLen, numBins, freqF32, s_CoeffsF32, s_StateF32);
+    (void)arm_goertzel_init_q31(&s_GoertzelQ31, winLen, numBins, freqQ31, s_CoeffsQ31, s_GStateQ31);
+    (void)arm_rfft_fast_init_f32(&s_Rfft, winLen);
+
+    best = BenchTime(Step, &point);
+
+    //the FFT per sample runs once for each sample after the first window
+    n = (BENCH_RFFT_SAMPLE == kind) ? (BENCH_STREAM_LEN - winLen) : BENCH_STREAM_LEN;
+
+    return best * 1e9 / n;
+}//end Time
+
+static void Step(void *arg)
+{
+    const BenchPoint_t *point  = (const BenchPoint_t*)arg;
+    uint16_t            winLen = point->winLen;
+    uint32_t            n;
+
+    switch (point->kind)
+    {
+        case BENCH_SDFT_F32_1:
+            //the bins after every sample
+            for (n = 0; n < BENCH_STREAM_LEN; n++)
+            {
+                arm_sdft_f32(&s_SdftF32, &s_InF32[n], 1u, s_OutF32);
+            }
+            break;
+        case BENCH_SDFT_F32:
+            arm_sdft_f32(&s_SdftF32, s_InF32, BENCH_STREAM_LEN, s_OutF32);
+            break;
+        case BENCH_SDFT_Q31:
+            arm_sdft_q31(&s_SdftQ31, s_InQ31, BENCH_STREAM_LEN, s_OutQ31);
+            break;
+        case BENCH_GOERTZEL_F32:
+            (void)arm_goertzel_f32(&s_GoertzelF32, s_InF32, BENCH_STREAM_LEN, s_OutF32);
+            break;
+        case BENCH_GOERTZEL_Q31:
+            (void)arm_goertzel_q31(&s_GoertzelQ31, s_InQ31, BENCH_STREAM_LEN, s_OutQ31);
+            break;
+        case BENCH_RFFT_SAMPLE:
+            //a copy of the window, as arm_rfft_fast_f32() overwrites its input
+            for (n = winLen; n < BENCH_STREAM_LEN; n++)
+            {
+                memcpy(s_Window, &s_InF32[n - winLen], winLen * sizeof(float32_t));
+                arm_rfft_fast_f32(&s_Rfft, s_Window, s_Spectrum, 0u);
+            }
+            break;
+        default:
+            for (n = winLen; n <= BENCH_STREAM_LEN; n += winLen)
+            {
+                memcpy(s_Window, &s_InF32[n - winLen], winLen * sizeof(float32_t));
+                arm_rfft_fast_f32(&s_Rfft, s_Window, s_Spectrum, 0u);
+            }
+            break;
+    }
+}//end Step
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
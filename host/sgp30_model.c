@@ -0,0 +1,275 @@
+//! @addtogroup Host
+//! @brief SGP30 device model
+//! @{
+//!
+//****************************************************************************/
+//! @file sgp30_model.c
+//! @brief SGP30 gas sensor on the host I2C master bus: command decoding,
+//!        measurement durations on the virtual clock, CRC-8 per word, the
+//!        15 s warm up after iaq_init and a baseline that can be read and
+//!        restored.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "sensirion_crc8.h"
+#include "sgp30_model.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define MODEL_CMD_IAQ_INIT        0x2003u
+#define MODEL_CMD_MEASURE_IAQ     0x2008u
+#define MODEL_CMD_GET_BASELINE    0x2015u
+#define MODEL_CMD_SET_BASELINE    0x201Eu
+#define MODEL_CMD_GET_FEATURES    0x202Fu
+#define MODEL_CMD_MEASURE_TEST    0x2032u
+#define MODEL_CMD_GET_SERIAL      0x3682u
+
+#define MODEL_WARMUP_US           15000000u
+#define MODEL_MAX_WORDS           3u
+
+typedef struct
+{
+    uint16_t cmd;
+    uint8_t  args;        //!< argument words after the command
+    uint8_t  words;       //!< words to read back
+    uint32_t duration_us; //!< time before the result can be read
+}ModelCmd_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief I2C device handlers, see HalHostI2cDevice_t
+//
+static HAL_StatusTypeDef Read(void *ctx, uint8_t *data, uint16_t count);
+static HAL_StatusTypeDef Write(void *ctx, const uint8_t *data, uint16_t count);
+
+//
+//! @brief Next signal value
+//! @param[in]    None
+//! @param[out]   tvoc    tVOC in ppb
+//! @param[out]   co2_eq  CO2eq in ppm
+//! @return       None
+//
+static void Signal(uint16_t *tvoc, uint16_t *co2_eq);
+
+//
+//! @brief Deterministic pseudo random numbers, xorshift32
+//! @param[in]    None
+//! @param[out]   None
+//! @return       Next value
+//
+static uint32_t Random(void);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static const ModelCmd_t s_Cmds[] =
+{
+    {MODEL_CMD_IAQ_INIT,     0, 0, 10000u},
+    {MODEL_CMD_MEASURE_IAQ,  0, 2, 12000u},
+    {MODEL_CMD_GET_BASELINE, 0, 2, 10000u},
+    {MODEL_CMD_SET_BASELINE, 2, 0, 10000u},
+    {MODEL_CMD_GET_FEATURES, 0, 1, 10000u},
+    {MODEL_CMD_MEASURE_TEST, 0, 1, 220000u},
+    {MODEL_CMD_GET_SERIAL,   0, 3, 500u},
+};
+
+static const HalHostI2cDevice_t s_Device =
+{
+    SGP30_MODEL_ADDRESS, Read, Write, NULL
+};
+
+static Sgp30ModelStats_t s_Stats;
+static uint32_t          s_Random   = 1;
+static uint16_t          s_Result[MODEL_MAX_WORDS];
+static uint8_t           s_Words    = 0;
+static uint64_t          s_ReadyUs  = 0;
+static uint64_t          s_InitUs   = 0;
+static uint32_t          s_Baseline = 0;
+//slow drift phase and decaying event level of the signal
+static uint32_t          s_Phase    = 0;
+static uint32_t          s_Event    = 0;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int Sgp30ModelAttach(uint32_t seed)
+{
+    s_Random = (0u == seed) ? 1u : seed;
+    memset(&s_Stats, 0, sizeof(s_Stats));
+
+    return HalHostI2cAttach(&s_Device);
+}//end Sgp30ModelAttach
+
+void Sgp30ModelGetStats(Sgp30ModelStats_t *stats)
+{
+    *stats = s_Stats;
+}//end Sgp30ModelGetStats
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static HAL_StatusTypeDef Read(void *ctx, uint8_t *data, uint16_t count)
+{
+    uint16_t i;
+
+    (void)ctx;
+
+    if ((0u == s_Words) || (count != s_Words * SENSIRION_CRC8_FRAME_SIZE))
+    {
+        s_Stats.unknown++;
+        return HAL_ERROR;
+    }
+
+    //the sensor does not acknowledge its address while it measures
+    if (HalHostMicros() < s_ReadyUs)
+    {
+        s_Stats.early++;
+        return HAL_ERROR;
+    }
+
+    for (i = 0; i < s_Words; i++)
+    {
+        data[3u * i]      = (uint8_t)(s_Result[i] >> 8);
+        data[3u * i + 1u] = (uint8_t)s_Result[i];
+        data[3u * i + 2u] = sensirion_crc8(&data[3u * i], 2);
+    }
+
+    s_Words = 0;
+    s_Stats.reads++;
+
+    return HAL_OK;
+}//end Read
+
+static HAL_StatusTypeDef Write(void *ctx, const uint8_t *data, uint16_t count)
+{
+    const ModelCmd_t *cmd = NULL;
+    uint16_t          code;
+    uint32_t          i;
+
+    (void)ctx;
+
+    if (count < 2u)
+    {
+        s_Stats.unknown++;
+        return HAL_ERROR;
+    }
+
+    code = (uint16_t)(((uint16_t)data[0] << 8) | data[1]);
+
+    for (i = 0; i < sizeof(s_Cmds) / sizeof(s_Cmds[0]); i++)
+    {
+        if (code == s_Cmds[i].cmd)
+        {
+            cmd = &s_Cmds[i];
+        }
+    }
+
+    if ((NULL == cmd) || (count != 2u + cmd->args * SENSIRION_CRC8_FRAME_SIZE) ||
+        ((0u != cmd->args) && (0 != sensirion_crc8_check_words(&data[2], cmd->args))))
+    {
+        s_Stats.unknown++;
+        return HAL_ERROR;
+    }
+
+    s_Stats.commands++;
+    s_Words   = cmd->words;
+    s_ReadyUs = HalHostMicros() + cmd->duration_us;
+
+    switch (code)
+    {
+    case MODEL_CMD_IAQ_INIT:
+        s_InitUs   = HalHostMicros();
+        s_Baseline = 0;
+        break;
+
+    case MODEL_CMD_MEASURE_IAQ:
+        if (HalHostMicros() - s_InitUs < MODEL_WARMUP_US)
+        {
+            s_Result[0] = 400;
+            s_Result[1] = 0;
+        }
+        else
+        {
+            Signal(&s_Result[1], &s_Result[0]);
+        }
+        //the baseline follows the clean air level
+        s_Baseline = ((uint32_t)(400u + (s_Phase >> 12) % 16u) << 16) |
+                     (uint32_t)(s_Phase >> 10) % 64u;
+        break;
+
+    case MODEL_CMD_GET_BASELINE:
+        s_Result[0] = (uint16_t)(s_Baseline >> 16);
+        s_Result[1] = (uint16_t)s_Baseline;
+        break;
+
+    case MODEL_CMD_SET_BASELINE:
+        s_Baseline = ((uint32_t)data[2] << 24) | ((uint32_t)data[3] << 16) |
+                     ((uint32_t)data[5] << 8) | data[6];
+        break;
+
+    case MODEL_CMD_GET_FEATURES:
+        s_Result[0] = 0x0022;
+        break;
+
+    case MODEL_CMD_MEASURE_TEST:
+        s_Result[0] = 0xD400;
+        break;
+
+    case MODEL_CMD_GET_SERIAL:
+        s_Result[0] = 0x0000;
+        s_Result[1] = 0x0123;
+        s_Result[2] = 0x4567;
+        break;
+
+    default:
+        break;
+    }
+
+    return HAL_OK;
+}//end Write
+
+static void Signal(uint16_t *tvoc, uint16_t *co2_eq)
+{
+    uint32_t wave;
+
+    //triangle over about an hour at 1 Hz, plus events such as cooking
+    s_Phase++;
+    wave = s_Phase % 3600u;
+    wave = (wave < 1800u) ? wave : 3600u - wave;
+
+    if (0u == Random() % 600u)
+    {
+        s_Event += 200u + Random() % 800u;
+    }
+    s_Event -= s_Event / 32u;
+
+    *tvoc   = (uint16_t)(20u + wave / 30u + s_Event + Random() % 4u);
+    *co2_eq = (uint16_t)(400u + wave / 6u + s_Event / 2u + Random() % 8u);
+}//end Signal
+
+static uint32_t Random(void)
+{
+    s_Random ^= s_Random << 13;
+    s_Random ^= s_Random >> 17;
+    s_Random ^= s_Random << 5;
+
+    return s_Random;
+}//end Random
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
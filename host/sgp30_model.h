@@ -0,0 +1,66 @@
+//! @addtogroup Host
+//! @{
+//
+//****************************************************************************
+//! @file sgp30_model.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the SGP30 device model on the host I2C bus
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef SGP30_MODEL_H
+#define SGP30_MODEL_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include <stdint.h>
+#include "hal_host.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+#define SGP30_MODEL_ADDRESS   0x58
+
+typedef struct
+{
+    uint32_t commands;    //!< commands accepted
+    uint32_t reads;       //!< word reads answered
+    uint32_t early;       //!< reads NACKed, measurement still running
+    uint32_t unknown;     //!< commands NACKed as unknown or malformed
+}Sgp30ModelStats_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Attach the model at SGP30_MODEL_ADDRESS. It answers the commands
+//!        sgp30.c and sgp_app.c send with CRC protected words, NACKs a read
+//!        made before the command duration has passed on the virtual clock,
+//!        and gives 400 ppm / 0 ppb for the first 15 s after iaq_init as the
+//!        sensor does. tVOC and CO2eq then follow a slow waveform with
+//!        random events.
+//! @param[in]    seed  Seed of the signal
+//! @param[out]   None
+//! @return       0, or -1 if the address is taken
+//
+int Sgp30ModelAttach(uint32_t seed);
+
+//
+//! @brief Get model counters
+//! @param[in]    None
+//! @param[out]   stats  Counters
+//! @return       None
+//
+void Sgp30ModelGetStats(Sgp30ModelStats_t *stats);
+
+#endif // SGP30_MODEL_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
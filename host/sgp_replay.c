@@ -0,0 +1,250 @@
+//! @addtogroup Host
+//! @brief Trace replay driver
+//! @{
+//!
+//****************************************************************************/
+//! @file sgp_replay.c
+//! @brief Feeds a recorded SGPT trace (see sensirion_trace.h) back through
+//!        SgpInit()/SgpPoll on Linux as fast as possible and reports
+//!        samples/second and per stage cost.
+//!
+//!        Build from the repo root (embedded-sgp submodule checked out):
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication -Isgp30
+//!            -Iembedded-sgp/embedded-common -Iembedded-sgp/sgp30
+//!            -Iembedded-sgp/sgp-common
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/sgp_replay.c host/hal_host.c
+//!            application/sgp_app.c application/uart_app.c
+//!            application/i2c_slave_app.c application/prof.c
+//!            application/sample_sched.c application/kv_store.c
+//!            application/crc32.c application/idle.c
+//!            application/rtc_clock.c application/event_log.c
+//!            sgp30/sensirion_hw_i2c_implementation.c sgp30/sensirion_crc8.c
+//!            sgp30/sensirion_trace.c
+//!            embedded-sgp/embedded-common/sensirion_common.c
+//!            embedded-sgp/sgp30/sgp30.c -o sgp_replay
+//!
+//!        Usage: sgp_replay <trace file>
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "sensirion_trace.h"
+#include "sgp_app.h"
+#include "uart_app.h"
+#include "prof.h"
+#include "sample_sched.h"
+#include "kv_store.h"
+#include "rtc_clock.h"
+#include "event_log.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Serve the next recorded response
+//
+static HAL_StatusTypeDef ReplayRead(uint8_t address, uint8_t *data, uint16_t count);
+
+//
+//! @brief Commands are not recorded, accept all of them
+//
+static HAL_StatusTypeDef ReplayWrite(uint8_t address, const uint8_t *data, uint16_t count);
+
+//
+//! @brief Print results and leave
+//
+static void ReplayFinish(const char *reason);
+
+//
+//! @brief Wall clock in seconds
+//
+static double WallSeconds(void);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static sensirion_trace_reader_t s_Reader;
+static uint32_t s_Records = 0;
+static uint32_t s_Samples = 0;
+static double   s_Start   = 0;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <trace file>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *file = fopen(argv[1], "rb");
+
+    if (NULL == file)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long len = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *trace = malloc((size_t)len);
+
+    if ( (NULL == trace) || (fread(trace, 1, (size_t)len, file) != (size_t)len) )
+    {
+        fprintf(stderr, "failed to read %s\n", argv[1]);
+        return 1;
+    }
+
+    fclose(file);
+
+    if (STATUS_OK != sensirion_trace_reader_init(&s_Reader, trace, (uint32_t)len))
+    {
+        fprintf(stderr, "%s is not a SGPT trace\n", argv[1]);
+        return 1;
+    }
+
+    HalHostSetI2cDevice(ReplayRead, ReplayWrite);
+    ProfInit();
+
+    s_Start = WallSeconds();
+
+    UARTInit();
+    KvStoreInit();
+    (void)RtcClockInit();
+    EventLogInit();
+    SgpInit();
+    SgpPollStart();
+
+    //ReplayRead() ends the run once the trace is used up
+    while (1)
+    {
+        SgpPollStep();
+        s_Samples++;
+    }
+}
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static HAL_StatusTypeDef ReplayRead(uint8_t address, uint8_t *data, uint16_t count)
+{
+    sensirion_trace_rec_t rec;
+
+    if (STATUS_OK != sensirion_trace_next(&s_Reader, &rec))
+    {
+        ReplayFinish("end of trace");
+    }
+
+    if ( (rec.address != address) || (rec.count != count) )
+    {
+        ReplayFinish("pipeline diverged from trace");
+    }
+
+    s_Records++;
+    HalHostSetTick(rec.timestamp_ms);
+
+    if (STATUS_OK != rec.status)
+    {
+        return HAL_ERROR;
+    }
+
+    memcpy(data, rec.data, count);
+
+    return HAL_OK;
+}
+
+static HAL_StatusTypeDef ReplayWrite(uint8_t address, const uint8_t *data, uint16_t count)
+{
+    (void)address;
+    (void)data;
+    (void)count;
+
+    return HAL_OK;
+}
+
+static void ReplayFinish(const char *reason)
+{
+    double elapsed = WallSeconds() - s_Start;
+
+    printf("replay stopped: %s\n", reason);
+    printf("records      : %u\n", s_Records);
+    printf("samples      : %u\n", s_Samples);
+    printf("virtual time : %u ms\n", HAL_GetTick());
+    printf("wall time    : %.6f s\n", elapsed);
+
+    if (elapsed > 0)
+    {
+        printf("samples/s    : %.0f\n", s_Samples / elapsed);
+    }
+
+    const SampleSchedStats_t *sched = SampleSchedGetStats();
+
+    printf("uart bytes   : %u\n", HalHostUartBytes());
+    printf("sched        : %u samples, %u reports, %u summaries, %u stores, %u changes\n",
+           sched->samples, sched->reports, sched->summaries, sched->stores,
+           sched->changes);
+
+    if (sched->samples > 0)
+    {
+        printf("saved        : %.1f%% reports, %.1f%% stores\n",
+               100.0 * (sched->samples - sched->reports) / sched->samples,
+               100.0 * (sched->samples - sched->stores) / sched->samples);
+    }
+
+    printf("%-10s %10s %14s %10s %10s\n", "stage", "calls",
+           "total " PROF_UNIT_STR, "mean", "max");
+
+    for (int stage = 0; stage < PROF_STAGE_COUNT; stage++)
+    {
+        const ProfStat_t *stat = ProfGet((ProfStage_t)stage);
+
+        printf("%-10s %10u %14llu %10llu %10u\n", ProfName((ProfStage_t)stage),
+               stat->calls, (unsigned long long)stat->total,
+               (unsigned long long)(stat->calls ? stat->total / stat->calls : 0),
+               stat->max);
+    }
+
+    exit(0);
+}
+
+static double WallSeconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,249 @@
+//! @addtogroup Host
+//! @brief Closed loop simulation on the host peripheral model
+//! @{
+//!
+//****************************************************************************/
+//! @file sgp_sim.c
+//! @brief Runs the firmware from boot on the host HAL model with the SGP30
+//!        device model on the I2C bus, for a span of virtual time, with a
+//!        reboot every few hours and faults injected at the given rates.
+//!        Covers the acquisition loop (SgpPollStep), storage (baseline and
+//!        boot counter in kv_store) and telemetry (UART reports) and
+//!        reports their cost, the active/idle split of the CPU and what the
+//!        faults did. The run is repeatable
+//!        for a given seed.
+//!
+//!        Build from the repo root (embedded-sgp submodule checked out):
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication -Isgp30
+//!            -Iembedded-sgp/embedded-common -Iembedded-sgp/sgp30
+//!            -Iembedded-sgp/sgp-common
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/sgp_sim.c host/sgp30_model.c host/hal_host.c
+//!            application/sgp_app.c application/uart_app.c
+//!            application/i2c_slave_app.c application/prof.c
+//!            application/sample_sched.c application/kv_store.c
+//!            application/crc32.c application/idle.c
+//!            application/rtc_clock.c application/event_log.c
+//!            sgp30/sensirion_hw_i2c_implementation.c sgp30/sensirion_crc8.c
+//!            sgp30/sensirion_trace.c
+//!            embedded-sgp/embedded-common/sensirion_common.c
+//!            embedded-sgp/sgp30/sgp30.c -o sgp_sim
+//!
+//!        Usage: sgp_sim [hours] [i2c fault ppm] [flash fault ppm] [seed]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "app_config.h"
+#include "hal_host.h"
+#include "sgp30_model.h"
+#include "sgp_app.h"
+#include "uart_app.h"
+#include "prof.h"
+#include "sample_sched.h"
+#include "kv_store.h"
+#include "idle.h"
+#include "rtc_clock.h"
+#include "event_log.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define SIM_REBOOT_HOURS   6u
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static uint64_t NowNs(void);
+static void Boot(void);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static uint32_t s_Boots = 0;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t            hours     = (argc > 1) ? (uint32_t)atoi(argv[1]) : 24u;
+    uint32_t            i2c_ppm   = (argc > 2) ? (uint32_t)atoi(argv[2]) : 0u;
+    uint32_t            flash_ppm = (argc > 3) ? (uint32_t)atoi(argv[3]) : 0u;
+    uint32_t            seed      = (argc > 4) ? (uint32_t)atoi(argv[4]) : 1u;
+    uint64_t            end_us    = (uint64_t)hours * 3600u * 1000000u;
+    uint64_t            start     = NowNs();
+    uint32_t            samples   = 0;
+    uint32_t            boot_kv   = 0;
+    uint32_t            baseline  = 0;
+    double              wall;
+    Sgp30ModelStats_t   model;
+    KvStoreStats_t      kv;
+    HalHostFlashStats_t flash;
+    IdleStats_t         idle;
+    int                 stage;
+
+    HalHostFaultSeed(seed);
+    HalHostFaultRate(HAL_HOST_FAULT_I2C_NACK, i2c_ppm);
+    HalHostFaultRate(HAL_HOST_FAULT_I2C_BITFLIP, i2c_ppm);
+    HalHostFaultRate(HAL_HOST_FAULT_FLASH_PROGRAM, flash_ppm);
+    HalHostFaultRate(HAL_HOST_FAULT_FLASH_ERASE, flash_ppm);
+
+    if (0 != Sgp30ModelAttach(seed))
+    {
+        fprintf(stderr, "I2C address taken\n");
+        return 1;
+    }
+
+    ProfInit();
+    IdleInit();
+    UARTInit();
+
+    while (HalHostMicros() < end_us)
+    {
+        uint64_t reboot_us = HalHostMicros() + (uint64_t)SIM_REBOOT_HOURS * 3600u * 1000000u;
+#if APP_SAMPLE_CLOCK_RTC
+        RtcStamp_t stamp;
+        uint32_t   due;
+
+        Boot();
+        (void)RtcClockStart(SAMPLE_SCHED_PERIOD_MS / 1000u);
+
+        //SgpPoll() without its endless loop
+        while ((HalHostMicros() < end_us) && (HalHostMicros() < reboot_us))
+        {
+            while (0u == (due = RtcClockTake(&stamp)))
+            {
+                KvStoreService();
+                (void)IdleUntil(HAL_GetTick() + SAMPLE_SCHED_PERIOD_MS);
+            }
+
+            if (due > 1u)
+            {
+                EventLogPut(EVENT_LOG_MISSED, EVENT_LOG_FLAG_WAKEUP, &stamp,
+                            (uint16_t)(due - 1u), 0);
+            }
+
+            SgpPollStepAt(&stamp, EVENT_LOG_FLAG_WAKEUP);
+            samples++;
+        }
+#else
+        uint32_t deadline;
+
+        Boot();
+        deadline = HAL_GetTick();
+
+        //SgpPoll() without its endless loop
+        while ((HalHostMicros() < end_us) && (HalHostMicros() < reboot_us))
+        {
+            SgpPollStep();
+            samples++;
+
+            deadline += SAMPLE_SCHED_PERIOD_MS;
+            do
+            {
+                KvStoreService();
+            } while (IdleUntil(deadline));
+        }
+#endif
+    }
+
+    wall = (double)(NowNs() - start) / 1e9;
+
+    KvStoreInit();
+    (void)KvStoreRead(KV_KEY_BOOT_COUNT, &boot_kv, sizeof(boot_kv), NULL);
+    (void)KvStoreRead(KV_KEY_SGP_BASELINE, &baseline, sizeof(baseline), NULL);
+    Sgp30ModelGetStats(&model);
+    KvStoreGetStats(&kv);
+    HalHostFlashGetStats(&flash);
+    IdleGetStats(&idle);
+
+    printf("virtual    %u h in %.3f s wall, %.0fx real time\n", (unsigned)hours, wall,
+           (wall > 0.0) ? (double)end_us / 1e6 / wall : 0.0);
+    printf("samples    %u, %u boots (%u stored), baseline 0x%08X stored\n",
+           (unsigned)samples, (unsigned)s_Boots, (unsigned)boot_kv, (unsigned)baseline);
+    printf("sensor     %u commands, %u reads, %u early reads, %u rejected\n",
+           (unsigned)model.commands, (unsigned)model.reads, (unsigned)model.early,
+           (unsigned)model.unknown);
+    printf("telemetry  %u UART bytes\n", (unsigned)HalHostUartBytes());
+    printf("storage    %u bytes programmed, %u erases, %.1f ms flash busy, %u records at boot\n",
+           (unsigned)flash.bytes, (unsigned)flash.erases, (double)flash.busy_us / 1e3,
+           (unsigned)kv.records);
+    printf("cpu        %.3f%% active, %llu active / %llu idle cycles, %u sleeps, %u early\n",
+           100.0 * (double)idle.active / (double)(idle.active + idle.idle),
+           (unsigned long long)idle.active, (unsigned long long)idle.idle,
+           (unsigned)idle.sleeps, (unsigned)idle.early);
+    printf("faults    ");
+    for (stage = 0; stage < HAL_HOST_FAULT_COUNT; stage++)
+    {
+        printf(" %s %u", HalHostFaultName((HalHostFault_t)stage),
+               (unsigned)HalHostFaultCount((HalHostFault_t)stage));
+    }
+    printf("\n");
+
+    printf("%-10s %10s %14s %10s %10s\n", "stage", "calls",
+           "total " PROF_UNIT_STR, "mean", "max");
+    for (stage = 0; stage < PROF_STAGE_COUNT; stage++)
+    {
+        const ProfStat_t *stat = ProfGet((ProfStage_t)stage);
+
+        printf("%-10s %10u %14llu %10llu %10u\n", ProfName((ProfStage_t)stage),
+               (unsigned)stat->calls, (unsigned long long)stat->total,
+               (unsigned long long)(stat->calls ? stat->total / stat->calls : 0),
+               (unsigned)stat->max);
+    }
+
+    //every boot must have been counted, faults or not
+    return (boot_kv == s_Boots) ? 0 : 2;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}//end NowNs
+
+static void Boot(void)
+{
+    uint32_t boots = 0;
+
+    //as main(): flash contents survive, RAM state is rebuilt
+    KvStoreInit();
+    (void)KvStoreRead(KV_KEY_BOOT_COUNT, &boots, sizeof(boots), NULL);
+    boots++;
+    while (KV_OK != KvStoreWrite(KV_KEY_BOOT_COUNT, &boots, sizeof(boots)))
+    {
+        //a refused program is retried, compaction frees room
+        (void)KvStoreService();
+    }
+    s_Boots++;
+
+    (void)RtcClockInit();
+    EventLogInit();
+    SgpInit();
+    SgpPollStart();
+}//end Boot
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
@@ -0,0 +1,255 @@
+//! @addtogroup Host
+//! @brief UART receive engine benchmark
+//! @{
+//!
+//****************************************************************************/
+//! @file uart_rx_bench.c
+//! @brief Streams generated command lines through the USART2 DMA receive
+//!        ring of uart_app.c at 921600 baud of virtual time and reports the
+//!        CPU cost per byte of the engine and a line consumer, the headroom
+//!        against the line rate, and the overrun accounting when the
+//!        consumer polls too slowly.
+//!
+//!        Build from the repo root:
+//!
+//!        gcc -O2 -DHOST_BUILD -DSTM32F411xE -include host/cmsis_host.h
+//!            -Ihost -Iapplication
+//!            -Idrivers/STM32F4xx_HAL_Driver/Inc -Idrivers/CMSIS/Include
+//!            -Idrivers/CMSIS/Device/ST/STM32F4xx/Include
+//!            host/uart_rx_bench.c host/hal_host.c application/uart_app.c
+//!            -o uart_rx_bench
+//!
+//!        Usage: uart_rx_bench [megabytes] [slow poll ms]
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+//user defined header files
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "uart_app.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define BENCH_BAUDRATE      921600u
+//8N1: start + 8 data + stop
+#define BENCH_BYTES_PER_S   (BENCH_BAUDRATE / 10u)
+#define BENCH_POLL_US       1000u
+#define BENCH_LINE_MAX      200u
+//a burst of lines, then the host pauses and the line goes idle
+#define BENCH_BURST_LINES   8u
+
+typedef struct
+{
+    uint64_t lines;
+    uint64_t bytes;
+    uint64_t failed;
+    uint32_t hash;
+    uint64_t ns;
+}BenchResult_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+static uint64_t NowNs(void);
+static uint32_t Fnv(uint32_t hash, const uint8_t *data, uint32_t len);
+static uint32_t Generate(uint8_t *buf, uint32_t size, uint32_t *lines, uint32_t *hash);
+static void Drain(BenchResult_t *result);
+static void Run(const uint8_t *stream, uint32_t size, uint32_t poll_us,
+                BenchResult_t *result, UARTRxStats_t *stats);
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static uint32_t s_Seed = 12345u;
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t megabytes = (argc > 1) ? (uint32_t)atoi(argv[1]) : 8u;
+    uint32_t slow_ms   = (argc > 2) ? (uint32_t)atoi(argv[2]) : 20u;
+    uint32_t size      = megabytes * 1024u * 1024u;
+    uint32_t lines     = 0;
+    uint32_t hash      = 2166136261u;
+    uint8_t *stream    = malloc(size);
+    BenchResult_t result;
+    UARTRxStats_t stats;
+    double   ns_per_byte;
+
+    if (NULL == stream)
+    {
+        return 1;
+    }
+
+    size = Generate(stream, size, &lines, &hash);
+    HalHostSetUartIrq(UARTRxIrqHandler);
+
+    Run(stream, size, BENCH_POLL_US, &result, &stats);
+    ns_per_byte = (double)result.ns / (double)result.bytes;
+
+    printf("%u bytes, %u lines at %u baud, consumer polls every %u us\n",
+           (unsigned)size, (unsigned)lines, (unsigned)BENCH_BAUDRATE,
+           (unsigned)BENCH_POLL_US);
+    printf("received   %llu lines %llu bytes, data %s\n",
+           (unsigned long long)result.lines, (unsigned long long)result.bytes,
+           ((result.hash == hash) && (result.lines == lines)) ? "intact" : "CORRUPT");
+    printf("idle       %u events, overruns %u (%u bytes), line errors %u\n",
+           (unsigned)stats.idle_events, (unsigned)stats.overruns,
+           (unsigned)stats.overrun_bytes, (unsigned)stats.line_errors);
+    printf("cost       %.1f ns/byte, %.0f bytes/s sustainable = %.0fx the line rate\n",
+           ns_per_byte, 1e9 / ns_per_byte, 1e9 / ns_per_byte / BENCH_BYTES_PER_S);
+
+    Run(stream, size, slow_ms * 1000u, &result, &stats);
+
+    printf("\nslow consumer, polls every %u ms\n", (unsigned)slow_ms);
+    printf("received   %llu lines %llu bytes, %llu lines dropped on consume\n",
+           (unsigned long long)result.lines, (unsigned long long)result.bytes,
+           (unsigned long long)result.failed);
+    printf("overruns   %u (%u bytes dropped of %u)\n",
+           (unsigned)stats.overruns, (unsigned)stats.overrun_bytes,
+           (unsigned)stats.bytes);
+
+    free(stream);
+
+    return 0;
+}//end main
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}//end NowNs
+
+static uint32_t Fnv(uint32_t hash, const uint8_t *data, uint32_t len)
+{
+    while (len--)
+    {
+        hash = (hash ^ *data++) * 16777619u;
+    }
+
+    return hash;
+}//end Fnv
+
+static uint32_t Generate(uint8_t *buf, uint32_t size, uint32_t *lines, uint32_t *hash)
+{
+    uint32_t pos = 0;
+
+    while (size - pos > BENCH_LINE_MAX)
+    {
+        uint32_t len = 4u + (s_Seed >> 16) % (BENCH_LINE_MAX - 4u);
+        uint32_t i;
+
+        for (i = 0; i < len - 1u; i++)
+        {
+            s_Seed   = s_Seed * 1103515245u + 12345u;
+            buf[pos + i] = (uint8_t)(' ' + (s_Seed >> 16) % 94u);
+        }
+        buf[pos + len - 1u] = '\n';
+
+        *hash = Fnv(*hash, &buf[pos], len);
+        (*lines)++;
+        pos += len;
+    }
+
+    return pos;
+}//end Generate
+
+static void Drain(BenchResult_t *result)
+{
+    UARTRxSpan_t first;
+    UARTRxSpan_t second;
+    uint16_t     len;
+    uint64_t     start = NowNs();
+
+    while (0 != (len = UARTRxLine(&first, &second)))
+    {
+        uint32_t hash = Fnv(result->hash, first.data, first.len);
+
+        hash = Fnv(hash, second.data, second.len);
+
+        if (0 == UARTRxConsume(len))
+        {
+            result->hash = hash;
+            result->lines++;
+            result->bytes += len;
+        }
+        else
+        {
+            result->failed++;
+        }
+    }
+
+    result->ns += NowNs() - start;
+}//end Drain
+
+static void Run(const uint8_t *stream, uint32_t size, uint32_t poll_us,
+                BenchResult_t *result, UARTRxStats_t *stats)
+{
+    uint32_t per_poll = (uint32_t)((uint64_t)BENCH_BYTES_PER_S * poll_us / 1000000u);
+    uint32_t pos      = 0;
+    uint32_t lines    = 0;
+
+    memset(result, 0, sizeof(*result));
+    result->hash = 2166136261u;
+    UARTInit();
+
+    while (pos < size)
+    {
+        uint32_t end = (size - pos < per_poll) ? size : pos + per_poll;
+        uint64_t start;
+
+        //feed line by line so bursts can end with an idle line
+        while (pos < end)
+        {
+            const uint8_t *nl  = memchr(&stream[pos], '\n', size - pos);
+            uint32_t       len = (uint32_t)(nl - &stream[pos]) + 1u;
+
+            if (pos + len > end)
+            {
+                len = end - pos;
+                HalHostUartRxFeed(&stream[pos], len);
+                pos += len;
+                break;
+            }
+
+            HalHostUartRxFeed(&stream[pos], len);
+            pos += len;
+
+            if (0 == (++lines % BENCH_BURST_LINES))
+            {
+                start = NowNs();
+                HalHostUartRxIdle();
+                result->ns += NowNs() - start;
+            }
+        }
+
+        Drain(result);
+    }
+
+    HalHostUartRxIdle();
+    Drain(result);
+    UARTRxGetStats(stats);
+}//end Run
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
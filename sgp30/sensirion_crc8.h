@@ -0,0 +1,81 @@
+//! @addtogroup SensirionCrc8
+//! @{
+//
+//****************************************************************************
+//! @file sensirion_crc8.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the table driven Sensirion CRC-8
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef SENSIRION_CRC8_H
+#define SENSIRION_CRC8_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include "sensirion_arch_config.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//CRC-8 used on every Sensirion word: poly x^8 + x^5 + x^4 + 1, init 0xFF
+#define SENSIRION_CRC8_POLYNOMIAL  0x31
+#define SENSIRION_CRC8_INIT        0xFF
+
+//One word on the wire: 2 data bytes followed by their CRC
+#define SENSIRION_CRC8_FRAME_SIZE  3
+
+//Largest response read through sensirion_i2c_read_words_checked()
+#define SENSIRION_CRC8_MAX_WORDS   16
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Bit at a time CRC-8, same algorithm as the common layer
+//! @param[in]    data   Bytes to checksum
+//! @param[in]    count  Number of bytes
+//! @param[out]   None
+//! @return       CRC-8
+//
+uint8_t sensirion_crc8_bitwise(const uint8_t* data, uint16_t count);
+
+//
+//! @brief Table driven CRC-8
+//! @param[in]    data   Bytes to checksum
+//! @param[in]    count  Number of bytes
+//! @param[out]   None
+//! @return       CRC-8
+//
+uint8_t sensirion_crc8(const uint8_t* data, uint16_t count);
+
+//
+//! @brief Validate every word of a raw multi-word response in one pass
+//! @param[in]    buf        Raw response, SENSIRION_CRC8_FRAME_SIZE bytes per word
+//! @param[in]    num_words  Number of words in buf
+//! @param[out]   None
+//! @return       STATUS_OK if all CRCs match, STATUS_FAIL otherwise
+//
+int8_t sensirion_crc8_check_words(const uint8_t* buf, uint16_t num_words);
+
+//
+//! @brief Read a multi-word response, validate it and convert to words
+//! @param[in]    address     7-bit I2C address
+//! @param[in]    num_words   Number of words to read, max SENSIRION_CRC8_MAX_WORDS
+//! @param[out]   data_words  Received words in host byte order
+//! @return       STATUS_OK on success, STATUS_FAIL otherwise
+//
+int16_t sensirion_i2c_read_words_checked(uint8_t address, uint16_t* data_words,
+                                         uint16_t num_words);
+
+#endif // SENSIRION_CRC8_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
@@ -32,11 +32,18 @@
 #include "sensirion_arch_config.h"
 #include "sensirion_common.h"
 #include "sensirion_i2c.h"
+#include "sensirion_trace.h"
 #include "stm32f4xx_hal.h"
+#include "prof.h"
+#include "app_config.h"
 
+#if !APP_I2C_BACKEND_LL
 I2C_HandleTypeDef hi2c1;
 
+APP_STATIC_ASSERT(sizeof(hi2c1) <= APP_RAM_BUDGET_SENSIRION, sensirion_ram_budget);
+
 static void Error_Handler(void);
+#endif
 
 /*
  * INSTRUCTIONS
@@ -61,6 +68,7 @@ int16_t sensirion_i2c_select_bus(uint8_t bus_idx) {
     return STATUS_FAIL;
 }
 
+#if !APP_I2C_BACKEND_LL
 /**
  * Initialize all hard- and software components that are needed for the I2C
  * communication.
@@ -101,13 +109,19 @@ void sensirion_i2c_release(void) {
 int8_t sensirion_i2c_read(uint8_t address, uint8_t* data, uint16_t count) {
     int8_t ret = STATUS_FAIL;
 
+    PROF_BEGIN(start);
     HAL_StatusTypeDef status = HAL_I2C_Master_Receive(&hi2c1, address<<1, (uint8_t*)data, count, 100);
+    PROF_END(PROF_STAGE_I2C_READ, start);
     
     if (HAL_OK == status)
     {
-        return STATUS_OK;
+        ret = STATUS_OK;
     }
 
+#if SENSIRION_TRACE_ENABLE
+    sensirion_trace_record(HAL_GetTick(), address, data, count, ret);
+#endif
+
     return ret;
 }
 
@@ -126,7 +140,9 @@ int8_t sensirion_i2c_write(uint8_t address, const uint8_t* data,
                            uint16_t count) {
     int8_t ret = STATUS_FAIL;
     
+    PROF_BEGIN(start);
     HAL_StatusTypeDef status = HAL_I2C_Master_Transmit(&hi2c1, address<<1, (uint8_t*)data, count, 100);
+    PROF_END(PROF_STAGE_I2C_WRITE, start);
     
     if (HAL_OK == status)
     {
@@ -135,6 +151,7 @@ int8_t sensirion_i2c_write(uint8_t address, const uint8_t* data,
     
     return ret;
 }
+#endif /* !APP_I2C_BACKEND_LL */
 
 /**
  * Sleep for a given number of microseconds. The function should delay the
@@ -155,6 +172,7 @@ void sensirion_sleep_usec(uint32_t useconds) {
     }
 }
 
+#if !APP_I2C_BACKEND_LL
 /**
   * @brief  This function is executed in case of error occurrence.
   * @param  None
@@ -169,3 +187,4 @@ static void Error_Handler(void)
   }
   /* USER CODE END Error_Handler */ 
 }
+#endif /* !APP_I2C_BACKEND_LL */
@@ -0,0 +1,366 @@
+//! @addtogroup SensirionLLI2c
+//! @brief LL based I2C1 master backend of the Sensirion driver
+//! @{
+//!
+//****************************************************************************/
+//! @file sensirion_ll_i2c.c
+//! @brief Compact interrupt driven I2C1 master for short write-then-read
+//!        transactions, built on the LL driver. Replaces the HAL backend in
+//!        sensirion_hw_i2c_implementation.c when APP_I2C_BACKEND_LL is set:
+//!        no handle locking, no state bookkeeping and no polling of every
+//!        flag with a timeout, the core sleeps in WFI while the bus runs.
+//!        Follows the master transmitter/receiver sequences of RM0383
+//!        section 18.3.3, including the 1, 2 and 3 byte receive endings.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+//user defined header files
+#include "app_config.h"
+
+#if APP_I2C_BACKEND_LL
+#include "stm32f4xx_hal.h"
+#include "stm32f4xx_ll_i2c.h"
+#include "sensirion_arch_config.h"
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+#include "sensirion_trace.h"
+#include "sensirion_ll_i2c.h"
+#include "prof.h"
+#include "idle.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+#define SGP_I2C                I2C1
+//I2C1 on the Arduino header of the Nucleo-F411RE (D15/D14)
+#define SGP_I2C_SCL_Pin        GPIO_PIN_8
+#define SGP_I2C_SDA_Pin        GPIO_PIN_9
+#define SGP_I2C_GPIO_Port      GPIOB
+
+#define I2C_ERROR_FLAGS        (I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR)
+
+typedef struct
+{
+    const uint8_t   *tx;
+    uint8_t         *rx;
+    uint16_t         tx_len;
+    uint16_t         rx_len;
+    uint8_t          addr;
+    uint8_t          reading;
+    volatile uint8_t busy;
+    volatile int8_t  result;
+}LLI2cXfer_t;
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Start the transaction in s_Xfer and sleep until the interrupts
+//!        finish it
+//! @param[in]    None
+//! @param[out]   None
+//! @return       STATUS_OK or STATUS_FAIL
+//
+static int8_t Run(void);
+
+//
+//! @brief End the transaction from interrupt or timeout context
+//! @param[in]    result  STATUS_OK or STATUS_FAIL
+//! @param[out]   None
+//! @return       None
+//
+static void Finish(int8_t result);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static LLI2cXfer_t s_Xfer;
+
+APP_STATIC_ASSERT(sizeof(s_Xfer) <= APP_RAM_BUDGET_SENSIRION, sensirion_ll_ram_budget);
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void sensirion_i2c_init(void)
+{
+    GPIO_InitTypeDef   GPIO_InitStruct = {0};
+    LL_I2C_InitTypeDef I2C_InitStruct  = {0};
+
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+    GPIO_InitStruct.Pin       = SGP_I2C_SCL_Pin | SGP_I2C_SDA_Pin;
+    GPIO_InitStruct.Mode      = GPIO_MODE_AF_OD;
+    GPIO_InitStruct.Pull      = GPIO_PULLUP;
+    GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_VERY_HIGH;
+    GPIO_InitStruct.Alternate = GPIO_AF4_I2C1;
+    HAL_GPIO_Init(SGP_I2C_GPIO_Port, &GPIO_InitStruct);
+
+    __HAL_RCC_I2C1_CLK_ENABLE();
+    __HAL_RCC_I2C1_FORCE_RESET();
+    __HAL_RCC_I2C1_RELEASE_RESET();
+
+    I2C_InitStruct.PeripheralMode  = LL_I2C_MODE_I2C;
+    I2C_InitStruct.ClockSpeed      = SENSIRION_LL_I2C_SPEED_HZ;
+    I2C_InitStruct.DutyCycle       = LL_I2C_DUTYCYCLE_2;
+    I2C_InitStruct.OwnAddress1     = 0;
+    I2C_InitStruct.TypeAcknowledge = LL_I2C_ACK;
+    I2C_InitStruct.OwnAddrSize     = LL_I2C_OWNADDRESS1_7BIT;
+    LL_I2C_Init(SGP_I2C, &I2C_InitStruct);
+
+    HAL_NVIC_SetPriority(I2C1_EV_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_SetPriority(I2C1_ER_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+}//end sensirion_i2c_init
+
+void sensirion_i2c_release(void)
+{
+    HAL_NVIC_DisableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_DisableIRQ(I2C1_ER_IRQn);
+    LL_I2C_Disable(SGP_I2C);
+    __HAL_RCC_I2C1_CLK_DISABLE();
+    HAL_GPIO_DeInit(SGP_I2C_GPIO_Port, SGP_I2C_SCL_Pin | SGP_I2C_SDA_Pin);
+}//end sensirion_i2c_release
+
+int8_t sensirion_i2c_read(uint8_t address, uint8_t* data, uint16_t count)
+{
+    PROF_BEGIN(start);
+    int8_t ret = sensirion_i2c_write_read(address, NULL, 0, data, count);
+    PROF_END(PROF_STAGE_I2C_READ, start);
+
+#if SENSIRION_TRACE_ENABLE
+    sensirion_trace_record(HAL_GetTick(), address, data, count, ret);
+#endif
+
+    return ret;
+}//end sensirion_i2c_read
+
+int8_t sensirion_i2c_write(uint8_t address, const uint8_t* data, uint16_t count)
+{
+    PROF_BEGIN(start);
+    int8_t ret = sensirion_i2c_write_read(address, data, count, NULL, 0);
+    PROF_END(PROF_STAGE_I2C_WRITE, start);
+
+    return ret;
+}//end sensirion_i2c_write
+
+int8_t sensirion_i2c_write_read(uint8_t address, const uint8_t* tx,
+                                uint16_t tx_count, uint8_t* rx,
+                                uint16_t rx_count)
+{
+    if ((0 == tx_count) && (0 == rx_count))
+    {
+        return STATUS_FAIL;
+    }
+
+    s_Xfer.tx      = tx;
+    s_Xfer.tx_len  = tx_count;
+    s_Xfer.rx      = rx;
+    s_Xfer.rx_len  = rx_count;
+    s_Xfer.addr    = (uint8_t)(address << 1);
+    s_Xfer.reading = 0;
+
+    return Run();
+}//end sensirion_i2c_write_read
+
+void sensirion_ll_i2c_ev_irq(void)
+{
+    PROF_BEGIN(start);
+    uint32_t sr1 = SGP_I2C->SR1;
+
+    if (sr1 & I2C_SR1_SB)
+    {
+        //clears SB together with the SR1 read above
+        s_Xfer.reading = (0 == s_Xfer.tx_len);
+        LL_I2C_TransmitData8(SGP_I2C, (uint8_t)(s_Xfer.addr | s_Xfer.reading));
+    }
+    else if (sr1 & I2C_SR1_ADDR)
+    {
+        if (!s_Xfer.reading)
+        {
+            LL_I2C_ClearFlag_ADDR(SGP_I2C);
+        }
+        else if (1 == s_Xfer.rx_len)
+        {
+            //NACK before clearing ADDR, STOP right after it
+            LL_I2C_AcknowledgeNextData(SGP_I2C, LL_I2C_NACK);
+            LL_I2C_ClearFlag_ADDR(SGP_I2C);
+            LL_I2C_GenerateStopCondition(SGP_I2C);
+        }
+        else if (2 == s_Xfer.rx_len)
+        {
+            //NACK applies to the second byte, both are read on BTF
+            LL_I2C_AcknowledgeNextData(SGP_I2C, LL_I2C_NACK);
+            LL_I2C_EnableBitPOS(SGP_I2C);
+            LL_I2C_ClearFlag_ADDR(SGP_I2C);
+            LL_I2C_DisableIT_BUF(SGP_I2C);
+        }
+        else
+        {
+            LL_I2C_AcknowledgeNextData(SGP_I2C, LL_I2C_ACK);
+            LL_I2C_ClearFlag_ADDR(SGP_I2C);
+            if (3 == s_Xfer.rx_len)
+            {
+                LL_I2C_DisableIT_BUF(SGP_I2C);
+            }
+        }
+    }
+    else if (!s_Xfer.reading)
+    {
+        if ((sr1 & I2C_SR1_TXE) && (s_Xfer.tx_len > 0))
+        {
+            LL_I2C_TransmitData8(SGP_I2C, *s_Xfer.tx++);
+            if (0 == --s_Xfer.tx_len)
+            {
+                //wait for the last byte to leave the shift register
+                LL_I2C_DisableIT_BUF(SGP_I2C);
+            }
+        }
+        else if (sr1 & I2C_SR1_BTF)
+        {
+            if (s_Xfer.rx_len > 0)
+            {
+                //repeated start into the read phase
+                LL_I2C_EnableIT_BUF(SGP_I2C);
+                LL_I2C_GenerateStartCondition(SGP_I2C);
+            }
+            else
+            {
+                LL_I2C_GenerateStopCondition(SGP_I2C);
+                Finish(STATUS_OK);
+            }
+        }
+    }
+    else if ((sr1 & I2C_SR1_RXNE) && (1 == s_Xfer.rx_len))
+    {
+        *s_Xfer.rx = LL_I2C_ReceiveData8(SGP_I2C);
+        s_Xfer.rx_len = 0;
+        Finish(STATUS_OK);
+    }
+    else if ((sr1 & I2C_SR1_RXNE) && (s_Xfer.rx_len > 3))
+    {
+        *s_Xfer.rx++ = LL_I2C_ReceiveData8(SGP_I2C);
+        if (3 == --s_Xfer.rx_len)
+        {
+            //the last three bytes are taken on BTF to place NACK and STOP
+            LL_I2C_DisableIT_BUF(SGP_I2C);
+        }
+    }
+    else if (sr1 & I2C_SR1_BTF)
+    {
+        if (3 == s_Xfer.rx_len)
+        {
+            //N-2 in DR, N-1 in shift register: NACK goes out with byte N
+            LL_I2C_AcknowledgeNextData(SGP_I2C, LL_I2C_NACK);
+            *s_Xfer.rx++ = LL_I2C_ReceiveData8(SGP_I2C);
+            s_Xfer.rx_len--;
+        }
+        else
+        {
+            //N-1 in DR, N in shift register
+            LL_I2C_GenerateStopCondition(SGP_I2C);
+            *s_Xfer.rx++ = LL_I2C_ReceiveData8(SGP_I2C);
+            *s_Xfer.rx++ = LL_I2C_ReceiveData8(SGP_I2C);
+            s_Xfer.rx_len = 0;
+            Finish(STATUS_OK);
+        }
+    }
+
+    PROF_END(PROF_STAGE_I2C_ISR, start);
+}//end sensirion_ll_i2c_ev_irq
+
+void sensirion_ll_i2c_er_irq(void)
+{
+    uint32_t sr1 = SGP_I2C->SR1;
+
+    if (sr1 & I2C_SR1_AF)
+    {
+        //address or data not acknowledged, release the bus
+        LL_I2C_GenerateStopCondition(SGP_I2C);
+    }
+
+    //error flags are rc_w0
+    SGP_I2C->SR1 = ~(sr1 & I2C_ERROR_FLAGS) & 0xFFFFu;
+    Finish(STATUS_FAIL);
+}//end sensirion_ll_i2c_er_irq
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static int8_t Run(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t tick    = HAL_GetTick();
+
+    //previous STOP may still be on the bus
+    while (LL_I2C_IsActiveFlag_BUSY(SGP_I2C))
+    {
+        if ((HAL_GetTick() - tick) > SENSIRION_LL_I2C_TIMEOUT_MS)
+        {
+            return STATUS_FAIL;
+        }
+    }
+
+    s_Xfer.busy   = 1;
+    s_Xfer.result = STATUS_FAIL;
+
+    LL_I2C_DisableBitPOS(SGP_I2C);
+    LL_I2C_AcknowledgeNextData(SGP_I2C, LL_I2C_ACK);
+    LL_I2C_EnableIT_EVT(SGP_I2C);
+    LL_I2C_EnableIT_BUF(SGP_I2C);
+    LL_I2C_EnableIT_ERR(SGP_I2C);
+    LL_I2C_GenerateStartCondition(SGP_I2C);
+
+    while (s_Xfer.busy)
+    {
+        if ((HAL_GetTick() - tick) > SENSIRION_LL_I2C_TIMEOUT_MS)
+        {
+            __disable_irq();
+            if (s_Xfer.busy)
+            {
+                LL_I2C_GenerateStopCondition(SGP_I2C);
+                Finish(STATUS_FAIL);
+            }
+            __set_PRIMASK(primask);
+            break;
+        }
+
+        //woken by the I2C1 interrupts, at the latest 1 ms on to look at
+        //the timeout; masked so a transfer ending here is not slept past
+        __disable_irq();
+        if (s_Xfer.busy)
+        {
+            IdleSleep(1000u);
+        }
+        __set_PRIMASK(primask);
+    }
+
+    return s_Xfer.result;
+}//end Run
+
+static void Finish(int8_t result)
+{
+    LL_I2C_DisableIT_EVT(SGP_I2C);
+    LL_I2C_DisableIT_BUF(SGP_I2C);
+    LL_I2C_DisableIT_ERR(SGP_I2C);
+    LL_I2C_DisableBitPOS(SGP_I2C);
+    LL_I2C_AcknowledgeNextData(SGP_I2C, LL_I2C_ACK);
+
+    s_Xfer.result = result;
+    s_Xfer.busy   = 0;
+}//end Finish
+
+#endif // APP_I2C_BACKEND_LL
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
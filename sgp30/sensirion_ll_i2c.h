@@ -0,0 +1,69 @@
+//! @addtogroup SensirionLLI2c
+//! @{
+//
+//****************************************************************************
+//! @file sensirion_ll_i2c.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the LL based interrupt driven I2C1 master backend of the
+//!        Sensirion driver (APP_I2C_BACKEND_LL)
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef SENSIRION_LL_I2C_H
+#define SENSIRION_LL_I2C_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include "sensirion_arch_config.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//Bus speed and per transaction timeout, same as the HAL backend
+#define SENSIRION_LL_I2C_SPEED_HZ     100000u
+#define SENSIRION_LL_I2C_TIMEOUT_MS   100u
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Write then read with a repeated start in between, for register
+//!        style devices that need no processing time between the two
+//! @param[in]    address   7-bit I2C address
+//! @param[in]    tx        Bytes to write, e.g. a register or command
+//! @param[in]    tx_count  Number of bytes to write, may be 0
+//! @param[in]    rx_count  Number of bytes to read, may be 0
+//! @param[out]   rx        Received bytes
+//! @return       STATUS_OK on success, STATUS_FAIL on NACK, bus error or timeout
+//
+int8_t sensirion_i2c_write_read(uint8_t address, const uint8_t* tx,
+                                uint16_t tx_count, uint8_t* rx,
+                                uint16_t rx_count);
+
+//
+//! @brief I2C1 event interrupt, call from I2C1_EV_IRQHandler
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void sensirion_ll_i2c_ev_irq(void);
+
+//
+//! @brief I2C1 error interrupt, call from I2C1_ER_IRQHandler
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void sensirion_ll_i2c_er_irq(void);
+
+#endif // SENSIRION_LL_I2C_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
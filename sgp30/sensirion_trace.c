@@ -0,0 +1,262 @@
+//! @addtogroup SensirionTrace
+//! @brief I2C response trace recorder and reader
+//! @{
+//!
+//****************************************************************************/
+//! @file sensirion_trace.c
+//! @brief Records raw sensirion_i2c_read() responses into a compact binary
+//!        trace and decodes it again for replay.
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//!
+//****************************************************************************/
+//****************************************************************************/
+//                           Includes
+//****************************************************************************/
+//standard header files
+#include <stdint.h>
+#include <string.h>
+//user defined header files
+#include "sensirion_arch_config.h"
+#include "sensirion_trace.h"
+
+//****************************************************************************/
+//                           Defines and typedefs
+//****************************************************************************/
+//worst case record overhead: 5 byte delta, address, 3 byte count
+#define RECORD_OVERHEAD   9
+
+//the reader is always available, recording storage only when enabled
+#if SENSIRION_TRACE_ENABLE
+#define TRACE_STORAGE_LEN SENSIRION_TRACE_BUF_LEN
+#else
+#define TRACE_STORAGE_LEN 1
+#endif
+
+//****************************************************************************/
+//                           Private Functions
+//****************************************************************************/
+//
+//! @brief Append a LEB128 varint
+//! @param[in]    value  Value to encode
+//! @param[out]   out    Output buffer
+//! @return       Number of bytes written
+//
+static uint16_t PutVarint(uint8_t* out, uint32_t value);
+
+//
+//! @brief Decode a LEB128 varint
+//! @param[in]    reader  Reader state
+//! @param[out]   value   Decoded value
+//! @return       STATUS_OK or STATUS_FAIL if truncated
+//
+static int16_t GetVarint(sensirion_trace_reader_t* reader, uint32_t* value);
+
+//****************************************************************************/
+//                           external variables
+//****************************************************************************/
+
+//****************************************************************************/
+//                           Private variables
+//****************************************************************************/
+static uint8_t  s_Buf[TRACE_STORAGE_LEN];
+static uint16_t s_Len           = 0;
+static uint8_t  s_Active        = 0;
+static uint32_t s_LastTimestamp = 0;
+static sensirion_trace_sink_t s_Sink = NULL;
+
+#if SENSIRION_TRACE_ENABLE
+APP_STATIC_ASSERT(sizeof(s_Buf) + 16 <= APP_RAM_BUDGET_TRACE, trace_ram_budget);
+#endif
+APP_STATIC_ASSERT(SENSIRION_TRACE_BUF_LEN >= SENSIRION_TRACE_HDR_LEN + RECORD_OVERHEAD + 9,
+                  trace_buf_fits_one_record);
+
+static const uint8_t s_Header[SENSIRION_TRACE_HDR_LEN] =
+{
+    'S', 'G', 'P', 'T', SENSIRION_TRACE_VERSION, 0, 0, 0
+};
+
+//****************************************************************************/
+//                    G L O B A L  F U N C T I O N S
+//****************************************************************************/
+void sensirion_trace_start(sensirion_trace_sink_t sink)
+{
+#if SENSIRION_TRACE_ENABLE
+    memcpy(s_Buf, s_Header, sizeof(s_Header));
+    s_Len           = sizeof(s_Header);
+    s_LastTimestamp = 0;
+    s_Sink          = sink;
+    s_Active        = 1;
+#else
+    (void)sink;
+#endif
+}//end sensirion_trace_start
+
+void sensirion_trace_stop(void)
+{
+    if ( (NULL != s_Sink) && (s_Len > 0) )
+    {
+        s_Sink(s_Buf, s_Len);
+        s_Len = 0;
+    }
+
+    s_Active = 0;
+}//end sensirion_trace_stop
+
+void sensirion_trace_record(uint32_t timestamp_ms, uint8_t address,
+                            const uint8_t* data, uint16_t count, int8_t status)
+{
+    uint16_t payload = (STATUS_OK == status) ? count : 0;
+
+    if (0 == s_Active)
+    {
+        return;
+    }
+
+    if ( (uint32_t)s_Len + RECORD_OVERHEAD + payload > sizeof(s_Buf) )
+    {
+        if (NULL == s_Sink)
+        {
+            //a gap would desync the replay, so the trace ends here
+            s_Active = 0;
+            return;
+        }
+
+        s_Sink(s_Buf, s_Len);
+        s_Len = 0;
+
+        if ( (uint32_t)RECORD_OVERHEAD + payload > sizeof(s_Buf) )
+        {
+            s_Active = 0;
+            return;
+        }
+    }
+
+    s_Len += PutVarint(&s_Buf[s_Len], timestamp_ms - s_LastTimestamp);
+    s_Buf[s_Len++] = (uint8_t)((address & 0x7F) |
+                               ((STATUS_OK == status) ? 0 : SENSIRION_TRACE_FAIL_FLAG));
+    s_Len += PutVarint(&s_Buf[s_Len], count);
+    memcpy(&s_Buf[s_Len], data, payload);
+    s_Len += payload;
+
+    s_LastTimestamp = timestamp_ms;
+}//end sensirion_trace_record
+
+const uint8_t* sensirion_trace_buffer(uint16_t* len)
+{
+    *len = s_Len;
+
+    return s_Buf;
+}//end sensirion_trace_buffer
+
+int16_t sensirion_trace_reader_init(sensirion_trace_reader_t* reader,
+                                    const uint8_t* buf, uint32_t len)
+{
+    if ( (len < SENSIRION_TRACE_HDR_LEN) ||
+         (0 != memcmp(buf, s_Header, SENSIRION_TRACE_HDR_LEN)) )
+    {
+        return STATUS_FAIL;
+    }
+
+    reader->pos          = buf + SENSIRION_TRACE_HDR_LEN;
+    reader->end          = buf + len;
+    reader->timestamp_ms = 0;
+
+    return STATUS_OK;
+}//end sensirion_trace_reader_init
+
+int16_t sensirion_trace_next(sensirion_trace_reader_t* reader,
+                             sensirion_trace_rec_t* rec)
+{
+    uint32_t delta = 0;
+    uint32_t count = 0;
+    uint8_t  addr  = 0;
+
+    if (STATUS_OK != GetVarint(reader, &delta))
+    {
+        return STATUS_FAIL;
+    }
+
+    if (reader->pos >= reader->end)
+    {
+        return STATUS_FAIL;
+    }
+
+    addr = *reader->pos++;
+
+    if ( (STATUS_OK != GetVarint(reader, &count)) || (count > 0xFFFF) )
+    {
+        return STATUS_FAIL;
+    }
+
+    reader->timestamp_ms += delta;
+
+    rec->timestamp_ms = reader->timestamp_ms;
+    rec->address      = addr & 0x7F;
+    rec->status       = (addr & SENSIRION_TRACE_FAIL_FLAG) ? STATUS_FAIL : STATUS_OK;
+    rec->count        = (uint16_t)count;
+    rec->data         = reader->pos;
+
+    if (STATUS_OK == rec->status)
+    {
+        if ( (uint32_t)(reader->end - reader->pos) < count )
+        {
+            return STATUS_FAIL;
+        }
+
+        reader->pos += count;
+    }
+
+    return STATUS_OK;
+}//end sensirion_trace_next
+
+/******************************************************************************
+ *                           L O C A L  F U N C T I O N S
+ *****************************************************************************/
+static uint16_t PutVarint(uint8_t* out, uint32_t value)
+{
+    uint16_t n = 0;
+
+    while (value >= 0x80)
+    {
+        out[n++] = (uint8_t)(value | 0x80);
+        value  >>= 7;
+    }
+
+    out[n++] = (uint8_t)value;
+
+    return n;
+}
+
+static int16_t GetVarint(sensirion_trace_reader_t* reader, uint32_t* value)
+{
+    uint32_t result = 0;
+    uint8_t  shift  = 0;
+
+    while (reader->pos < reader->end)
+    {
+        uint8_t byte = *reader->pos++;
+
+        result |= (uint32_t)(byte & 0x7F) << shift;
+
+        if (0 == (byte & 0x80))
+        {
+            *value = result;
+            return STATUS_OK;
+        }
+
+        shift += 7;
+
+        if (shift > 28)
+        {
+            break;
+        }
+    }
+
+    return STATUS_FAIL;
+}
+
+/******************************************************************************
+ *                             End of file
+ ******************************************************************************/
+/** @}*/
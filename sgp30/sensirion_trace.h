@@ -0,0 +1,130 @@
+//! @addtogroup SensirionTrace
+//! @{
+//
+//****************************************************************************
+//! @file sensirion_trace.h
+//! @brief This contains the prototypes, macros, constants or global variables
+//!        for the I2C response trace recorder and reader
+//! @author Savindra Kumar(savindran1989@gmail.com)
+//! @bug No known bugs.
+//
+//****************************************************************************
+#ifndef SENSIRION_TRACE_H
+#define SENSIRION_TRACE_H
+
+//****************************************************************************
+//                           Includes
+//****************************************************************************
+#include "sensirion_arch_config.h"
+#include "app_config.h"
+
+//****************************************************************************
+//                           Constants and typedefs
+//****************************************************************************
+//Set to 1 to record every sensirion_i2c_read() response
+#ifndef SENSIRION_TRACE_ENABLE
+#define SENSIRION_TRACE_ENABLE     APP_FEATURE_TRACE
+#endif
+
+//Recording buffer, flushed to the sink when full
+#ifndef SENSIRION_TRACE_BUF_LEN
+#define SENSIRION_TRACE_BUF_LEN    APP_TRACE_BUF_LEN
+#endif
+
+//Trace layout:
+//  header : 'S' 'G' 'P' 'T', version, 3 reserved bytes
+//  record : varint timestamp delta in ms from the previous record
+//           address byte, bit 7 set if the read failed
+//           varint byte count
+//           payload, only present if the read succeeded
+#define SENSIRION_TRACE_VERSION    1
+#define SENSIRION_TRACE_HDR_LEN    8
+#define SENSIRION_TRACE_FAIL_FLAG  0x80
+
+typedef void (*sensirion_trace_sink_t)(const uint8_t* data, uint16_t len);
+
+typedef struct
+{
+    const uint8_t* pos;
+    const uint8_t* end;
+    uint32_t timestamp_ms;
+}sensirion_trace_reader_t;
+
+typedef struct
+{
+    uint32_t timestamp_ms;
+    uint8_t  address;
+    int8_t   status;
+    uint16_t count;
+    const uint8_t* data;
+}sensirion_trace_rec_t;
+
+//****************************************************************************
+//                           Global variables
+//****************************************************************************
+
+//****************************************************************************
+//                           Global Functions
+//****************************************************************************
+//
+//! @brief Start recording
+//! @param[in]    sink  Called with every full buffer, may be NULL to record
+//!                     into RAM only until the buffer is full
+//! @param[out]   None
+//! @return       None
+//
+void sensirion_trace_start(sensirion_trace_sink_t sink);
+
+//
+//! @brief Stop recording and flush pending data to the sink
+//! @param[in]    None
+//! @param[out]   None
+//! @return       None
+//
+void sensirion_trace_stop(void);
+
+//
+//! @brief Record one I2C read response
+//! @param[in]    timestamp_ms  Time of the read
+//! @param[in]    address       7-bit I2C address
+//! @param[in]    data          Response bytes
+//! @param[in]    count         Number of bytes requested
+//! @param[in]    status        STATUS_OK or error returned by the read
+//! @param[out]   None
+//! @return       None
+//
+void sensirion_trace_record(uint32_t timestamp_ms, uint8_t address,
+                            const uint8_t* data, uint16_t count, int8_t status);
+
+//
+//! @brief Get the recording buffer, e.g. to dump it with a debugger
+//! @param[in]    None
+//! @param[out]   len  Number of valid bytes
+//! @return       Recording buffer
+//
+const uint8_t* sensirion_trace_buffer(uint16_t* len);
+
+//
+//! @brief Attach a reader to a complete trace
+//! @param[in]    buf  Trace including header
+//! @param[in]    len  Trace length
+//! @param[out]   reader  Reader state
+//! @return       STATUS_OK if the header is valid, STATUS_FAIL otherwise
+//
+int16_t sensirion_trace_reader_init(sensirion_trace_reader_t* reader,
+                                    const uint8_t* buf, uint32_t len);
+
+//
+//! @brief Decode next record, payload points into the trace (no copy)
+//! @param[in]    reader  Reader state
+//! @param[out]   rec     Decoded record
+//! @return       STATUS_OK, STATUS_FAIL at end of trace or on corruption
+//
+int16_t sensirion_trace_next(sensirion_trace_reader_t* reader,
+                             sensirion_trace_rec_t* rec);
+
+#endif // SENSIRION_TRACE_H
+//****************************************************************************
+//                             End of file
+//****************************************************************************
+//! @}
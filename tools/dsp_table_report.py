@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+#****************************************************************************
+# @file dsp_table_report.py
+# @brief Flash taken by the CMSIS-DSP FFT and fast math tables per table
+#        selection.
+#
+# Compiles CommonTables/arm_common_tables.c and arm_const_structs.c once per
+# configuration and prints the size of what each one keeps.  A configuration
+# is a name and the defines it adds to the build, see arm_common_tables.h:
+#
+#   python tools/dsp_table_report.py
+#   python tools/dsp_table_report.py -c "rfft512=-DARM_DSP_CONFIG_TABLES
+#       -DARM_TABLES_RFFT_FAST_F32_512" -v
+#
+# Without -c a few typical configurations are reported.  The "ram" ones keep
+# only the bit reversal table of arm_cfft_init_ram_f32() and
+# arm_rfft_fast_init_ram_f32(), which take 2 * fftLen floats of RAM instead.
+# The real coefficient tables of arm_rfft_init_q15/q31() and of the deprecated
+# arm_rfft_init_f32() and DCT4 live in those files and are not counted.
+#
+# arm-none-eabi-gcc is used when found, else the host gcc with ARM_MATH_HOST:
+# the tables are the same size, the structs hold 64-bit pointers there.
+# @author Savindra Kumar(savindran1989@gmail.com)
+#****************************************************************************
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DSP = os.path.join(ROOT, "drivers", "CMSIS", "DSP")
+SOURCES = ("arm_common_tables.c", "arm_const_structs.c")
+
+CONFIGS = (
+    ("all", ""),
+    ("none", "-DARM_DSP_CONFIG_TABLES"),
+    ("fast math", "-DARM_DSP_CONFIG_TABLES -DARM_ALL_FAST_TABLES"),
+    ("rfft_fast 1024", "-DARM_DSP_CONFIG_TABLES -DARM_TABLES_RFFT_FAST_F32_1024"),
+    ("rfft_fast 4096", "-DARM_DSP_CONFIG_TABLES -DARM_TABLES_RFFT_FAST_F32_4096"),
+    ("rfft_fast 4096 ram", "-DARM_DSP_CONFIG_TABLES -DARM_TABLE_BITREVIDX_FLT_2048"),
+    ("cfft_f32 1024", "-DARM_DSP_CONFIG_TABLES -DARM_TABLES_CFFT_F32_1024"),
+    ("cfft_f32 1024 ram", "-DARM_DSP_CONFIG_TABLES -DARM_TABLE_BITREVIDX_FLT_1024"),
+    ("cfft_q15 256", "-DARM_DSP_CONFIG_TABLES -DARM_TABLES_CFFT_Q15_256"),
+    ("rfft_q31 2048", "-DARM_DSP_CONFIG_TABLES -DARM_TABLES_RFFT_Q31_2048"),
+)
+
+
+def toolchain(cc):
+    """Return (compiler, nm, target flags)."""
+    if cc is None:
+        cc = "arm-none-eabi-gcc" if shutil.which("arm-none-eabi-gcc") else "gcc"
+    if "arm-none-eabi" in cc:
+        flags = ["-mcpu=cortex-m4", "-mthumb", "-mfloat-abi=hard",
+                 "-mfpu=fpv4-sp-d16", "-DARM_MATH_CM4", "-D__FPU_PRESENT=1",
+                 "-I" + os.path.join(ROOT, "drivers", "CMSIS", "Include")]
+        nm = cc.replace("gcc", "nm")
+    else:
+        flags = ["-DARM_MATH_HOST"]
+        nm = "nm"
+    return cc, nm, flags
+
+
+def measure(cc, nm, flags, defines, tmp):
+    """Return {symbol: (source, bytes)} of the objects built with defines."""
+    symbols = {}
+    for src in SOURCES:
+        obj = os.path.join(tmp, src.replace(".c", ".o"))
+        cmd = [cc, "-Os", "-c", "-fdata-sections", "-I" + os.path.join(DSP, "Include")]
+        cmd += flags + defines.split()
+        cmd += [os.path.join(DSP, "Source", "CommonTables", src), "-o", obj]
+        result = subprocess.run(cmd, capture_output=True, text=True)
+        if result.returncode != 0:
+            sys.exit("%s\n%s" % (" ".join(cmd), result.stderr))
+        out = subprocess.run([nm, "-S", obj], capture_output=True, text=True,
+                             check=True).stdout
+        for line in out.splitlines():
+            fields = line.split()
+            # address size type name, defined data symbols only
+            if len(fields) == 4 and fields[2] in "rRdD":
+                symbols[fields[3]] = (src, int(fields[1], 16))
+    return symbols
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-c", "--config", action="append", metavar="NAME=DEFINES",
+                        help="configuration to report, may be repeated")
+    parser.add_argument("--cc", help="compiler, default arm-none-eabi-gcc or gcc")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="list the tables of each configuration")
+    args = parser.parse_args()
+
+    configs = CONFIGS
+    if args.config:
+        configs = [tuple(c.split("=", 1)) if "=" in c else (c, c) for c in args.config]
+
+    cc, nm, flags = toolchain(args.cc)
+    print("compiler: %s" % cc)
+    print("%-20s %8s %10s %10s %10s" % ("config", "symbols", "tables", "structs", "flash"))
+    with tempfile.TemporaryDirectory() as tmp:
+        for name, defines in configs:
+            symbols = measure(cc, nm, flags, defines, tmp)
+            tables = sum(s for f, s in symbols.values() if f == SOURCES[0])
+            structs = sum(s for f, s in symbols.values() if f == SOURCES[1])
+            print("%-20s %8d %10d %10d %10d" % (name, len(symbols), tables,
+                                                 structs, tables + structs))
+            if args.verbose:
+                for sym in sorted(symbols, key=lambda k: -symbols[k][1]):
+                    print("    %-40s %8d" % (sym, symbols[sym][1]))
+
+
+if __name__ == "__main__":
+    main()
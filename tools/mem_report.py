@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#****************************************************************************
+# @file mem_report.py
+# @brief Per module RAM/flash usage report from the IAR linker map file.
+#
+# Reads the "MODULE SUMMARY" section of the map (enabled in the project
+# linker options), writes one CSV row per object file and optionally compares
+# against the CSV of an earlier build:
+#
+#   python tools/mem_report.py Debug/List/stm32-sgp30voc-integrataion.map
+#   python tools/mem_report.py new.map -o new.csv --compare old.csv
+#
+# flash = ro code + ro data, ram = rw data (.bss and .data).
+# @author Savindra Kumar(savindran1989@gmail.com)
+#****************************************************************************
+import argparse
+import csv
+import re
+import sys
+
+COLUMNS = ("ro code", "ro data", "rw data")
+NUMBER = re.compile(r"\d{1,3}(?:[ ']\d{3})*")
+
+
+def _number(text):
+    text = text.replace(" ", "").replace("'", "").replace(",", "")
+    return int(text) if text.isdigit() else 0
+
+
+def parse_map(path):
+    """Return {module: (ro_code, ro_data, rw_data)} summed over libraries."""
+    with open(path, errors="replace") as f:
+        lines = f.read().splitlines()
+
+    try:
+        start = next(i for i, l in enumerate(lines) if "MODULE SUMMARY" in l)
+    except StopIteration:
+        sys.exit("%s: no MODULE SUMMARY section" % path)
+
+    ends = None
+    modules = {}
+    for line in lines[start + 1:]:
+        if line.startswith("***") and ends is not None:
+            break
+        if ends is None:
+            # Header line, numbers are right aligned to the column titles
+            if all(c in line for c in COLUMNS):
+                ends = [line.index(c) + len(c) for c in COLUMNS]
+            continue
+        name = line.strip().split("  ")[0] if line.strip() else ""
+        if (not line.startswith("    ") or not name or name.startswith("-")
+                or name.endswith(":") or name.startswith("Total")
+                or name.startswith("Grand Total")):
+            continue
+        # Numbers use space thousands separators ("16 384"), assign each one
+        # to the column whose right edge is nearest to where it ends
+        values = [0, 0, 0]
+        rest = line[len(line) - len(line.lstrip()) + len(name):]
+        offset = len(line) - len(rest)
+        for m in NUMBER.finditer(rest):
+            col = min(range(len(ends)),
+                      key=lambda i: abs(ends[i] - (offset + m.end())))
+            values[col] += _number(m.group())
+        old = modules.get(name, (0, 0, 0))
+        modules[name] = tuple(a + b for a, b in zip(old, values))
+    return modules
+
+
+def write_csv(modules, out):
+    writer = csv.writer(out, lineterminator="\n")
+    writer.writerow(["module", "flash", "ram", "ro_code", "ro_data", "rw_data"])
+    for name in sorted(modules):
+        code, data, rw = modules[name]
+        writer.writerow([name, code + data, rw, code, data, rw])
+
+
+def read_csv(path):
+    with open(path) as f:
+        return {r["module"]: (int(r["flash"]), int(r["ram"]))
+                for r in csv.DictReader(f)}
+
+
+def compare(modules, old):
+    new = {k: (v[0] + v[1], v[2]) for k, v in modules.items()}
+    print("%-32s %10s %8s %10s %8s" % ("module", "flash", "delta", "ram", "delta"))
+    total = [0, 0, 0, 0]
+    for name in sorted(set(new) | set(old)):
+        flash, ram = new.get(name, (0, 0))
+        oflash, oram = old.get(name, (0, 0))
+        total = [total[0] + flash, total[1] + flash - oflash,
+                 total[2] + ram, total[3] + ram - oram]
+        if flash == oflash and ram == oram:
+            continue
+        print("%-32s %10d %+8d %10d %+8d" % (name, flash, flash - oflash,
+                                              ram, ram - oram))
+    print("%-32s %10d %+8d %10d %+8d" % ("Total", *total))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("map", help="IAR linker map file")
+    parser.add_argument("-o", "--output", help="CSV file, default stdout")
+    parser.add_argument("--compare", metavar="OLD_CSV",
+                        help="print per module deltas against an older report")
+    args = parser.parse_args()
+
+    modules = parse_map(args.map)
+    if args.output:
+        with open(args.output, "w") as f:
+            write_csv(modules, f)
+    elif not args.compare:
+        write_csv(modules, sys.stdout)
+    if args.compare:
+        compare(modules, read_csv(args.compare))
+
+
+if __name__ == "__main__":
+    main()